@@ -3,6 +3,7 @@
 #include "CoreEngine.h"
 #include "Assets/Assets/TextureAsset.h"
 #include "Assets/TypesForAssets/Texture.h"
+#include "Assets/AssetsManager.h"
 
 FTextureAsset::FTextureAsset(const std::string& InAssetName, const std::string& InAssetPath)
 	: FAssetBase(InAssetName, InAssetPath)
@@ -26,11 +27,8 @@ EAssetType FTextureAsset::GetAssetType() const
 
 FVector2D<float> FTextureAsset::GetSize() const
 {
-	FVector2D<float> Size;
-	
-	SDL_GetTextureSize(Texture->GetSDLTexture(), &Size.X, &Size.Y);
-
-	return Size;
+	// SDL texture may be atlas page, so size is taken from texture
+	return Texture->GetSize();
 }
 
 FTexture* FTextureAsset::GetTexture() const
@@ -42,7 +40,7 @@ void FTextureAsset::PrepareTexture(SDL_Renderer* InRenderer)
 {
 	if (!bIsTexturePrepared)
 	{
-		Texture = new FTexture(AssetPath, InRenderer);
+		Texture = new FTexture(AssetPath, InRenderer, FGlobalDefines::GEngine->GetAssetsManager()->GetTextureAtlas(InRenderer));
 
 		bIsTexturePrepared = true;
 	}
@@ -4,9 +4,11 @@
 #include "Assets/AssetsManager.h"
 #include "Assets/Assets/AssetBase.h"
 #include "Assets/IniReader/IniManager.h"
+#include "Assets/TypesForAssets/TextureAtlas.h"
 
 FAssetsManager::FAssetsManager()
-	: IniManager(new FIniManager(this))
+	: bIsTextureAtlasEnabled(true)
+	, IniManager(new FIniManager(this))
 	, AssetDirName("Assets")
 	, ConfigDirName("Config")
 	, MapsDirName("Maps")
@@ -24,6 +26,24 @@ FAssetsManager::~FAssetsManager()
 	AssetsByType.Clear();
 }
 
+std::shared_ptr<FTextureAtlas> FAssetsManager::GetTextureAtlas(SDL_Renderer* InRenderer)
+{
+	if (!bIsTextureAtlasEnabled || InRenderer == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (TextureAtlases.HasKey(InRenderer))
+	{
+		return TextureAtlases[InRenderer];
+	}
+
+	std::shared_ptr<FTextureAtlas> NewTextureAtlas = std::make_shared<FTextureAtlas>(InRenderer);
+	TextureAtlases.Emplace(InRenderer, NewTextureAtlas);
+
+	return NewTextureAtlas;
+}
+
 FIniManager* FAssetsManager::GetIniManager() const
 {
 	return IniManager;
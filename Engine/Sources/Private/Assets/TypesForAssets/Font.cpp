@@ -4,6 +4,7 @@
 #include "Assets/TypesForAssets/Font.h"
 
 #include "Assets/Assets/FontAsset.h"
+#include "Assets/TypesForAssets/GlyphCache.h"
 
 FFont::FFont(FFontAsset* InFontAsset, const int InFontSize)
 	: Font(nullptr)
@@ -19,6 +20,11 @@ FFont::FFont(FFontAsset* InFontAsset, const int InFontSize)
 
 FFont::~FFont()
 {
+	for (const std::pair<SDL_Renderer* const, FGlyphCache*>& GlyphCachePair : GlyphCaches)
+	{
+		delete GlyphCachePair.second;
+	}
+
 	FFont::DeInitializeFont();
 
 #if ENGINE_MEMORY_ALLOCATION_DEBUG_FONTS
@@ -36,6 +42,21 @@ int FFont::GetFontSize() const
 	return FontSize;
 }
 
+FGlyphCache* FFont::GetGlyphCache(SDL_Renderer* InRenderer)
+{
+	if (Font == nullptr || InRenderer == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (!GlyphCaches.ContainsKey(InRenderer))
+	{
+		GlyphCaches.Emplace(InRenderer, new FGlyphCache(Font, InRenderer));
+	}
+
+	return GlyphCaches.At(InRenderer);
+}
+
 void FFont::Reinitialize()
 {
 	Font = nullptr;
@@ -0,0 +1,213 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "Assets/TypesForAssets/GlyphCache.h"
+
+#include "Renderer/SpriteBatch.h"
+
+FGlyphCache::FGlyphCache(TTF_Font* InFont, SDL_Renderer* InRenderer)
+	: Font(InFont)
+	, TextureAtlas(InRenderer, GlyphPageSize)
+	, LineHeight(0)
+	, NumberOfRasterizedGlyphs(0)
+{
+#if defined(ENGINE_USING_VIDEO) && ENGINE_USING_VIDEO
+	if (Font != nullptr)
+	{
+		LineHeight = TTF_GetFontHeight(Font);
+	}
+#endif
+}
+
+template<typename TFunction>
+bool FGlyphCache::ForEachGlyph(const std::string& InText, TFunction InFunction, int32& OutWidth)
+{
+	bool bAreAllGlyphsCached = true;
+
+	const char* TextPointer = InText.c_str();
+	size_t TextLength = InText.length();
+
+	int32 PenX = 0;
+	int32 MaxX = 0;
+	Uint32 PreviousCodepoint = 0;
+
+	while (TextLength > 0)
+	{
+		const Uint32 Codepoint = SDL_StepUTF8(&TextPointer, &TextLength);
+		if (Codepoint == 0)
+		{
+			break;
+		}
+
+		if (PreviousCodepoint != 0)
+		{
+			PenX += GetKerning(PreviousCodepoint, Codepoint);
+		}
+
+		const FGlyph& Glyph = GetGlyph(Codepoint);
+		if (Glyph.bHasImage)
+		{
+			MaxX = FMath::Max(MaxX, PenX + Glyph.OffsetX + static_cast<int32>(Glyph.Region.Rect.w));
+		}
+		else if (Glyph.bIsCacheFailed)
+		{
+			bAreAllGlyphsCached = false;
+		}
+
+		InFunction(Glyph, PenX);
+
+		PenX += Glyph.Advance;
+		PreviousCodepoint = Codepoint;
+	}
+
+	OutWidth = FMath::Max(PenX, MaxX);
+
+	return bAreAllGlyphsCached;
+}
+
+const FGlyph& FGlyphCache::GetGlyph(const Uint32 InCodepoint)
+{
+	auto GlyphIterator = Glyphs.Map.find(InCodepoint);
+	if (GlyphIterator != Glyphs.Map.end())
+	{
+		return GlyphIterator->second;
+	}
+
+	FGlyph& Glyph = Glyphs.Map[InCodepoint];
+
+#if defined(ENGINE_USING_VIDEO) && ENGINE_USING_VIDEO
+	if (Font != nullptr)
+	{
+		int32 MinX = 0;
+		int32 MaxX = 0;
+		int32 MinY = 0;
+		int32 MaxY = 0;
+
+		if (TTF_GetGlyphMetrics(Font, InCodepoint, &MinX, &MaxX, &MinY, &MaxY, &Glyph.Advance))
+		{
+			// Same as layout of whole string, image starts at pen unless glyph reaches left of it
+			Glyph.OffsetX = FMath::Min(MinX, 0);
+		}
+
+		SDL_Surface* GlyphSurface = TTF_RenderGlyph_Blended(Font, InCodepoint, FColorRGBA::ColorWhite());
+		if (GlyphSurface != nullptr)
+		{
+			Glyph.bHasImage = TextureAtlas.AddSurface(GlyphSurface, Glyph.Region);
+			Glyph.bIsCacheFailed = !Glyph.bHasImage;
+
+			if (Glyph.bIsCacheFailed)
+			{
+				LOG_WARN("Glyph " << InCodepoint << " could not be cached, font size may be too big for glyph atlas.");
+			}
+
+			SDL_DestroySurface(GlyphSurface);
+
+			NumberOfRasterizedGlyphs++;
+		}
+	}
+#endif
+
+	return Glyph;
+}
+
+int32 FGlyphCache::GetKerning(const Uint32 InPreviousCodepoint, const Uint32 InCodepoint)
+{
+	const uint64 Key = (static_cast<uint64>(InPreviousCodepoint) << 32) | InCodepoint;
+
+	auto KerningIterator = Kernings.Map.find(Key);
+	if (KerningIterator != Kernings.Map.end())
+	{
+		return KerningIterator->second;
+	}
+
+	int32 Kerning = 0;
+
+#if defined(ENGINE_USING_VIDEO) && ENGINE_USING_VIDEO
+	if (Font != nullptr && !TTF_GetGlyphKerning(Font, InPreviousCodepoint, InCodepoint, &Kerning))
+	{
+		Kerning = 0;
+	}
+#endif
+
+	Kernings.Map.emplace(Key, Kerning);
+
+	return Kerning;
+}
+
+bool FGlyphCache::MeasureText(const std::string& InText, FVector2D<int32>& OutSize)
+{
+	const bool bAreAllGlyphsCached = ForEachGlyph(InText, [](const FGlyph&, const int32)
+	{
+	}, OutSize.X);
+
+	OutSize.Y = LineHeight;
+
+	return bAreAllGlyphsCached;
+}
+
+bool FGlyphCache::BuildTextGeometry(const std::string& InText, const FColorRGBA& InColor, CArray<FSpriteBatchGeometry>& OutGeometries, FVector2D<int32>& OutSize)
+{
+	OutGeometries.Clear();
+
+	const SDL_FColor Color = {
+		static_cast<float>(InColor.R) / 255.f,
+		static_cast<float>(InColor.G) / 255.f,
+		static_cast<float>(InColor.B) / 255.f,
+		static_cast<float>(InColor.A) / 255.f
+	};
+
+	const float PageSize = static_cast<float>(GlyphPageSize);
+
+	const bool bAreAllGlyphsCached = ForEachGlyph(InText, [&](const FGlyph& Glyph, const int32 PenX)
+	{
+		if (!Glyph.bHasImage)
+		{
+			return;
+		}
+
+		// Usually all glyphs are on first page
+		FSpriteBatchGeometry* Geometry = nullptr;
+		for (FSpriteBatchGeometry& GeometrySearch : OutGeometries)
+		{
+			if (GeometrySearch.Texture == Glyph.Region.PageTexture)
+			{
+				Geometry = &GeometrySearch;
+
+				break;
+			}
+		}
+
+		if (Geometry == nullptr)
+		{
+			OutGeometries.Push(FSpriteBatchGeometry(Glyph.Region.PageTexture, 0));
+			Geometry = &OutGeometries[OutGeometries.GetLastIndex()];
+		}
+
+		const SDL_FRect& Rect = Glyph.Region.Rect;
+
+		const float Left = static_cast<float>(PenX + Glyph.OffsetX);
+		const float Right = Left + Rect.w;
+		const float Bottom = Rect.h;
+
+		const float MinU = Rect.x / PageSize;
+		const float MinV = Rect.y / PageSize;
+		const float MaxU = (Rect.x + Rect.w) / PageSize;
+		const float MaxV = (Rect.y + Rect.h) / PageSize;
+
+		const int FirstVertexIndex = static_cast<int>(Geometry->Vertices.size());
+
+		Geometry->Vertices.push_back({ { Left, 0.f }, Color, { MinU, MinV } });
+		Geometry->Vertices.push_back({ { Right, 0.f }, Color, { MaxU, MinV } });
+		Geometry->Vertices.push_back({ { Right, Bottom }, Color, { MaxU, MaxV } });
+		Geometry->Vertices.push_back({ { Left, Bottom }, Color, { MinU, MaxV } });
+
+		Geometry->Indices.insert(Geometry->Indices.end(), {
+			FirstVertexIndex, FirstVertexIndex + 1, FirstVertexIndex + 2,
+			FirstVertexIndex, FirstVertexIndex + 2, FirstVertexIndex + 3
+		});
+	}, OutSize.X);
+
+	OutSize.Y = LineHeight;
+
+	return bAreAllGlyphsCached;
+}
@@ -3,7 +3,12 @@
 #include "CoreEngine.h"
 #include "Assets/TypesForAssets/Texture.h"
 
-FTexture::FTexture(const std::string& InTexturePath, SDL_Renderer* Renderer)
+#include "Renderer/Renderer.h"
+
+FTexture::FTexture(const std::string& InTexturePath, SDL_Renderer* Renderer, const std::shared_ptr<FTextureAtlas>& InTextureAtlas)
+	: SDLTexture(nullptr)
+	, SourceRect({ 0.f, 0.f, 0.f, 0.f })
+	, SourceUV({ 0.f, 0.f, 1.f, 1.f })
 {
 #if defined(ENGINE_USING_VIDEO) && ENGINE_USING_VIDEO
 	// Attempt load
@@ -12,8 +17,30 @@ FTexture::FTexture(const std::string& InTexturePath, SDL_Renderer* Renderer)
 	// Check if succesfuly loaded
 	if (TemporarySurface != nullptr)
 	{
-		// To memory
-		SDLTexture = SDL_CreateTextureFromSurface(Renderer, TemporarySurface);
+		if (InTextureAtlas != nullptr && InTextureAtlas->AddSurface(TemporarySurface, AtlasRegion))
+		{
+			TextureAtlas = InTextureAtlas;
+			SDLTexture = AtlasRegion.PageTexture;
+			SourceRect = AtlasRegion.Rect;
+
+			float PageWidth = 0.f;
+			float PageHeight = 0.f;
+			SDL_GetTextureSize(SDLTexture, &PageWidth, &PageHeight);
+
+			SourceUV = { SourceRect.x / PageWidth, SourceRect.y / PageHeight, SourceRect.w / PageWidth, SourceRect.h / PageHeight };
+		}
+		else
+		{
+			{
+				// Render thread may be using renderer
+				FScopedRenderResourcesLock RenderResourcesLock;
+
+				// To memory
+				SDLTexture = SDL_CreateTextureFromSurface(Renderer, TemporarySurface);
+			}
+
+			SourceRect = { 0.f, 0.f, static_cast<float>(TemporarySurface->w), static_cast<float>(TemporarySurface->h) };
+		}
 
 		SDL_DestroySurface(TemporarySurface);
 	}
@@ -27,9 +54,15 @@ FTexture::FTexture(const std::string& InTexturePath, SDL_Renderer* Renderer)
 FTexture::~FTexture()
 {
 #if defined(ENGINE_USING_VIDEO) && ENGINE_USING_VIDEO
-	if (SDLTexture != nullptr)
+	if (TextureAtlas != nullptr)
 	{
-		SDL_DestroyTexture(SDLTexture);
+		// Page is owned by atlas
+		TextureAtlas->ReleaseRegion(AtlasRegion);
+	}
+	else if (SDLTexture != nullptr)
+	{
+		// Texture may be still used by frame recorded for render thread
+		FRenderer::DestroyTextureDeferred(SDLTexture);
 	}
 	else
 	{
@@ -38,10 +71,16 @@ FTexture::~FTexture()
 #endif
 }
 
-void FTexture::Draw(SDL_Renderer* Renderer, const SDL_FRect SourceRect, const SDL_FRect DestinationRect) const
+void FTexture::Draw(SDL_Renderer* Renderer, SDL_FRect InSourceRect, const SDL_FRect DestinationRect) const
 {
 #if defined(ENGINE_USING_VIDEO) && ENGINE_USING_VIDEO
-	SDL_RenderTexture(Renderer, SDLTexture, &SourceRect, &DestinationRect);
+	InSourceRect.x += SourceRect.x;
+	InSourceRect.y += SourceRect.y;
+
+	FRenderer::ExecuteOrEnqueue([Renderer, Texture = SDLTexture, InSourceRect, DestinationRect]()
+	{
+		SDL_RenderTexture(Renderer, Texture, &InSourceRect, &DestinationRect);
+	});
 #endif
 }
 
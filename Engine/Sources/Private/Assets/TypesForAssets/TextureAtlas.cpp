@@ -0,0 +1,180 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "Assets/TypesForAssets/TextureAtlas.h"
+
+#include "Renderer/Renderer.h"
+
+FTextureAtlas::FTextureAtlas(SDL_Renderer* InRenderer, const int32 InPageSize)
+	: Renderer(InRenderer)
+	, PageSize(InPageSize)
+{
+}
+
+FTextureAtlas::~FTextureAtlas()
+{
+	for (const FAtlasPage& Page : Pages)
+	{
+		// Page may be still used by frame recorded for render thread
+		FRenderer::DestroyTextureDeferred(Page.Texture);
+	}
+}
+
+bool FTextureAtlas::AddSurface(SDL_Surface* InSurface, FTextureAtlasRegion& OutRegion)
+{
+	if (InSurface == nullptr || InSurface->w > MaxTextureSize || InSurface->h > MaxTextureSize)
+	{
+		return false;
+	}
+
+	const FVector2D<int32> PaddedSize(InSurface->w + (Padding * 2), InSurface->h + (Padding * 2));
+
+	int32 PageIndex = INDEX_NONE;
+	FVector2D<int32> Location;
+
+	for (int32 i = 0; i < Pages.Size(); i++)
+	{
+		if (Pages[i].Packer.Insert(PaddedSize, Location))
+		{
+			PageIndex = i;
+
+			break;
+		}
+	}
+
+	if (PageIndex == INDEX_NONE)
+	{
+		PageIndex = AddPage();
+
+		if (PageIndex == INDEX_NONE || !Pages[PageIndex].Packer.Insert(PaddedSize, Location))
+		{
+			return false;
+		}
+	}
+
+	SDL_Surface* PaddedSurface = CreatePaddedSurface(InSurface);
+	if (PaddedSurface == nullptr)
+	{
+		LOG_WARN("Can not convert surface for texture atlas. (" << SDL_GetError() << ")");
+
+		return false;
+	}
+
+	FAtlasPage& Page = Pages[PageIndex];
+
+	const SDL_Rect UpdateRect = { Location.X, Location.Y, PaddedSize.X, PaddedSize.Y };
+
+	{
+		// Render thread may be using renderer
+		FScopedRenderResourcesLock RenderResourcesLock;
+
+		SDL_UpdateTexture(Page.Texture, &UpdateRect, PaddedSurface->pixels, PaddedSurface->pitch);
+	}
+
+	SDL_DestroySurface(PaddedSurface);
+
+	Page.NumberOfRegions++;
+
+	OutRegion.PageTexture = Page.Texture;
+	OutRegion.PageIndex = PageIndex;
+	OutRegion.Rect = {
+		static_cast<float>(Location.X + Padding),
+		static_cast<float>(Location.Y + Padding),
+		static_cast<float>(InSurface->w),
+		static_cast<float>(InSurface->h)
+	};
+
+	return true;
+}
+
+void FTextureAtlas::ReleaseRegion(const FTextureAtlasRegion& InRegion)
+{
+	if (Pages.IsValidIndex(InRegion.PageIndex))
+	{
+		FAtlasPage& Page = Pages[InRegion.PageIndex];
+
+		Page.NumberOfRegions--;
+
+		// Texture of page is kept for next textures
+		if (Page.NumberOfRegions <= 0)
+		{
+			Page.NumberOfRegions = 0;
+			Page.Packer.Reset();
+		}
+	}
+}
+
+int32 FTextureAtlas::AddPage()
+{
+	SDL_Texture* PageTexture;
+
+	{
+		// Render thread may be using renderer
+		FScopedRenderResourcesLock RenderResourcesLock;
+
+		PageTexture = SDL_CreateTexture(Renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, PageSize, PageSize);
+		if (PageTexture != nullptr)
+		{
+			SDL_SetTextureBlendMode(PageTexture, SDL_BLENDMODE_BLEND);
+		}
+	}
+
+	if (PageTexture == nullptr)
+	{
+		LOG_WARN("Can not create texture atlas page. (" << SDL_GetError() << ")");
+
+		return INDEX_NONE;
+	}
+
+	Pages.Push({ PageTexture, FTextureAtlasPacker(FVector2D<int32>(PageSize, PageSize)), 0 });
+
+	LOG_INFO("Texture atlas page " << Pages.GetLastIndex() << " created.");
+
+	return Pages.GetLastIndex();
+}
+
+SDL_Surface* FTextureAtlas::CreatePaddedSurface(SDL_Surface* InSurface)
+{
+	SDL_Surface* ConvertedSurface = SDL_ConvertSurface(InSurface, SDL_PIXELFORMAT_RGBA32);
+	if (ConvertedSurface == nullptr)
+	{
+		return nullptr;
+	}
+
+	SDL_Surface* PaddedSurface = SDL_CreateSurface(InSurface->w + (Padding * 2), InSurface->h + (Padding * 2), SDL_PIXELFORMAT_RGBA32);
+	if (PaddedSurface != nullptr)
+	{
+		// Pixels are copied as they are, alpha included
+		SDL_SetSurfaceBlendMode(ConvertedSurface, SDL_BLENDMODE_NONE);
+
+		const int32 Width = InSurface->w;
+		const int32 Height = InSurface->h;
+
+		SDL_Rect Destination = { Padding, Padding, Width, Height };
+		SDL_BlitSurface(ConvertedSurface, nullptr, PaddedSurface, &Destination);
+
+		for (int32 i = 0; i < Padding; i++)
+		{
+			const SDL_Rect TopRow = { 0, 0, Width, 1 };
+			const SDL_Rect BottomRow = { 0, Height - 1, Width, 1 };
+			const SDL_Rect LeftColumn = { 0, 0, 1, Height };
+			const SDL_Rect RightColumn = { Width - 1, 0, 1, Height };
+
+			Destination = { Padding, i, Width, 1 };
+			SDL_BlitSurface(ConvertedSurface, &TopRow, PaddedSurface, &Destination);
+
+			Destination = { Padding, Padding + Height + i, Width, 1 };
+			SDL_BlitSurface(ConvertedSurface, &BottomRow, PaddedSurface, &Destination);
+
+			Destination = { i, Padding, 1, Height };
+			SDL_BlitSurface(ConvertedSurface, &LeftColumn, PaddedSurface, &Destination);
+
+			Destination = { Padding + Width + i, Padding, 1, Height };
+			SDL_BlitSurface(ConvertedSurface, &RightColumn, PaddedSurface, &Destination);
+		}
+	}
+
+	SDL_DestroySurface(ConvertedSurface);
+
+	return PaddedSurface;
+}
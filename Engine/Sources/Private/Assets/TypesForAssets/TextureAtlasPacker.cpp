@@ -0,0 +1,143 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "Assets/TypesForAssets/TextureAtlasPacker.h"
+
+FTextureAtlasPacker::FTextureAtlasPacker(const FVector2D<int32>& InPageSize)
+	: PageSize(InPageSize)
+	, UsedArea(0)
+{
+	Reset();
+}
+
+bool FTextureAtlasPacker::Insert(const FVector2D<int32>& InSize, FVector2D<int32>& OutLocation)
+{
+	if (InSize.X <= 0 || InSize.Y <= 0 || InSize.X > PageSize.X || InSize.Y > PageSize.Y)
+	{
+		return false;
+	}
+
+	int32 BestSegmentIndex = INDEX_NONE;
+	int32 BestBottom = std::numeric_limits<int32>::max();
+	int32 BestWidth = std::numeric_limits<int32>::max();
+	int32 BestY = 0;
+
+	for (int32 SegmentIndex = 0; SegmentIndex < Skyline.Size(); SegmentIndex++)
+	{
+		const int32 Y = FindY(SegmentIndex, InSize);
+		if (Y != INDEX_NONE)
+		{
+			// Lowest bottom first, then narrower segment, so wide gaps are kept for wide rectangles
+			const int32 Bottom = Y + InSize.Y;
+			const int32 Width = Skyline[SegmentIndex].Width;
+
+			if (Bottom < BestBottom || (Bottom == BestBottom && Width < BestWidth))
+			{
+				BestSegmentIndex = SegmentIndex;
+				BestBottom = Bottom;
+				BestWidth = Width;
+				BestY = Y;
+			}
+		}
+	}
+
+	if (BestSegmentIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutLocation = FVector2D<int32>(Skyline[BestSegmentIndex].X, BestY);
+
+	AddSegment(BestSegmentIndex, OutLocation, InSize);
+
+	UsedArea += static_cast<int64>(InSize.X) * InSize.Y;
+
+	return true;
+}
+
+void FTextureAtlasPacker::Reset()
+{
+	Skyline.Clear();
+	Skyline.Push({ 0, 0, PageSize.X });
+
+	UsedArea = 0;
+}
+
+float FTextureAtlasPacker::GetOccupancy() const
+{
+	const int64 PageArea = static_cast<int64>(PageSize.X) * PageSize.Y;
+
+	return (PageArea > 0) ? static_cast<float>(static_cast<double>(UsedArea) / static_cast<double>(PageArea)) : 0.f;
+}
+
+int32 FTextureAtlasPacker::FindY(const int32 SegmentIndex, const FVector2D<int32>& InSize) const
+{
+	const int32 X = Skyline[SegmentIndex].X;
+	if (X + InSize.X > PageSize.X)
+	{
+		return INDEX_NONE;
+	}
+
+	// Rectangle rests on highest segment below it
+	int32 Y = 0;
+	int32 WidthLeft = InSize.X;
+
+	for (int32 i = SegmentIndex; WidthLeft > 0; i++)
+	{
+		Y = FMath::Max(Y, Skyline[i].Y);
+
+		if (Y + InSize.Y > PageSize.Y)
+		{
+			return INDEX_NONE;
+		}
+
+		WidthLeft -= Skyline[i].Width;
+	}
+
+	return Y;
+}
+
+void FTextureAtlasPacker::AddSegment(const int32 SegmentIndex, const FVector2D<int32>& InLocation, const FVector2D<int32>& InSize)
+{
+	Skyline.Vector.insert(Skyline.Vector.begin() + SegmentIndex, { InLocation.X, InLocation.Y + InSize.Y, InSize.X });
+
+	// Segments covered by new one are shrunk or removed
+	const int32 Right = InLocation.X + InSize.X;
+
+	for (int32 i = SegmentIndex + 1; i < Skyline.Size(); )
+	{
+		FSkylineSegment& Segment = Skyline[i];
+
+		if (Segment.X >= Right)
+		{
+			break;
+		}
+
+		const int32 SegmentRight = Segment.X + Segment.Width;
+		if (SegmentRight <= Right)
+		{
+			Skyline.Vector.erase(Skyline.Vector.begin() + i);
+		}
+		else
+		{
+			Segment.Width = SegmentRight - Right;
+			Segment.X = Right;
+
+			break;
+		}
+	}
+
+	// Neighbours on same height become one segment
+	for (int32 i = 0; i + 1 < Skyline.Size(); )
+	{
+		if (Skyline[i].Y == Skyline[i + 1].Y)
+		{
+			Skyline[i].Width += Skyline[i + 1].Width;
+			Skyline.Vector.erase(Skyline.Vector.begin() + i + 1);
+		}
+		else
+		{
+			i++;
+		}
+	}
+}
@@ -15,8 +15,13 @@ void FAIActionMove::Initialize()
 {
 	FAIActionBase::Initialize();
 
-	// Get entity. Should always be valid.
-	EEntity* Entity = GetTree()->GetOwnerEntity();
+	EEntity* Entity = GetOwnerEntity();
+	if (Entity == nullptr)
+	{
+		LOG_WARN("FAIActionMove initialized for destroyed entity.");
+
+		return;
+	}
 
 	// Move component does not have to be present.
 	CurrentMoveComponent = Entity->GetComponentByClass<UMoveComponent>();
@@ -28,7 +33,7 @@ void FAIActionMove::Initialize()
 
 bool FAIActionMove::ShouldFinishAction() const
 {
-	return (CurrentMoveComponent != nullptr && !CurrentMoveComponent->IsMoving());
+	return (CurrentMoveComponent != nullptr && !CurrentMoveComponent->IsMoving() && !CurrentMoveComponent->IsWaitingForPath());
 }
 
 void FAIActionMove::EndAction()
@@ -36,7 +41,7 @@ void FAIActionMove::EndAction()
 	FAIActionBase::EndAction();
 
 	// Disable if moving due to action running
-	if (CurrentMoveComponent != nullptr && (IsActionRunning() && CurrentMoveComponent->IsMoving()))
+	if (CurrentMoveComponent != nullptr && (IsActionRunning() && (CurrentMoveComponent->IsMoving() || CurrentMoveComponent->IsWaitingForPath())))
 	{
 		CurrentMoveComponent->AbortMovement();
 		CurrentMoveComponent = nullptr;
@@ -57,7 +62,7 @@ void FAIActionMove::SetTargetLocation(const FVector2D<int32>& InLocation)
 {
 	if (CurrentMoveComponent != nullptr)
 	{
-		CurrentMoveComponent->SetTargetMoveLocation(InLocation);
+		CurrentMoveComponent->MoveToLocation(InLocation);
 	}
 }
 
@@ -6,7 +6,7 @@
 #include "ECS/AI/AIActionBase.h"
 
 FAITree::FAITree(EEntity* InOwnerEntity)
-	: OwnerEntity(InOwnerEntity)
+	: OwnerEntityHandle(InOwnerEntity->GetEntityHandle())
 	, bIsTreeEnabled(true)
 {
 }
@@ -59,7 +59,7 @@ void FAITree::Tick()
 
 EEntity* FAITree::GetOwnerEntity() const
 {
-	return OwnerEntity;
+	return OwnerEntityHandle.Get();
 }
 
 void FAITree::SetIsTreeEnabled(const bool bInEnable)
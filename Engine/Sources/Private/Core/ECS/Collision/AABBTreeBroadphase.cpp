@@ -0,0 +1,434 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Collision/AABBTreeBroadphase.h"
+
+FAABBTreeBroadphase::FAABBTreeBroadphase(const float InFatMargin)
+	: RootIndex(INDEX_NONE)
+	, FreeListIndex(INDEX_NONE)
+	, NumberOfProxies(0)
+	, NumberOfReinserts(0)
+	, FatMargin(InFatMargin)
+{
+}
+
+FBroadphaseProxyId FAABBTreeBroadphase::CreateProxy(const FCollisionAABB& InBounds, FCollisionBase* InCollision, const FCollisionFilter& InFilter)
+{
+	const int32 LeafIndex = AllocateNode();
+
+	FAABBTreeNode& Leaf = Nodes[LeafIndex];
+	Leaf.Bounds = InBounds.Expanded(FatMargin);
+	Leaf.ProxyBounds = InBounds;
+	Leaf.Collision = InCollision;
+	Leaf.Filter = InFilter;
+	Leaf.Height = 0;
+
+	InsertLeaf(LeafIndex);
+
+	NumberOfProxies++;
+
+	MarkMoved(LeafIndex);
+
+	return LeafIndex;
+}
+
+void FAABBTreeBroadphase::DestroyProxy(const FBroadphaseProxyId ProxyId)
+{
+	RemoveLeaf(ProxyId);
+	FreeNode(ProxyId);
+
+	NumberOfProxies--;
+}
+
+void FAABBTreeBroadphase::SetProxyFilter(const FBroadphaseProxyId ProxyId, const FCollisionFilter& InFilter)
+{
+	Nodes[ProxyId].Filter = InFilter;
+
+	// Pairs which were filtered before might be reported now
+	MarkMoved(ProxyId);
+}
+
+void FAABBTreeBroadphase::MoveProxy(const FBroadphaseProxyId ProxyId, const FCollisionAABB& InBounds)
+{
+	Nodes[ProxyId].ProxyBounds = InBounds;
+
+	if (!Nodes[ProxyId].Bounds.Contains(InBounds))
+	{
+		RemoveLeaf(ProxyId);
+
+		Nodes[ProxyId].Bounds = InBounds.Expanded(FatMargin);
+
+		InsertLeaf(ProxyId);
+
+		NumberOfReinserts++;
+	}
+
+	// Pairs are searched even without reinsert, object might have moved into other object inside of fat bounds
+	MarkMoved(ProxyId);
+}
+
+FCollisionBase* FAABBTreeBroadphase::GetCollision(const FBroadphaseProxyId ProxyId) const
+{
+	return Nodes[ProxyId].Collision;
+}
+
+void FAABBTreeBroadphase::Query(const FCollisionAABB& InBounds, CArray<FBroadphaseProxyId>& OutProxyIds) const
+{
+	QueryInternal(InBounds, [&](const int32 LeafIndex)
+	{
+		if (Nodes[LeafIndex].ProxyBounds.Overlaps(InBounds))
+		{
+			OutProxyIds.Push(LeafIndex);
+		}
+	});
+}
+
+void FAABBTreeBroadphase::QuerySegment(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, CArray<FBroadphaseProxyId>& OutProxyIds) const
+{
+	TraverseInternal([&](const FCollisionAABB& NodeBounds) { return NodeBounds.IntersectsSegment(InStart, InEnd); }, [&](const int32 LeafIndex)
+	{
+		if (Nodes[LeafIndex].ProxyBounds.IntersectsSegment(InStart, InEnd))
+		{
+			OutProxyIds.Push(LeafIndex);
+		}
+	});
+}
+
+void FAABBTreeBroadphase::UpdatePairs(CArray<FBroadphasePair>& OutPairs)
+{
+	OutPairs.Clear();
+
+	for (const FBroadphaseProxyId ProxyId : MovedProxies)
+	{
+		FAABBTreeNode& MovedNode = Nodes[ProxyId];
+
+		// Destroyed (or already handled if id was reused) proxies are skipped
+		if (MovedNode.Height != 0 || !MovedNode.bIsMoved)
+		{
+			continue;
+		}
+
+		MovedNode.bIsMoved = false;
+
+		const FCollisionAABB& MovedBounds = MovedNode.ProxyBounds;
+
+		// Exact bounds are inside of fat bounds, so tree can be queried with them
+		QueryInternal(MovedBounds, [&](const int32 LeafIndex)
+		{
+			const FAABBTreeNode& Leaf = Nodes[LeafIndex];
+
+			// Pair of two moved proxies is added when second one is handled
+			if (LeafIndex != ProxyId && !Leaf.bIsMoved && Leaf.ProxyBounds.Overlaps(MovedBounds) && Leaf.Filter.CanCollide(MovedNode.Filter))
+			{
+				OutPairs.Push(FBroadphasePair(ProxyId, LeafIndex));
+			}
+		});
+	}
+
+	MovedProxies.Clear();
+
+	SortAndRemoveDuplicatePairs(OutPairs);
+}
+
+void FAABBTreeBroadphase::DiscardMovedProxies()
+{
+	for (const FBroadphaseProxyId ProxyId : MovedProxies)
+	{
+		Nodes[ProxyId].bIsMoved = false;
+	}
+
+	MovedProxies.Clear();
+}
+
+void FAABBTreeBroadphase::DebugRender(const FRenderer* Renderer) const
+{
+	for (const FAABBTreeNode& Node : Nodes)
+	{
+		if (Node.Height != INDEX_NONE)
+		{
+			const FColorRGBA DrawColor = Node.IsLeaf() ? FColorRGBA::ColorLightGreen() : FColorRGBA::ColorOrange();
+
+			Renderer->DrawRectangleOutline(Node.Bounds.Min, Node.Bounds.Max - Node.Bounds.Min, DrawColor);
+		}
+	}
+}
+
+int32 FAABBTreeBroadphase::GetHeight() const
+{
+	return (RootIndex != INDEX_NONE) ? Nodes[RootIndex].Height : INDEX_NONE;
+}
+
+int32 FAABBTreeBroadphase::AllocateNode()
+{
+	int32 NodeIndex;
+
+	if (FreeListIndex != INDEX_NONE)
+	{
+		NodeIndex = FreeListIndex;
+		FreeListIndex = Nodes[NodeIndex].ParentOrNext;
+	}
+	else
+	{
+		NodeIndex = static_cast<int32>(Nodes.size());
+		Nodes.emplace_back();
+	}
+
+	FAABBTreeNode& Node = Nodes[NodeIndex];
+	Node.Collision = nullptr;
+	Node.ParentOrNext = INDEX_NONE;
+	Node.Child1 = INDEX_NONE;
+	Node.Child2 = INDEX_NONE;
+	Node.Height = 0;
+	Node.bIsMoved = false;
+
+	return NodeIndex;
+}
+
+void FAABBTreeBroadphase::FreeNode(const int32 NodeIndex)
+{
+	FAABBTreeNode& Node = Nodes[NodeIndex];
+	Node.Collision = nullptr;
+	Node.ParentOrNext = FreeListIndex;
+	Node.Height = INDEX_NONE;
+	Node.bIsMoved = false;
+
+	FreeListIndex = NodeIndex;
+}
+
+void FAABBTreeBroadphase::InsertLeaf(const int32 LeafIndex)
+{
+	if (RootIndex == INDEX_NONE)
+	{
+		RootIndex = LeafIndex;
+		Nodes[RootIndex].ParentOrNext = INDEX_NONE;
+
+		return;
+	}
+
+	const FCollisionAABB LeafBounds = Nodes[LeafIndex].Bounds;
+
+	// Find best sibling using perimeter as cost (surface area heuristic in 2D)
+	int32 Index = RootIndex;
+	while (!Nodes[Index].IsLeaf())
+	{
+		const FAABBTreeNode& Node = Nodes[Index];
+
+		const float Perimeter = Node.Bounds.GetPerimeter();
+		const float CombinedPerimeter = FCollisionAABB::Combine(Node.Bounds, LeafBounds).GetPerimeter();
+
+		// Cost of creating new parent for this node and the new leaf
+		const float Cost = 2.f * CombinedPerimeter;
+
+		// Minimum cost of pushing the leaf further down the tree
+		const float InheritanceCost = 2.f * (CombinedPerimeter - Perimeter);
+
+		auto GetDescendCost = [&](const int32 ChildIndex) -> float
+		{
+			const FAABBTreeNode& Child = Nodes[ChildIndex];
+			const float NewPerimeter = FCollisionAABB::Combine(LeafBounds, Child.Bounds).GetPerimeter();
+
+			return Child.IsLeaf() ? (NewPerimeter + InheritanceCost) : (NewPerimeter - Child.Bounds.GetPerimeter() + InheritanceCost);
+		};
+
+		const float Cost1 = GetDescendCost(Node.Child1);
+		const float Cost2 = GetDescendCost(Node.Child2);
+
+		if (Cost < Cost1 && Cost < Cost2)
+		{
+			break;
+		}
+
+		Index = (Cost1 < Cost2) ? Node.Child1 : Node.Child2;
+	}
+
+	const int32 SiblingIndex = Index;
+
+	// Allocation can move nodes, use indexes from here
+	const int32 NewParentIndex = AllocateNode();
+	const int32 OldParentIndex = Nodes[SiblingIndex].ParentOrNext;
+
+	FAABBTreeNode& NewParent = Nodes[NewParentIndex];
+	NewParent.ParentOrNext = OldParentIndex;
+	NewParent.Bounds = FCollisionAABB::Combine(LeafBounds, Nodes[SiblingIndex].Bounds);
+	NewParent.Height = Nodes[SiblingIndex].Height + 1;
+	NewParent.Child1 = SiblingIndex;
+	NewParent.Child2 = LeafIndex;
+
+	if (OldParentIndex != INDEX_NONE)
+	{
+		FAABBTreeNode& OldParent = Nodes[OldParentIndex];
+		if (OldParent.Child1 == SiblingIndex)
+		{
+			OldParent.Child1 = NewParentIndex;
+		}
+		else
+		{
+			OldParent.Child2 = NewParentIndex;
+		}
+	}
+	else
+	{
+		RootIndex = NewParentIndex;
+	}
+
+	Nodes[SiblingIndex].ParentOrNext = NewParentIndex;
+	Nodes[LeafIndex].ParentOrNext = NewParentIndex;
+
+	RefitFrom(NewParentIndex);
+}
+
+void FAABBTreeBroadphase::RemoveLeaf(const int32 LeafIndex)
+{
+	if (LeafIndex == RootIndex)
+	{
+		RootIndex = INDEX_NONE;
+
+		return;
+	}
+
+	const int32 ParentIndex = Nodes[LeafIndex].ParentOrNext;
+	const int32 GrandParentIndex = Nodes[ParentIndex].ParentOrNext;
+	const int32 SiblingIndex = (Nodes[ParentIndex].Child1 == LeafIndex) ? Nodes[ParentIndex].Child2 : Nodes[ParentIndex].Child1;
+
+	if (GrandParentIndex != INDEX_NONE)
+	{
+		// Connect sibling to grand parent, parent is not needed anymore
+		FAABBTreeNode& GrandParent = Nodes[GrandParentIndex];
+		if (GrandParent.Child1 == ParentIndex)
+		{
+			GrandParent.Child1 = SiblingIndex;
+		}
+		else
+		{
+			GrandParent.Child2 = SiblingIndex;
+		}
+
+		Nodes[SiblingIndex].ParentOrNext = GrandParentIndex;
+
+		FreeNode(ParentIndex);
+
+		RefitFrom(GrandParentIndex);
+	}
+	else
+	{
+		RootIndex = SiblingIndex;
+		Nodes[SiblingIndex].ParentOrNext = INDEX_NONE;
+
+		FreeNode(ParentIndex);
+	}
+
+	Nodes[LeafIndex].ParentOrNext = INDEX_NONE;
+}
+
+int32 FAABBTreeBroadphase::Balance(const int32 NodeIndex)
+{
+	const int32 IndexA = NodeIndex;
+
+	if (Nodes[IndexA].IsLeaf() || Nodes[IndexA].Height < 2)
+	{
+		return IndexA;
+	}
+
+	const int32 IndexB = Nodes[IndexA].Child1;
+	const int32 IndexC = Nodes[IndexA].Child2;
+
+	const int32 HeightDifference = Nodes[IndexC].Height - Nodes[IndexB].Height;
+
+	// Rotate higher child up, IndexUp goes in place of A and A becomes its child
+	auto Rotate = [&](const int32 IndexUp, const int32 IndexOther) -> int32
+	{
+		FAABBTreeNode& A = Nodes[IndexA];
+		FAABBTreeNode& Up = Nodes[IndexUp];
+
+		const int32 IndexF = Up.Child1;
+		const int32 IndexG = Up.Child2;
+
+		// Swap A and Up
+		Up.Child1 = IndexA;
+		Up.ParentOrNext = A.ParentOrNext;
+		A.ParentOrNext = IndexUp;
+
+		if (Up.ParentOrNext != INDEX_NONE)
+		{
+			FAABBTreeNode& UpParent = Nodes[Up.ParentOrNext];
+			if (UpParent.Child1 == IndexA)
+			{
+				UpParent.Child1 = IndexUp;
+			}
+			else
+			{
+				UpParent.Child2 = IndexUp;
+			}
+		}
+		else
+		{
+			RootIndex = IndexUp;
+		}
+
+		// Higher grandchild stays with Up, lower goes to A in place of Up
+		const bool bIsFHigher = (Nodes[IndexF].Height > Nodes[IndexG].Height);
+		const int32 IndexStay = bIsFHigher ? IndexF : IndexG;
+		const int32 IndexMove = bIsFHigher ? IndexG : IndexF;
+
+		Up.Child2 = IndexStay;
+
+		if (A.Child1 == IndexUp)
+		{
+			A.Child1 = IndexMove;
+		}
+		else
+		{
+			A.Child2 = IndexMove;
+		}
+
+		Nodes[IndexMove].ParentOrNext = IndexA;
+
+		A.Bounds = FCollisionAABB::Combine(Nodes[IndexOther].Bounds, Nodes[IndexMove].Bounds);
+		A.Height = 1 + FMath::Max(Nodes[IndexOther].Height, Nodes[IndexMove].Height);
+
+		Up.Bounds = FCollisionAABB::Combine(A.Bounds, Nodes[IndexStay].Bounds);
+		Up.Height = 1 + FMath::Max(A.Height, Nodes[IndexStay].Height);
+
+		return IndexUp;
+	};
+
+	if (HeightDifference > 1)
+	{
+		return Rotate(IndexC, IndexB);
+	}
+
+	if (HeightDifference < -1)
+	{
+		return Rotate(IndexB, IndexC);
+	}
+
+	return IndexA;
+}
+
+void FAABBTreeBroadphase::RefitFrom(int32 NodeIndex)
+{
+	while (NodeIndex != INDEX_NONE)
+	{
+		NodeIndex = Balance(NodeIndex);
+
+		FAABBTreeNode& Node = Nodes[NodeIndex];
+		const FAABBTreeNode& Child1 = Nodes[Node.Child1];
+		const FAABBTreeNode& Child2 = Nodes[Node.Child2];
+
+		Node.Height = 1 + FMath::Max(Child1.Height, Child2.Height);
+		Node.Bounds = FCollisionAABB::Combine(Child1.Bounds, Child2.Bounds);
+
+		NodeIndex = Node.ParentOrNext;
+	}
+}
+
+void FAABBTreeBroadphase::MarkMoved(const FBroadphaseProxyId ProxyId)
+{
+	FAABBTreeNode& Node = Nodes[ProxyId];
+	if (!Node.bIsMoved)
+	{
+		Node.bIsMoved = true;
+
+		MovedProxies.Push(ProxyId);
+	}
+}
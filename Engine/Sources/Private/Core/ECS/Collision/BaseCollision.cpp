@@ -6,6 +6,8 @@
 FCollisionBase::FCollisionBase(UCollisionComponent* InCollisionComponent)
 	: CollisionType(ECollisionType::Other)
 	, CollisionComponent(InCollisionComponent)
+	, BroadphaseProxyId(INDEX_NONE)
+	, bIsMovedSinceUpdate(false)
 {
 }
 
@@ -0,0 +1,460 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Collision/CollisionKernels.h"
+
+#include "ECS/Collision/CircleCollision.h"
+#include "ECS/Collision/SquareCollision.h"
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+	#define ENGINE_COLLISION_KERNELS_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define ENGINE_COLLISION_KERNELS_SSE2 1
+#endif
+
+namespace
+{
+	/** Thin wrapper over SIMD registers, so each kernel is written once */
+#if ENGINE_COLLISION_KERNELS_AVX2
+	typedef __m256 FFloatLanes;
+	constexpr int32 NumberOfLanes = 8;
+
+	FFloatLanes LoadLanes(const float* Data) { return _mm256_loadu_ps(Data); }
+	FFloatLanes SetLanes(const float Value) { return _mm256_set1_ps(Value); }
+	FFloatLanes AddLanes(const FFloatLanes A, const FFloatLanes B) { return _mm256_add_ps(A, B); }
+	FFloatLanes SubLanes(const FFloatLanes A, const FFloatLanes B) { return _mm256_sub_ps(A, B); }
+	FFloatLanes MulLanes(const FFloatLanes A, const FFloatLanes B) { return _mm256_mul_ps(A, B); }
+	FFloatLanes MinLanes(const FFloatLanes A, const FFloatLanes B) { return _mm256_min_ps(A, B); }
+	FFloatLanes MaxLanes(const FFloatLanes A, const FFloatLanes B) { return _mm256_max_ps(A, B); }
+	FFloatLanes GreaterLanes(const FFloatLanes A, const FFloatLanes B) { return _mm256_cmp_ps(A, B, _CMP_GT_OQ); }
+	FFloatLanes AndLanes(const FFloatLanes A, const FFloatLanes B) { return _mm256_and_ps(A, B); }
+	int32 MaskOfLanes(const FFloatLanes A) { return _mm256_movemask_ps(A); }
+#elif ENGINE_COLLISION_KERNELS_SSE2
+	typedef __m128 FFloatLanes;
+	constexpr int32 NumberOfLanes = 4;
+
+	FFloatLanes LoadLanes(const float* Data) { return _mm_loadu_ps(Data); }
+	FFloatLanes SetLanes(const float Value) { return _mm_set1_ps(Value); }
+	FFloatLanes AddLanes(const FFloatLanes A, const FFloatLanes B) { return _mm_add_ps(A, B); }
+	FFloatLanes SubLanes(const FFloatLanes A, const FFloatLanes B) { return _mm_sub_ps(A, B); }
+	FFloatLanes MulLanes(const FFloatLanes A, const FFloatLanes B) { return _mm_mul_ps(A, B); }
+	FFloatLanes MinLanes(const FFloatLanes A, const FFloatLanes B) { return _mm_min_ps(A, B); }
+	FFloatLanes MaxLanes(const FFloatLanes A, const FFloatLanes B) { return _mm_max_ps(A, B); }
+	FFloatLanes GreaterLanes(const FFloatLanes A, const FFloatLanes B) { return _mm_cmpgt_ps(A, B); }
+	FFloatLanes AndLanes(const FFloatLanes A, const FFloatLanes B) { return _mm_and_ps(A, B); }
+	int32 MaskOfLanes(const FFloatLanes A) { return _mm_movemask_ps(A); }
+#endif
+
+#if ENGINE_COLLISION_KERNELS_AVX2 || ENGINE_COLLISION_KERNELS_SSE2
+	void StoreMask(const int32 Mask, uint8* OutResults)
+	{
+		for (int32 Lane = 0; Lane < NumberOfLanes; Lane++)
+		{
+			OutResults[Lane] = static_cast<uint8>((Mask >> Lane) & 1);
+		}
+	}
+#endif
+
+	/** Scalar versions, used for tail of batch and when SIMD is not available */
+	bool IsCircleIntersectingCircle(const float X, const float Y, const float Radius, const float OtherX, const float OtherY, const float OtherRadius)
+	{
+		const float DistanceX = OtherX - X;
+		const float DistanceY = OtherY - Y;
+		const float SummaryRadius = Radius + OtherRadius;
+
+		return (SummaryRadius * SummaryRadius) > (DistanceX * DistanceX + DistanceY * DistanceY);
+	}
+
+	bool IsCircleIntersectingRectangle(const float X, const float Y, const float Radius, const float MinX, const float MinY, const float MaxX, const float MaxY)
+	{
+		const float DistanceX = X - FMath::Max(MinX, FMath::Min(X, MaxX));
+		const float DistanceY = Y - FMath::Max(MinY, FMath::Min(Y, MaxY));
+
+		return (Radius * Radius) > (DistanceX * DistanceX + DistanceY * DistanceY);
+	}
+
+	bool IsRectangleIntersectingRectangle(const float MinX, const float MinY, const float MaxX, const float MaxY, const float OtherMinX, const float OtherMinY, const float OtherMaxX, const float OtherMaxY)
+	{
+		return (MaxX > OtherMinX && OtherMaxX > MinX && MaxY > OtherMinY && OtherMaxY > MinY);
+	}
+
+	float GetRelative(const int Value, const int Origin)
+	{
+		return static_cast<float>(static_cast<int64>(Value) - Origin);
+	}
+}
+
+void FCollisionCircleBatch::Add(const FCircle& InCircle)
+{
+	X.Push(static_cast<float>(InCircle.GetLocation().X));
+	Y.Push(static_cast<float>(InCircle.GetLocation().Y));
+	Radius.Push(static_cast<float>(InCircle.GetRadius()));
+}
+
+void FCollisionCircleBatch::Add(const FCircle& InCircle, const FVector2D<int>& InOrigin)
+{
+	X.Push(GetRelative(InCircle.GetLocation().X, InOrigin.X));
+	Y.Push(GetRelative(InCircle.GetLocation().Y, InOrigin.Y));
+	Radius.Push(static_cast<float>(InCircle.GetRadius()));
+}
+
+void FCollisionCircleBatch::Reserve(const int32 Number)
+{
+	X.Resize(Number);
+	Y.Resize(Number);
+	Radius.Resize(Number);
+}
+
+void FCollisionCircleBatch::Clear()
+{
+	X.Clear();
+	Y.Clear();
+	Radius.Clear();
+}
+
+void FCollisionRectangleBatch::Add(const FRectangle& InRectangle)
+{
+	MinX.Push(static_cast<float>(InRectangle.GetPositionTopLeft().X));
+	MinY.Push(static_cast<float>(InRectangle.GetPositionTopLeft().Y));
+	MaxX.Push(static_cast<float>(InRectangle.GetPositionBottomRight().X));
+	MaxY.Push(static_cast<float>(InRectangle.GetPositionBottomRight().Y));
+}
+
+void FCollisionRectangleBatch::Add(const FRectangle& InRectangle, const FVector2D<int>& InOrigin)
+{
+	MinX.Push(GetRelative(InRectangle.GetPositionTopLeft().X, InOrigin.X));
+	MinY.Push(GetRelative(InRectangle.GetPositionTopLeft().Y, InOrigin.Y));
+	MaxX.Push(GetRelative(InRectangle.GetPositionBottomRight().X, InOrigin.X));
+	MaxY.Push(GetRelative(InRectangle.GetPositionBottomRight().Y, InOrigin.Y));
+}
+
+void FCollisionRectangleBatch::Reserve(const int32 Number)
+{
+	MinX.Resize(Number);
+	MinY.Resize(Number);
+	MaxX.Resize(Number);
+	MaxY.Resize(Number);
+}
+
+void FCollisionRectangleBatch::Clear()
+{
+	MinX.Clear();
+	MinY.Clear();
+	MaxX.Clear();
+	MaxY.Clear();
+}
+
+void FCollisionKernels::CircleAgainstCircles(const FCircle& InCircle, const FCollisionCircleBatch& Candidates, CArray<uint8>& OutResults)
+{
+	const int32 NumberOfCandidates = Candidates.Size();
+	OutResults.SetNum(NumberOfCandidates);
+
+	const float CircleX = static_cast<float>(InCircle.GetLocation().X);
+	const float CircleY = static_cast<float>(InCircle.GetLocation().Y);
+	const float CircleRadius = static_cast<float>(InCircle.GetRadius());
+
+	const float* CandidatesX = Candidates.X.Vector.data();
+	const float* CandidatesY = Candidates.Y.Vector.data();
+	const float* CandidatesRadius = Candidates.Radius.Vector.data();
+	uint8* Results = OutResults.Vector.data();
+
+	int32 Index = 0;
+
+#if ENGINE_COLLISION_KERNELS_AVX2 || ENGINE_COLLISION_KERNELS_SSE2
+	const FFloatLanes LanesX = SetLanes(CircleX);
+	const FFloatLanes LanesY = SetLanes(CircleY);
+	const FFloatLanes LanesRadius = SetLanes(CircleRadius);
+
+	for (; Index + NumberOfLanes <= NumberOfCandidates; Index += NumberOfLanes)
+	{
+		const FFloatLanes DistanceX = SubLanes(LoadLanes(CandidatesX + Index), LanesX);
+		const FFloatLanes DistanceY = SubLanes(LoadLanes(CandidatesY + Index), LanesY);
+		const FFloatLanes SummaryRadius = AddLanes(LanesRadius, LoadLanes(CandidatesRadius + Index));
+
+		const FFloatLanes DistanceSquared = AddLanes(MulLanes(DistanceX, DistanceX), MulLanes(DistanceY, DistanceY));
+
+		StoreMask(MaskOfLanes(GreaterLanes(MulLanes(SummaryRadius, SummaryRadius), DistanceSquared)), Results + Index);
+	}
+#endif
+
+	for (; Index < NumberOfCandidates; Index++)
+	{
+		Results[Index] = IsCircleIntersectingCircle(CircleX, CircleY, CircleRadius, CandidatesX[Index], CandidatesY[Index], CandidatesRadius[Index]) ? 1 : 0;
+	}
+}
+
+void FCollisionKernels::CircleAgainstRectangles(const FCircle& InCircle, const FCollisionRectangleBatch& Candidates, CArray<uint8>& OutResults)
+{
+	const int32 NumberOfCandidates = Candidates.Size();
+	OutResults.SetNum(NumberOfCandidates);
+
+	const float CircleX = static_cast<float>(InCircle.GetLocation().X);
+	const float CircleY = static_cast<float>(InCircle.GetLocation().Y);
+	const float CircleRadius = static_cast<float>(InCircle.GetRadius());
+
+	const float* CandidatesMinX = Candidates.MinX.Vector.data();
+	const float* CandidatesMinY = Candidates.MinY.Vector.data();
+	const float* CandidatesMaxX = Candidates.MaxX.Vector.data();
+	const float* CandidatesMaxY = Candidates.MaxY.Vector.data();
+	uint8* Results = OutResults.Vector.data();
+
+	int32 Index = 0;
+
+#if ENGINE_COLLISION_KERNELS_AVX2 || ENGINE_COLLISION_KERNELS_SSE2
+	const FFloatLanes LanesX = SetLanes(CircleX);
+	const FFloatLanes LanesY = SetLanes(CircleY);
+	const FFloatLanes LanesRadiusSquared = SetLanes(CircleRadius * CircleRadius);
+
+	for (; Index + NumberOfLanes <= NumberOfCandidates; Index += NumberOfLanes)
+	{
+		// Closest point of rectangle to circle
+		const FFloatLanes ClosestX = MaxLanes(LoadLanes(CandidatesMinX + Index), MinLanes(LanesX, LoadLanes(CandidatesMaxX + Index)));
+		const FFloatLanes ClosestY = MaxLanes(LoadLanes(CandidatesMinY + Index), MinLanes(LanesY, LoadLanes(CandidatesMaxY + Index)));
+
+		const FFloatLanes DistanceX = SubLanes(LanesX, ClosestX);
+		const FFloatLanes DistanceY = SubLanes(LanesY, ClosestY);
+		const FFloatLanes DistanceSquared = AddLanes(MulLanes(DistanceX, DistanceX), MulLanes(DistanceY, DistanceY));
+
+		StoreMask(MaskOfLanes(GreaterLanes(LanesRadiusSquared, DistanceSquared)), Results + Index);
+	}
+#endif
+
+	for (; Index < NumberOfCandidates; Index++)
+	{
+		Results[Index] = IsCircleIntersectingRectangle(CircleX, CircleY, CircleRadius, CandidatesMinX[Index], CandidatesMinY[Index], CandidatesMaxX[Index], CandidatesMaxY[Index]) ? 1 : 0;
+	}
+}
+
+void FCollisionKernels::RectangleAgainstRectangles(const FRectangle& InRectangle, const FCollisionRectangleBatch& Candidates, CArray<uint8>& OutResults)
+{
+	const int32 NumberOfCandidates = Candidates.Size();
+	OutResults.SetNum(NumberOfCandidates);
+
+	const float RectangleMinX = static_cast<float>(InRectangle.GetPositionTopLeft().X);
+	const float RectangleMinY = static_cast<float>(InRectangle.GetPositionTopLeft().Y);
+	const float RectangleMaxX = static_cast<float>(InRectangle.GetPositionBottomRight().X);
+	const float RectangleMaxY = static_cast<float>(InRectangle.GetPositionBottomRight().Y);
+
+	const float* CandidatesMinX = Candidates.MinX.Vector.data();
+	const float* CandidatesMinY = Candidates.MinY.Vector.data();
+	const float* CandidatesMaxX = Candidates.MaxX.Vector.data();
+	const float* CandidatesMaxY = Candidates.MaxY.Vector.data();
+	uint8* Results = OutResults.Vector.data();
+
+	int32 Index = 0;
+
+#if ENGINE_COLLISION_KERNELS_AVX2 || ENGINE_COLLISION_KERNELS_SSE2
+	const FFloatLanes LanesMinX = SetLanes(RectangleMinX);
+	const FFloatLanes LanesMinY = SetLanes(RectangleMinY);
+	const FFloatLanes LanesMaxX = SetLanes(RectangleMaxX);
+	const FFloatLanes LanesMaxY = SetLanes(RectangleMaxY);
+
+	for (; Index + NumberOfLanes <= NumberOfCandidates; Index += NumberOfLanes)
+	{
+		const FFloatLanes OverlapX = AndLanes(GreaterLanes(LanesMaxX, LoadLanes(CandidatesMinX + Index)), GreaterLanes(LoadLanes(CandidatesMaxX + Index), LanesMinX));
+		const FFloatLanes OverlapY = AndLanes(GreaterLanes(LanesMaxY, LoadLanes(CandidatesMinY + Index)), GreaterLanes(LoadLanes(CandidatesMaxY + Index), LanesMinY));
+
+		StoreMask(MaskOfLanes(AndLanes(OverlapX, OverlapY)), Results + Index);
+	}
+#endif
+
+	for (; Index < NumberOfCandidates; Index++)
+	{
+		Results[Index] = IsRectangleIntersectingRectangle(RectangleMinX, RectangleMinY, RectangleMaxX, RectangleMaxY, CandidatesMinX[Index], CandidatesMinY[Index], CandidatesMaxX[Index], CandidatesMaxY[Index]) ? 1 : 0;
+	}
+}
+
+void FCollisionKernels::RectangleAgainstCircles(const FRectangle& InRectangle, const FCollisionCircleBatch& Candidates, CArray<uint8>& OutResults)
+{
+	const int32 NumberOfCandidates = Candidates.Size();
+	OutResults.SetNum(NumberOfCandidates);
+
+	const float RectangleMinX = static_cast<float>(InRectangle.GetPositionTopLeft().X);
+	const float RectangleMinY = static_cast<float>(InRectangle.GetPositionTopLeft().Y);
+	const float RectangleMaxX = static_cast<float>(InRectangle.GetPositionBottomRight().X);
+	const float RectangleMaxY = static_cast<float>(InRectangle.GetPositionBottomRight().Y);
+
+	const float* CandidatesX = Candidates.X.Vector.data();
+	const float* CandidatesY = Candidates.Y.Vector.data();
+	const float* CandidatesRadius = Candidates.Radius.Vector.data();
+	uint8* Results = OutResults.Vector.data();
+
+	int32 Index = 0;
+
+#if ENGINE_COLLISION_KERNELS_AVX2 || ENGINE_COLLISION_KERNELS_SSE2
+	const FFloatLanes LanesMinX = SetLanes(RectangleMinX);
+	const FFloatLanes LanesMinY = SetLanes(RectangleMinY);
+	const FFloatLanes LanesMaxX = SetLanes(RectangleMaxX);
+	const FFloatLanes LanesMaxY = SetLanes(RectangleMaxY);
+
+	for (; Index + NumberOfLanes <= NumberOfCandidates; Index += NumberOfLanes)
+	{
+		const FFloatLanes CircleX = LoadLanes(CandidatesX + Index);
+		const FFloatLanes CircleY = LoadLanes(CandidatesY + Index);
+		const FFloatLanes CircleRadius = LoadLanes(CandidatesRadius + Index);
+
+		// Closest point of rectangle to each circle
+		const FFloatLanes DistanceX = SubLanes(CircleX, MaxLanes(LanesMinX, MinLanes(CircleX, LanesMaxX)));
+		const FFloatLanes DistanceY = SubLanes(CircleY, MaxLanes(LanesMinY, MinLanes(CircleY, LanesMaxY)));
+		const FFloatLanes DistanceSquared = AddLanes(MulLanes(DistanceX, DistanceX), MulLanes(DistanceY, DistanceY));
+
+		StoreMask(MaskOfLanes(GreaterLanes(MulLanes(CircleRadius, CircleRadius), DistanceSquared)), Results + Index);
+	}
+#endif
+
+	for (; Index < NumberOfCandidates; Index++)
+	{
+		Results[Index] = IsCircleIntersectingRectangle(CandidatesX[Index], CandidatesY[Index], CandidatesRadius[Index], RectangleMinX, RectangleMinY, RectangleMaxX, RectangleMaxY) ? 1 : 0;
+	}
+}
+
+void FCollisionKernels::CirclesAgainstCircles(const FCollisionCircleBatch& CirclesA, const FCollisionCircleBatch& CirclesB, CArray<uint8>& OutResults)
+{
+	const int32 NumberOfPairs = CirclesA.Size();
+	OutResults.SetNum(NumberOfPairs);
+
+	const float* CirclesAX = CirclesA.X.Vector.data();
+	const float* CirclesAY = CirclesA.Y.Vector.data();
+	const float* CirclesARadius = CirclesA.Radius.Vector.data();
+	const float* CirclesBX = CirclesB.X.Vector.data();
+	const float* CirclesBY = CirclesB.Y.Vector.data();
+	const float* CirclesBRadius = CirclesB.Radius.Vector.data();
+	uint8* Results = OutResults.Vector.data();
+
+	int32 Index = 0;
+
+#if ENGINE_COLLISION_KERNELS_AVX2 || ENGINE_COLLISION_KERNELS_SSE2
+	for (; Index + NumberOfLanes <= NumberOfPairs; Index += NumberOfLanes)
+	{
+		const FFloatLanes DistanceX = SubLanes(LoadLanes(CirclesBX + Index), LoadLanes(CirclesAX + Index));
+		const FFloatLanes DistanceY = SubLanes(LoadLanes(CirclesBY + Index), LoadLanes(CirclesAY + Index));
+		const FFloatLanes SummaryRadius = AddLanes(LoadLanes(CirclesARadius + Index), LoadLanes(CirclesBRadius + Index));
+
+		const FFloatLanes DistanceSquared = AddLanes(MulLanes(DistanceX, DistanceX), MulLanes(DistanceY, DistanceY));
+
+		StoreMask(MaskOfLanes(GreaterLanes(MulLanes(SummaryRadius, SummaryRadius), DistanceSquared)), Results + Index);
+	}
+#endif
+
+	for (; Index < NumberOfPairs; Index++)
+	{
+		Results[Index] = IsCircleIntersectingCircle(CirclesAX[Index], CirclesAY[Index], CirclesARadius[Index], CirclesBX[Index], CirclesBY[Index], CirclesBRadius[Index]) ? 1 : 0;
+	}
+}
+
+void FCollisionKernels::CirclesAgainstRectangles(const FCollisionCircleBatch& Circles, const FCollisionRectangleBatch& Rectangles, CArray<uint8>& OutResults)
+{
+	const int32 NumberOfPairs = Circles.Size();
+	OutResults.SetNum(NumberOfPairs);
+
+	const float* CirclesX = Circles.X.Vector.data();
+	const float* CirclesY = Circles.Y.Vector.data();
+	const float* CirclesRadius = Circles.Radius.Vector.data();
+	const float* RectanglesMinX = Rectangles.MinX.Vector.data();
+	const float* RectanglesMinY = Rectangles.MinY.Vector.data();
+	const float* RectanglesMaxX = Rectangles.MaxX.Vector.data();
+	const float* RectanglesMaxY = Rectangles.MaxY.Vector.data();
+	uint8* Results = OutResults.Vector.data();
+
+	int32 Index = 0;
+
+#if ENGINE_COLLISION_KERNELS_AVX2 || ENGINE_COLLISION_KERNELS_SSE2
+	for (; Index + NumberOfLanes <= NumberOfPairs; Index += NumberOfLanes)
+	{
+		const FFloatLanes CircleX = LoadLanes(CirclesX + Index);
+		const FFloatLanes CircleY = LoadLanes(CirclesY + Index);
+		const FFloatLanes CircleRadius = LoadLanes(CirclesRadius + Index);
+
+		// Closest point of each rectangle to its circle
+		const FFloatLanes DistanceX = SubLanes(CircleX, MaxLanes(LoadLanes(RectanglesMinX + Index), MinLanes(CircleX, LoadLanes(RectanglesMaxX + Index))));
+		const FFloatLanes DistanceY = SubLanes(CircleY, MaxLanes(LoadLanes(RectanglesMinY + Index), MinLanes(CircleY, LoadLanes(RectanglesMaxY + Index))));
+		const FFloatLanes DistanceSquared = AddLanes(MulLanes(DistanceX, DistanceX), MulLanes(DistanceY, DistanceY));
+
+		StoreMask(MaskOfLanes(GreaterLanes(MulLanes(CircleRadius, CircleRadius), DistanceSquared)), Results + Index);
+	}
+#endif
+
+	for (; Index < NumberOfPairs; Index++)
+	{
+		Results[Index] = IsCircleIntersectingRectangle(CirclesX[Index], CirclesY[Index], CirclesRadius[Index], RectanglesMinX[Index], RectanglesMinY[Index], RectanglesMaxX[Index], RectanglesMaxY[Index]) ? 1 : 0;
+	}
+}
+
+void FCollisionKernels::RectanglesAgainstRectangles(const FCollisionRectangleBatch& RectanglesA, const FCollisionRectangleBatch& RectanglesB, CArray<uint8>& OutResults)
+{
+	const int32 NumberOfPairs = RectanglesA.Size();
+	OutResults.SetNum(NumberOfPairs);
+
+	const float* RectanglesAMinX = RectanglesA.MinX.Vector.data();
+	const float* RectanglesAMinY = RectanglesA.MinY.Vector.data();
+	const float* RectanglesAMaxX = RectanglesA.MaxX.Vector.data();
+	const float* RectanglesAMaxY = RectanglesA.MaxY.Vector.data();
+	const float* RectanglesBMinX = RectanglesB.MinX.Vector.data();
+	const float* RectanglesBMinY = RectanglesB.MinY.Vector.data();
+	const float* RectanglesBMaxX = RectanglesB.MaxX.Vector.data();
+	const float* RectanglesBMaxY = RectanglesB.MaxY.Vector.data();
+	uint8* Results = OutResults.Vector.data();
+
+	int32 Index = 0;
+
+#if ENGINE_COLLISION_KERNELS_AVX2 || ENGINE_COLLISION_KERNELS_SSE2
+	for (; Index + NumberOfLanes <= NumberOfPairs; Index += NumberOfLanes)
+	{
+		const FFloatLanes OverlapX = AndLanes(GreaterLanes(LoadLanes(RectanglesAMaxX + Index), LoadLanes(RectanglesBMinX + Index)), GreaterLanes(LoadLanes(RectanglesBMaxX + Index), LoadLanes(RectanglesAMinX + Index)));
+		const FFloatLanes OverlapY = AndLanes(GreaterLanes(LoadLanes(RectanglesAMaxY + Index), LoadLanes(RectanglesBMinY + Index)), GreaterLanes(LoadLanes(RectanglesBMaxY + Index), LoadLanes(RectanglesAMinY + Index)));
+
+		StoreMask(MaskOfLanes(AndLanes(OverlapX, OverlapY)), Results + Index);
+	}
+#endif
+
+	for (; Index < NumberOfPairs; Index++)
+	{
+		Results[Index] = IsRectangleIntersectingRectangle(RectanglesAMinX[Index], RectanglesAMinY[Index], RectanglesAMaxX[Index], RectanglesAMaxY[Index], RectanglesBMinX[Index], RectanglesBMinY[Index], RectanglesBMaxX[Index], RectanglesBMaxY[Index]) ? 1 : 0;
+	}
+}
+
+bool FCollisionKernels::IsCirclePairExact(const FCircle& CircleA, const FCircle& CircleB)
+{
+	const FVector2D<int>& Origin = CircleA.GetLocation();
+
+	return IsExactDistance(static_cast<int64>(CircleB.GetLocation().X) - Origin.X)
+		&& IsExactDistance(static_cast<int64>(CircleB.GetLocation().Y) - Origin.Y)
+		&& IsExactDistance(static_cast<int64>(CircleA.GetRadius()) + CircleB.GetRadius());
+}
+
+bool FCollisionKernels::IsCircleAndRectanglePairExact(const FCircle& InCircle, const FRectangle& InRectangle)
+{
+	const FVector2D<int>& Origin = InCircle.GetLocation();
+
+	// Closest point of rectangle is between its corners, so its distance is not bigger than distances of corners
+	return IsExactDistance(static_cast<int64>(InRectangle.GetPositionTopLeft().X) - Origin.X)
+		&& IsExactDistance(static_cast<int64>(InRectangle.GetPositionTopLeft().Y) - Origin.Y)
+		&& IsExactDistance(static_cast<int64>(InRectangle.GetPositionBottomRight().X) - Origin.X)
+		&& IsExactDistance(static_cast<int64>(InRectangle.GetPositionBottomRight().Y) - Origin.Y)
+		&& IsExactDistance(InCircle.GetRadius());
+}
+
+bool FCollisionKernels::IsRectanglePairExact(const FRectangle& RectangleA, const FRectangle& RectangleB)
+{
+	const FVector2D<int>& Origin = RectangleA.GetPositionTopLeft();
+
+	return IsExactCoordinate(static_cast<int64>(RectangleA.GetPositionBottomRight().X) - Origin.X)
+		&& IsExactCoordinate(static_cast<int64>(RectangleA.GetPositionBottomRight().Y) - Origin.Y)
+		&& IsExactCoordinate(static_cast<int64>(RectangleB.GetPositionTopLeft().X) - Origin.X)
+		&& IsExactCoordinate(static_cast<int64>(RectangleB.GetPositionTopLeft().Y) - Origin.Y)
+		&& IsExactCoordinate(static_cast<int64>(RectangleB.GetPositionBottomRight().X) - Origin.X)
+		&& IsExactCoordinate(static_cast<int64>(RectangleB.GetPositionBottomRight().Y) - Origin.Y);
+}
+
+const char* FCollisionKernels::GetInstructionSetName()
+{
+#if ENGINE_COLLISION_KERNELS_AVX2
+	return "AVX2";
+#elif ENGINE_COLLISION_KERNELS_SSE2
+	return "SSE2";
+#else
+	return "Scalar";
+#endif
+}
@@ -5,87 +5,62 @@
 
 #include "Assets/IniReader/IniManager.h"
 #include "Assets/IniReader/IniObject.h"
+#include "ECS/Collision/AABBTreeBroadphase.h"
 #include "ECS/Collision/CircleCollision.h"
+#include "ECS/Collision/GridBroadphase.h"
 #include "ECS/Collision/SquareCollision.h"
 #include "ECS/Components/Collision/CollisionComponent.h"
+#include "Misc/StringHelpers.h"
 #include "Renderer/Map/Map.h"
 #include "Threads/ThreadsManager.h"
 
 FCollisionManager::FCollisionManager()
-	: CollisionTileSize(64, 64)
-	, bIsCollisionReady(false)
+	: BroadphaseType(ECollisionBroadphaseType::Grid)
+	, NumberOfContactNarrowphasePairs(0)
+	, CollisionTick(0)
+	, CollisionTileSize(64, 64)
+	, AABBTreeFatMargin(FAABBTreeBroadphase::DefaultFatMargin)
 	, bIsDebugEnabled(true)
 {
+	CollisionLayerFilters.Emplace(DefaultCollisionLayerName, FCollisionFilter());
 }
 
 FCollisionManager::~FCollisionManager()
 {
-	for (FCollisionMeshRow* CollisionRow : CollisionRows)
-	{
-		for (FCollisionTile* CollisionTile : CollisionRow->CollisionTiles)
-		{
-			delete CollisionTile;
-		}
-
-		delete CollisionRow;
-	}
 }
 
 void FCollisionManager::InitializeSubSystem()
 {
 	ISubSystemInstanceInterface::InitializeSubSystem();
 
-	const std::string CollisionSettingsIniName = "CollisionSettings";
-	FIniManager* IniManager = FGlobalDefines::GEngine->GetAssetsManager()->GetIniManager();
-	EngineCollisionSettingsIniObject = IniManager->GetIniObject(CollisionSettingsIniName);
-	if (EngineCollisionSettingsIniObject && EngineCollisionSettingsIniObject->DoesIniExist())
+	// Without engine (tools, tests) default settings are used and narrowphase runs on calling thread
+	FEngine* Engine = FGlobalDefines::GEngine;
+	if (Engine != nullptr)
 	{
-		EngineCollisionSettingsIniObject->LoadIni();
+		LoadSettings();
+	}
 
-		const std::string CollisionTileSizeFieldName = "CollisionTileSize";
-		const FIniField IniField = EngineCollisionSettingsIniObject->FindFieldByName(CollisionTileSizeFieldName);
-		if (IniField.IsValid())
-		{
-			const int CollisionTileSizeValue = IniField.GetValueAsInt();
+	CreateBroadphase();
 
-			CollisionTileSize = FVector2D<int>(CollisionTileSizeValue, CollisionTileSizeValue);
+	Narrowphase = std::make_shared<FCollisionNarrowphase>(Engine != nullptr ? Engine->GetThreadsManager() : nullptr);
 
-			LOG_INFO("Collision mesh size from ini: " << CollisionTileSizeValue << " x " << CollisionTileSizeValue << " each.");
-		}
-	}
-	else
+	for (FCollisionBase* Collision : CollisionWaitingForAddArray)
 	{
-		LOG_WARN("Missing collision ini file.");
+		AddToBroadphase(Collision);
 	}
 
-	BuildCollision();
+	CollisionWaitingForAddArray.Clear();
 }
 
 void FCollisionManager::TickSubSystem()
 {
 	ISubSystemInstanceInterface::TickSubSystem();
 
-	if (bIsCollisionReady)
-	{
-		if (!CollisionWaitingForAddArray.IsEmpty())
-		{
-			for (FCollisionBase* Collision : CollisionWaitingForAddArray)
-			{
-				PutCollisionIntoMesh(Collision, true);
-			}
-
-			CollisionWaitingForAddArray.Clear();
-		}
-
-		if (!CollisionWaitingForRemovalArray.IsEmpty())
-		{
-			for (FCollisionBase* Collision : CollisionWaitingForRemovalArray)
-			{
-				RemoveCollisionFromMesh(Collision);
-			}
+	CollisionTick++;
 
-			CollisionWaitingForRemovalArray.Clear();
-		}
+	if (Broadphase != nullptr)
+	{
+		UpdateCollisionPairs();
 	}
 }
 
@@ -93,39 +68,26 @@ void FCollisionManager::RenderSubSystem()
 {
 	ISubSystemInstanceInterface::RenderSubSystem();
 
-	if (bIsCollisionReady)
-	{
 #if _DEBUG
-		if (bIsDebugEnabled)
+	if (bIsDebugEnabled && Broadphase != nullptr)
+	{
+		FMap* CurrentMap = dynamic_cast<FMap*>(GetSubSystemParentInterface());
+		if (CurrentMap != nullptr)
 		{
-			FMap* CurrentMap = dynamic_cast<FMap*>(GetSubSystemParentInterface());
-			if (CurrentMap != nullptr)
-			{
-				FWindow* Window = CurrentMap->GetEntityManager()->GetOwnerWindow();
-				const FRenderer* Renderer = Window->GetRenderer();
-
-				for (FCollisionMeshRow* Row : CollisionRows)
-				{
-					for (const FCollisionTile* CollisionTile : Row->CollisionTiles)
-					{
-						FColorRGBA DrawColor = CollisionTile->CollisionObjects.IsEmpty() ? FColorRGBA::ColorLightGreen() : FColorRGBA::ColorOrange();
+			FWindow* Window = CurrentMap->GetEntityManager()->GetOwnerWindow();
+			const FRenderer* Renderer = Window->GetRenderer();
 
-						Renderer->DrawRectangleOutline(CollisionTile->TileLocation, CollisionTile->TileSize, DrawColor);
-					}
-				}
-			}
+			Broadphase->DebugRender(Renderer);
 		}
-#endif
 	}
+#endif
 }
 
 void FCollisionManager::RegisterCollision(FCollisionBase* InCollision)
 {
-	AllCollisionArray.Push(InCollision);
-
-	if (bIsCollisionReady)
+	if (Broadphase != nullptr)
 	{
-		PutCollisionIntoMesh(InCollision);
+		AddToBroadphase(InCollision);
 	}
 	else
 	{
@@ -135,365 +97,459 @@ void FCollisionManager::RegisterCollision(FCollisionBase* InCollision)
 
 void FCollisionManager::UnRegisterCollision(FCollisionBase* InCollision)
 {
-	AllCollisionArray.Remove(InCollision);
+	EndAllContacts(InCollision);
 
-	if (bIsCollisionReady)
+	if (InCollision->BroadphaseProxyId != INDEX_NONE)
 	{
-		RemoveCollisionFromMesh(InCollision);
+		Broadphase->DestroyProxy(InCollision->BroadphaseProxyId);
+
+		InCollision->BroadphaseProxyId = INDEX_NONE;
 	}
-	else
+
+	if (InCollision->bIsMovedSinceUpdate)
 	{
-		CollisionWaitingForRemovalArray.Push(InCollision);
+		MovedCollisions.Remove(InCollision);
+
+		InCollision->bIsMovedSinceUpdate = false;
 	}
+
+	CollisionWaitingForAddArray.Remove(InCollision);
 }
 
-void FCollisionManager::OnCollisionObjectMoved(FCollisionBase* InCollisionObject)
+FCollisionFilter FCollisionManager::MakeCollisionFilter(const std::string& InLayerName, const bool bInIsStatic) const
 {
-	if (bIsCollisionReady)
+	FCollisionFilter Filter;
+
+	const auto LayerIterator = CollisionLayerFilters.Map.find(InLayerName);
+	if (LayerIterator != CollisionLayerFilters.Map.end())
 	{
-		UpdateCollisionOnMesh(InCollisionObject);
+		Filter = LayerIterator->second;
 	}
-}
-
-void FCollisionManager::BuildCollision()
-{
-	FMap* CurrentMap = dynamic_cast<FMap*>(GetSubSystemParentInterface());
-	if (CurrentMap != nullptr)
+	else
 	{
-		MapSizeInPixelsCache = CurrentMap->GetMapSizeInPixels();
+		LOG_WARN("Unknown collision layer: " << InLayerName << ", default filter will be used.");
+	}
 
-		bIsCollisionReady = false;
+	Filter.bIsStatic = bInIsStatic;
 
-		FDelegateSafe<> AsyncWork;
-		AsyncWork.BindObject(this, &FCollisionManager::CreateCollisionTiles);
+	return Filter;
+}
 
-		FDelegateSafe<> MainThreadCallback;
-		MainThreadCallback.BindObject(this, &FCollisionManager::OnCollisionCreated);
+FCollisionLayerMask FCollisionManager::GetCollisionLayerMask(const std::string& InLayerName) const
+{
+	const auto LayerIterator = CollisionLayerFilters.Map.find(InLayerName);
 
-		FGlobalDefines::GEngine->GetThreadsManager()->AddAsyncDelegate(AsyncWork, MainThreadCallback);
-	}
+	return (LayerIterator != CollisionLayerFilters.Map.end()) ? LayerIterator->second.Layer : 0;
 }
 
-void FCollisionManager::CreateCollisionTiles()
+void FCollisionManager::SetCollisionFilter(FCollisionBase* InCollision, const FCollisionFilter& InFilter)
 {
-	// Add 1 to each axis because otherwise we might be missing one tile (half tile for example) at end if map size does not perfectly divide into mesh
-	const FVector2D<int> TargetNumberOfTiles = (MapSizeInPixelsCache / CollisionTileSize) + FVector2D<int>(1, 1);
+	if (InCollision->GetCollisionFilter() == InFilter)
+	{
+		return;
+	}
 
-	CArray<FCollisionMeshRow*> TemporaryCollisionRows;
+	InCollision->SetCollisionFilter(InFilter);
 
-	FVector2D<int> CurrentTileIndex;
-	// Vertical tiles
-	for (; CurrentTileIndex.Y < TargetNumberOfTiles.Y; CurrentTileIndex.Y++)
+	if (InCollision->BroadphaseProxyId != INDEX_NONE)
 	{
-		// Create row for new tiles
-		FCollisionMeshRow* CollisionTilesRow = new FCollisionMeshRow();
+		Broadphase->SetProxyFilter(InCollision->BroadphaseProxyId, InFilter);
 
-		// Reset on each loop iteration
-		CurrentTileIndex.X = 0;
-
-		// Horizontal tiles
-		for (; CurrentTileIndex.X < TargetNumberOfTiles.X; CurrentTileIndex.X++)
+		// Existing contacts are checked again, same as after move
+		if (!InCollision->bIsMovedSinceUpdate)
 		{
-			FCollisionTile* CollisionTile = new FCollisionTile();
-
-			CollisionTile->TileLocation = CurrentTileIndex * CollisionTileSize;
-			CollisionTile->TileSize = CollisionTileSize;
+			InCollision->bIsMovedSinceUpdate = true;
 
-			CollisionTilesRow->CollisionTiles.Push(CollisionTile);
+			MovedCollisions.Push(InCollision);
 		}
-
-		TemporaryCollisionRows.Push(CollisionTilesRow);
 	}
-
-	CollisionRows = TemporaryCollisionRows;
-
-	LOG_INFO("Created " << TargetNumberOfTiles.X * TargetNumberOfTiles.Y << " tiles.");
 }
 
-void FCollisionManager::OnCollisionCreated()
+void FCollisionManager::OnCollisionObjectMoved(FCollisionBase* InCollisionObject)
 {
-	OnCollisionTilesCreated.Execute();
+	if (InCollisionObject->BroadphaseProxyId != INDEX_NONE)
+	{
+		Broadphase->MoveProxy(InCollisionObject->BroadphaseProxyId, GetCollisionBounds(InCollisionObject));
 
-	bIsCollisionReady = true;
+		if (!InCollisionObject->bIsMovedSinceUpdate)
+		{
+			InCollisionObject->bIsMovedSinceUpdate = true;
 
-	LOG_INFO("Collision map created.");
+			MovedCollisions.Push(InCollisionObject);
+		}
+	}
 }
 
-void FCollisionManager::PutCollisionIntoMesh(FCollisionBase* InCollision, const bool bIsDelayed)
+FCollisionAABB FCollisionManager::GetCollisionBounds(FCollisionBase* InCollision) const
 {
-	InCollision->CurrentlyLocatedTiles = GetTilesFromCollision(InCollision);
-
-	for (FCollisionTile* Tile : InCollision->CurrentlyLocatedTiles)
+	switch (InCollision->GetCollisionType())
 	{
-		Tile->CollisionObjects.Push(InCollision);
-	}
+		case ECollisionType::Circle:
+		{
+			const FCircle& CircleData = static_cast<FCircleCollision*>(InCollision)->GetCircleData();
+			const FVector2D<int>& Location = CircleData.GetLocation();
+			const int Radius = CircleData.GetRadius();
+
+			return FCollisionAABB(
+				FVector2D<float>(static_cast<float>(Location.X - Radius), static_cast<float>(Location.Y - Radius)),
+				FVector2D<float>(static_cast<float>(Location.X + Radius), static_cast<float>(Location.Y + Radius))
+			);
+		}
+		case ECollisionType::Square:
+		{
+			const FRectangleWithDiagonal& RectangleData = static_cast<FSquareCollision*>(InCollision)->GetSquareData();
 
-	// In case where we added collision before building collision mesh, skip this step
-	if (!bIsDelayed)
-	{
-		// After putting it inside we should find intersections with other colliders
-		for (FCollisionTile* Tile : InCollision->CurrentlyLocatedTiles)
+			return FCollisionAABB(FVector2D<float>(RectangleData.GetPositionTopLeft()), FVector2D<float>(RectangleData.GetPositionBottomRight()));
+		}
+		case ECollisionType::Other:
 		{
-			// Skip single colliders
-			if (Tile->CollisionObjects.Size() > 1)
-			{
-				for (FCollisionBase* TileCollisionA : Tile->CollisionObjects)
-				{
-					for (FCollisionBase* TileCollisionB : Tile->CollisionObjects)
-					{
-						// Skip self
-						if (TileCollisionA != TileCollisionB && TileCollisionA->CollisionComponent->IsCollisionEnabled() && TileCollisionB->CollisionComponent->IsCollisionEnabled())
-						{
-							const bool bIsIntersecting = IsIntersecting(TileCollisionA, TileCollisionB);
-							if (bIsIntersecting)
-							{
-								LOG_INFO("Found intersection :)!");
-
-								OnCollisionBegin(TileCollisionA, TileCollisionB);
-							}
-						}
-					}
-				}
-			}
+			break;
 		}
 	}
-}
 
-void FCollisionManager::RemoveCollisionFromMesh(FCollisionBase* InCollision)
-{
-	OnCollisionEnd(InCollision);
+	return GetCustomTypeBounds(InCollision);
 }
 
-void FCollisionManager::UpdateCollisionOnMesh(FCollisionBase* InCollision)
+void FCollisionManager::LoadSettings()
 {
-	const CArray<FCollisionTile*> PreviousTiles = InCollision->CurrentlyLocatedTiles;
-	const CArray<FCollisionTile*> NewTiles = GetTilesFromCollision(InCollision);
-	
-	InCollision->CurrentlyLocatedTiles = NewTiles;
-
-	// Remove collision from tiles which does not intersect anymore
-	for (FCollisionTile* PreviousTile : PreviousTiles)
+	const std::string CollisionSettingsIniName = "CollisionSettings";
+	FIniManager* IniManager = FGlobalDefines::GEngine->GetAssetsManager()->GetIniManager();
+	EngineCollisionSettingsIniObject = IniManager->GetIniObject(CollisionSettingsIniName);
+	if (EngineCollisionSettingsIniObject && EngineCollisionSettingsIniObject->DoesIniExist())
 	{
-		if (!NewTiles.Contains(PreviousTile))
+		EngineCollisionSettingsIniObject->LoadIni();
+
+		const std::string BroadphaseFieldName = "Broadphase";
+		const FIniField BroadphaseIniField = EngineCollisionSettingsIniObject->FindFieldByName(BroadphaseFieldName);
+		if (BroadphaseIniField.IsValid())
 		{
-			PreviousTile->CollisionObjects.RemoveAll(InCollision);
+			const std::string& BroadphaseValue = BroadphaseIniField.GetValueAsString();
+			if (BroadphaseValue == "Grid")
+			{
+				BroadphaseType = ECollisionBroadphaseType::Grid;
+			}
+			else if (BroadphaseValue == "AABBTree")
+			{
+				BroadphaseType = ECollisionBroadphaseType::AABBTree;
+			}
+			else
+			{
+				LOG_WARN("Unknown collision broadphase: " << BroadphaseValue << ", Grid will be used.");
+			}
 		}
-	}
 
-	// Add collision to new tiles
-	for (FCollisionTile* NewTile : NewTiles)
-	{
-		if (!PreviousTiles.Contains(NewTile))
+		const std::string CollisionTileSizeFieldName = "CollisionTileSize";
+		const FIniField CollisionTileSizeIniField = EngineCollisionSettingsIniObject->FindFieldByName(CollisionTileSizeFieldName);
+		if (CollisionTileSizeIniField.IsValid())
 		{
-			NewTile->CollisionObjects.Push(InCollision);
+			const int CollisionTileSizeValue = CollisionTileSizeIniField.GetValueAsInt();
+
+			CollisionTileSize = FVector2D<int>(CollisionTileSizeValue, CollisionTileSizeValue);
+
+			LOG_INFO("Collision mesh size from ini: " << CollisionTileSizeValue << " x " << CollisionTileSizeValue << " each.");
 		}
-	}
 
-	// Collision between other collision objects
-	for (FCollisionTile* Tiles : InCollision->CurrentlyLocatedTiles)
-	{
-		for (FCollisionBase* CollisionObject : Tiles->CollisionObjects)
+		const std::string AABBTreeFatMarginFieldName = "AABBTreeFatMargin";
+		const FIniField AABBTreeFatMarginIniField = EngineCollisionSettingsIniObject->FindFieldByName(AABBTreeFatMarginFieldName);
+		if (AABBTreeFatMarginIniField.IsValid())
 		{
-			if (CollisionObject != InCollision && CollisionObject->CollisionComponent->IsCollisionEnabled() && InCollision->CollisionComponent->IsCollisionEnabled())
-			{
-				const bool bWasIntersecting = CollisionObject->OtherCollidersCurrentlyColliding.Contains(InCollision);
-				const bool bIsCurrentlyIntersecting = IsIntersecting(InCollision, CollisionObject);
-
-				if (bWasIntersecting && !bIsCurrentlyIntersecting)
-				{
-					OnCollisionEnd(InCollision);
-				}
-				else if (!bWasIntersecting && bIsCurrentlyIntersecting)
-				{
-					OnCollisionBegin(InCollision, CollisionObject);
-				}
-			}
+			AABBTreeFatMargin = static_cast<float>(FMath::Max(AABBTreeFatMarginIniField.GetValueAsInt(), 0));
 		}
+
+		LoadCollisionLayers();
+	}
+	else
+	{
+		LOG_WARN("Missing collision ini file.");
 	}
 }
 
-bool FCollisionManager::IsIntersecting(FCollisionBase* CollisionA, FCollisionBase* CollisionB)
+void FCollisionManager::LoadCollisionLayers()
 {
-	bool bIsIntersecting = false;
+	const std::string CollisionLayersFieldName = "CollisionLayers";
+	const FIniField CollisionLayersIniField = EngineCollisionSettingsIniObject->FindFieldByName(CollisionLayersFieldName);
+	if (!CollisionLayersIniField.IsValid())
+	{
+		return;
+	}
 
-	if (CollisionA->GetCollisionType() == ECollisionType::Other || CollisionB->GetCollisionType() == ECollisionType::Other)
+	CArray<std::string> LayerNames = FStringHelpers::SplitString(CollisionLayersIniField.GetValueAsString(), ',');
+	if (LayerNames.Size() > MaxNumberOfCollisionLayers)
 	{
-		// Handle any custom collision types
-		bIsIntersecting = IsIntersectingCustomTypes(CollisionA, CollisionB);
+		LOG_WARN("Too many collision layers: " << LayerNames.Size() << ", only first " << MaxNumberOfCollisionLayers << " will be used.");
+
+		LayerNames.SetNum(MaxNumberOfCollisionLayers);
 	}
-	else
+
+	// Each layer is one bit, layer collides with all layers unless it has 'CollidesWith' field
+	CollisionLayerFilters.Clear();
+
+	for (int32 LayerIndex = 0; LayerIndex < LayerNames.Size(); LayerIndex++)
 	{
-		switch (CollisionA->GetCollisionType())
+		CollisionLayerFilters.Emplace(LayerNames[LayerIndex], FCollisionFilter(static_cast<FCollisionLayerMask>(1u << LayerIndex), FCollisionFilter::AllLayers));
+	}
+
+	for (const std::string& LayerName : LayerNames)
+	{
+		const FIniField CollidesWithIniField = EngineCollisionSettingsIniObject->FindFieldByName(LayerName + "CollidesWith");
+		if (CollidesWithIniField.IsValid())
 		{
-			case ECollisionType::Circle:
-			{
-				switch (CollisionB->GetCollisionType())
-				{
-					case ECollisionType::Circle:
-					{
-						const FCircle& CircleDataA = dynamic_cast<FCircleCollision*>(CollisionA)->GetCircleData();
-						const FCircle& CircleDataB = dynamic_cast<FCircleCollision*>(CollisionB)->GetCircleData();
-
-						bIsIntersecting = FCollisionGlobals::CirclesIntersect(CircleDataA, CircleDataB);
-
-						break;
-					}
-					case ECollisionType::Square:
-					{
-						const FCircle& CircleData = dynamic_cast<FCircleCollision*>(CollisionA)->GetCircleData();
-						const FRectangleWithDiagonal& RectangleData = dynamic_cast<FSquareCollision*>(CollisionB)->GetSquareData();
-
-						bIsIntersecting = FCollisionGlobals::CircleAndSquareIntersect(RectangleData, CircleData);
-
-						break;
-					}
-					case ECollisionType::Other:
-					{
-						LOG_ERROR("ECollisionType::Other found (#Circle). Collision will not work in this case.");
-
-						break;
-					}
-				}
+			FCollisionLayerMask Mask = 0;
 
-				break;
-			}
-			case ECollisionType::Square:
+			for (const std::string& OtherLayerName : FStringHelpers::SplitString(CollidesWithIniField.GetValueAsString(), ','))
 			{
-				switch (CollisionB->GetCollisionType())
+				const FCollisionLayerMask OtherLayer = GetCollisionLayerMask(OtherLayerName);
+				if (OtherLayer == 0)
 				{
-					case ECollisionType::Circle:
-					{
-						const FRectangleWithDiagonal& RectangleData = dynamic_cast<FSquareCollision*>(CollisionA)->GetSquareData();
-						const FCircle& CircleData = dynamic_cast<FCircleCollision*>(CollisionB)->GetCircleData();
-
-						bIsIntersecting = FCollisionGlobals::CircleAndSquareIntersect(RectangleData, CircleData);
-
-						break;
-					}
-					case ECollisionType::Square:
-					{
-						const FRectangleWithDiagonal& RectangleDataA = dynamic_cast<FSquareCollision*>(CollisionA)->GetSquareData();
-						const FRectangleWithDiagonal& RectangleDataB = dynamic_cast<FSquareCollision*>(CollisionB)->GetSquareData();
-
-						bIsIntersecting = FCollisionGlobals::RectanglesIntersect(RectangleDataA, RectangleDataB);
-
-						break;
-					}
-					case ECollisionType::Other:
-					{
-						LOG_ERROR("ECollisionType::Other found (#Square). Collision will not work in this case.");
-
-						break;
-					}
+					LOG_WARN("Unknown collision layer: " << OtherLayerName << " in " << LayerName << "CollidesWith.");
 				}
 
-				break;
+				Mask |= OtherLayer;
 			}
-			case ECollisionType::Other:
-			{
-				LOG_ERROR("ECollisionType::Other found. Collision will not work in this case.");
 
-				break;
-			}
+			CollisionLayerFilters[LayerName].Mask = Mask;
 		}
 	}
 
-	return bIsIntersecting;
+	LOG_INFO("Collision layers from ini: " << CollisionLayersIniField.GetValueAsString());
 }
 
-CArray<FCollisionTile*> FCollisionManager::GetTilesFromCollision(FCollisionBase* InCollision)
+void FCollisionManager::CreateBroadphase()
 {
-	CArray<FCollisionTile*> OutTiles;
-
-	switch (InCollision->GetCollisionType())
+	switch (BroadphaseType)
 	{
-		case ECollisionType::Circle:
+		case ECollisionBroadphaseType::Grid:
 		{
-			FCircleCollision* CircleCollision = dynamic_cast<FCircleCollision*>(InCollision);
-			const FCircle& CircleCollisionData = CircleCollision->GetCircleData();
-			OutTiles = GetTilesIntersectingCircle(CircleCollisionData.GetLocation(), CircleCollisionData.GetRadius());
+			// Objects outside of map are kept in border cells, so grid without map still works (slowly)
+			FVector2D<int> WorldSize;
 
-			break;
-		}
-		case ECollisionType::Square:
-		{
-			FSquareCollision* SquareCollision = dynamic_cast<FSquareCollision*>(InCollision);
-			const FRectangleWithDiagonal& FRectangleWithDiagonalData = SquareCollision->GetSquareData();
-			OutTiles = GetTilesIntersectingRectangle(FRectangleWithDiagonalData.GetPositionTopLeft(), FRectangleWithDiagonalData.GetSize());
+			FMap* CurrentMap = dynamic_cast<FMap*>(GetSubSystemParentInterface());
+			if (CurrentMap != nullptr)
+			{
+				WorldSize = CurrentMap->GetMapSizeInPixels();
+			}
+
+			Broadphase = std::make_shared<FGridBroadphase>(CollisionTileSize, WorldSize);
+
+			LOG_INFO("Collision broadphase: Grid.");
 
 			break;
 		}
-		case ECollisionType::Other:
+		case ECollisionBroadphaseType::AABBTree:
 		{
-			OutTiles = GetTilesIntersectingCustomType(InCollision);
+			Broadphase = std::make_shared<FAABBTreeBroadphase>(AABBTreeFatMargin);
+
+			LOG_INFO("Collision broadphase: AABBTree.");
 
 			break;
 		}
 	}
 
-	// Remove duplicates
-	OutTiles.RemoveDuplicates();
+	CollisionQuery = std::make_shared<FCollisionQuery>(Broadphase.get());
+}
 
-	return OutTiles;
+void FCollisionManager::AddToBroadphase(FCollisionBase* InCollision)
+{
+	InCollision->BroadphaseProxyId = Broadphase->CreateProxy(GetCollisionBounds(InCollision), InCollision, InCollision->GetCollisionFilter());
 }
 
-CArray<FCollisionTile*> FCollisionManager::GetTilesIntersectingRectangle(const FVector2D<int>& InLocation, const FVector2D<int>& InSize) const
+void FCollisionManager::UpdateCollisionPairs()
 {
-	CArray<FCollisionTile*> OutTiles;
+	NarrowphasePairs.Clear();
+	NarrowphasePairKeys.Clear();
+	DisabledContactKeys.Clear();
+
+	// Existing contacts of moved objects, broadphase only reports pairs
+	for (FCollisionBase* MovedCollision : MovedCollisions)
+	{
+		MovedCollision->bIsMovedSinceUpdate = false;
+
+		const bool bIsMovedCollisionEnabled = IsCollisionEnabled(MovedCollision);
+
+		for (FCollisionBase* OtherCollider : MovedCollision->OtherCollidersCurrentlyColliding)
+		{
+			const uint64 ContactKey = GetContactKey(MovedCollision, OtherCollider);
+
+			FCollisionContact& Contact = ContactCache[ContactKey];
+
+			// Both objects moved, contact was added by other object
+			if (Contact.LastUpdateTick == CollisionTick)
+			{
+				continue;
+			}
+
+			Contact.LastUpdateTick = CollisionTick;
+
+			// Filter might have changed since contact began
+			if (bIsMovedCollisionEnabled && IsCollisionEnabled(OtherCollider) && MovedCollision->GetCollisionFilter().CanCollide(OtherCollider->GetCollisionFilter()))
+			{
+				NarrowphasePairs.Push(FCollisionNarrowphasePair(Contact.CollisionA, Contact.CollisionB));
+				NarrowphasePairKeys.Push(ContactKey);
+			}
+			else
+			{
+				DisabledContactKeys.Push(ContactKey);
+			}
+		}
+	}
+
+	MovedCollisions.Clear();
+
+	NumberOfContactNarrowphasePairs = NarrowphasePairs.Size();
+
+	// Pairs are sorted and unique, so each begin is called once and always in same order
+	Broadphase->UpdatePairs(BroadphasePairs);
 
-	if (InSize > CollisionTileSize)
+	for (const FBroadphasePair& Pair : BroadphasePairs)
 	{
-		LOG_WARN("Custom logic is required for Objects greater than single CollisionTile. #1");
+		const uint64 ContactKey = Pair.GetKey();
+
+		// Existing contacts were already added above
+		if (ContactCache.ContainsKey(ContactKey))
+		{
+			continue;
+		}
+
+		FCollisionBase* CollisionA = Broadphase->GetCollision(Pair.ProxyA);
+		FCollisionBase* CollisionB = Broadphase->GetCollision(Pair.ProxyB);
+
+		if (CollisionA != nullptr && CollisionB != nullptr && IsCollisionEnabled(CollisionA) && IsCollisionEnabled(CollisionB))
+		{
+			NarrowphasePairs.Push(FCollisionNarrowphasePair(CollisionA, CollisionB));
+			NarrowphasePairKeys.Push(ContactKey);
+		}
 	}
 
-	const FVector2D<int> RelativeLocation = InLocation;
+	// Circles and squares are checked in batches by kernels, only custom types reach callback
+	Narrowphase->FindIntersectingShapes(NarrowphasePairs, [this](FCollisionBase* CollisionA, FCollisionBase* CollisionB)
+	{
+		return IsIntersectingCustomTypes(CollisionA, CollisionB);
+	}, IntersectingPairIndexes);
 
-	// Find edge locations and add to @OutTiles
-	CArray<FVector2D<int>> RectangleEdgeLocations;
-	RectangleEdgeLocations.Push({ RelativeLocation.X, RelativeLocation.Y });
-	RectangleEdgeLocations.Push({ RelativeLocation.X + InSize.X, RelativeLocation.Y });
-	RectangleEdgeLocations.Push({ RelativeLocation.X, RelativeLocation.Y + InSize.Y });
-	RectangleEdgeLocations.Push(RelativeLocation + InSize);
+	// Callbacks on main thread, in order of pairs
+	for (const uint64 ContactKey : DisabledContactKeys)
+	{
+		if (ContactCache.ContainsKey(ContactKey))
+		{
+			EndContact(ContactKey);
+		}
+	}
 
-	for (const FVector2D<int>& RectangleEdgeLocation : RectangleEdgeLocations)
+	int32 IntersectingIndex = 0;
+	for (int32 PairIndex = 0; PairIndex < NarrowphasePairs.Size(); PairIndex++)
 	{
-		const FVector2D<float> TileLocation = FVector2D<float>(RectangleEdgeLocation) / FVector2D<float>(CollisionTileSize);
-		FVector2D<int> TileLocationInt;
+		const bool bIsPairIntersecting = (IntersectingIndex < IntersectingPairIndexes.Size() && IntersectingPairIndexes[IntersectingIndex] == PairIndex);
+		if (bIsPairIntersecting)
+		{
+			IntersectingIndex++;
+		}
 
-		TileLocationInt.X = FMath::FloorToInt(TileLocation.X);
-		TileLocationInt.Y = FMath::FloorToInt(TileLocation.Y);
+		const uint64 ContactKey = NarrowphasePairKeys[PairIndex];
 
-		if (CollisionRows.IsValidIndex(TileLocationInt.Y))
+		if (PairIndex < NumberOfContactNarrowphasePairs)
 		{
-			FCollisionMeshRow* Row = CollisionRows[TileLocationInt.Y];
-			if (Row->CollisionTiles.IsValidIndex(TileLocationInt.X))
+			// Contact might have been ended by callback
+			if (ContactCache.ContainsKey(ContactKey))
 			{
-				FCollisionTile* Tile = Row->CollisionTiles[TileLocationInt.X];
+				if (bIsPairIntersecting)
+				{
+					StayContact(ContactKey);
+				}
+				else
+				{
+					EndContact(ContactKey);
+				}
+			}
+		}
+		else if (bIsPairIntersecting)
+		{
+			const FCollisionNarrowphasePair& Pair = NarrowphasePairs[PairIndex];
 
-				OutTiles.Push(Tile);
+			// Earlier callback might have unregistered or disabled one of collisions
+			if (Pair.CollisionA->BroadphaseProxyId != INDEX_NONE && Pair.CollisionB->BroadphaseProxyId != INDEX_NONE
+				&& IsCollisionEnabled(Pair.CollisionA) && IsCollisionEnabled(Pair.CollisionB))
+			{
+				BeginContact(ContactKey, Pair.CollisionA, Pair.CollisionB);
 			}
 		}
 	}
+}
 
-	return OutTiles;
+const FCollisionContact* FCollisionManager::FindContact(FCollisionBase* CollisionA, FCollisionBase* CollisionB) const
+{
+	if (CollisionA->BroadphaseProxyId == INDEX_NONE || CollisionB->BroadphaseProxyId == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	const auto ContactIterator = ContactCache.Map.find(GetContactKey(CollisionA, CollisionB));
+
+	return (ContactIterator != ContactCache.Map.end()) ? &ContactIterator->second : nullptr;
 }
 
-CArray<FCollisionTile*> FCollisionManager::GetTilesIntersectingCircle(const FVector2D<int>& InLocation, const int InRadius) const
+void FCollisionManager::OverlapCircle(const FVector2D<int>& InLocation, const int InRadius, const FCollisionLayerMask LayerMask, CArray<FCollisionBase*>& OutCollisions) const
 {
-	CArray<FCollisionTile*> OutTiles;
+	if (CollisionQuery != nullptr)
+	{
+		CollisionQuery->OverlapCircle(InLocation, InRadius, FCollisionQueryFilter(LayerMask), OutCollisions);
+	}
+	else
+	{
+		OutCollisions.Clear();
+	}
+}
 
-	if (InRadius > static_cast<int>(CollisionTileSize.Magnitude()))
+void FCollisionManager::OverlapRectangle(const FVector2D<int>& InTopLeft, const FVector2D<int>& InSize, const FCollisionLayerMask LayerMask, CArray<FCollisionBase*>& OutCollisions) const
+{
+	if (CollisionQuery != nullptr)
+	{
+		CollisionQuery->OverlapRectangle(InTopLeft, InSize, FCollisionQueryFilter(LayerMask), OutCollisions);
+	}
+	else
 	{
-		LOG_WARN("Custom logic is required for Objects greater than single CollisionTile. #2");
+		OutCollisions.Clear();
 	}
+}
 
-	// Create Rectangle of circle size to find tiles using rectangle function
-	const FVector2D<int> RectangleTopLeft = InLocation - FVector2D<int>(InRadius, InRadius);
-	const FVector2D<int> RectangleSize = { InRadius * 2 };
+bool FCollisionManager::RaycastFirst(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, const FCollisionLayerMask LayerMask, FCollisionRayHit& OutHit) const
+{
+	if (CollisionQuery != nullptr)
+	{
+		return CollisionQuery->RaycastFirst(InStart, InEnd, FCollisionQueryFilter(LayerMask), OutHit);
+	}
+
+	OutHit = FCollisionRayHit();
 
-	OutTiles = GetTilesIntersectingRectangle(RectangleTopLeft, RectangleSize);
+	return false;
+}
 
-	return OutTiles;
+void FCollisionManager::RaycastAll(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, const FCollisionLayerMask LayerMask, CArray<FCollisionRayHit>& OutHits) const
+{
+	if (CollisionQuery != nullptr)
+	{
+		CollisionQuery->RaycastAll(InStart, InEnd, FCollisionQueryFilter(LayerMask), OutHits);
+	}
+	else
+	{
+		OutHits.Clear();
+	}
+}
+
+void FCollisionManager::FindNearest(const FVector2D<int>& InLocation, const int32 MaxCount, const float MaxDistance, const FCollisionLayerMask LayerMask, CArray<FCollisionNearestResult>& OutResults) const
+{
+	if (CollisionQuery != nullptr)
+	{
+		CollisionQuery->FindNearest(InLocation, MaxCount, MaxDistance, FCollisionQueryFilter(LayerMask), OutResults);
+	}
+	else
+	{
+		OutResults.Clear();
+	}
+}
+
+bool FCollisionManager::IsCollisionEnabled(const FCollisionBase* InCollision)
+{
+	return InCollision->GetCollisionComponent()->IsCollisionEnabled();
 }
 
 bool FCollisionManager::IsIntersectingCustomTypes(FCollisionBase* CollisionA, FCollisionBase* CollisionB)
@@ -503,32 +559,89 @@ bool FCollisionManager::IsIntersectingCustomTypes(FCollisionBase* CollisionA, FC
 	return false;
 }
 
-CArray<FCollisionTile*> FCollisionManager::GetTilesIntersectingCustomType(FCollisionBase* Collision)
+FCollisionAABB FCollisionManager::GetCustomTypeBounds(FCollisionBase* InCollision) const
 {
+	LOG_WARN("Detected unsupported collision type, it will not be found by broadphase.");
+
 	return { };
 }
 
-void FCollisionManager::OnCollisionBegin(FCollisionBase* CollisionA, FCollisionBase* CollisionB)
+void FCollisionManager::BeginContact(const uint64 ContactKey, FCollisionBase* CollisionA, FCollisionBase* CollisionB)
 {
+	FCollisionContact Contact;
+	Contact.CollisionA = CollisionA;
+	Contact.CollisionB = CollisionB;
+	Contact.BeginTick = CollisionTick;
+	Contact.LastUpdateTick = CollisionTick;
+
+	ContactCache.Emplace(ContactKey, Contact);
+
 	CollisionA->OtherCollidersCurrentlyColliding.Push(CollisionB);
 	CollisionB->OtherCollidersCurrentlyColliding.Push(CollisionA);
 
 	CollisionA->GetCollisionComponent()->OnCollisionBegin(CollisionB->GetCollisionComponent());
+	if (!ContactCache.ContainsKey(ContactKey))
+	{
+		return;
+	}
+
 	CollisionB->GetCollisionComponent()->OnCollisionBegin(CollisionA->GetCollisionComponent());
+	if (!ContactCache.ContainsKey(ContactKey))
+	{
+		return;
+	}
+
+	OnContactBegin.Execute(Contact);
+}
+
+void FCollisionManager::StayContact(const uint64 ContactKey)
+{
+	// Copy, contact in cache is removed if callback ends it
+	const FCollisionContact Contact = ContactCache[ContactKey];
+
+	Contact.CollisionA->GetCollisionComponent()->OnCollisionStay(Contact.CollisionB->GetCollisionComponent());
+	if (!ContactCache.ContainsKey(ContactKey))
+	{
+		return;
+	}
+
+	Contact.CollisionB->GetCollisionComponent()->OnCollisionStay(Contact.CollisionA->GetCollisionComponent());
+	if (!ContactCache.ContainsKey(ContactKey))
+	{
+		return;
+	}
+
+	OnContactStay.Execute(Contact);
 }
 
-void FCollisionManager::OnCollisionEnd(FCollisionBase* InCollision)
+void FCollisionManager::EndContact(const uint64 ContactKey)
 {
-	for (FCollisionBase* OtherCollider : InCollision->OtherCollidersCurrentlyColliding)
+	// Copy, contact is removed before callbacks so they can safely move or unregister collision
+	const FCollisionContact Contact = ContactCache[ContactKey];
+	ContactCache.Remove(ContactKey);
+
+	Contact.CollisionA->OtherCollidersCurrentlyColliding.Remove(Contact.CollisionB);
+	Contact.CollisionB->OtherCollidersCurrentlyColliding.Remove(Contact.CollisionA);
+
+	Contact.CollisionA->GetCollisionComponent()->OnCollisionEnd(Contact.CollisionB->GetCollisionComponent());
+	Contact.CollisionB->GetCollisionComponent()->OnCollisionEnd(Contact.CollisionA->GetCollisionComponent());
+
+	OnContactEnd.Execute(Contact);
+}
+
+void FCollisionManager::EndAllContacts(FCollisionBase* InCollision)
+{
+	while (!InCollision->OtherCollidersCurrentlyColliding.IsEmpty())
 	{
-		// Before removing collision we should find previous intersections and call on end of intersections?
-		InCollision->GetCollisionComponent()->OnCollisionEnd(OtherCollider->GetCollisionComponent());
-		OtherCollider->GetCollisionComponent()->OnCollisionEnd(InCollision->GetCollisionComponent());
+		FCollisionBase* OtherCollider = InCollision->OtherCollidersCurrentlyColliding[InCollision->OtherCollidersCurrentlyColliding.GetLastIndex()];
 
-		OtherCollider->OtherCollidersCurrentlyColliding.Remove(InCollision);
+		EndContact(GetContactKey(InCollision, OtherCollider));
 	}
+}
 
-	InCollision->OtherCollidersCurrentlyColliding.Clear();
+uint64 FCollisionManager::GetContactKey(const FCollisionBase* CollisionA, const FCollisionBase* CollisionB)
+{
+	return FBroadphasePair(CollisionA->BroadphaseProxyId, CollisionB->BroadphaseProxyId).GetKey();
 }
 
 bool FCollisionGlobals::RectanglesIntersect(const FRectangleWithDiagonal& RectangleA, const FRectangleWithDiagonal& RectangleB)
@@ -549,10 +662,12 @@ bool FCollisionGlobals::CirclesIntersect(const FCircle& CircleA, const FCircle&
 	const FVector2D<int> CircleALocation = CircleA.GetLocation();
 	const FVector2D<int> CircleBLocation = CircleB.GetLocation();
 
-	const int Distance = CircleALocation.DistanceTo(CircleBLocation);
-	const int SummaryRadius = CircleA.GetRadius() + CircleB.GetRadius();
+	// Squared distance avoids sqrt, int64 avoids overflow of squares
+	const int64 DistanceX = static_cast<int64>(CircleBLocation.X) - CircleALocation.X;
+	const int64 DistanceY = static_cast<int64>(CircleBLocation.Y) - CircleALocation.Y;
+	const int64 SummaryRadius = static_cast<int64>(CircleA.GetRadius()) + CircleB.GetRadius();
 
-	return (SummaryRadius > Distance);
+	return (SummaryRadius * SummaryRadius) > (DistanceX * DistanceX + DistanceY * DistanceY);
 }
 
 bool FCollisionGlobals::CircleAndSquareIntersect(const FRectangleWithDiagonal& Rectangle, const FCircle& Circle)
@@ -567,11 +682,12 @@ bool FCollisionGlobals::CircleAndSquareIntersect(const FRectangleWithDiagonal& R
 	const int ClosestY = std::max(RectPositionTopLeft.Y, std::min(CircleLocation.Y, RectPositionBottomRight.Y));
 
 	// Calculate the distance between the circle's center and this closest point 
-	const int DistanceX = CircleLocation.X - ClosestX;
-	const int DistanceY = CircleLocation.Y - ClosestY;
+	const int64 DistanceX = static_cast<int64>(CircleLocation.X) - ClosestX;
+	const int64 DistanceY = static_cast<int64>(CircleLocation.Y) - ClosestY;
 
 	// If the distance is less than the circle's radius, there is an intersection 
-	const int DistanceSquared = (DistanceX * DistanceX) + (DistanceY * DistanceY);
+	const int64 DistanceSquared = (DistanceX * DistanceX) + (DistanceY * DistanceY);
+	const int64 Radius = Circle.GetRadius();
 
-	return DistanceSquared < (Circle.GetRadius() * Circle.GetRadius());
+	return DistanceSquared < (Radius * Radius);
 }
@@ -0,0 +1,229 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Collision/CollisionNarrowphase.h"
+
+#include "ECS/Collision/CircleCollision.h"
+#include "ECS/Collision/CollisionManager.h"
+#include "ECS/Collision/SquareCollision.h"
+
+void FCollisionNarrowphaseBatchData::Clear()
+{
+	CirclesA.Clear();
+	CirclesB.Clear();
+	CirclePairIndexes.Clear();
+
+	MixedCircles.Clear();
+	MixedRectangles.Clear();
+	MixedPairIndexes.Clear();
+
+	RectanglesA.Clear();
+	RectanglesB.Clear();
+	RectanglePairIndexes.Clear();
+
+	PairResults.Clear();
+}
+
+FCollisionNarrowphase::FCollisionNarrowphase(FThreadsManager* InThreadsManager)
+	: MinPairsForParallel(DefaultMinPairsForParallel)
+{
+	if (InThreadsManager != nullptr)
+	{
+		TaskGraph = std::make_shared<FTaskGraph>(InThreadsManager);
+	}
+}
+
+bool FCollisionNarrowphase::IsIntersecting(FCollisionBase* CollisionA, FCollisionBase* CollisionB)
+{
+	// Called from workers, so custom types are not logged here
+	bool bIsIntersecting = false;
+
+	switch (CollisionA->GetCollisionType())
+	{
+		case ECollisionType::Circle:
+		{
+			switch (CollisionB->GetCollisionType())
+			{
+				case ECollisionType::Circle:
+				{
+					const FCircle& CircleDataA = static_cast<FCircleCollision*>(CollisionA)->GetCircleData();
+					const FCircle& CircleDataB = static_cast<FCircleCollision*>(CollisionB)->GetCircleData();
+
+					bIsIntersecting = FCollisionGlobals::CirclesIntersect(CircleDataA, CircleDataB);
+
+					break;
+				}
+				case ECollisionType::Square:
+				{
+					const FCircle& CircleData = static_cast<FCircleCollision*>(CollisionA)->GetCircleData();
+					const FRectangleWithDiagonal& RectangleData = static_cast<FSquareCollision*>(CollisionB)->GetSquareData();
+
+					bIsIntersecting = FCollisionGlobals::CircleAndSquareIntersect(RectangleData, CircleData);
+
+					break;
+				}
+				case ECollisionType::Other:
+				{
+					break;
+				}
+			}
+
+			break;
+		}
+		case ECollisionType::Square:
+		{
+			switch (CollisionB->GetCollisionType())
+			{
+				case ECollisionType::Circle:
+				{
+					const FRectangleWithDiagonal& RectangleData = static_cast<FSquareCollision*>(CollisionA)->GetSquareData();
+					const FCircle& CircleData = static_cast<FCircleCollision*>(CollisionB)->GetCircleData();
+
+					bIsIntersecting = FCollisionGlobals::CircleAndSquareIntersect(RectangleData, CircleData);
+
+					break;
+				}
+				case ECollisionType::Square:
+				{
+					const FRectangleWithDiagonal& RectangleDataA = static_cast<FSquareCollision*>(CollisionA)->GetSquareData();
+					const FRectangleWithDiagonal& RectangleDataB = static_cast<FSquareCollision*>(CollisionB)->GetSquareData();
+
+					bIsIntersecting = FCollisionGlobals::RectanglesIntersect(RectangleDataA, RectangleDataB);
+
+					break;
+				}
+				case ECollisionType::Other:
+				{
+					break;
+				}
+			}
+
+			break;
+		}
+		case ECollisionType::Other:
+		{
+			break;
+		}
+	}
+
+	return bIsIntersecting;
+}
+
+void FCollisionNarrowphase::CheckShapesWithKernels(const CArray<FCollisionNarrowphasePair>& InPairs, const int32 FirstPairIndex, const int32 EndPairIndex, FCollisionNarrowphaseBatchData& BatchData)
+{
+	BatchData.Clear();
+
+	for (int32 PairIndex = FirstPairIndex; PairIndex < EndPairIndex; PairIndex++)
+	{
+		FCollisionBase* CollisionA = InPairs[PairIndex].CollisionA;
+		FCollisionBase* CollisionB = InPairs[PairIndex].CollisionB;
+
+		const ECollisionType CollisionTypeA = CollisionA->GetCollisionType();
+		const ECollisionType CollisionTypeB = CollisionB->GetCollisionType();
+		const int32 BatchPairIndex = PairIndex - FirstPairIndex;
+
+		ECollisionNarrowphasePairResult PairResult = ECollisionNarrowphasePairResult::Unchecked;
+		bool bIsAddedToKernels = false;
+
+		// Shapes are added relative to first shape of pair, see FCollisionKernels::Is*Exact
+		if (CollisionTypeA == ECollisionType::Circle && CollisionTypeB == ECollisionType::Circle)
+		{
+			const FCircle& CircleDataA = static_cast<FCircleCollision*>(CollisionA)->GetCircleData();
+			const FCircle& CircleDataB = static_cast<FCircleCollision*>(CollisionB)->GetCircleData();
+
+			const int64 DistanceX = static_cast<int64>(CircleDataB.GetLocation().X) - CircleDataA.GetLocation().X;
+			const int64 DistanceY = static_cast<int64>(CircleDataB.GetLocation().Y) - CircleDataA.GetLocation().Y;
+
+			if (FCollisionKernels::IsExactDistance(DistanceX) && FCollisionKernels::IsExactDistance(DistanceY) &&
+				FCollisionKernels::IsExactDistance(static_cast<int64>(CircleDataA.GetRadius()) + CircleDataB.GetRadius()))
+			{
+				BatchData.CirclesA.Add(0.f, 0.f, static_cast<float>(CircleDataA.GetRadius()));
+				BatchData.CirclesB.Add(static_cast<float>(DistanceX), static_cast<float>(DistanceY), static_cast<float>(CircleDataB.GetRadius()));
+				BatchData.CirclePairIndexes.Push(BatchPairIndex);
+
+				bIsAddedToKernels = true;
+			}
+		}
+		else if (CollisionTypeA == ECollisionType::Square && CollisionTypeB == ECollisionType::Square)
+		{
+			const FRectangleWithDiagonal& RectangleDataA = static_cast<FSquareCollision*>(CollisionA)->GetSquareData();
+			const FRectangleWithDiagonal& RectangleDataB = static_cast<FSquareCollision*>(CollisionB)->GetSquareData();
+
+			const FVector2D<int>& OriginA = RectangleDataA.GetPositionTopLeft();
+			const FVector2D<int>& BottomRightA = RectangleDataA.GetPositionBottomRight();
+			const FVector2D<int>& TopLeftB = RectangleDataB.GetPositionTopLeft();
+			const FVector2D<int>& BottomRightB = RectangleDataB.GetPositionBottomRight();
+
+			const int64 MaxXA = static_cast<int64>(BottomRightA.X) - OriginA.X;
+			const int64 MaxYA = static_cast<int64>(BottomRightA.Y) - OriginA.Y;
+			const int64 MinXB = static_cast<int64>(TopLeftB.X) - OriginA.X;
+			const int64 MinYB = static_cast<int64>(TopLeftB.Y) - OriginA.Y;
+			const int64 MaxXB = static_cast<int64>(BottomRightB.X) - OriginA.X;
+			const int64 MaxYB = static_cast<int64>(BottomRightB.Y) - OriginA.Y;
+
+			if (FCollisionKernels::IsExactCoordinate(MaxXA) && FCollisionKernels::IsExactCoordinate(MaxYA) &&
+				FCollisionKernels::IsExactCoordinate(MinXB) && FCollisionKernels::IsExactCoordinate(MinYB) &&
+				FCollisionKernels::IsExactCoordinate(MaxXB) && FCollisionKernels::IsExactCoordinate(MaxYB))
+			{
+				BatchData.RectanglesA.Add(0.f, 0.f, static_cast<float>(MaxXA), static_cast<float>(MaxYA));
+				BatchData.RectanglesB.Add(static_cast<float>(MinXB), static_cast<float>(MinYB), static_cast<float>(MaxXB), static_cast<float>(MaxYB));
+				BatchData.RectanglePairIndexes.Push(BatchPairIndex);
+
+				bIsAddedToKernels = true;
+			}
+		}
+		else if (CollisionTypeA != ECollisionType::Other && CollisionTypeB != ECollisionType::Other)
+		{
+			FCollisionBase* CircleCollision = (CollisionTypeA == ECollisionType::Circle) ? CollisionA : CollisionB;
+			FCollisionBase* SquareCollision = (CollisionTypeA == ECollisionType::Circle) ? CollisionB : CollisionA;
+
+			const FCircle& CircleData = static_cast<FCircleCollision*>(CircleCollision)->GetCircleData();
+			const FRectangleWithDiagonal& RectangleData = static_cast<FSquareCollision*>(SquareCollision)->GetSquareData();
+
+			const FVector2D<int>& Origin = CircleData.GetLocation();
+			const FVector2D<int>& TopLeft = RectangleData.GetPositionTopLeft();
+			const FVector2D<int>& BottomRight = RectangleData.GetPositionBottomRight();
+
+			const int64 MinX = static_cast<int64>(TopLeft.X) - Origin.X;
+			const int64 MinY = static_cast<int64>(TopLeft.Y) - Origin.Y;
+			const int64 MaxX = static_cast<int64>(BottomRight.X) - Origin.X;
+			const int64 MaxY = static_cast<int64>(BottomRight.Y) - Origin.Y;
+
+			if (FCollisionKernels::IsExactDistance(MinX) && FCollisionKernels::IsExactDistance(MinY) &&
+				FCollisionKernels::IsExactDistance(MaxX) && FCollisionKernels::IsExactDistance(MaxY) &&
+				FCollisionKernels::IsExactDistance(CircleData.GetRadius()))
+			{
+				BatchData.MixedCircles.Add(0.f, 0.f, static_cast<float>(CircleData.GetRadius()));
+				BatchData.MixedRectangles.Add(static_cast<float>(MinX), static_cast<float>(MinY), static_cast<float>(MaxX), static_cast<float>(MaxY));
+				BatchData.MixedPairIndexes.Push(BatchPairIndex);
+
+				bIsAddedToKernels = true;
+			}
+		}
+
+		if (!bIsAddedToKernels && CollisionTypeA != ECollisionType::Other && CollisionTypeB != ECollisionType::Other)
+		{
+			// Rare pairs of far or huge shapes, float would not be exact
+			PairResult = IsIntersecting(CollisionA, CollisionB) ? ECollisionNarrowphasePairResult::Intersecting : ECollisionNarrowphasePairResult::NotIntersecting;
+		}
+
+		BatchData.PairResults.Push(PairResult);
+	}
+
+	auto StoreKernelResults = [&BatchData](const CArray<int32>& BatchPairIndexes)
+	{
+		for (int32 Index = 0; Index < BatchPairIndexes.Size(); Index++)
+		{
+			BatchData.PairResults[BatchPairIndexes[Index]] = (BatchData.KernelResults[Index] != 0) ? ECollisionNarrowphasePairResult::Intersecting : ECollisionNarrowphasePairResult::NotIntersecting;
+		}
+	};
+
+	FCollisionKernels::CirclesAgainstCircles(BatchData.CirclesA, BatchData.CirclesB, BatchData.KernelResults);
+	StoreKernelResults(BatchData.CirclePairIndexes);
+
+	FCollisionKernels::CirclesAgainstRectangles(BatchData.MixedCircles, BatchData.MixedRectangles, BatchData.KernelResults);
+	StoreKernelResults(BatchData.MixedPairIndexes);
+
+	FCollisionKernels::RectanglesAgainstRectangles(BatchData.RectanglesA, BatchData.RectanglesB, BatchData.KernelResults);
+	StoreKernelResults(BatchData.RectanglePairIndexes);
+}
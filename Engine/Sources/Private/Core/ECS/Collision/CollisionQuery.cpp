@@ -0,0 +1,478 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Collision/CollisionQuery.h"
+
+#include "ECS/Collision/CircleCollision.h"
+#include "ECS/Collision/CollisionManager.h"
+#include "ECS/Collision/SquareCollision.h"
+#include "ECS/Components/Collision/CollisionComponent.h"
+
+#include <algorithm>
+
+bool FCollisionQueryFilter::IsPassing(const FCollisionBase* InCollision) const
+{
+	if ((InCollision->GetCollisionLayer() & LayerMask) == 0)
+	{
+		return false;
+	}
+
+	const UCollisionComponent* CollisionComponent = InCollision->GetCollisionComponent();
+
+	return (CollisionComponent == nullptr || CollisionComponent->IsCollisionEnabled());
+}
+
+FCollisionQuery::FCollisionQuery(const ICollisionBroadphaseInterface* InBroadphase)
+	: Broadphase(InBroadphase)
+{
+}
+
+void FCollisionQuery::OverlapCircle(const FVector2D<int>& InLocation, const int InRadius, const FCollisionQueryFilter& InFilter, CArray<FCollisionBase*>& OutCollisions) const
+{
+	OutCollisions.Clear();
+
+	const FCircle Circle(InLocation, InRadius);
+
+	const FCollisionAABB CircleBounds(
+		FVector2D<float>(static_cast<float>(InLocation.X - InRadius), static_cast<float>(InLocation.Y - InRadius)),
+		FVector2D<float>(static_cast<float>(InLocation.X + InRadius), static_cast<float>(InLocation.Y + InRadius))
+	);
+
+	ProxyIdsCache.Clear();
+	Broadphase->Query(CircleBounds, ProxyIdsCache);
+
+	ClearCandidates();
+
+	// Shapes are added relative to query location, so kernels stay exact for any location in world
+	for (const FBroadphaseProxyId ProxyId : ProxyIdsCache)
+	{
+		FCollisionBase* Collision = Broadphase->GetCollision(ProxyId);
+
+		if (!InFilter.IsPassing(Collision))
+		{
+			continue;
+		}
+
+		const int32 CandidateIndex = AddCandidate(Collision);
+
+		switch (Collision->GetCollisionType())
+		{
+			case ECollisionType::Circle:
+			{
+				const FCircle& CircleData = static_cast<FCircleCollision*>(Collision)->GetCircleData();
+
+				if (FCollisionKernels::IsCirclePairExact(Circle, CircleData))
+				{
+					CircleCandidatesCache.Add(CircleData, InLocation);
+					CircleCandidateIndexesCache.Push(CandidateIndex);
+				}
+				else
+				{
+					CandidateResultsCache[CandidateIndex] = IsCircleOverlapping(InLocation, InRadius, Collision) ? 1 : 0;
+				}
+
+				break;
+			}
+			case ECollisionType::Square:
+			{
+				const FRectangleWithDiagonal& RectangleData = static_cast<FSquareCollision*>(Collision)->GetSquareData();
+
+				if (FCollisionKernels::IsCircleAndRectanglePairExact(Circle, RectangleData))
+				{
+					RectangleCandidatesCache.Add(RectangleData, InLocation);
+					RectangleCandidateIndexesCache.Push(CandidateIndex);
+				}
+				else
+				{
+					CandidateResultsCache[CandidateIndex] = IsCircleOverlapping(InLocation, InRadius, Collision) ? 1 : 0;
+				}
+
+				break;
+			}
+			case ECollisionType::Other:
+			{
+				break;
+			}
+		}
+	}
+
+	const FCircle CircleAtOrigin(FVector2D<int>(0, 0), InRadius);
+
+	FCollisionKernels::CircleAgainstCircles(CircleAtOrigin, CircleCandidatesCache, KernelResultsCache);
+	StoreKernelResults(CircleCandidateIndexesCache);
+
+	FCollisionKernels::CircleAgainstRectangles(CircleAtOrigin, RectangleCandidatesCache, KernelResultsCache);
+	StoreKernelResults(RectangleCandidateIndexesCache);
+
+	PushOverlappingCandidates(OutCollisions);
+}
+
+void FCollisionQuery::OverlapRectangle(const FVector2D<int>& InTopLeft, const FVector2D<int>& InSize, const FCollisionQueryFilter& InFilter, CArray<FCollisionBase*>& OutCollisions) const
+{
+	OutCollisions.Clear();
+
+	const FRectangleWithDiagonal Rectangle(InTopLeft, InSize);
+
+	const FCollisionAABB RectangleBounds(FVector2D<float>(Rectangle.GetPositionTopLeft()), FVector2D<float>(Rectangle.GetPositionBottomRight()));
+
+	ProxyIdsCache.Clear();
+	Broadphase->Query(RectangleBounds, ProxyIdsCache);
+
+	ClearCandidates();
+
+	// Shapes are added relative to top left of query, so kernels stay exact for any location in world
+	for (const FBroadphaseProxyId ProxyId : ProxyIdsCache)
+	{
+		FCollisionBase* Collision = Broadphase->GetCollision(ProxyId);
+
+		if (!InFilter.IsPassing(Collision))
+		{
+			continue;
+		}
+
+		const int32 CandidateIndex = AddCandidate(Collision);
+
+		switch (Collision->GetCollisionType())
+		{
+			case ECollisionType::Circle:
+			{
+				const FCircle& CircleData = static_cast<FCircleCollision*>(Collision)->GetCircleData();
+
+				if (FCollisionKernels::IsCircleAndRectanglePairExact(CircleData, Rectangle))
+				{
+					CircleCandidatesCache.Add(CircleData, InTopLeft);
+					CircleCandidateIndexesCache.Push(CandidateIndex);
+				}
+				else
+				{
+					CandidateResultsCache[CandidateIndex] = IsRectangleOverlapping(Rectangle, Collision) ? 1 : 0;
+				}
+
+				break;
+			}
+			case ECollisionType::Square:
+			{
+				const FRectangleWithDiagonal& RectangleData = static_cast<FSquareCollision*>(Collision)->GetSquareData();
+
+				if (FCollisionKernels::IsRectanglePairExact(Rectangle, RectangleData))
+				{
+					RectangleCandidatesCache.Add(RectangleData, InTopLeft);
+					RectangleCandidateIndexesCache.Push(CandidateIndex);
+				}
+				else
+				{
+					CandidateResultsCache[CandidateIndex] = IsRectangleOverlapping(Rectangle, Collision) ? 1 : 0;
+				}
+
+				break;
+			}
+			case ECollisionType::Other:
+			{
+				break;
+			}
+		}
+	}
+
+	const FRectangle RectangleAtOrigin(FVector2D<int>(0, 0), InSize);
+
+	FCollisionKernels::RectangleAgainstCircles(RectangleAtOrigin, CircleCandidatesCache, KernelResultsCache);
+	StoreKernelResults(CircleCandidateIndexesCache);
+
+	FCollisionKernels::RectangleAgainstRectangles(RectangleAtOrigin, RectangleCandidatesCache, KernelResultsCache);
+	StoreKernelResults(RectangleCandidateIndexesCache);
+
+	PushOverlappingCandidates(OutCollisions);
+}
+
+bool FCollisionQuery::RaycastFirst(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, const FCollisionQueryFilter& InFilter, FCollisionRayHit& OutHit) const
+{
+	OutHit = FCollisionRayHit();
+
+	FBroadphaseProxyId HitProxyId = INDEX_NONE;
+
+	ProxyIdsCache.Clear();
+	Broadphase->QuerySegment(InStart, InEnd, ProxyIdsCache);
+
+	for (const FBroadphaseProxyId ProxyId : ProxyIdsCache)
+	{
+		FCollisionBase* Collision = Broadphase->GetCollision(ProxyId);
+
+		float Fraction;
+		if (InFilter.IsPassing(Collision) && RaycastCollision(InStart, InEnd, Collision, Fraction))
+		{
+			// Lower proxy id wins when fractions are same, so result does not depend on broadphase order
+			if (OutHit.Collision == nullptr || Fraction < OutHit.Fraction || (Fraction == OutHit.Fraction && ProxyId < HitProxyId))
+			{
+				HitProxyId = ProxyId;
+				OutHit.Collision = Collision;
+				OutHit.Fraction = Fraction;
+			}
+		}
+	}
+
+	if (OutHit.Collision != nullptr)
+	{
+		OutHit.Location = FVector2D<float>(InStart.X + (InEnd.X - InStart.X) * OutHit.Fraction, InStart.Y + (InEnd.Y - InStart.Y) * OutHit.Fraction);
+
+		return true;
+	}
+
+	return false;
+}
+
+void FCollisionQuery::RaycastAll(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, const FCollisionQueryFilter& InFilter, CArray<FCollisionRayHit>& OutHits) const
+{
+	OutHits.Clear();
+
+	ProxyIdsCache.Clear();
+	Broadphase->QuerySegment(InStart, InEnd, ProxyIdsCache);
+
+	for (const FBroadphaseProxyId ProxyId : ProxyIdsCache)
+	{
+		FCollisionBase* Collision = Broadphase->GetCollision(ProxyId);
+
+		float Fraction;
+		if (InFilter.IsPassing(Collision) && RaycastCollision(InStart, InEnd, Collision, Fraction))
+		{
+			FCollisionRayHit Hit;
+			Hit.Collision = Collision;
+			Hit.Fraction = Fraction;
+			Hit.Location = FVector2D<float>(InStart.X + (InEnd.X - InStart.X) * Fraction, InStart.Y + (InEnd.Y - InStart.Y) * Fraction);
+
+			OutHits.Push(Hit);
+		}
+	}
+
+	std::sort(OutHits.Vector.begin(), OutHits.Vector.end(), [](const FCollisionRayHit& HitA, const FCollisionRayHit& HitB)
+	{
+		return (HitA.Fraction < HitB.Fraction) || (HitA.Fraction == HitB.Fraction && HitA.Collision->GetBroadphaseProxyId() < HitB.Collision->GetBroadphaseProxyId());
+	});
+}
+
+void FCollisionQuery::FindNearest(const FVector2D<int>& InLocation, const int32 MaxCount, const float MaxDistance, const FCollisionQueryFilter& InFilter, CArray<FCollisionNearestResult>& OutResults) const
+{
+	OutResults.Clear();
+
+	if (MaxCount <= 0 || MaxDistance < 0.f)
+	{
+		return;
+	}
+
+	float SearchRadius = FMath::Min(InitialNearestSearchRadius, MaxDistance);
+
+	while (true)
+	{
+		OutResults.Clear();
+
+		const FCollisionAABB SearchBounds(
+			FVector2D<float>(static_cast<float>(InLocation.X) - SearchRadius, static_cast<float>(InLocation.Y) - SearchRadius),
+			FVector2D<float>(static_cast<float>(InLocation.X) + SearchRadius, static_cast<float>(InLocation.Y) + SearchRadius)
+		);
+
+		ProxyIdsCache.Clear();
+		Broadphase->Query(SearchBounds, ProxyIdsCache);
+
+		// Shape closer than search radius always has bounds overlapping search bounds, so collisions found inside of radius are complete
+		for (const FBroadphaseProxyId ProxyId : ProxyIdsCache)
+		{
+			FCollisionBase* Collision = Broadphase->GetCollision(ProxyId);
+
+			if (InFilter.IsPassing(Collision))
+			{
+				const float Distance = GetDistanceToCollision(InLocation, Collision);
+
+				if (Distance >= 0.f && Distance <= SearchRadius)
+				{
+					OutResults.Push(FCollisionNearestResult(Collision, Distance));
+				}
+			}
+		}
+
+		const bool bFoundAll = (ProxyIdsCache.Size() >= Broadphase->GetNumberOfProxies());
+		if (OutResults.Size() >= MaxCount || SearchRadius >= MaxDistance || bFoundAll)
+		{
+			break;
+		}
+
+		SearchRadius = FMath::Min(SearchRadius * 2.f, MaxDistance);
+	}
+
+	std::sort(OutResults.Vector.begin(), OutResults.Vector.end(), [](const FCollisionNearestResult& ResultA, const FCollisionNearestResult& ResultB)
+	{
+		return (ResultA.Distance < ResultB.Distance) || (ResultA.Distance == ResultB.Distance && ResultA.Collision->GetBroadphaseProxyId() < ResultB.Collision->GetBroadphaseProxyId());
+	});
+
+	if (OutResults.Size() > MaxCount)
+	{
+		OutResults.SetNum(MaxCount);
+	}
+}
+
+bool FCollisionQuery::IsCircleOverlapping(const FVector2D<int>& InLocation, const int InRadius, FCollisionBase* InCollision)
+{
+	const FCircle Circle(InLocation, InRadius);
+
+	switch (InCollision->GetCollisionType())
+	{
+		case ECollisionType::Circle:
+		{
+			return FCollisionGlobals::CirclesIntersect(Circle, static_cast<FCircleCollision*>(InCollision)->GetCircleData());
+		}
+		case ECollisionType::Square:
+		{
+			return FCollisionGlobals::CircleAndSquareIntersect(static_cast<FSquareCollision*>(InCollision)->GetSquareData(), Circle);
+		}
+		case ECollisionType::Other:
+		{
+			break;
+		}
+	}
+
+	return false;
+}
+
+bool FCollisionQuery::IsRectangleOverlapping(const FRectangleWithDiagonal& InRectangle, FCollisionBase* InCollision)
+{
+	switch (InCollision->GetCollisionType())
+	{
+		case ECollisionType::Circle:
+		{
+			return FCollisionGlobals::CircleAndSquareIntersect(InRectangle, static_cast<FCircleCollision*>(InCollision)->GetCircleData());
+		}
+		case ECollisionType::Square:
+		{
+			return FCollisionGlobals::RectanglesIntersect(InRectangle, static_cast<FSquareCollision*>(InCollision)->GetSquareData());
+		}
+		case ECollisionType::Other:
+		{
+			break;
+		}
+	}
+
+	return false;
+}
+
+bool FCollisionQuery::RaycastCollision(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, FCollisionBase* InCollision, float& OutFraction)
+{
+	switch (InCollision->GetCollisionType())
+	{
+		case ECollisionType::Circle:
+		{
+			const FCircle& Circle = static_cast<FCircleCollision*>(InCollision)->GetCircleData();
+
+			const float Radius = static_cast<float>(Circle.GetRadius());
+			const float DeltaX = InEnd.X - InStart.X;
+			const float DeltaY = InEnd.Y - InStart.Y;
+			const float FromCenterX = InStart.X - static_cast<float>(Circle.GetLocation().X);
+			const float FromCenterY = InStart.Y - static_cast<float>(Circle.GetLocation().Y);
+
+			// Solve |Start + Delta * Fraction - Center|^2 = Radius^2
+			const float A = DeltaX * DeltaX + DeltaY * DeltaY;
+			const float B = 2.f * (FromCenterX * DeltaX + FromCenterY * DeltaY);
+			const float C = FromCenterX * FromCenterX + FromCenterY * FromCenterY - Radius * Radius;
+
+			if (C <= 0.f)
+			{
+				// Starts inside
+				OutFraction = 0.f;
+
+				return true;
+			}
+
+			const float Discriminant = B * B - 4.f * A * C;
+			if (A == 0.f || Discriminant < 0.f)
+			{
+				return false;
+			}
+
+			OutFraction = (-B - std::sqrt(Discriminant)) / (2.f * A);
+
+			return (OutFraction >= 0.f && OutFraction <= 1.f);
+		}
+		case ECollisionType::Square:
+		{
+			const FRectangleWithDiagonal& Rectangle = static_cast<FSquareCollision*>(InCollision)->GetSquareData();
+
+			const FCollisionAABB RectangleBounds(FVector2D<float>(Rectangle.GetPositionTopLeft()), FVector2D<float>(Rectangle.GetPositionBottomRight()));
+
+			return RectangleBounds.ClipSegment(InStart, InEnd, OutFraction);
+		}
+		case ECollisionType::Other:
+		{
+			break;
+		}
+	}
+
+	return false;
+}
+
+float FCollisionQuery::GetDistanceToCollision(const FVector2D<int>& InLocation, FCollisionBase* InCollision)
+{
+	switch (InCollision->GetCollisionType())
+	{
+		case ECollisionType::Circle:
+		{
+			const FCircle& Circle = static_cast<FCircleCollision*>(InCollision)->GetCircleData();
+
+			const float DistanceX = static_cast<float>(InLocation.X - Circle.GetLocation().X);
+			const float DistanceY = static_cast<float>(InLocation.Y - Circle.GetLocation().Y);
+
+			return FMath::Max(std::sqrt(DistanceX * DistanceX + DistanceY * DistanceY) - static_cast<float>(Circle.GetRadius()), 0.f);
+		}
+		case ECollisionType::Square:
+		{
+			const FRectangleWithDiagonal& Rectangle = static_cast<FSquareCollision*>(InCollision)->GetSquareData();
+
+			const int ClosestX = FMath::Max(Rectangle.GetPositionTopLeft().X, FMath::Min(InLocation.X, Rectangle.GetPositionBottomRight().X));
+			const int ClosestY = FMath::Max(Rectangle.GetPositionTopLeft().Y, FMath::Min(InLocation.Y, Rectangle.GetPositionBottomRight().Y));
+
+			const float DistanceX = static_cast<float>(InLocation.X - ClosestX);
+			const float DistanceY = static_cast<float>(InLocation.Y - ClosestY);
+
+			return std::sqrt(DistanceX * DistanceX + DistanceY * DistanceY);
+		}
+		case ECollisionType::Other:
+		{
+			break;
+		}
+	}
+
+	return -1.f;
+}
+
+void FCollisionQuery::ClearCandidates() const
+{
+	CandidatesCache.Clear();
+	CandidateResultsCache.Clear();
+	CircleCandidatesCache.Clear();
+	CircleCandidateIndexesCache.Clear();
+	RectangleCandidatesCache.Clear();
+	RectangleCandidateIndexesCache.Clear();
+}
+
+int32 FCollisionQuery::AddCandidate(FCollisionBase* InCollision) const
+{
+	CandidatesCache.Push(InCollision);
+	CandidateResultsCache.Push(static_cast<uint8>(0));
+
+	return CandidatesCache.GetLastIndex();
+}
+
+void FCollisionQuery::StoreKernelResults(const CArray<int32>& InCandidateIndexes) const
+{
+	for (int32 Index = 0; Index < InCandidateIndexes.Size(); Index++)
+	{
+		CandidateResultsCache[InCandidateIndexes[Index]] = KernelResultsCache[Index];
+	}
+}
+
+void FCollisionQuery::PushOverlappingCandidates(CArray<FCollisionBase*>& OutCollisions) const
+{
+	for (int32 CandidateIndex = 0; CandidateIndex < CandidatesCache.Size(); CandidateIndex++)
+	{
+		if (CandidateResultsCache[CandidateIndex] != 0)
+		{
+			OutCollisions.Push(CandidatesCache[CandidateIndex]);
+		}
+	}
+}
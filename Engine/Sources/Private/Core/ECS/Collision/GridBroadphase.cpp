@@ -0,0 +1,288 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Collision/GridBroadphase.h"
+
+FGridBroadphase::FGridBroadphase(const FVector2D<int>& InCellSize, const FVector2D<int>& InWorldSize)
+	: CellSize(FMath::Max(InCellSize.X, 1), FMath::Max(InCellSize.Y, 1))
+	, NumberOfProxies(0)
+	, CurrentQueryStamp(0)
+{
+	// Add 1 to each axis because otherwise we might be missing one cell (half cell for example) at end if world size does not perfectly divide into grid
+	NumberOfCellsX = FMath::Max(InWorldSize.X, 0) / CellSize.X + 1;
+	NumberOfCellsY = FMath::Max(InWorldSize.Y, 0) / CellSize.Y + 1;
+
+	Cells.resize(static_cast<size_t>(NumberOfCellsX) * NumberOfCellsY);
+}
+
+FBroadphaseProxyId FGridBroadphase::CreateProxy(const FCollisionAABB& InBounds, FCollisionBase* InCollision, const FCollisionFilter& InFilter)
+{
+	FBroadphaseProxyId ProxyId;
+
+	if (FreeProxyIds.empty())
+	{
+		ProxyId = static_cast<FBroadphaseProxyId>(Proxies.size());
+
+		Proxies.emplace_back();
+		ProxyQueryStamps.push_back(0);
+	}
+	else
+	{
+		ProxyId = FreeProxyIds.back();
+		FreeProxyIds.pop_back();
+	}
+
+	FGridProxy& Proxy = Proxies[ProxyId];
+	Proxy.Bounds = InBounds;
+	Proxy.Collision = InCollision;
+	Proxy.Filter = InFilter;
+	Proxy.bIsUsed = true;
+	Proxy.bIsMoved = false;
+
+	AddToCells(ProxyId);
+
+	NumberOfProxies++;
+
+	MarkMoved(ProxyId);
+
+	return ProxyId;
+}
+
+void FGridBroadphase::DestroyProxy(const FBroadphaseProxyId ProxyId)
+{
+	RemoveFromCells(ProxyId);
+
+	FGridProxy& Proxy = Proxies[ProxyId];
+	Proxy.Collision = nullptr;
+	Proxy.bIsUsed = false;
+	Proxy.bIsMoved = false;
+
+	FreeProxyIds.push_back(ProxyId);
+
+	NumberOfProxies--;
+}
+
+void FGridBroadphase::SetProxyFilter(const FBroadphaseProxyId ProxyId, const FCollisionFilter& InFilter)
+{
+	Proxies[ProxyId].Filter = InFilter;
+
+	// Pairs which were filtered before might be reported now
+	MarkMoved(ProxyId);
+}
+
+void FGridBroadphase::MoveProxy(const FBroadphaseProxyId ProxyId, const FCollisionAABB& InBounds)
+{
+	FGridProxy& Proxy = Proxies[ProxyId];
+	Proxy.Bounds = InBounds;
+
+	int32 MinCellX, MinCellY, MaxCellX, MaxCellY;
+	GetCellRange(InBounds, MinCellX, MinCellY, MaxCellX, MaxCellY);
+
+	// Most moves stay in same cells
+	if (MinCellX != Proxy.MinCellX || MinCellY != Proxy.MinCellY || MaxCellX != Proxy.MaxCellX || MaxCellY != Proxy.MaxCellY)
+	{
+		RemoveFromCells(ProxyId);
+		AddToCells(ProxyId);
+	}
+
+	MarkMoved(ProxyId);
+}
+
+FCollisionBase* FGridBroadphase::GetCollision(const FBroadphaseProxyId ProxyId) const
+{
+	return Proxies[ProxyId].Collision;
+}
+
+void FGridBroadphase::Query(const FCollisionAABB& InBounds, CArray<FBroadphaseProxyId>& OutProxyIds) const
+{
+	QueryInternal(InBounds, [&](const FBroadphaseProxyId ProxyId)
+	{
+		OutProxyIds.Push(ProxyId);
+	});
+}
+
+void FGridBroadphase::QuerySegment(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, CArray<FBroadphaseProxyId>& OutProxyIds) const
+{
+	const FCollisionAABB SegmentBounds(
+		FVector2D<float>(FMath::Min(InStart.X, InEnd.X), FMath::Min(InStart.Y, InEnd.Y)),
+		FVector2D<float>(FMath::Max(InStart.X, InEnd.X), FMath::Max(InStart.Y, InEnd.Y))
+	);
+
+	const FCollisionAABB GridBounds(FVector2D<float>(0.f, 0.f), FVector2D<float>(static_cast<float>(NumberOfCellsX * CellSize.X), static_cast<float>(NumberOfCellsY * CellSize.Y)));
+
+	if (!GridBounds.Contains(SegmentBounds))
+	{
+		// Objects outside of world are kept in border cells, so walking cells crossed by segment could miss them
+		QueryInternal(SegmentBounds, [&](const FBroadphaseProxyId ProxyId)
+		{
+			if (Proxies[ProxyId].Bounds.IntersectsSegment(InStart, InEnd))
+			{
+				OutProxyIds.Push(ProxyId);
+			}
+		});
+
+		return;
+	}
+
+	const float CellSizeX = static_cast<float>(CellSize.X);
+	const float CellSizeY = static_cast<float>(CellSize.Y);
+	const FVector2D<float> Delta(InEnd.X - InStart.X, InEnd.Y - InStart.Y);
+
+	int32 CellX = FMath::Clamp(static_cast<int32>(std::floor(InStart.X / CellSizeX)), 0, NumberOfCellsX - 1);
+	int32 CellY = FMath::Clamp(static_cast<int32>(std::floor(InStart.Y / CellSizeY)), 0, NumberOfCellsY - 1);
+	const int32 EndCellX = FMath::Clamp(static_cast<int32>(std::floor(InEnd.X / CellSizeX)), 0, NumberOfCellsX - 1);
+	const int32 EndCellY = FMath::Clamp(static_cast<int32>(std::floor(InEnd.Y / CellSizeY)), 0, NumberOfCellsY - 1);
+
+	const int32 StepX = (Delta.X > 0.f) ? 1 : -1;
+	const int32 StepY = (Delta.Y > 0.f) ? 1 : -1;
+
+	// Fraction of segment at which next cell border is crossed and fraction needed to cross whole cell
+	const float Infinity = std::numeric_limits<float>::infinity();
+	float NextBorderFractionX = (Delta.X != 0.f) ? ((static_cast<float>(CellX + (StepX > 0 ? 1 : 0)) * CellSizeX - InStart.X) / Delta.X) : Infinity;
+	float NextBorderFractionY = (Delta.Y != 0.f) ? ((static_cast<float>(CellY + (StepY > 0 ? 1 : 0)) * CellSizeY - InStart.Y) / Delta.Y) : Infinity;
+	const float CellFractionX = (Delta.X != 0.f) ? (CellSizeX / std::abs(Delta.X)) : Infinity;
+	const float CellFractionY = (Delta.Y != 0.f) ? (CellSizeY / std::abs(Delta.Y)) : Infinity;
+
+	// Number of steps is known upfront, so rounding errors can not make walk miss end cell
+	const int32 NumberOfSteps = std::abs(EndCellX - CellX) + std::abs(EndCellY - CellY);
+
+	CurrentQueryStamp++;
+
+	for (int32 Step = 0; Step <= NumberOfSteps; Step++)
+	{
+		for (const FBroadphaseProxyId ProxyId : Cells[CellY * NumberOfCellsX + CellX])
+		{
+			if (ProxyQueryStamps[ProxyId] != CurrentQueryStamp)
+			{
+				ProxyQueryStamps[ProxyId] = CurrentQueryStamp;
+
+				if (Proxies[ProxyId].Bounds.IntersectsSegment(InStart, InEnd))
+				{
+					OutProxyIds.Push(ProxyId);
+				}
+			}
+		}
+
+		const bool bCanStepX = (CellX != EndCellX);
+		const bool bCanStepY = (CellY != EndCellY);
+
+		if (bCanStepX && (!bCanStepY || NextBorderFractionX < NextBorderFractionY))
+		{
+			CellX += StepX;
+			NextBorderFractionX += CellFractionX;
+		}
+		else if (bCanStepY)
+		{
+			CellY += StepY;
+			NextBorderFractionY += CellFractionY;
+		}
+	}
+}
+
+void FGridBroadphase::UpdatePairs(CArray<FBroadphasePair>& OutPairs)
+{
+	OutPairs.Clear();
+
+	for (const FBroadphaseProxyId ProxyId : MovedProxies)
+	{
+		FGridProxy& MovedProxy = Proxies[ProxyId];
+
+		// Destroyed (or already handled if id was reused) proxies are skipped
+		if (!MovedProxy.bIsUsed || !MovedProxy.bIsMoved)
+		{
+			continue;
+		}
+
+		MovedProxy.bIsMoved = false;
+
+		QueryInternal(MovedProxy.Bounds, [&](const FBroadphaseProxyId OtherProxyId)
+		{
+			// Pair of two moved proxies is added when second one is handled
+			const FGridProxy& OtherProxy = Proxies[OtherProxyId];
+
+			if (OtherProxyId != ProxyId && !OtherProxy.bIsMoved && OtherProxy.Filter.CanCollide(MovedProxy.Filter))
+			{
+				OutPairs.Push(FBroadphasePair(ProxyId, OtherProxyId));
+			}
+		});
+	}
+
+	MovedProxies.Clear();
+
+	SortAndRemoveDuplicatePairs(OutPairs);
+}
+
+void FGridBroadphase::DebugRender(const FRenderer* Renderer) const
+{
+	for (int32 CellY = 0; CellY < NumberOfCellsY; CellY++)
+	{
+		for (int32 CellX = 0; CellX < NumberOfCellsX; CellX++)
+		{
+			const CArray<FBroadphaseProxyId>& Cell = Cells[CellY * NumberOfCellsX + CellX];
+			const FColorRGBA DrawColor = Cell.IsEmpty() ? FColorRGBA::ColorLightGreen() : FColorRGBA::ColorOrange();
+
+			const FVector2D<float> CellLocation(static_cast<float>(CellX * CellSize.X), static_cast<float>(CellY * CellSize.Y));
+
+			Renderer->DrawRectangleOutline(CellLocation, FVector2D<float>(CellSize), DrawColor);
+		}
+	}
+}
+
+void FGridBroadphase::GetCellRange(const FCollisionAABB& InBounds, int32& OutMinCellX, int32& OutMinCellY, int32& OutMaxCellX, int32& OutMaxCellY) const
+{
+	OutMinCellX = FMath::Clamp(static_cast<int32>(std::floor(InBounds.Min.X / static_cast<float>(CellSize.X))), 0, NumberOfCellsX - 1);
+	OutMinCellY = FMath::Clamp(static_cast<int32>(std::floor(InBounds.Min.Y / static_cast<float>(CellSize.Y))), 0, NumberOfCellsY - 1);
+	OutMaxCellX = FMath::Clamp(static_cast<int32>(std::floor(InBounds.Max.X / static_cast<float>(CellSize.X))), 0, NumberOfCellsX - 1);
+	OutMaxCellY = FMath::Clamp(static_cast<int32>(std::floor(InBounds.Max.Y / static_cast<float>(CellSize.Y))), 0, NumberOfCellsY - 1);
+}
+
+void FGridBroadphase::AddToCells(const FBroadphaseProxyId ProxyId)
+{
+	FGridProxy& Proxy = Proxies[ProxyId];
+
+	GetCellRange(Proxy.Bounds, Proxy.MinCellX, Proxy.MinCellY, Proxy.MaxCellX, Proxy.MaxCellY);
+
+	for (int32 CellY = Proxy.MinCellY; CellY <= Proxy.MaxCellY; CellY++)
+	{
+		for (int32 CellX = Proxy.MinCellX; CellX <= Proxy.MaxCellX; CellX++)
+		{
+			Cells[CellY * NumberOfCellsX + CellX].Push(ProxyId);
+		}
+	}
+}
+
+void FGridBroadphase::RemoveFromCells(const FBroadphaseProxyId ProxyId)
+{
+	const FGridProxy& Proxy = Proxies[ProxyId];
+
+	for (int32 CellY = Proxy.MinCellY; CellY <= Proxy.MaxCellY; CellY++)
+	{
+		for (int32 CellX = Proxy.MinCellX; CellX <= Proxy.MaxCellX; CellX++)
+		{
+			std::vector<FBroadphaseProxyId>& CellProxyIds = Cells[CellY * NumberOfCellsX + CellX].Vector;
+
+			// Order inside of cell does not matter, swap with last
+			for (size_t i = 0; i < CellProxyIds.size(); i++)
+			{
+				if (CellProxyIds[i] == ProxyId)
+				{
+					CellProxyIds[i] = CellProxyIds.back();
+					CellProxyIds.pop_back();
+
+					break;
+				}
+			}
+		}
+	}
+}
+
+void FGridBroadphase::MarkMoved(const FBroadphaseProxyId ProxyId)
+{
+	FGridProxy& Proxy = Proxies[ProxyId];
+	if (!Proxy.bIsMoved)
+	{
+		Proxy.bIsMoved = true;
+
+		MovedProxies.Push(ProxyId);
+	}
+}
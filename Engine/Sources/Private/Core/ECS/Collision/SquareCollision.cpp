@@ -13,6 +13,8 @@ void FRectangle::SetLocationTopLeftCorner(const FVector2D<int>& InPositionTopLef
 void FRectangle::SetSize(const FVector2D<int>& InSize)
 {
 	Size = InSize;
+
+	UpdatePositionBottomRight();
 }
 
 const FVector2D<int>& FRectangle::GetPositionTopLeft() const
@@ -25,6 +25,8 @@ bool IComponentManagerInterface::DestroyComponent(const std::string& ComponentNa
 
 		OnComponentDestroy(ComponentName, ComponentsMap[ComponentName].get());
 
+		RemoveComponentFromTypeIdLookup(ComponentsMap[ComponentName].get());
+
 		ComponentsMap[ComponentName].reset();
 
 		ComponentsMap.Remove(ComponentName);
@@ -45,6 +47,8 @@ bool IComponentManagerInterface::DestroyComponentByInstance(const UBaseComponent
 
 			OnComponentDestroy(ComponentPair.first, ComponentPair.second.get());
 
+			RemoveComponentFromTypeIdLookup(Component);
+
 			ComponentPair.second.reset();
 
 			ComponentsMap.Remove(ComponentPair.first);
@@ -135,4 +139,25 @@ void IComponentManagerInterface::Cleanup()
 	}
 
 	ComponentsMap.Clear();
+	ComponentsByTypeId.Clear();
+}
+
+void IComponentManagerInterface::RemoveComponentFromTypeIdLookup(const UBaseComponent* Component)
+{
+	FComponentTypeId TypeIdToRemove = INDEX_NONE;
+
+	for (const std::pair<const FComponentTypeId, UBaseComponent*>& TypeIdPair : ComponentsByTypeId)
+	{
+		if (TypeIdPair.second == Component)
+		{
+			TypeIdToRemove = TypeIdPair.first;
+
+			break;
+		}
+	}
+
+	if (TypeIdToRemove != INDEX_NONE)
+	{
+		ComponentsByTypeId.Remove(TypeIdToRemove);
+	}
 }
@@ -0,0 +1,82 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/ComponentStorage.h"
+
+FComponentStorage::FComponentStorage()
+	: NumberOfEntities(0)
+{
+}
+
+FComponentStorage::~FComponentStorage()
+{
+	Clear();
+}
+
+FStorageEntityId FComponentStorage::CreateEntity()
+{
+	FStorageEntityId NewEntityId;
+
+	if (FreeEntityIds.IsEmpty())
+	{
+		NewEntityId = static_cast<FStorageEntityId>(EntitiesAlive.size());
+
+		EntitiesAlive.push_back(true);
+	}
+	else
+	{
+		NewEntityId = FreeEntityIds[FreeEntityIds.GetLastIndex()];
+		FreeEntityIds.RemoveAt(FreeEntityIds.GetLastIndex());
+
+		EntitiesAlive[NewEntityId] = true;
+	}
+
+	NumberOfEntities++;
+
+	return NewEntityId;
+}
+
+void FComponentStorage::DestroyEntity(const FStorageEntityId EntityId)
+{
+	if (IsEntityValid(EntityId))
+	{
+		for (const std::shared_ptr<IComponentPoolInterface>& Pool : Pools)
+		{
+			if (Pool != nullptr)
+			{
+				Pool->RemoveComponent(EntityId);
+			}
+		}
+
+		EntitiesAlive[EntityId] = false;
+
+		FreeEntityIds.Push(EntityId);
+
+		NumberOfEntities--;
+	}
+	else
+	{
+		LOG_WARN("Trying to destroy invalid storage entity: " << EntityId);
+	}
+}
+
+bool FComponentStorage::IsEntityValid(const FStorageEntityId EntityId) const
+{
+	return (EntityId >= 0 && EntityId < static_cast<FStorageEntityId>(EntitiesAlive.size()) && EntitiesAlive[EntityId]);
+}
+
+void FComponentStorage::Clear()
+{
+	for (const std::shared_ptr<IComponentPoolInterface>& Pool : Pools)
+	{
+		if (Pool != nullptr)
+		{
+			Pool->Clear();
+		}
+	}
+
+	EntitiesAlive.clear();
+	FreeEntityIds.Clear();
+
+	NumberOfEntities = 0;
+}
@@ -0,0 +1,16 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/ComponentTypeId.h"
+
+static std::atomic<FComponentTypeId> NextComponentTypeId = 0;
+
+int32 FComponentTypeIdGenerator::GetNumberOfTypes()
+{
+	return NextComponentTypeId.load();
+}
+
+FComponentTypeId FComponentTypeIdGenerator::GenerateNextTypeId()
+{
+	return NextComponentTypeId.fetch_add(1);
+}
@@ -42,10 +42,8 @@ void UCircleCollisionComponent::Render()
 #endif
 }
 
-void UCircleCollisionComponent::OnLocationChanged()
+void UCircleCollisionComponent::UpdateCollisionLocation()
 {
-	UCollisionComponent::OnLocationChanged();
-
 	if (CircleCollision != nullptr)
 	{
 		FCircle& CircleCollisionDataForEdit = CircleCollision->GetCircleDataForEdit();
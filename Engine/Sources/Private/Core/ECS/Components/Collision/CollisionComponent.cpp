@@ -12,6 +12,8 @@ UCollisionComponent::UCollisionComponent(IComponentManagerInterface* InComponent
 	, CollisionManagerCached(nullptr)
 	, bCollisionsEnabled(false)
 	, bCollisionsEnabledInitial(true)
+	, bIsCollisionStatic(false)
+	, CollisionLayerName("Default")
 {
 }
 
@@ -19,14 +21,50 @@ void UCollisionComponent::BeginPlay()
 {
 	UComponent::BeginPlay();
 
-	CollisionManagerCached = GetCollisionManager();
+	// Might be set before BeginPlay, see SetCollisionManager
+	if (CollisionManagerCached == nullptr)
+	{
+		CollisionManagerCached = GetCollisionManager();
+	}
 
 	SetCollisionsEnabled(bCollisionsEnabledInitial);
 }
 
 void UCollisionComponent::SetCollisionsEnabled(const bool bNewInEnabled)
 {
-	bCollisionsEnabled = bNewInEnabled;
+	if (bCollisionsEnabled != bNewInEnabled)
+	{
+		bCollisionsEnabled = bNewInEnabled;
+
+		// Manager will end or begin contacts on next tick
+		NotifyCollisionChanged();
+	}
+}
+
+void UCollisionComponent::SetCollisionLayer(const std::string& InCollisionLayerName)
+{
+	if (CollisionLayerName != InCollisionLayerName)
+	{
+		CollisionLayerName = InCollisionLayerName;
+
+		for (FCollisionBase* CollisionObject : CollisionObjectsArray)
+		{
+			UpdateCollisionFilter(CollisionObject);
+		}
+	}
+}
+
+void UCollisionComponent::SetCollisionStatic(const bool bInIsStatic)
+{
+	if (bIsCollisionStatic != bInIsStatic)
+	{
+		bIsCollisionStatic = bInIsStatic;
+
+		for (FCollisionBase* CollisionObject : CollisionObjectsArray)
+		{
+			UpdateCollisionFilter(CollisionObject);
+		}
+	}
 }
 
 void UCollisionComponent::AddCollision(FCollisionBase* CollisionObject)
@@ -35,6 +73,9 @@ void UCollisionComponent::AddCollision(FCollisionBase* CollisionObject)
 	{
 		CollisionObjectsArray.Push(CollisionObject);
 
+		// Filter is set before register, so broadphase never pairs object with wrong filter
+		UpdateCollisionFilter(CollisionObject);
+
 		CollisionManagerCached->RegisterCollision(CollisionObject);
 	}
 	else
@@ -59,16 +100,17 @@ void UCollisionComponent::RemoveCollision(FCollisionBase* CollisionObject)
 
 void UCollisionComponent::OnLocationChanged()
 {
+	// Absolute location is updated by transform, shapes must follow it before CollisionManager reads them
 	UComponent::OnLocationChanged();
 
-	if (CollisionManagerCached != nullptr)
-	{
-		// Send notification about changed collision to CollisionManager
-		for (FCollisionBase* CollisionObjects : CollisionObjectsArray)
-		{
-			CollisionManagerCached->OnCollisionObjectMoved(CollisionObjects);
-		}
-	}
+	UpdateCollisionLocation();
+
+	NotifyCollisionChanged();
+}
+
+void UCollisionComponent::SetCollisionManager(FCollisionManager* InCollisionManager)
+{
+	CollisionManagerCached = InCollisionManager;
 }
 
 const CArray<FCollisionBase*>& UCollisionComponent::GetCollisionObjectsArray() const
@@ -81,6 +123,11 @@ void UCollisionComponent::OnCollisionBegin(UCollisionComponent* OtherCollision)
 	OnCollisionEnter.Execute(OtherCollision);
 }
 
+void UCollisionComponent::OnCollisionStay(UCollisionComponent* OtherCollision)
+{
+	OnCollisionStaying.Execute(OtherCollision);
+}
+
 void UCollisionComponent::OnCollisionEnd(UCollisionComponent* OtherCollision)
 {
 	OnCollisionExit.Execute(OtherCollision);
@@ -90,13 +137,17 @@ FCollisionManager* UCollisionComponent::GetCollisionManager() const
 {
 	FCollisionManager* FoundCollisionManager = nullptr;
 
-	FMapManager* MapManager = GetOwnerWindow()->GetMapManager();
-	if (MapManager != nullptr)
+	FWindow* OwnerWindow = GetOwnerWindow();
+	if (OwnerWindow != nullptr)
 	{
-		FMap* CurrentMap = MapManager->GetCurrentMap();
-		if (CurrentMap != nullptr)
+		FMapManager* MapManager = OwnerWindow->GetMapManager();
+		if (MapManager != nullptr)
 		{
-			FoundCollisionManager = CurrentMap->GetSubSystemByClass<FCollisionManager>();
+			FMap* CurrentMap = MapManager->GetCurrentMap();
+			if (CurrentMap != nullptr)
+			{
+				FoundCollisionManager = CurrentMap->GetSubSystemByClass<FCollisionManager>();
+			}
 		}
 	}
 
@@ -108,6 +159,29 @@ FVector2D<int> UCollisionComponent::GetLocationForCollision() const
 	return GetAbsoluteLocation();
 }
 
+void UCollisionComponent::UpdateCollisionLocation()
+{
+}
+
+void UCollisionComponent::NotifyCollisionChanged()
+{
+	if (CollisionManagerCached != nullptr)
+	{
+		for (FCollisionBase* CollisionObjects : CollisionObjectsArray)
+		{
+			CollisionManagerCached->OnCollisionObjectMoved(CollisionObjects);
+		}
+	}
+}
+
+void UCollisionComponent::UpdateCollisionFilter(FCollisionBase* CollisionObject)
+{
+	if (CollisionManagerCached != nullptr)
+	{
+		CollisionManagerCached->SetCollisionFilter(CollisionObject, CollisionManagerCached->MakeCollisionFilter(CollisionLayerName, bIsCollisionStatic));
+	}
+}
+
 #if _DEBUG
 FColorRGBA UCollisionComponent::GetCollisionDebugColor()
 {
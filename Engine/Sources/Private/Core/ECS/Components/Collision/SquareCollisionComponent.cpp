@@ -49,13 +49,10 @@ void USquareCollisionComponent::Render()
 #endif
 }
 
-void USquareCollisionComponent::OnLocationChanged()
+void USquareCollisionComponent::UpdateCollisionLocation()
 {
-	UCollisionComponent::OnLocationChanged();
-
 	if (SquareCollision != nullptr)
 	{
-		// Update location
 		FRectangleWithDiagonal& SquareDataForEdit = SquareCollision->GetSquareDataForEdit();
 		SquareDataForEdit.SetLocationTopLeftCorner(GetAbsoluteLocation());
 	}
@@ -76,5 +73,7 @@ void USquareCollisionComponent::OnSizeChanged()
 	{
 		FRectangleWithDiagonal& SquareDataForEdit = SquareCollision->GetSquareDataForEdit();
 		SquareDataForEdit.SetSize(GetSize());
+
+		NotifyCollisionChanged();
 	}
 }
@@ -106,11 +106,19 @@ void UArrowComponent::RenderArrow()
 	{
 		FRenderer* Renderer = GetOwnerWindow()->GetRenderer();
 
-		static const FVector2D<int> ArrowPivotPoint = { 0, 0 };
-
-		FRenderer::OverrideTextureColor(ArrowTextureAsset->GetTexture()->GetSDLTexture(), ArrowColor);
-		Renderer->DrawTextureAdvanced(ArrowTextureAsset, GetLocationCenter(), ArrowRenderSize, GetAbsoluteRotation() + 180, ArrowPivotPoint, SDL_FLIP_VERTICAL);
-		FRenderer::OverrideTextureColorReset(ArrowTextureAsset->GetTexture()->GetSDLTexture());
+		const FVector2D<float> ArrowLocation = GetLocationCenter();
+		const FVector2D<float> ArrowSize = ArrowRenderSize;
+
+		// Color is part of sprite, so arrows of different colors can still be batched together
+		FSpriteDrawRequest Sprite;
+		Sprite.Texture = ArrowTextureAsset->GetTexture()->GetSDLTexture();
+		Sprite.SourceUV = ArrowTextureAsset->GetTexture()->GetSourceUV();
+		Sprite.Destination = { ArrowLocation.X, ArrowLocation.Y, ArrowSize.X, ArrowSize.Y };
+		Sprite.Rotation = GetAbsoluteRotation() + 180;
+		Sprite.Flip = SDL_FLIP_VERTICAL;
+		Sprite.Color = ArrowColor;
+
+		Renderer->DrawSprite(Sprite);
 	}
 }
 
@@ -8,6 +8,8 @@
 
 UMoveComponent::UMoveComponent(IComponentManagerInterface* InComponentManagerInterface)
 	: UComponent(InComponentManagerInterface)
+	, CurrentWaypointIndex(0)
+	, PathRequestId(INDEX_NONE)
 	, bIsMoving(false)
 	, bShouldRotateInstant(false)
 	, StopDistance(0.f)
@@ -42,6 +44,14 @@ void UMoveComponent::BeginPlay()
 	}
 }
 
+void UMoveComponent::EndPlay()
+{
+	// Result must not be delivered to destroyed component
+	CancelPathRequest();
+
+	UComponent::EndPlay();
+}
+
 void UMoveComponent::Tick(const float DeltaTime)
 {
 	UComponent::Tick(DeltaTime);
@@ -55,11 +65,15 @@ void UMoveComponent::Tick(const float DeltaTime)
 				if (RootTransformComponent != nullptr)
 				{
 					CurrentLocation = RootTransformComponent->GetAbsoluteLocation();
-					CalculatedTargetLocation = TargetLocation;
 
-					UpdateRotationToTarget(DeltaTime);
+					if (FlowField == nullptr || UpdateFlowFieldTarget())
+					{
+						CalculatedTargetLocation = TargetLocation;
 
-					UpdateLocationToTarget(DeltaTime);
+						UpdateRotationToTarget(DeltaTime);
+
+						UpdateLocationToTarget(DeltaTime);
+					}
 				}
 
 				break;
@@ -102,6 +116,75 @@ void UMoveComponent::ResetStoppingDistance()
 }
 
 void UMoveComponent::SetTargetMoveLocation(const FVector2D<int> NewTargetLocation)
+{
+	CancelPathRequest();
+
+	MoveWaypoints.Clear();
+	CurrentWaypointIndex = 0;
+	FlowField = nullptr;
+
+	StartMovementToLocation(NewTargetLocation);
+}
+
+void UMoveComponent::SetMovePath(const CArray<FVector2D<int>>& InWaypoints)
+{
+	CancelPathRequest();
+
+	if (InWaypoints.Size() > 0)
+	{
+		MoveWaypoints = InWaypoints;
+		CurrentWaypointIndex = 0;
+		FlowField = nullptr;
+
+		StartMovementToLocation(MoveWaypoints[CurrentWaypointIndex]);
+	}
+	else
+	{
+		AbortMovement();
+	}
+}
+
+void UMoveComponent::MoveToLocation(const FVector2D<int> InLocation)
+{
+	FNavigationManager* NavigationManager = GetNavigationManager();
+	if (NavigationManager != nullptr && RootTransformComponent != nullptr)
+	{
+		CancelPathRequest();
+
+		FDelegateSafe<void, const FNavigationPathResult&> OnPathFoundDelegate;
+		OnPathFoundDelegate.BindObject(this, &UMoveComponent::OnPathFound);
+
+		PathRequestId = NavigationManager->RequestPath(RootTransformComponent->GetAbsoluteLocation(), InLocation, OnPathFoundDelegate);
+	}
+	else
+	{
+		SetTargetMoveLocation(InLocation);
+	}
+}
+
+void UMoveComponent::MoveToLocationWithFlowField(const FVector2D<int> InLocation)
+{
+	FNavigationManager* NavigationManager = GetNavigationManager();
+	if (NavigationManager != nullptr)
+	{
+		CancelPathRequest();
+
+		MoveWaypoints.Clear();
+		CurrentWaypointIndex = 0;
+
+		FlowField = NavigationManager->GetFlowField(InLocation);
+		FlowFieldGoalLocation = InLocation;
+
+		// Target is replaced by next tile of flow field on tick
+		StartMovementToLocation(InLocation);
+	}
+	else
+	{
+		SetTargetMoveLocation(InLocation);
+	}
+}
+
+void UMoveComponent::StartMovementToLocation(const FVector2D<int>& NewTargetLocation)
 {
 	FMap* CurrentMap = GetEntity()->GetCurrentMap();
 	if (CurrentMap->IsInBounds(NewTargetLocation))
@@ -126,7 +209,12 @@ void UMoveComponent::SetTargetMoveLocation(const FVector2D<int> NewTargetLocatio
 
 void UMoveComponent::AbortMovement()
 {
+	CancelPathRequest();
+
 	TargetLocation = FVector2D<int>();
+	MoveWaypoints.Clear();
+	CurrentWaypointIndex = 0;
+	FlowField = nullptr;
 
 	bIsMoving = false;
 
@@ -241,10 +329,13 @@ void UMoveComponent::UpdateLocationToTarget(const float DeltaTime)
 {
 	const float CurrentDistance = static_cast<float>(CurrentLocation.DistanceTo(TargetLocation));
 
-	if (CurrentDistance < StopDistance)
+	// Stop distance is only used for last waypoint, earlier ones are reached exactly to not cut corners of walls
+	const float CurrentStopDistance = IsMovingToLastLocation() ? StopDistance : 0.f;
+
+	if (CurrentDistance < CurrentStopDistance)
 	{
-		// We are close enough. Stop.
-		AbortMovement();
+		// We are close enough.
+		OnTargetLocationReached();
 	}
 	else
 	{
@@ -261,8 +352,11 @@ void UMoveComponent::UpdateLocationToTarget(const float DeltaTime)
 		{
 			NewLocation = TargetLocation;
 
-			// We are close enough. Stop.
-			AbortMovement();
+			// Next waypoint starts from exact location
+			PreciseLocation = NewLocation;
+
+			// We are close enough.
+			OnTargetLocationReached();
 		}
 		else
 		{
@@ -320,6 +414,107 @@ bool UMoveComponent::IsInMapBounds(const FVector2D<int>& Location) const
 	return bIsInBounds;
 }
 
+void UMoveComponent::OnTargetLocationReached()
+{
+	if (FlowField != nullptr)
+	{
+		// Next tile is taken from flow field on next tick
+		if (IsMovingToLastLocation())
+		{
+			AbortMovement();
+		}
+	}
+	else if (CurrentWaypointIndex + 1 < MoveWaypoints.Size())
+	{
+		CurrentWaypointIndex++;
+
+		TargetLocation = MoveWaypoints[CurrentWaypointIndex];
+	}
+	else
+	{
+		AbortMovement();
+	}
+}
+
+bool UMoveComponent::IsMovingToLastLocation() const
+{
+	if (FlowField != nullptr)
+	{
+		return (TargetLocation == FlowFieldGoalLocation);
+	}
+
+	return (CurrentWaypointIndex + 1 >= MoveWaypoints.Size());
+}
+
+bool UMoveComponent::UpdateFlowFieldTarget()
+{
+	const FVector2D<int32> CurrentTile = FlowField->LocationToTile(CurrentLocation);
+
+	if (CurrentTile == FlowField->GetGoalTile())
+	{
+		TargetLocation = FlowFieldGoalLocation;
+	}
+	else
+	{
+		const FVector2D<int32> FlowDirection = FlowField->GetFlowDirection(CurrentTile.X, CurrentTile.Y);
+		if (FlowDirection.X == 0 && FlowDirection.Y == 0)
+		{
+			OnPathNotFound();
+
+			return false;
+		}
+
+		TargetLocation = FlowField->TileToLocation(CurrentTile + FlowDirection);
+	}
+
+	return true;
+}
+
+FNavigationManager* UMoveComponent::GetNavigationManager() const
+{
+	FNavigationManager* NavigationManager = nullptr;
+
+	if (CurrentMap != nullptr)
+	{
+		NavigationManager = CurrentMap->GetSubSystemByClass<FNavigationManager>();
+	}
+
+	return NavigationManager;
+}
+
+void UMoveComponent::CancelPathRequest()
+{
+	if (PathRequestId != INDEX_NONE)
+	{
+		FNavigationManager* NavigationManager = GetNavigationManager();
+		if (NavigationManager != nullptr)
+		{
+			NavigationManager->CancelPathRequest(PathRequestId);
+		}
+
+		PathRequestId = INDEX_NONE;
+	}
+}
+
+void UMoveComponent::OnPathFound(const FNavigationPathResult& InResult)
+{
+	PathRequestId = INDEX_NONE;
+
+	if (InResult.bIsPathFound)
+	{
+		SetMovePath(InResult.Waypoints);
+	}
+	else
+	{
+		OnPathNotFound();
+	}
+}
+
+void UMoveComponent::OnPathNotFound()
+{
+	AbortMovement();
+}
+
 void UMoveComponent::OnRequestedLocationOutOfBounds()
 {
 	AbortMovement();
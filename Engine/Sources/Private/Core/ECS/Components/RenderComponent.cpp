@@ -6,12 +6,15 @@
 #include "Assets/AssetsManagerHelpers.h"
 #include "Assets/Assets/TextureAsset.h"
 #include "Assets/Collection/AssetCollectionItem.h"
+#include "ECS/Entity.h"
 
 URenderComponent::URenderComponent(IComponentManagerInterface* InComponentManagerInterface)
 	: UComponent(InComponentManagerInterface)
+	, OwnerEntity(nullptr)
 	, TextureAsset(nullptr)
 	, CurrentRenderCenterType(ERenderCenterType::RotateAround)
 	, CurrentRenderType(ERenderType::Center)
+	, RenderLayer(0)
 {
 }
 
@@ -21,12 +24,24 @@ void URenderComponent::BeginPlay()
 
 	// Set default size
 	SetImageSize(GetSize());
+
+	OwnerEntity = GetEntity();
+	if (OwnerEntity != nullptr)
+	{
+		OwnerEntity->RegisterRenderComponent(this);
+	}
 }
 
 void URenderComponent::EndPlay()
 {
 	UComponent::EndPlay();
 
+	if (OwnerEntity != nullptr)
+	{
+		OwnerEntity->UnRegisterRenderComponent(this);
+		OwnerEntity = nullptr;
+	}
+
 	if (TextureAsset != nullptr)
 	{
 		TextureAsset->DecrementNumberOfReferences();
@@ -40,52 +55,63 @@ void URenderComponent::Render()
 
 	if (TextureAsset != nullptr)
 	{
-		FVector2D<int> RenderLocation;
- 
-		switch (CurrentRenderType)
-		{
-			case ERenderType::Center:
-			{
-				RenderLocation = GetLocationCenter();
+		const FVector2D<int> RenderLocation = GetRenderLocation();
+		const FVector2D<int> PivotLocationCenter = GetRenderCenterOfRotation();
 
-				break;
-			}
+		const FVector2D<float> RenderSize = GetSize();
 
-			case ERenderType::AbsoluteLocation:
-			{
-				RenderLocation = GetAbsoluteLocation();
+		FSpriteDrawRequest Sprite;
+		Sprite.Texture = TextureAsset->GetTexture()->GetSDLTexture();
+		Sprite.SourceUV = TextureAsset->GetTexture()->GetSourceUV();
+		Sprite.Destination = { static_cast<float>(RenderLocation.X), static_cast<float>(RenderLocation.Y), RenderSize.X, RenderSize.Y };
+		Sprite.Rotation = GetAbsoluteRotation();
+		Sprite.CenterOfRotation = PivotLocationCenter;
+		Sprite.Layer = RenderLayer;
 
-				break;
-			}
-		}
+		GetOwnerWindow()->GetRenderer()->DrawSprite(Sprite);
+	}
+}
 
-		FVector2D<int> PivotLocationCenter;
+void URenderComponent::OnLocationChanged()
+{
+	UComponent::OnLocationChanged();
 
-		switch (CurrentRenderCenterType)
-		{
-			case ERenderCenterType::RotateAround:
-			{
-				PivotLocationCenter = GetSize() / 2;
+	MarkRenderBoundsDirty();
+}
 
-				break;
-			}
+void URenderComponent::OnRotationChanged()
+{
+	UComponent::OnRotationChanged();
 
-			case ERenderCenterType::AtPivotPoint:
-			{
-				// Do nothing we want to rotate at zero
+	MarkRenderBoundsDirty();
+}
 
-				break;
-			}
-		}
+void URenderComponent::OnSizeChanged()
+{
+	UComponent::OnSizeChanged();
 
-		GetOwnerWindow()->GetRenderer()->DrawTextureAdvanced(
-			TextureAsset, 
-			RenderLocation,
-			GetSize(), 
-			GetAbsoluteRotation(),
-			PivotLocationCenter
-		);
+	MarkRenderBoundsDirty();
+}
+
+FCollisionAABB URenderComponent::GetRenderBounds() const
+{
+	const FVector2D<float> RenderLocation = GetRenderLocation();
+	const FVector2D<float> RenderSize = GetSize();
+
+	if (GetAbsoluteRotation() % 360 == 0)
+	{
+		return FCollisionAABB(RenderLocation, RenderLocation + RenderSize);
 	}
+
+	// Farthest corner from center of rotation does not depend on rotation
+	const FVector2D<float> CenterOfRotation = GetRenderCenterOfRotation();
+	const float FarCornerX = FMath::Max(CenterOfRotation.X, RenderSize.X - CenterOfRotation.X);
+	const float FarCornerY = FMath::Max(CenterOfRotation.Y, RenderSize.Y - CenterOfRotation.Y);
+	const float Radius = FMath::Sqrt(FarCornerX * FarCornerX + FarCornerY * FarCornerY);
+
+	const FVector2D<float> Pivot = RenderLocation + CenterOfRotation;
+
+	return FCollisionAABB(FVector2D<float>(Pivot.X - Radius, Pivot.Y - Radius), FVector2D<float>(Pivot.X + Radius, Pivot.Y + Radius));
 }
 
 void URenderComponent::SetImage(const FAssetCollectionItem& AssetCollectionItem)
@@ -148,9 +174,69 @@ void URenderComponent::SetImageSize(const FVector2D<int>& InSize)
 void URenderComponent::SetRenderLocationType(const ERenderType InRenderType)
 {
 	CurrentRenderType = InRenderType;
+
+	MarkRenderBoundsDirty();
 }
 
 void URenderComponent::SetRenderCenterType(const ERenderCenterType InRenderCenterType)
 {
 	CurrentRenderCenterType = InRenderCenterType;
+
+	MarkRenderBoundsDirty();
+}
+
+FVector2D<int> URenderComponent::GetRenderLocation() const
+{
+	FVector2D<int> RenderLocation;
+
+	switch (CurrentRenderType)
+	{
+		case ERenderType::Center:
+		{
+			RenderLocation = GetLocationCenter();
+
+			break;
+		}
+
+		case ERenderType::AbsoluteLocation:
+		{
+			RenderLocation = GetAbsoluteLocation();
+
+			break;
+		}
+	}
+
+	return RenderLocation;
+}
+
+FVector2D<int> URenderComponent::GetRenderCenterOfRotation() const
+{
+	FVector2D<int> PivotLocationCenter;
+
+	switch (CurrentRenderCenterType)
+	{
+		case ERenderCenterType::RotateAround:
+		{
+			PivotLocationCenter = GetSize() / 2;
+
+			break;
+		}
+
+		case ERenderCenterType::AtPivotPoint:
+		{
+			// Do nothing we want to rotate at zero
+
+			break;
+		}
+	}
+
+	return PivotLocationCenter;
+}
+
+void URenderComponent::MarkRenderBoundsDirty() const
+{
+	if (OwnerEntity != nullptr)
+	{
+		OwnerEntity->MarkRenderBoundsDirty();
+	}
 }
@@ -1,6 +1,8 @@
 #include "CoreEngine.h"
 #include "Core/ECS/Entities/WeaponBase.h"
 
+#include "ECS/Components/TeamComponent.h"
+#include "ECS/Systems/ProjectileSystem.h"
 #include "Timer/TimerManager.h"
 
 EWeaponBase::EWeaponBase(FEntityManager* InEntityManager)
@@ -43,6 +45,55 @@ void EWeaponBase::SetAttackCooldown(const float NewDelay)
 	CooldownAttackTime = NewDelay;
 }
 
+bool EWeaponBase::FireProjectile(FProjectileData InProjectileData)
+{
+	FProjectileSystem* ProjectileSystem = GetProjectileSystem();
+	if (ProjectileSystem == nullptr)
+	{
+		return false;
+	}
+
+	// Handle of holder is kept after holder is destroyed (IsAttached is false then), so weapon does not fire as itself
+	const bool bHasHolder = (GetEntityAttachmentHandle().GetEntityManager() != nullptr);
+	const FEntityHandle& ShooterHandle = bHasHolder ? GetEntityAttachmentHandle() : GetEntityHandle();
+
+	// Weapon or entity holding it is pending destroy
+	EEntity* ShooterEntity = ShooterHandle.Get();
+	if (ShooterEntity == nullptr)
+	{
+		return false;
+	}
+
+	if (InProjectileData.Owner.GetEntityManager() == nullptr)
+	{
+		InProjectileData.Owner = ShooterHandle;
+	}
+
+	if (InProjectileData.Team == INDEX_NONE)
+	{
+		const UTeamComponent* TeamComponent = ShooterEntity->GetComponentByClass<UTeamComponent>();
+		if (TeamComponent != nullptr)
+		{
+			InProjectileData.Team = TeamComponent->GetCurrentTeam();
+		}
+	}
+
+	return ProjectileSystem->FireProjectile(InProjectileData);
+}
+
+FProjectileSystem* EWeaponBase::GetProjectileSystem() const
+{
+	FEntityManager* EntityManager = GetEntityManagerOwner();
+
+	FProjectileSystem* ProjectileSystem = EntityManager->GetEntitySystemByClass<FProjectileSystem>();
+	if (ProjectileSystem == nullptr)
+	{
+		ProjectileSystem = EntityManager->CreateEntitySystem<FProjectileSystem>();
+	}
+
+	return ProjectileSystem;
+}
+
 void EWeaponBase::PerformAttack()
 {
 }
@@ -6,15 +6,18 @@
 #include "Engine/Logic/GameModeManager.h"
 #include "Renderer/WindowAdvanced.h"
 #include "Renderer/Map/MapManager.h"
+#include "ECS/EntityManager.h"
+#include "ECS/Components/RenderComponent.h"
 
 EEntity::EEntity(FEntityManager* InEntityManager)
 	: IComponentManagerInterface(nullptr, InEntityManager->GetOwnerWindow())
 	, EntityManagerOwner(InEntityManager)
 	, DefaultRootComponent(nullptr)
 	, bWasBeginPlayCalled(false)
-	, EntityAttachment(nullptr)
+	, bIsPendingDestroy(false)
 	, EntityAttachmentRootComponent(nullptr)
 	, AttachmentRelativeRotation(0)
+	, StorageEntityId(INDEX_NONE)
 {
 }
 
@@ -82,18 +85,63 @@ void EEntity::ReceiveRender()
 #endif
 }
 
+bool EEntity::GetRenderBounds(FCollisionAABB& OutBounds) const
+{
+	if (RegisteredRenderComponents.IsEmpty())
+	{
+		return false;
+	}
+
+	OutBounds = RegisteredRenderComponents[0]->GetRenderBounds();
+
+	for (ContainerInt i = 1; i < RegisteredRenderComponents.Size(); i++)
+	{
+		OutBounds = FCollisionAABB::Combine(OutBounds, RegisteredRenderComponents[i]->GetRenderBounds());
+	}
+
+	return true;
+}
+
+void EEntity::MarkRenderBoundsDirty()
+{
+	// Pending destroy entities are already removed from culling or will be soon
+	if (!bIsPendingDestroy && !RenderCullingState.bIsBoundsDirty)
+	{
+		EntityManagerOwner->GetRenderCulling().MarkEntityBoundsDirty(this);
+	}
+}
+
+void EEntity::RegisterRenderComponent(URenderComponent* InRenderComponent)
+{
+	RegisteredRenderComponents.Push(InRenderComponent);
+
+	MarkRenderBoundsDirty();
+}
+
+void EEntity::UnRegisterRenderComponent(URenderComponent* InRenderComponent)
+{
+	if (RegisteredRenderComponents.Remove(InRenderComponent))
+	{
+		MarkRenderBoundsDirty();
+	}
+}
+
 bool EEntity::IsAttached() const
 {
-	return (EntityAttachment != nullptr);
+	return EntityAttachment.IsValid();
 }
 
 void EEntity::ResetAttachment()
 {
-	if (EntityAttachment != nullptr)
+	if (EntityAttachment.GetEntityManager() != nullptr)
 	{
-		OnDeAttachedFromEntity();
+		// Delegates of destroyed entity are already gone
+		if (EntityAttachment.IsValid())
+		{
+			OnDeAttachedFromEntity();
+		}
 
-		EntityAttachment = nullptr;
+		EntityAttachment.Reset();
 		EntityAttachmentRootComponent = nullptr;
 	}
 }
@@ -104,7 +152,7 @@ void EEntity::AttachToEntity(EEntity* InEntityToAttachTo)
 	{
 		ResetAttachment();
 
-		EntityAttachment = InEntityToAttachTo;
+		EntityAttachment = InEntityToAttachTo->GetEntityHandle();
 		EntityAttachmentRootComponent = InEntityToAttachTo->GetRootComponent();
 
 		OnAttachedToEntity();
@@ -146,9 +194,9 @@ void EEntity::SetRelativeLocation(const FVector2D<int32> NewLocation)
 {
 	AttachmentRelativeLocation = NewLocation;
 
-	if (EntityAttachmentRootComponent != nullptr)
+	if (UParentComponent* AttachmentRootComponent = GetEntityAttachmentRootComponent())
 	{
-		OnAttachedComponentLocationChanged(EntityAttachmentRootComponent->GetLocation());
+		OnAttachedComponentLocationChanged(AttachmentRootComponent->GetLocation());
 	}
 }
 
@@ -156,9 +204,9 @@ void EEntity::SetRelativeRotation(const int32 NewRotation)
 {
 	AttachmentRelativeRotation = NewRotation;
 
-	if (EntityAttachmentRootComponent != nullptr)
+	if (UParentComponent* AttachmentRootComponent = GetEntityAttachmentRootComponent())
 	{
-		OnAttachedComponentRotationChanged(EntityAttachmentRootComponent->GetRotation());
+		OnAttachedComponentRotationChanged(AttachmentRootComponent->GetRotation());
 	}
 }
 
@@ -240,16 +288,22 @@ FGameModeBase* EEntity::GetGameMode() const
 
 void EEntity::RegisterInputInternal()
 {
-	FEventHandler* InputHandler = FGlobalDefines::GEngine->GetEventHandler();
+	if (FGlobalDefines::GEngine != nullptr)
+	{
+		FEventHandler* InputHandler = FGlobalDefines::GEngine->GetEventHandler();
 
-	RegisterInput(InputHandler);
+		RegisterInput(InputHandler);
+	}
 }
 
 void EEntity::UnRegisterInputInternal()
 {
-	FEventHandler* InputHandler = FGlobalDefines::GEngine->GetEventHandler();
+	if (FGlobalDefines::GEngine != nullptr)
+	{
+		FEventHandler* InputHandler = FGlobalDefines::GEngine->GetEventHandler();
 
-	UnRegisterInput(InputHandler);
+		UnRegisterInput(InputHandler);
+	}
 }
 
 void EEntity::SetupAIActions()
@@ -271,6 +325,26 @@ void EEntity::OnComponentCreated(const std::string& ComponentName, UBaseComponen
 	}
 }
 
+FComponentStorage& EEntity::GetComponentStorage() const
+{
+	return EntityManagerOwner->GetComponentStorage();
+}
+
+FStorageEntityId EEntity::GetOrCreateStorageEntityId()
+{
+	if (StorageEntityId == INDEX_NONE)
+	{
+		StorageEntityId = GetComponentStorage().CreateEntity();
+	}
+
+	return StorageEntityId;
+}
+
+UParentComponent* EEntity::GetEntityAttachmentRootComponent() const
+{
+	return EntityAttachment.IsValid() ? EntityAttachmentRootComponent : nullptr;
+}
+
 void EEntity::OnAttachedToEntity()
 {
 	if (EntityAttachmentRootComponent != nullptr)
@@ -0,0 +1,31 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/EntityHandle.h"
+
+FEntityHandle::FEntityHandle()
+	: EntityManager(nullptr)
+{
+}
+
+FEntityHandle::FEntityHandle(FEntityManager* InEntityManager, const FSlotMapKey& InKey)
+	: EntityManager(InEntityManager)
+	, Key(InKey)
+{
+}
+
+EEntity* FEntityHandle::Get() const
+{
+	return (EntityManager != nullptr) ? EntityManager->GetEntityByHandle(*this) : nullptr;
+}
+
+bool FEntityHandle::IsValid() const
+{
+	return (Get() != nullptr);
+}
+
+void FEntityHandle::Reset()
+{
+	EntityManager = nullptr;
+	Key = FSlotMapKey();
+}
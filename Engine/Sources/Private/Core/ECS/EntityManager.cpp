@@ -3,8 +3,13 @@
 #include "CoreEngine.h"
 #include "ECS/EntityManager.h"
 
+#include "Renderer/Window.h"
+
+#include <algorithm>
+
 FEntityManager::FEntityManager(FWindow* InOwnerWindow)
-	: OwnerWindow(InOwnerWindow)
+	: LastNumberOfRenderedEntities(0)
+	, OwnerWindow(InOwnerWindow)
 {
 }
 
@@ -12,6 +17,12 @@ FEntityManager::~FEntityManager()
 {
 	OnEntityManagerDestroyed.Execute();
 
+	FlushPendingDestroyEntities();
+
+	// Entities are deleted one by one below, handles to them must not resolve during EndPlay of others
+	EntitySlots.Clear();
+
+	// Entities destroyed from EndPlay below are deleted by this loop anyway
 	for (EEntity* Entity : Entities)
 	{
 		Entity->EndPlay();
@@ -20,47 +31,157 @@ FEntityManager::~FEntityManager()
 	}
 
 	Entities.Clear();
+	PendingDestroyEntities.Clear();
+	RenderCulling.Clear();
+
+	EntitySystems.Clear();
+
+	ComponentStorage.Clear();
 }
 
 bool FEntityManager::DestroyEntity(const EEntity* Entity)
 {
-	bool bWasFound = false;
+	if (Entity != nullptr && Entity->GetEntityHandle().GetEntityManager() == this)
+	{
+		return DestroyEntity(Entity->GetEntityHandle());
+	}
+
+	return false;
+}
+
+bool FEntityManager::DestroyEntity(const FEntityHandle& EntityHandle)
+{
+	EEntity* Entity = GetEntityByHandle(EntityHandle);
+	if (Entity != nullptr)
+	{
+		// Release slot now so handles become invalid, actual destruction waits for safe point
+		EntitySlots.Remove(EntityHandle.GetKey());
 
-	for (ContainerInt i = 0; i < Entities.Size(); i++)
+		Entity->bIsPendingDestroy = true;
+
+		PendingDestroyEntities.Push(Entity);
+
+		return true;
+	}
+
+	return false;
+}
+
+void FEntityManager::FlushPendingDestroyEntities()
+{
+	if (PendingDestroyEntities.IsEmpty())
+	{
+		return;
+	}
+
+	// Entities marked dirty before destroy are removed from dirty list here, not one by one
+	RenderCulling.UpdateDirtyEntities();
+
+	// EndPlay may destroy more entities, they are appended and handled in same loop
+	for (ContainerInt i = 0; i < PendingDestroyEntities.Size(); i++)
 	{
-		EEntity* CurrentEntity = Entities[i];
-		if (CurrentEntity == Entity)
+		EEntity* PendingEntity = PendingDestroyEntities[i];
+
+		OnEntityPreDestroyed(PendingEntity);
+
+		PendingEntity->EndPlay();
+
+		PendingEntity->ResetAttachment();
+
+		RenderCulling.RemoveEntity(PendingEntity);
+
+		if (PendingEntity->GetStorageEntityId() != INDEX_NONE)
 		{
-			OnEntityPreDestroyed(CurrentEntity);
+			ComponentStorage.DestroyEntity(PendingEntity->GetStorageEntityId());
+		}
+	}
 
-			CurrentEntity->EndPlay();
+	// Single pass keeping order of remaining entities (render order)
+	std::vector<EEntity*>& EntitiesVector = Entities.Vector;
+	EntitiesVector.erase(std::remove_if(EntitiesVector.begin(), EntitiesVector.end(), [](const EEntity* Entity)
+	{
+		return Entity->IsPendingDestroy();
+	}), EntitiesVector.end());
+
+	for (EEntity* PendingEntity : PendingDestroyEntities)
+	{
+		delete PendingEntity;
+	}
 
-			Entities.RemoveAt(i);
+	PendingDestroyEntities.Clear();
+}
+
+EEntity* FEntityManager::GetEntityByHandle(const FEntityHandle& EntityHandle) const
+{
+	EEntity* const* EntityPtr = EntitySlots.Find(EntityHandle.GetKey());
 
-			delete CurrentEntity;
+	return (EntityPtr != nullptr) ? *EntityPtr : nullptr;
+}
 
-			bWasFound = true;
+bool FEntityManager::DestroyEntitySystem(const FEntitySystem* InEntitySystem)
+{
+	for (ContainerInt i = 0; i < EntitySystems.Size(); i++)
+	{
+		if (EntitySystems[i].get() == InEntitySystem)
+		{
+			EntitySystems.RemoveAt(i);
 
-			break;
+			return true;
 		}
 	}
 
-	return bWasFound;
+	return false;
 }
 
 void FEntityManager::Tick(const float DeltaTime)
 {
-	for (EEntity* Entity : Entities)
+	// Index loop, entities can be created during tick
+	for (ContainerInt i = 0; i < Entities.Size(); i++)
+	{
+		EEntity* Entity = Entities[i];
+		if (!Entity->IsPendingDestroy())
+		{
+			Entity->ReceiveTick(DeltaTime);
+		}
+	}
+
+	for (const std::shared_ptr<FEntitySystem>& EntitySystem : EntitySystems)
 	{
-		Entity->ReceiveTick(DeltaTime);
+		EntitySystem->Tick(DeltaTime);
 	}
+
+	// Safe point, nothing iterates entities now
+	FlushPendingDestroyEntities();
+}
+
+FCollisionAABB FEntityManager::GetCameraBounds() const
+{
+	const FVector2D<float> CameraLocation = -OwnerWindow->GetRenderer()->GetRenderOffset();
+	const FVector2D<float> WindowSize = OwnerWindow->GetWindowSize();
+
+	return FCollisionAABB(CameraLocation, CameraLocation + WindowSize);
 }
 
 void FEntityManager::Render()
 {
-	for (EEntity* Entity : Entities)
+	// Entities outside of camera skip whole render path
+	RenderCulling.QueryVisibleEntities(GetCameraBounds(), VisibleEntities);
+
+	LastNumberOfRenderedEntities = 0;
+
+	for (EEntity* Entity : VisibleEntities)
+	{
+		if (!Entity->IsPendingDestroy())
+		{
+			Entity->ReceiveRender();
+
+			LastNumberOfRenderedEntities++;
+		}
+	}
+
+	for (const std::shared_ptr<FEntitySystem>& EntitySystem : EntitySystems)
 	{
-		Entity->ReceiveRender();
+		EntitySystem->Render();
 	}
 }
 
@@ -0,0 +1,183 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/EntityRenderCulling.h"
+
+#include "ECS/Entity.h"
+
+#include <algorithm>
+
+FEntityRenderCulling::FEntityRenderCulling()
+	: NextRenderOrder(0)
+	, NumberOfEntities(0)
+{
+}
+
+void FEntityRenderCulling::AddEntity(EEntity* InEntity)
+{
+	FEntityRenderCullingState& State = InEntity->RenderCullingState;
+	State = FEntityRenderCullingState();
+	State.RenderOrder = NextRenderOrder++;
+
+	NumberOfEntities++;
+
+	// Without proxy entity can not be culled, so it is never missing in first frame
+	AddUnboundedEntity(InEntity);
+
+	MarkEntityBoundsDirty(InEntity);
+}
+
+void FEntityRenderCulling::RemoveEntity(EEntity* InEntity)
+{
+	FEntityRenderCullingState& State = InEntity->RenderCullingState;
+
+	if (State.bIsBoundsDirty)
+	{
+		// Rare, only entities destroyed while other pending entities are flushed
+		DirtyEntities.Remove(InEntity);
+
+		State.bIsBoundsDirty = false;
+	}
+
+	if (State.ProxyId != INDEX_NONE)
+	{
+		SetProxyEntity(State.ProxyId, nullptr);
+
+		Tree.DestroyProxy(State.ProxyId);
+		State.ProxyId = INDEX_NONE;
+	}
+	else
+	{
+		RemoveUnboundedEntity(InEntity);
+	}
+
+	NumberOfEntities--;
+}
+
+void FEntityRenderCulling::Clear()
+{
+	Tree = FAABBTreeBroadphase();
+
+	ProxyEntities.Clear();
+	UnboundedEntities.Clear();
+	DirtyEntities.Clear();
+
+	NumberOfEntities = 0;
+}
+
+void FEntityRenderCulling::MarkEntityBoundsDirty(EEntity* InEntity)
+{
+	FEntityRenderCullingState& State = InEntity->RenderCullingState;
+	if (!State.bIsBoundsDirty)
+	{
+		State.bIsBoundsDirty = true;
+
+		DirtyEntities.Push(InEntity);
+	}
+}
+
+void FEntityRenderCulling::UpdateDirtyEntities()
+{
+	if (DirtyEntities.IsEmpty())
+	{
+		return;
+	}
+
+	for (EEntity* Entity : DirtyEntities)
+	{
+		FEntityRenderCullingState& State = Entity->RenderCullingState;
+		State.bIsBoundsDirty = false;
+
+		FCollisionAABB Bounds;
+		if (Entity->GetRenderBounds(Bounds))
+		{
+			if (State.ProxyId != INDEX_NONE)
+			{
+				// Proxy is reinserted only when bounds leave fat bounds
+				Tree.MoveProxy(State.ProxyId, Bounds);
+			}
+			else
+			{
+				RemoveUnboundedEntity(Entity);
+
+				State.ProxyId = Tree.CreateProxy(Bounds, nullptr);
+				SetProxyEntity(State.ProxyId, Entity);
+			}
+		}
+		else if (State.ProxyId != INDEX_NONE)
+		{
+			SetProxyEntity(State.ProxyId, nullptr);
+
+			Tree.DestroyProxy(State.ProxyId);
+			State.ProxyId = INDEX_NONE;
+
+			AddUnboundedEntity(Entity);
+		}
+	}
+
+	DirtyEntities.Clear();
+
+	// Pairs are never updated, without this moved proxies would pile up
+	Tree.DiscardMovedProxies();
+}
+
+void FEntityRenderCulling::QueryVisibleEntities(const FCollisionAABB& InCameraBounds, CArray<EEntity*>& OutEntities)
+{
+	OutEntities.Clear();
+
+	UpdateDirtyEntities();
+
+	ProxyIdsCache.Clear();
+	Tree.Query(InCameraBounds, ProxyIdsCache);
+
+	for (const FBroadphaseProxyId ProxyId : ProxyIdsCache)
+	{
+		OutEntities.Push(ProxyEntities[ProxyId]);
+	}
+
+	for (EEntity* Entity : UnboundedEntities)
+	{
+		OutEntities.Push(Entity);
+	}
+
+	// Tree order depends on insertion history, keep render order of entities
+	std::sort(OutEntities.Vector.begin(), OutEntities.Vector.end(), [](const EEntity* A, const EEntity* B)
+	{
+		return (A->RenderCullingState.RenderOrder < B->RenderCullingState.RenderOrder);
+	});
+}
+
+void FEntityRenderCulling::AddUnboundedEntity(EEntity* InEntity)
+{
+	InEntity->RenderCullingState.UnboundedIndex = UnboundedEntities.Size();
+
+	UnboundedEntities.Push(InEntity);
+}
+
+void FEntityRenderCulling::RemoveUnboundedEntity(EEntity* InEntity)
+{
+	const int32 Index = InEntity->RenderCullingState.UnboundedIndex;
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Swap with last, order is restored by sort in query
+	EEntity* LastEntity = UnboundedEntities[UnboundedEntities.Size() - 1];
+	UnboundedEntities[Index] = LastEntity;
+	LastEntity->RenderCullingState.UnboundedIndex = Index;
+
+	UnboundedEntities.Vector.pop_back();
+
+	InEntity->RenderCullingState.UnboundedIndex = INDEX_NONE;
+}
+
+void FEntityRenderCulling::SetProxyEntity(const FBroadphaseProxyId ProxyId, EEntity* InEntity)
+{
+	if (ProxyId >= ProxyEntities.Size())
+	{
+		ProxyEntities.Vector.resize(ProxyId + 1, nullptr);
+	}
+
+	ProxyEntities[ProxyId] = InEntity;
+}
@@ -0,0 +1,24 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/EntitySystem.h"
+
+#include "ECS/EntityManager.h"
+
+FEntitySystem::FEntitySystem(FEntityManager* InEntityManager)
+	: EntityManager(InEntityManager)
+{
+}
+
+void FEntitySystem::Tick(const float /*DeltaTime*/)
+{
+}
+
+void FEntitySystem::Render()
+{
+}
+
+FComponentStorage& FEntitySystem::GetComponentStorage() const
+{
+	return EntityManager->GetComponentStorage();
+}
@@ -0,0 +1,388 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Navigation/NavigationFlowField.h"
+#include "ECS/Navigation/NavigationGrid.h"
+#include "ECS/Navigation/NavigationPathfinder.h"
+
+namespace
+{
+	/** Directions ordered so opposite direction of index is 7 - index */
+	constexpr int32 DirectionsX[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+	constexpr int32 DirectionsY[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+	constexpr int32 NumberOfDirections = 8;
+
+	constexpr uint8 GoalDirectionIndex = 8;
+	constexpr uint8 NoDirectionIndex = 255;
+
+	uint8 GetOppositeDirectionIndex(const int32 DirectionIndex)
+	{
+		return static_cast<uint8>(7 - DirectionIndex);
+	}
+
+	int32 GetMoveCost(const int32 DirectionIndex)
+	{
+		return (DirectionsX[DirectionIndex] != 0 && DirectionsY[DirectionIndex] != 0) ? FNavigationPathfinder::DiagonalMoveCost : FNavigationPathfinder::StraightMoveCost;
+	}
+}
+
+FNavigationFlowField::FNavigationFlowField()
+	: TileSize(32, 32)
+	, LastNumberOfUpdatedTiles(0)
+{
+}
+
+void FNavigationFlowField::Build(const FNavigationGrid& InGrid, const FVector2D<int32>& InGoalTile)
+{
+	SizeInTiles = InGrid.GetSizeInTiles();
+	TileSize = InGrid.GetTileSize();
+	GoalTile = InGoalTile;
+
+	const int32 NumberOfTiles = InGrid.GetNumberOfTiles();
+
+	IntegrationCosts.Clear();
+	IntegrationCosts.Vector.resize(NumberOfTiles, UnreachableCost);
+	DirectionIndexes.Clear();
+	DirectionIndexes.Vector.resize(NumberOfTiles, NoDirectionIndex);
+
+	OpenTiles.Clear();
+	LastNumberOfUpdatedTiles = 0;
+
+	if (InGrid.IsWalkable(GoalTile.X, GoalTile.Y))
+	{
+		OpenTile(GetTileIndex(GoalTile.X, GoalTile.Y), 0, GoalDirectionIndex);
+
+		ProcessOpenTiles(InGrid);
+	}
+}
+
+void FNavigationFlowField::OnTileWalkabilityChanged(const FNavigationGrid& InGrid, const FVector2D<int32>& InTile)
+{
+	if (InGrid.GetSizeInTiles() != SizeInTiles)
+	{
+		Build(InGrid, GoalTile);
+
+		return;
+	}
+
+	if (!IsInBounds(InTile.X, InTile.Y))
+	{
+		return;
+	}
+
+	OpenTiles.Clear();
+	LastNumberOfUpdatedTiles = 0;
+
+	// Orthogonal neighbours, diagonal moves between them go along changed tile
+	const FVector2D<int32> SideTiles[4] = {
+		FVector2D<int32>(InTile.X - 1, InTile.Y), FVector2D<int32>(InTile.X + 1, InTile.Y),
+		FVector2D<int32>(InTile.X, InTile.Y - 1), FVector2D<int32>(InTile.X, InTile.Y + 1)
+	};
+
+	if (InGrid.IsWalkable(InTile.X, InTile.Y))
+	{
+		// New moves can only lower costs, so lower costs are spread from tiles next to new moves
+		OpenTileFromNeighbours(InGrid, InTile.X, InTile.Y);
+
+		for (const FVector2D<int32>& SideTile : SideTiles)
+		{
+			OpenTileFromNeighbours(InGrid, SideTile.X, SideTile.Y);
+		}
+	}
+	else
+	{
+		// Removed moves can only raise costs, tiles whose paths used them are computed again from tiles around them
+		CArray<int32> ResetTileIndexes;
+
+		ResetTileWithDependentTiles(InTile.X, InTile.Y, ResetTileIndexes);
+
+		for (const FVector2D<int32>& SideTile : SideTiles)
+		{
+			if (IsInBounds(SideTile.X, SideTile.Y))
+			{
+				const uint8 DirectionIndex = DirectionIndexes[GetTileIndex(SideTile.X, SideTile.Y)];
+				if (DirectionIndex < NumberOfDirections && DirectionsX[DirectionIndex] != 0 && DirectionsY[DirectionIndex] != 0)
+				{
+					const bool bIsMovingAlongTile = (SideTile.X + DirectionsX[DirectionIndex] == InTile.X && SideTile.Y == InTile.Y)
+						|| (SideTile.X == InTile.X && SideTile.Y + DirectionsY[DirectionIndex] == InTile.Y);
+
+					if (bIsMovingAlongTile)
+					{
+						ResetTileWithDependentTiles(SideTile.X, SideTile.Y, ResetTileIndexes);
+					}
+				}
+			}
+		}
+
+		for (const int32 ResetTileIndex : ResetTileIndexes)
+		{
+			OpenTileFromNeighbours(InGrid, ResetTileIndex % SizeInTiles.X, ResetTileIndex / SizeInTiles.X);
+		}
+	}
+
+	ProcessOpenTiles(InGrid);
+}
+
+FVector2D<int32> FNavigationFlowField::GetFlowDirection(const int32 X, const int32 Y) const
+{
+	FVector2D<int32> FlowDirection;
+
+	if (IsInBounds(X, Y))
+	{
+		const uint8 DirectionIndex = DirectionIndexes[GetTileIndex(X, Y)];
+		if (DirectionIndex < NumberOfDirections)
+		{
+			FlowDirection = FVector2D<int32>(DirectionsX[DirectionIndex], DirectionsY[DirectionIndex]);
+		}
+	}
+
+	return FlowDirection;
+}
+
+FVector2D<int32> FNavigationFlowField::LocationToTile(const FVector2D<int32>& InLocation) const
+{
+	return {
+		FMath::FloorToInt(static_cast<float>(InLocation.X) / static_cast<float>(TileSize.X)),
+		FMath::FloorToInt(static_cast<float>(InLocation.Y) / static_cast<float>(TileSize.Y))
+	};
+}
+
+FVector2D<int32> FNavigationFlowField::TileToLocation(const FVector2D<int32>& InTile) const
+{
+	return { (InTile.X * TileSize.X) + (TileSize.X / 2), (InTile.Y * TileSize.Y) + (TileSize.Y / 2) };
+}
+
+void FNavigationFlowField::OpenTile(const int32 TileIndex, const int32 InCost, const uint8 InDirectionIndex)
+{
+	if (InCost < IntegrationCosts[TileIndex])
+	{
+		IntegrationCosts[TileIndex] = InCost;
+		DirectionIndexes[TileIndex] = InDirectionIndex;
+
+		FOpenTile NewOpenTile;
+		NewOpenTile.Cost = InCost;
+		NewOpenTile.TileIndex = TileIndex;
+
+		OpenTiles.Push(NewOpenTile);
+		std::push_heap(OpenTiles.Vector.begin(), OpenTiles.Vector.end());
+	}
+}
+
+void FNavigationFlowField::OpenTileFromNeighbours(const FNavigationGrid& InGrid, const int32 X, const int32 Y)
+{
+	if (!InGrid.IsWalkable(X, Y))
+	{
+		return;
+	}
+
+	const int32 TileIndex = GetTileIndex(X, Y);
+
+	if (X == GoalTile.X && Y == GoalTile.Y)
+	{
+		OpenTile(TileIndex, 0, GoalDirectionIndex);
+
+		return;
+	}
+
+	for (int32 DirectionIndex = 0; DirectionIndex < NumberOfDirections; DirectionIndex++)
+	{
+		const int32 DirectionX = DirectionsX[DirectionIndex];
+		const int32 DirectionY = DirectionsY[DirectionIndex];
+
+		if (InGrid.CanMove(X, Y, DirectionX, DirectionY))
+		{
+			const int32 NeighbourCost = IntegrationCosts[GetTileIndex(X + DirectionX, Y + DirectionY)];
+			if (NeighbourCost != UnreachableCost)
+			{
+				OpenTile(TileIndex, NeighbourCost + GetMoveCost(DirectionIndex), static_cast<uint8>(DirectionIndex));
+			}
+		}
+	}
+}
+
+void FNavigationFlowField::ProcessOpenTiles(const FNavigationGrid& InGrid)
+{
+	while (!OpenTiles.Vector.empty())
+	{
+		std::pop_heap(OpenTiles.Vector.begin(), OpenTiles.Vector.end());
+		const FOpenTile CurrentOpenTile = OpenTiles.Vector.back();
+		OpenTiles.Vector.pop_back();
+
+		// Tile could be added again with lower cost, older entries are skipped
+		if (CurrentOpenTile.Cost > IntegrationCosts[CurrentOpenTile.TileIndex])
+		{
+			continue;
+		}
+
+		LastNumberOfUpdatedTiles++;
+
+		const int32 X = CurrentOpenTile.TileIndex % SizeInTiles.X;
+		const int32 Y = CurrentOpenTile.TileIndex / SizeInTiles.X;
+
+		// Moves are symmetric, so neighbour which can be reached can also move here
+		for (int32 DirectionIndex = 0; DirectionIndex < NumberOfDirections; DirectionIndex++)
+		{
+			const int32 DirectionX = DirectionsX[DirectionIndex];
+			const int32 DirectionY = DirectionsY[DirectionIndex];
+
+			if (InGrid.CanMove(X, Y, DirectionX, DirectionY))
+			{
+				OpenTile(GetTileIndex(X + DirectionX, Y + DirectionY), CurrentOpenTile.Cost + GetMoveCost(DirectionIndex), GetOppositeDirectionIndex(DirectionIndex));
+			}
+		}
+	}
+}
+
+void FNavigationFlowField::ResetTileWithDependentTiles(const int32 X, const int32 Y, CArray<int32>& OutResetTileIndexes)
+{
+	const int32 FirstTileIndex = GetTileIndex(X, Y);
+	if (IntegrationCosts[FirstTileIndex] == UnreachableCost)
+	{
+		return;
+	}
+
+	IntegrationCosts[FirstTileIndex] = UnreachableCost;
+	DirectionIndexes[FirstTileIndex] = NoDirectionIndex;
+
+	// Directions form tree to goal, dependent tiles are subtree of tile
+	const int32 FirstResetIndex = OutResetTileIndexes.Size();
+	OutResetTileIndexes.Push(FirstTileIndex);
+
+	for (int32 ResetIndex = FirstResetIndex; ResetIndex < OutResetTileIndexes.Size(); ResetIndex++)
+	{
+		const int32 TileIndex = OutResetTileIndexes[ResetIndex];
+		const int32 TileX = TileIndex % SizeInTiles.X;
+		const int32 TileY = TileIndex / SizeInTiles.X;
+
+		for (int32 DirectionIndex = 0; DirectionIndex < NumberOfDirections; DirectionIndex++)
+		{
+			const int32 NeighbourX = TileX + DirectionsX[DirectionIndex];
+			const int32 NeighbourY = TileY + DirectionsY[DirectionIndex];
+
+			if (IsInBounds(NeighbourX, NeighbourY))
+			{
+				const int32 NeighbourTileIndex = GetTileIndex(NeighbourX, NeighbourY);
+				if (DirectionIndexes[NeighbourTileIndex] == GetOppositeDirectionIndex(DirectionIndex))
+				{
+					IntegrationCosts[NeighbourTileIndex] = UnreachableCost;
+					DirectionIndexes[NeighbourTileIndex] = NoDirectionIndex;
+
+					OutResetTileIndexes.Push(NeighbourTileIndex);
+				}
+			}
+		}
+	}
+}
+
+FNavigationFlowFieldCache::FNavigationFlowFieldCache()
+	: UseStamp(0)
+	, Capacity(DefaultCapacity)
+	, NumberOfBuilds(0)
+{
+}
+
+std::shared_ptr<FNavigationFlowField> FNavigationFlowFieldCache::GetFlowField(const FNavigationGrid& InGrid, const FVector2D<int32>& InGoalTile)
+{
+	UseStamp++;
+
+	for (FCachedFlowField& CachedFlowField : CachedFlowFields)
+	{
+		if (CachedFlowField.FlowField->GetGoalTile() == InGoalTile)
+		{
+			CachedFlowField.LastUseStamp = UseStamp;
+
+			return CachedFlowField.FlowField;
+		}
+	}
+
+	std::shared_ptr<FNavigationFlowField> FlowField;
+
+	// Evicted field still used by units is up to date, so it's taken back instead of building new one
+	for (int32 EvictedIndex = 0; EvictedIndex < EvictedFlowFields.Size(); EvictedIndex++)
+	{
+		std::shared_ptr<FNavigationFlowField> EvictedFlowField = EvictedFlowFields[EvictedIndex].lock();
+		if (EvictedFlowField != nullptr && EvictedFlowField->GetGoalTile() == InGoalTile)
+		{
+			FlowField = EvictedFlowField;
+
+			EvictedFlowFields.Vector.erase(EvictedFlowFields.Vector.begin() + EvictedIndex);
+
+			break;
+		}
+	}
+
+	if (FlowField == nullptr)
+	{
+		FlowField = std::make_shared<FNavigationFlowField>();
+		FlowField->Build(InGrid, InGoalTile);
+
+		NumberOfBuilds++;
+	}
+
+	FCachedFlowField NewCachedFlowField;
+	NewCachedFlowField.FlowField = FlowField;
+	NewCachedFlowField.LastUseStamp = UseStamp;
+	CachedFlowFields.Push(NewCachedFlowField);
+
+	EvictFlowFields();
+
+	return FlowField;
+}
+
+void FNavigationFlowFieldCache::OnTileWalkabilityChanged(const FNavigationGrid& InGrid, const FVector2D<int32>& InTile)
+{
+	for (FCachedFlowField& CachedFlowField : CachedFlowFields)
+	{
+		CachedFlowField.FlowField->OnTileWalkabilityChanged(InGrid, InTile);
+	}
+
+	for (int32 EvictedIndex = EvictedFlowFields.Size() - 1; EvictedIndex >= 0; EvictedIndex--)
+	{
+		std::shared_ptr<FNavigationFlowField> EvictedFlowField = EvictedFlowFields[EvictedIndex].lock();
+		if (EvictedFlowField != nullptr)
+		{
+			EvictedFlowField->OnTileWalkabilityChanged(InGrid, InTile);
+		}
+		else
+		{
+			EvictedFlowFields.Vector.erase(EvictedFlowFields.Vector.begin() + EvictedIndex);
+		}
+	}
+}
+
+void FNavigationFlowFieldCache::Clear()
+{
+	CachedFlowFields.Clear();
+	EvictedFlowFields.Clear();
+}
+
+void FNavigationFlowFieldCache::SetCapacity(const int32 InCapacity)
+{
+	Capacity = FMath::Max(InCapacity, 1);
+
+	EvictFlowFields();
+}
+
+void FNavigationFlowFieldCache::EvictFlowFields()
+{
+	while (CachedFlowFields.Size() > Capacity)
+	{
+		int32 LeastRecentlyUsedIndex = 0;
+
+		for (int32 CachedIndex = 1; CachedIndex < CachedFlowFields.Size(); CachedIndex++)
+		{
+			if (CachedFlowFields[CachedIndex].LastUseStamp < CachedFlowFields[LeastRecentlyUsedIndex].LastUseStamp)
+			{
+				LeastRecentlyUsedIndex = CachedIndex;
+			}
+		}
+
+		// Kept as weak, so it's repaired as long as some unit follows it
+		if (CachedFlowFields[LeastRecentlyUsedIndex].FlowField.use_count() > 1)
+		{
+			EvictedFlowFields.Push(CachedFlowFields[LeastRecentlyUsedIndex].FlowField);
+		}
+
+		CachedFlowFields.Vector.erase(CachedFlowFields.Vector.begin() + LeastRecentlyUsedIndex);
+	}
+}
@@ -0,0 +1,140 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Navigation/NavigationGrid.h"
+#include "Assets/Assets/MapAsset.h"
+
+FNavigationGrid::FNavigationGrid()
+	: TileSize(32, 32)
+{
+}
+
+void FNavigationGrid::Initialize(const FVector2D<int32>& InSizeInTiles, const FVector2D<int32>& InTileSize)
+{
+	SizeInTiles = FVector2D<int32>(FMath::Max(InSizeInTiles.X, 0), FMath::Max(InSizeInTiles.Y, 0));
+	TileSize = FVector2D<int32>(FMath::Max(InTileSize.X, 1), FMath::Max(InTileSize.Y, 1));
+
+	WalkableTiles.Clear();
+	WalkableTiles.Vector.resize(static_cast<size_t>(SizeInTiles.X) * SizeInTiles.Y, 1);
+}
+
+void FNavigationGrid::BuildFromMapData(const FMapData& InMapData)
+{
+	// Rows might have different length, shorter ones are padded with blocked tiles
+	int32 MapWidth = 0;
+	for (const FMapRow& MapRow : InMapData.MapArray)
+	{
+		MapWidth = FMath::Max(MapWidth, MapRow.Array.Size());
+	}
+
+	Initialize(FVector2D<int32>(MapWidth, InMapData.MapArray.Size()), InMapData.AssetsTileSize);
+
+	for (int32 Y = 0; Y < SizeInTiles.Y; Y++)
+	{
+		for (int32 X = 0; X < SizeInTiles.X; X++)
+		{
+			WalkableTiles[GetTileIndex(X, Y)] = IsMapTileWalkable(InMapData, X, Y) ? 1 : 0;
+		}
+	}
+}
+
+void FNavigationGrid::UpdateTileFromMapData(const FMapData& InMapData, const FVector2D<int32>& InTile)
+{
+	if (IsInBounds(InTile.X, InTile.Y))
+	{
+		SetWalkable(InTile.X, InTile.Y, IsMapTileWalkable(InMapData, InTile.X, InTile.Y));
+	}
+}
+
+void FNavigationGrid::SetWalkable(const int32 X, const int32 Y, const bool bIsWalkable)
+{
+	if (IsInBounds(X, Y))
+	{
+		WalkableTiles[GetTileIndex(X, Y)] = bIsWalkable ? 1 : 0;
+	}
+}
+
+FVector2D<int32> FNavigationGrid::LocationToTile(const FVector2D<int32>& InLocation) const
+{
+	return {
+		FMath::FloorToInt(static_cast<float>(InLocation.X) / static_cast<float>(TileSize.X)),
+		FMath::FloorToInt(static_cast<float>(InLocation.Y) / static_cast<float>(TileSize.Y))
+	};
+}
+
+FVector2D<int32> FNavigationGrid::TileToLocation(const FVector2D<int32>& InTile) const
+{
+	return { (InTile.X * TileSize.X) + (TileSize.X / 2), (InTile.Y * TileSize.Y) + (TileSize.Y / 2) };
+}
+
+bool FNavigationGrid::HasLineOfSight(const FVector2D<int32>& InStartTile, const FVector2D<int32>& InEndTile) const
+{
+	// Walks every tile touched by segment between tile centers
+	int32 DistanceX = FMath::Abs(InEndTile.X - InStartTile.X);
+	int32 DistanceY = FMath::Abs(InEndTile.Y - InStartTile.Y);
+	const int32 StepX = (InEndTile.X > InStartTile.X) ? 1 : -1;
+	const int32 StepY = (InEndTile.Y > InStartTile.Y) ? 1 : -1;
+
+	int32 X = InStartTile.X;
+	int32 Y = InStartTile.Y;
+	int32 NumberOfTilesLeft = 1 + DistanceX + DistanceY;
+	int32 Error = DistanceX - DistanceY;
+
+	DistanceX *= 2;
+	DistanceY *= 2;
+
+	for (; NumberOfTilesLeft > 0; NumberOfTilesLeft--)
+	{
+		if (!IsWalkable(X, Y))
+		{
+			return false;
+		}
+
+		if (Error > 0)
+		{
+			X += StepX;
+			Error -= DistanceY;
+		}
+		else if (Error < 0)
+		{
+			Y += StepY;
+			Error += DistanceX;
+		}
+		else
+		{
+			// Exactly through corner, both tiles next to it are checked as for diagonal move
+			if (NumberOfTilesLeft > 1 && (!IsWalkable(X + StepX, Y) || !IsWalkable(X, Y + StepY)))
+			{
+				return false;
+			}
+
+			X += StepX;
+			Y += StepY;
+			Error += DistanceX - DistanceY;
+			NumberOfTilesLeft--;
+		}
+	}
+
+	return true;
+}
+
+bool FNavigationGrid::IsMapTileWalkable(const FMapData& InMapData, const int32 X, const int32 Y)
+{
+	bool bIsWalkable = false;
+
+	if (InMapData.MapArray.IsValidIndex(Y))
+	{
+		const FMapRow& MapRow = InMapData.MapArray[Y];
+		if (MapRow.Array.IsValidIndex(X))
+		{
+			// Tile without asset has nothing to walk on
+			const int32 AssetIndex = MapRow.Array[X];
+			if (InMapData.MapSubAssetSettingsArray.IsValidIndex(AssetIndex))
+			{
+				bIsWalkable = (InMapData.MapSubAssetSettingsArray[AssetIndex].Collision == 0);
+			}
+		}
+	}
+
+	return bIsWalkable;
+}
@@ -0,0 +1,891 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Navigation/NavigationHierarchy.h"
+#include "ECS/Navigation/NavigationFlowField.h"
+#include "ECS/Navigation/NavigationPathfinder.h"
+
+namespace
+{
+	constexpr int32 UnreachableCost = FNavigationFlowField::UnreachableCost;
+
+	int32 GetDirection(const int32 Value)
+	{
+		return (Value > 0) - (Value < 0);
+	}
+
+	/** Appends tile unless it's same as last one, pieces of path share tiles where they meet */
+	void AppendPathTile(const FVector2D<int32>& InTile, CArray<FVector2D<int32>>& OutTiles)
+	{
+		if (OutTiles.Size() == 0 || OutTiles.Vector.back() != InTile)
+		{
+			OutTiles.Push(InTile);
+		}
+	}
+
+	/** Keeps only start, turning and end tiles of path made of single steps */
+	void CompressPath(const CArray<FVector2D<int32>>& InTiles, CArray<FVector2D<int32>>& OutTiles)
+	{
+		OutTiles.Clear();
+
+		for (const FVector2D<int32>& Tile : InTiles.Vector)
+		{
+			const int32 NumberOfPathTiles = OutTiles.Size();
+			if (NumberOfPathTiles >= 2)
+			{
+				const FVector2D<int32>& LastTile = OutTiles[NumberOfPathTiles - 1];
+				const FVector2D<int32>& BeforeLastTile = OutTiles[NumberOfPathTiles - 2];
+
+				if (GetDirection(LastTile.X - BeforeLastTile.X) == GetDirection(Tile.X - LastTile.X)
+					&& GetDirection(LastTile.Y - BeforeLastTile.Y) == GetDirection(Tile.Y - LastTile.Y))
+				{
+					OutTiles[NumberOfPathTiles - 1] = Tile;
+
+					continue;
+				}
+			}
+
+			OutTiles.Push(Tile);
+		}
+	}
+
+	uint64 MakeClusterPairKey(const int32 StartClusterIndex, const int32 EndClusterIndex)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(StartClusterIndex)) << 32) | static_cast<uint32>(EndClusterIndex);
+	}
+}
+
+FNavigationHierarchy::FNavigationHierarchy()
+	: ClusterSize(DefaultClusterSize)
+	, bUseAbstractPathCache(true)
+	, CacheUseStamp(0)
+	, GraphVersion(0)
+	, NumberOfCacheHits(0)
+{
+}
+
+FNavigationHierarchy::FNavigationHierarchy(const FNavigationHierarchy& Other)
+{
+	std::shared_lock Lock(Other.Mutex);
+	std::lock_guard CacheLock(Other.CacheMutex);
+
+	Grid = Other.Grid;
+	ClusterSize = Other.ClusterSize;
+	NumberOfClusters = Other.NumberOfClusters;
+	Clusters = Other.Clusters;
+	Nodes = Other.Nodes;
+	FreeNodeIds = Other.FreeNodeIds;
+	NodeIdByTileIndex = Other.NodeIdByTileIndex;
+	AbstractPathCache = Other.AbstractPathCache;
+	bUseAbstractPathCache = Other.bUseAbstractPathCache;
+	CacheUseStamp = Other.CacheUseStamp;
+	GraphVersion = Other.GraphVersion;
+	NumberOfCacheHits = Other.NumberOfCacheHits;
+}
+
+void FNavigationHierarchy::Build(const FNavigationGrid& InGrid, const int32 InClusterSize)
+{
+	std::unique_lock Lock(Mutex);
+
+	Grid = InGrid;
+	ClusterSize = FMath::Max(InClusterSize, 2);
+
+	const FVector2D<int32> SizeInTiles = Grid.GetSizeInTiles();
+	NumberOfClusters.X = (SizeInTiles.X + ClusterSize - 1) / ClusterSize;
+	NumberOfClusters.Y = (SizeInTiles.Y + ClusterSize - 1) / ClusterSize;
+
+	Clusters.Clear();
+	Nodes.Clear();
+	FreeNodeIds.Clear();
+	NodeIdByTileIndex.Clear();
+	AbstractPathCache.Clear();
+
+	Clusters.SetNum(NumberOfClusters.X * NumberOfClusters.Y);
+
+	for (int32 ClusterY = 0; ClusterY < NumberOfClusters.Y; ClusterY++)
+	{
+		for (int32 ClusterX = 0; ClusterX < NumberOfClusters.X; ClusterX++)
+		{
+			// Clusters on right and bottom edge may be smaller
+			FCluster& Cluster = Clusters[(ClusterY * NumberOfClusters.X) + ClusterX];
+			Cluster.Min = FVector2D<int32>(ClusterX * ClusterSize, ClusterY * ClusterSize);
+			Cluster.Size = FVector2D<int32>(FMath::Min(ClusterSize, SizeInTiles.X - Cluster.Min.X), FMath::Min(ClusterSize, SizeInTiles.Y - Cluster.Min.Y));
+		}
+	}
+
+	for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Size(); ClusterIndex++)
+	{
+		BuildEntrances(ClusterIndex, true);
+		BuildEntrances(ClusterIndex, false);
+	}
+
+	for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Size(); ClusterIndex++)
+	{
+		BuildIntraClusterEdges(ClusterIndex);
+	}
+
+	GraphVersion++;
+}
+
+void FNavigationHierarchy::SetTileWalkable(const FVector2D<int32>& InTile, const bool bIsWalkable)
+{
+	std::unique_lock Lock(Mutex);
+
+	if (!Grid.IsInBounds(InTile.X, InTile.Y) || Grid.IsWalkable(InTile.X, InTile.Y) == bIsWalkable)
+	{
+		return;
+	}
+
+	Grid.SetWalkable(InTile.X, InTile.Y, bIsWalkable);
+
+	const int32 ClusterX = InTile.X / ClusterSize;
+	const int32 ClusterY = InTile.Y / ClusterSize;
+	const int32 ClusterIndex = GetClusterIndex(InTile.X, InTile.Y);
+
+	// Openings on all four borders of cluster, west and north ones are kept by neighbours
+	RemoveEntrances(Clusters[ClusterIndex].EastEntrances);
+	BuildEntrances(ClusterIndex, true);
+	RemoveEntrances(Clusters[ClusterIndex].SouthEntrances);
+	BuildEntrances(ClusterIndex, false);
+
+	if (ClusterX > 0)
+	{
+		RemoveEntrances(Clusters[ClusterIndex - 1].EastEntrances);
+		BuildEntrances(ClusterIndex - 1, true);
+	}
+
+	if (ClusterY > 0)
+	{
+		RemoveEntrances(Clusters[ClusterIndex - NumberOfClusters.X].SouthEntrances);
+		BuildEntrances(ClusterIndex - NumberOfClusters.X, false);
+	}
+
+	// Portals of neighbours could change, so their connections are built again too
+	BuildIntraClusterEdges(ClusterIndex);
+
+	if (ClusterX > 0)
+	{
+		BuildIntraClusterEdges(ClusterIndex - 1);
+	}
+
+	if (ClusterX < NumberOfClusters.X - 1)
+	{
+		BuildIntraClusterEdges(ClusterIndex + 1);
+	}
+
+	if (ClusterY > 0)
+	{
+		BuildIntraClusterEdges(ClusterIndex - NumberOfClusters.X);
+	}
+
+	if (ClusterY < NumberOfClusters.Y - 1)
+	{
+		BuildIntraClusterEdges(ClusterIndex + NumberOfClusters.X);
+	}
+
+	GraphVersion++;
+}
+
+bool FNavigationHierarchy::FindPath(const FVector2D<int32>& InStartTile, const FVector2D<int32>& InEndTile, CArray<FVector2D<int32>>& OutPathTiles, int32& OutPathCost)
+{
+	std::shared_lock Lock(Mutex);
+
+	OutPathTiles.Clear();
+	OutPathCost = 0;
+
+	if (!Grid.IsWalkable(InStartTile.X, InStartTile.Y) || !Grid.IsWalkable(InEndTile.X, InEndTile.Y))
+	{
+		return false;
+	}
+
+	if (InStartTile == InEndTile)
+	{
+		OutPathTiles.Push(InStartTile);
+
+		return true;
+	}
+
+	const std::shared_ptr<FSearchScratch> Scratch = AcquireScratch();
+
+	const int32 StartClusterIndex = GetClusterIndex(InStartTile.X, InStartTile.Y);
+	const int32 EndClusterIndex = GetClusterIndex(InEndTile.X, InEndTile.Y);
+	const FCluster& StartCluster = Clusters[StartClusterIndex];
+	const FCluster& EndCluster = Clusters[EndClusterIndex];
+
+	CArray<FVector2D<int32>> FullPathTiles;
+
+	// Path inside one cluster does not need portals
+	if (StartClusterIndex == EndClusterIndex)
+	{
+		RunLocalSearch(*Scratch, StartCluster, InStartTile, &InEndTile);
+
+		const int32 LocalCost = GetLocalCost(*Scratch, StartCluster, InEndTile);
+		if (LocalCost != UnreachableCost)
+		{
+			AppendLocalPathToSource(*Scratch, StartCluster, InEndTile, FullPathTiles);
+			std::reverse(FullPathTiles.Vector.begin(), FullPathTiles.Vector.end());
+
+			CompressPath(FullPathTiles, OutPathTiles);
+			OutPathCost = LocalCost;
+
+			ReleaseScratch(Scratch);
+
+			return true;
+		}
+	}
+
+	// Connect start and end to portals of their clusters
+	CArray<int32>& NodeStartCosts = Scratch->NodeStartCosts;
+	CArray<int32>& NodeEndCosts = Scratch->NodeEndCosts;
+
+	const int32 NumberOfNodes = Nodes.Size();
+	if (NodeStartCosts.Size() != NumberOfNodes)
+	{
+		NodeStartCosts.Clear();
+		NodeStartCosts.Vector.resize(NumberOfNodes, UnreachableCost);
+		NodeEndCosts.Clear();
+		NodeEndCosts.Vector.resize(NumberOfNodes, UnreachableCost);
+	}
+
+	RunLocalSearch(*Scratch, StartCluster, InStartTile);
+	for (const int32 NodeId : StartCluster.NodeIds.Vector)
+	{
+		NodeStartCosts[NodeId] = GetLocalCost(*Scratch, StartCluster, Nodes[NodeId].Tile);
+	}
+
+	RunLocalSearch(*Scratch, EndCluster, InEndTile);
+	for (const int32 NodeId : EndCluster.NodeIds.Vector)
+	{
+		NodeEndCosts[NodeId] = GetLocalCost(*Scratch, EndCluster, Nodes[NodeId].Tile);
+	}
+
+	CArray<int32> AbstractPathNodeIds;
+	bool bIsPathFound = false;
+
+	const uint64 ClusterPairKey = MakeClusterPairKey(StartClusterIndex, EndClusterIndex);
+
+	if (bUseAbstractPathCache)
+	{
+		std::lock_guard CacheLock(CacheMutex);
+
+		auto CachedPathIterator = AbstractPathCache.Map.find(ClusterPairKey);
+		if (CachedPathIterator != AbstractPathCache.Map.end())
+		{
+			FCachedAbstractPath& CachedPath = CachedPathIterator->second;
+
+			// Cached path is usable when graph did not change and both ends can reach its portals
+			if (CachedPath.GraphVersion == GraphVersion
+				&& NodeStartCosts[CachedPath.NodeIds.Vector.front()] != UnreachableCost
+				&& NodeEndCosts[CachedPath.NodeIds.Vector.back()] != UnreachableCost)
+			{
+				CachedPath.LastUseStamp = ++CacheUseStamp;
+				AbstractPathNodeIds = CachedPath.NodeIds;
+
+				NumberOfCacheHits++;
+				bIsPathFound = true;
+			}
+		}
+	}
+
+	if (!bIsPathFound)
+	{
+		bIsPathFound = FindAbstractPath(*Scratch, InStartTile, InEndTile, StartClusterIndex, AbstractPathNodeIds);
+
+		if (bIsPathFound && bUseAbstractPathCache)
+		{
+			std::lock_guard CacheLock(CacheMutex);
+
+			if (AbstractPathCache.Size() >= AbstractPathCacheCapacity && !AbstractPathCache.ContainsKey(ClusterPairKey))
+			{
+				// Forget least recently used path
+				auto OldestPathIterator = AbstractPathCache.Map.begin();
+				for (auto It = AbstractPathCache.Map.begin(); It != AbstractPathCache.Map.end(); ++It)
+				{
+					if (It->second.LastUseStamp < OldestPathIterator->second.LastUseStamp)
+					{
+						OldestPathIterator = It;
+					}
+				}
+
+				AbstractPathCache.Map.erase(OldestPathIterator);
+			}
+
+			FCachedAbstractPath& CachedPath = AbstractPathCache.Map[ClusterPairKey];
+			CachedPath.NodeIds = AbstractPathNodeIds;
+			CachedPath.GraphVersion = GraphVersion;
+			CachedPath.LastUseStamp = ++CacheUseStamp;
+		}
+	}
+
+	if (bIsPathFound)
+	{
+		OutPathCost = RefinePath(*Scratch, InStartTile, InEndTile, AbstractPathNodeIds, FullPathTiles);
+
+		CompressPath(FullPathTiles, OutPathTiles);
+	}
+
+	// Costs are kept only for this query
+	for (const int32 NodeId : StartCluster.NodeIds.Vector)
+	{
+		NodeStartCosts[NodeId] = UnreachableCost;
+	}
+
+	for (const int32 NodeId : EndCluster.NodeIds.Vector)
+	{
+		NodeEndCosts[NodeId] = UnreachableCost;
+	}
+
+	ReleaseScratch(Scratch);
+
+	return bIsPathFound;
+}
+
+void FNavigationHierarchy::SetUseAbstractPathCache(const bool bInUseAbstractPathCache)
+{
+	std::unique_lock Lock(Mutex);
+
+	bUseAbstractPathCache = bInUseAbstractPathCache;
+
+	if (!bUseAbstractPathCache)
+	{
+		AbstractPathCache.Clear();
+	}
+}
+
+int32 FNavigationHierarchy::GetNumberOfNodes() const
+{
+	std::shared_lock Lock(Mutex);
+
+	return NodeIdByTileIndex.Size();
+}
+
+int32 FNavigationHierarchy::GetNumberOfEdges() const
+{
+	std::shared_lock Lock(Mutex);
+
+	int32 NumberOfEdges = 0;
+
+	for (const FNode& Node : Nodes.Vector)
+	{
+		NumberOfEdges += Node.Edges.Size();
+	}
+
+	return NumberOfEdges;
+}
+
+int32 FNavigationHierarchy::GetNumberOfCacheHits() const
+{
+	std::lock_guard CacheLock(CacheMutex);
+
+	return NumberOfCacheHits;
+}
+
+void FNavigationHierarchy::BuildEntrances(const int32 ClusterIndex, const bool bIsEastBorder)
+{
+	const FCluster& Cluster = Clusters[ClusterIndex];
+
+	const int32 ClusterX = ClusterIndex % NumberOfClusters.X;
+	const int32 ClusterY = ClusterIndex / NumberOfClusters.X;
+
+	// Last cluster in row or column has no border on that side
+	if ((bIsEastBorder && ClusterX >= NumberOfClusters.X - 1) || (!bIsEastBorder && ClusterY >= NumberOfClusters.Y - 1))
+	{
+		return;
+	}
+
+	const int32 NeighbourClusterIndex = bIsEastBorder ? (ClusterIndex + 1) : (ClusterIndex + NumberOfClusters.X);
+
+	// Tiles along border are walked with Offset, tile on other side is one step in Normal direction
+	const FVector2D<int32> Normal = bIsEastBorder ? FVector2D<int32>(1, 0) : FVector2D<int32>(0, 1);
+	const FVector2D<int32> Along = bIsEastBorder ? FVector2D<int32>(0, 1) : FVector2D<int32>(1, 0);
+	const FVector2D<int32> BorderStart = bIsEastBorder
+		? FVector2D<int32>(Cluster.Min.X + Cluster.Size.X - 1, Cluster.Min.Y)
+		: FVector2D<int32>(Cluster.Min.X, Cluster.Min.Y + Cluster.Size.Y - 1);
+	const int32 BorderLength = bIsEastBorder ? Cluster.Size.Y : Cluster.Size.X;
+
+	CArray<FEntrance> NewEntrances;
+
+	auto AddEntrance = [&](const int32 Offset)
+	{
+		const FVector2D<int32> Tile(BorderStart.X + (Along.X * Offset), BorderStart.Y + (Along.Y * Offset));
+		const FVector2D<int32> NeighbourTile(Tile.X + Normal.X, Tile.Y + Normal.Y);
+
+		FEntrance Entrance;
+		Entrance.NodeIdA = AddNode(Tile, ClusterIndex);
+		Entrance.NodeIdB = AddNode(NeighbourTile, NeighbourClusterIndex);
+
+		FEdge InterClusterEdge;
+		InterClusterEdge.Cost = FNavigationPathfinder::StraightMoveCost;
+		InterClusterEdge.bIsIntraClusterEdge = false;
+
+		InterClusterEdge.ToNodeId = Entrance.NodeIdB;
+		Nodes[Entrance.NodeIdA].Edges.Push(InterClusterEdge);
+
+		InterClusterEdge.ToNodeId = Entrance.NodeIdA;
+		Nodes[Entrance.NodeIdB].Edges.Push(InterClusterEdge);
+
+		NewEntrances.Push(Entrance);
+	};
+
+	int32 OpeningStart = INDEX_NONE;
+
+	for (int32 Offset = 0; Offset <= BorderLength; Offset++)
+	{
+		const FVector2D<int32> Tile(BorderStart.X + (Along.X * Offset), BorderStart.Y + (Along.Y * Offset));
+		const bool bIsOpen = (Offset < BorderLength) && Grid.IsWalkable(Tile.X, Tile.Y) && Grid.IsWalkable(Tile.X + Normal.X, Tile.Y + Normal.Y);
+
+		if (bIsOpen && OpeningStart == INDEX_NONE)
+		{
+			OpeningStart = Offset;
+		}
+		else if (!bIsOpen && OpeningStart != INDEX_NONE)
+		{
+			const int32 OpeningEnd = Offset - 1;
+
+			if ((OpeningEnd - OpeningStart + 1) <= MaxOpeningWidthForSinglePortal)
+			{
+				AddEntrance((OpeningStart + OpeningEnd) / 2);
+			}
+			else
+			{
+				AddEntrance(OpeningStart);
+				AddEntrance(OpeningEnd);
+			}
+
+			OpeningStart = INDEX_NONE;
+		}
+	}
+
+	FCluster& MutableCluster = Clusters[ClusterIndex];
+	if (bIsEastBorder)
+	{
+		MutableCluster.EastEntrances = NewEntrances;
+	}
+	else
+	{
+		MutableCluster.SouthEntrances = NewEntrances;
+	}
+}
+
+void FNavigationHierarchy::RemoveEntrances(CArray<FEntrance>& InEntrances)
+{
+	for (const FEntrance& Entrance : InEntrances.Vector)
+	{
+		RemoveInterClusterEdge(Entrance.NodeIdA, Entrance.NodeIdB);
+		RemoveInterClusterEdge(Entrance.NodeIdB, Entrance.NodeIdA);
+
+		ReleaseNode(Entrance.NodeIdA);
+		ReleaseNode(Entrance.NodeIdB);
+	}
+
+	InEntrances.Clear();
+}
+
+void FNavigationHierarchy::BuildIntraClusterEdges(const int32 ClusterIndex)
+{
+	const FCluster& Cluster = Clusters[ClusterIndex];
+
+	for (const int32 NodeId : Cluster.NodeIds.Vector)
+	{
+		CArray<FEdge>& Edges = Nodes[NodeId].Edges;
+
+		Edges.Vector.erase(std::remove_if(Edges.Vector.begin(), Edges.Vector.end(), [](const FEdge& Edge)
+		{
+			return Edge.bIsIntraClusterEdge;
+		}), Edges.Vector.end());
+	}
+
+	for (const int32 NodeId : Cluster.NodeIds.Vector)
+	{
+		RunLocalSearch(BuildScratch, Cluster, Nodes[NodeId].Tile);
+
+		for (const int32 OtherNodeId : Cluster.NodeIds.Vector)
+		{
+			if (OtherNodeId != NodeId)
+			{
+				const int32 Cost = GetLocalCost(BuildScratch, Cluster, Nodes[OtherNodeId].Tile);
+				if (Cost != UnreachableCost)
+				{
+					FEdge IntraClusterEdge;
+					IntraClusterEdge.ToNodeId = OtherNodeId;
+					IntraClusterEdge.Cost = Cost;
+					IntraClusterEdge.bIsIntraClusterEdge = true;
+
+					Nodes[NodeId].Edges.Push(IntraClusterEdge);
+				}
+			}
+		}
+	}
+}
+
+int32 FNavigationHierarchy::AddNode(const FVector2D<int32>& InTile, const int32 ClusterIndex)
+{
+	const int32 TileIndex = Grid.GetTileIndex(InTile.X, InTile.Y);
+
+	// Portal tile may be shared by openings on two borders near cluster corner
+	std::optional<int32> ExistingNodeId = NodeIdByTileIndex.FindValueByKey(TileIndex);
+	if (ExistingNodeId.has_value())
+	{
+		Nodes[ExistingNodeId.value()].NumberOfEntrances++;
+
+		return ExistingNodeId.value();
+	}
+
+	int32 NodeId;
+	if (FreeNodeIds.Size() > 0)
+	{
+		NodeId = FreeNodeIds.Vector.back();
+		FreeNodeIds.Vector.pop_back();
+	}
+	else
+	{
+		NodeId = Nodes.Size();
+		Nodes.Push(FNode());
+	}
+
+	FNode& Node = Nodes[NodeId];
+	Node.Tile = InTile;
+	Node.ClusterIndex = ClusterIndex;
+	Node.NumberOfEntrances = 1;
+	Node.Edges.Clear();
+
+	Clusters[ClusterIndex].NodeIds.Push(NodeId);
+	NodeIdByTileIndex.Emplace(TileIndex, NodeId);
+
+	return NodeId;
+}
+
+void FNavigationHierarchy::ReleaseNode(const int32 NodeId)
+{
+	FNode& Node = Nodes[NodeId];
+
+	Node.NumberOfEntrances--;
+	if (Node.NumberOfEntrances <= 0)
+	{
+		// Intra cluster edges pointing to it are removed when its cluster is rebuilt
+		CArray<int32>& ClusterNodeIds = Clusters[Node.ClusterIndex].NodeIds;
+		ClusterNodeIds.Vector.erase(std::remove(ClusterNodeIds.Vector.begin(), ClusterNodeIds.Vector.end(), NodeId), ClusterNodeIds.Vector.end());
+
+		NodeIdByTileIndex.Remove(Grid.GetTileIndex(Node.Tile.X, Node.Tile.Y));
+
+		Node.Edges.Clear();
+		FreeNodeIds.Push(NodeId);
+	}
+}
+
+void FNavigationHierarchy::RemoveInterClusterEdge(const int32 FromNodeId, const int32 ToNodeId)
+{
+	CArray<FEdge>& Edges = Nodes[FromNodeId].Edges;
+
+	for (auto It = Edges.Vector.begin(); It != Edges.Vector.end(); ++It)
+	{
+		if (!It->bIsIntraClusterEdge && It->ToNodeId == ToNodeId)
+		{
+			Edges.Vector.erase(It);
+
+			break;
+		}
+	}
+}
+
+void FNavigationHierarchy::RunLocalSearch(FSearchScratch& InScratch, const FCluster& InCluster, const FVector2D<int32>& InSourceTile, const FVector2D<int32>* InEndTile) const
+{
+	CArray<int32>& LocalCosts = InScratch.LocalCosts;
+	CArray<int32>& LocalParents = InScratch.LocalParents;
+	CArray<FOpenEntry>& LocalOpenEntries = InScratch.LocalOpenEntries;
+
+	const int32 NumberOfLocalTiles = InCluster.Size.X * InCluster.Size.Y;
+
+	LocalCosts.Clear();
+	LocalCosts.Vector.resize(NumberOfLocalTiles, UnreachableCost);
+	LocalParents.Clear();
+	LocalParents.Vector.resize(NumberOfLocalTiles, INDEX_NONE);
+	LocalOpenEntries.Clear();
+
+	auto GetLocalIndex = [&InCluster](const int32 X, const int32 Y)
+	{
+		return ((Y - InCluster.Min.Y) * InCluster.Size.X) + (X - InCluster.Min.X);
+	};
+
+	const int32 EndLocalIndex = (InEndTile != nullptr) ? GetLocalIndex(InEndTile->X, InEndTile->Y) : INDEX_NONE;
+	const int32 SourceLocalIndex = GetLocalIndex(InSourceTile.X, InSourceTile.Y);
+
+	LocalCosts[SourceLocalIndex] = 0;
+	LocalOpenEntries.Push({ 0, 0, SourceLocalIndex });
+
+	while (!LocalOpenEntries.Vector.empty())
+	{
+		std::pop_heap(LocalOpenEntries.Vector.begin(), LocalOpenEntries.Vector.end());
+		const FOpenEntry OpenEntry = LocalOpenEntries.Vector.back();
+		LocalOpenEntries.Vector.pop_back();
+
+		// Older entry of tile which was reached again with lower cost
+		if (OpenEntry.Cost != LocalCosts[OpenEntry.Index])
+		{
+			continue;
+		}
+
+		if (OpenEntry.Index == EndLocalIndex)
+		{
+			break;
+		}
+
+		const int32 X = InCluster.Min.X + (OpenEntry.Index % InCluster.Size.X);
+		const int32 Y = InCluster.Min.Y + (OpenEntry.Index / InCluster.Size.X);
+
+		for (int32 DirectionY = -1; DirectionY <= 1; DirectionY++)
+		{
+			for (int32 DirectionX = -1; DirectionX <= 1; DirectionX++)
+			{
+				const int32 NeighbourX = X + DirectionX;
+				const int32 NeighbourY = Y + DirectionY;
+
+				const bool bIsInCluster = NeighbourX >= InCluster.Min.X && NeighbourX < InCluster.Min.X + InCluster.Size.X
+					&& NeighbourY >= InCluster.Min.Y && NeighbourY < InCluster.Min.Y + InCluster.Size.Y;
+
+				if ((DirectionX != 0 || DirectionY != 0) && bIsInCluster && Grid.CanMove(X, Y, DirectionX, DirectionY))
+				{
+					const int32 MoveCost = (DirectionX != 0 && DirectionY != 0) ? FNavigationPathfinder::DiagonalMoveCost : FNavigationPathfinder::StraightMoveCost;
+					const int32 NeighbourCost = OpenEntry.Cost + MoveCost;
+					const int32 NeighbourLocalIndex = GetLocalIndex(NeighbourX, NeighbourY);
+
+					if (NeighbourCost < LocalCosts[NeighbourLocalIndex])
+					{
+						LocalCosts[NeighbourLocalIndex] = NeighbourCost;
+						LocalParents[NeighbourLocalIndex] = OpenEntry.Index;
+
+						LocalOpenEntries.Push({ NeighbourCost, NeighbourCost, NeighbourLocalIndex });
+						std::push_heap(LocalOpenEntries.Vector.begin(), LocalOpenEntries.Vector.end());
+					}
+				}
+			}
+		}
+	}
+}
+
+int32 FNavigationHierarchy::GetLocalCost(const FSearchScratch& InScratch, const FCluster& InCluster, const FVector2D<int32>& InTile) const
+{
+	return InScratch.LocalCosts[((InTile.Y - InCluster.Min.Y) * InCluster.Size.X) + (InTile.X - InCluster.Min.X)];
+}
+
+void FNavigationHierarchy::AppendLocalPathToSource(const FSearchScratch& InScratch, const FCluster& InCluster, const FVector2D<int32>& InTile, CArray<FVector2D<int32>>& OutTiles) const
+{
+	int32 LocalIndex = ((InTile.Y - InCluster.Min.Y) * InCluster.Size.X) + (InTile.X - InCluster.Min.X);
+
+	while (LocalIndex != INDEX_NONE)
+	{
+		AppendPathTile(FVector2D<int32>(InCluster.Min.X + (LocalIndex % InCluster.Size.X), InCluster.Min.Y + (LocalIndex / InCluster.Size.X)), OutTiles);
+
+		LocalIndex = InScratch.LocalParents[LocalIndex];
+	}
+}
+
+bool FNavigationHierarchy::FindAbstractPath(FSearchScratch& InScratch, const FVector2D<int32>& InStartTile, const FVector2D<int32>& InEndTile, const int32 StartClusterIndex, CArray<int32>& OutNodeIds) const
+{
+	OutNodeIds.Clear();
+
+	const CArray<int32>& NodeStartCosts = InScratch.NodeStartCosts;
+	const CArray<int32>& NodeEndCosts = InScratch.NodeEndCosts;
+	CArray<int32>& AbstractCosts = InScratch.AbstractCosts;
+	CArray<int32>& AbstractParents = InScratch.AbstractParents;
+	CArray<uint32>& AbstractVisitedStamps = InScratch.AbstractVisitedStamps;
+	CArray<uint32>& AbstractClosedStamps = InScratch.AbstractClosedStamps;
+	CArray<FOpenEntry>& AbstractOpenEntries = InScratch.AbstractOpenEntries;
+	uint32& AbstractSearchStamp = InScratch.AbstractSearchStamp;
+
+	const int32 NumberOfNodes = Nodes.Size();
+	const int32 StartIndex = NumberOfNodes;
+	const int32 EndIndex = NumberOfNodes + 1;
+
+	if (AbstractVisitedStamps.Size() != NumberOfNodes + 2)
+	{
+		AbstractCosts.SetNum(NumberOfNodes + 2);
+		AbstractParents.SetNum(NumberOfNodes + 2);
+
+		AbstractVisitedStamps.Clear();
+		AbstractVisitedStamps.Vector.resize(NumberOfNodes + 2, 0);
+		AbstractClosedStamps.Clear();
+		AbstractClosedStamps.Vector.resize(NumberOfNodes + 2, 0);
+
+		AbstractSearchStamp = 0;
+	}
+
+	AbstractSearchStamp++;
+
+	// Stamp wrapped around, old values could be taken as valid
+	if (AbstractSearchStamp == 0)
+	{
+		std::fill(AbstractVisitedStamps.Vector.begin(), AbstractVisitedStamps.Vector.end(), 0);
+		std::fill(AbstractClosedStamps.Vector.begin(), AbstractClosedStamps.Vector.end(), 0);
+
+		AbstractSearchStamp = 1;
+	}
+
+	AbstractOpenEntries.Clear();
+
+	auto OpenNode = [&](const int32 Index, const int32 ParentIndex, const int32 Cost)
+	{
+		if (AbstractClosedStamps[Index] != AbstractSearchStamp && (AbstractVisitedStamps[Index] != AbstractSearchStamp || Cost < AbstractCosts[Index]))
+		{
+			AbstractVisitedStamps[Index] = AbstractSearchStamp;
+			AbstractCosts[Index] = Cost;
+			AbstractParents[Index] = ParentIndex;
+
+			// Costs of connections are lengths of real paths, so octile distance never overestimates
+			const int32 Heuristic = (Index == EndIndex) ? 0 : FNavigationPathfinder::GetOctileDistance(Nodes[Index].Tile, InEndTile);
+
+			AbstractOpenEntries.Push({ Cost + Heuristic, Cost, Index });
+			std::push_heap(AbstractOpenEntries.Vector.begin(), AbstractOpenEntries.Vector.end());
+		}
+	};
+
+	AbstractVisitedStamps[StartIndex] = AbstractSearchStamp;
+	AbstractCosts[StartIndex] = 0;
+	AbstractParents[StartIndex] = INDEX_NONE;
+	AbstractOpenEntries.Push({ FNavigationPathfinder::GetOctileDistance(InStartTile, InEndTile), 0, StartIndex });
+
+	while (!AbstractOpenEntries.Vector.empty())
+	{
+		std::pop_heap(AbstractOpenEntries.Vector.begin(), AbstractOpenEntries.Vector.end());
+		const FOpenEntry OpenEntry = AbstractOpenEntries.Vector.back();
+		AbstractOpenEntries.Vector.pop_back();
+
+		const int32 Index = OpenEntry.Index;
+
+		if (AbstractClosedStamps[Index] == AbstractSearchStamp)
+		{
+			continue;
+		}
+
+		AbstractClosedStamps[Index] = AbstractSearchStamp;
+
+		if (Index == EndIndex)
+		{
+			for (int32 PathIndex = AbstractParents[EndIndex]; PathIndex != StartIndex; PathIndex = AbstractParents[PathIndex])
+			{
+				OutNodeIds.Push(PathIndex);
+			}
+
+			std::reverse(OutNodeIds.Vector.begin(), OutNodeIds.Vector.end());
+
+			return true;
+		}
+
+		if (Index == StartIndex)
+		{
+			for (const int32 NodeId : Clusters[StartClusterIndex].NodeIds.Vector)
+			{
+				if (NodeStartCosts[NodeId] != UnreachableCost)
+				{
+					OpenNode(NodeId, StartIndex, NodeStartCosts[NodeId]);
+				}
+			}
+		}
+		else
+		{
+			for (const FEdge& Edge : Nodes[Index].Edges.Vector)
+			{
+				OpenNode(Edge.ToNodeId, Index, OpenEntry.Cost + Edge.Cost);
+			}
+
+			if (NodeEndCosts[Index] != UnreachableCost)
+			{
+				OpenNode(EndIndex, Index, OpenEntry.Cost + NodeEndCosts[Index]);
+			}
+		}
+	}
+
+	return false;
+}
+
+FNavigationHierarchy::FEdge* FNavigationHierarchy::FindEdge(const int32 FromNodeId, const int32 ToNodeId)
+{
+	FEdge* CheapestEdge = nullptr;
+
+	for (FEdge& Edge : Nodes[FromNodeId].Edges.Vector)
+	{
+		if (Edge.ToNodeId == ToNodeId && (CheapestEdge == nullptr || Edge.Cost < CheapestEdge->Cost))
+		{
+			CheapestEdge = &Edge;
+		}
+	}
+
+	return CheapestEdge;
+}
+
+int32 FNavigationHierarchy::RefinePath(FSearchScratch& InScratch, const FVector2D<int32>& InStartTile, const FVector2D<int32>& InEndTile, const CArray<int32>& InNodeIds, CArray<FVector2D<int32>>& OutTiles)
+{
+	OutTiles.Clear();
+
+	const int32 FirstNodeId = InNodeIds.Vector.front();
+	const int32 LastNodeId = InNodeIds.Vector.back();
+
+	int32 PathCost = InScratch.NodeStartCosts[FirstNodeId] + InScratch.NodeEndCosts[LastNodeId];
+
+	// Start to first portal, search runs from start so path is walked backwards
+	const FCluster& StartCluster = Clusters[Nodes[FirstNodeId].ClusterIndex];
+	RunLocalSearch(InScratch, StartCluster, InStartTile, &Nodes[FirstNodeId].Tile);
+	AppendLocalPathToSource(InScratch, StartCluster, Nodes[FirstNodeId].Tile, OutTiles);
+	std::reverse(OutTiles.Vector.begin(), OutTiles.Vector.end());
+
+	for (int32 PathIndex = 0; PathIndex < InNodeIds.Size() - 1; PathIndex++)
+	{
+		const int32 FromNodeId = InNodeIds[PathIndex];
+		const int32 ToNodeId = InNodeIds[PathIndex + 1];
+
+		FEdge* Edge = FindEdge(FromNodeId, ToNodeId);
+		PathCost += Edge->Cost;
+
+		if (Edge->bIsIntraClusterEdge)
+		{
+			// Other queries may fill same connection, search of one cluster is short enough to run under lock
+			std::lock_guard CacheLock(CacheMutex);
+
+			if (Edge->TilePath.Size() == 0)
+			{
+				const FCluster& Cluster = Clusters[Nodes[FromNodeId].ClusterIndex];
+				RunLocalSearch(InScratch, Cluster, Nodes[FromNodeId].Tile, &Nodes[ToNodeId].Tile);
+				AppendLocalPathToSource(InScratch, Cluster, Nodes[ToNodeId].Tile, Edge->TilePath);
+				std::reverse(Edge->TilePath.Vector.begin(), Edge->TilePath.Vector.end());
+			}
+
+			for (const FVector2D<int32>& Tile : Edge->TilePath.Vector)
+			{
+				AppendPathTile(Tile, OutTiles);
+			}
+		}
+		else
+		{
+			AppendPathTile(Nodes[ToNodeId].Tile, OutTiles);
+		}
+	}
+
+	// Last portal to end, search runs from end so walking back gives right order
+	const FCluster& EndCluster = Clusters[Nodes[LastNodeId].ClusterIndex];
+	RunLocalSearch(InScratch, EndCluster, InEndTile, &Nodes[LastNodeId].Tile);
+	AppendLocalPathToSource(InScratch, EndCluster, Nodes[LastNodeId].Tile, OutTiles);
+
+	return PathCost;
+}
+
+std::shared_ptr<FNavigationHierarchy::FSearchScratch> FNavigationHierarchy::AcquireScratch()
+{
+	std::lock_guard ScratchLock(ScratchMutex);
+
+	if (FreeScratches.Size() > 0)
+	{
+		std::shared_ptr<FSearchScratch> Scratch = FreeScratches.Vector.back();
+		FreeScratches.Vector.pop_back();
+
+		return Scratch;
+	}
+
+	return std::make_shared<FSearchScratch>();
+}
+
+void FNavigationHierarchy::ReleaseScratch(const std::shared_ptr<FSearchScratch>& InScratch)
+{
+	std::lock_guard ScratchLock(ScratchMutex);
+
+	FreeScratches.Push(InScratch);
+}
@@ -0,0 +1,311 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Navigation/NavigationManager.h"
+
+#include "ECS/Navigation/NavigationGrid.h"
+#include "ECS/Navigation/NavigationHierarchy.h"
+#include "Renderer/Map/Map.h"
+#include "Threads/ThreadsManager.h"
+
+/** Pathfinders shared by queries, kept alive by async queries when manager is gone */
+class FNavigationPathfinderPool
+{
+public:
+	std::shared_ptr<FNavigationPathfinder> Acquire()
+	{
+		std::shared_ptr<FNavigationPathfinder> Pathfinder;
+
+		std::lock_guard Lock(Mutex);
+
+		if (FreePathfinders.Size() > 0)
+		{
+			Pathfinder = FreePathfinders.Vector.back();
+			FreePathfinders.Vector.pop_back();
+		}
+		else
+		{
+			Pathfinder = std::make_shared<FNavigationPathfinder>();
+		}
+
+		return Pathfinder;
+	}
+
+	void Release(const std::shared_ptr<FNavigationPathfinder>& InPathfinder)
+	{
+		std::lock_guard Lock(Mutex);
+
+		FreePathfinders.Push(InPathfinder);
+	}
+
+protected:
+	CArray<std::shared_ptr<FNavigationPathfinder>> FreePathfinders;
+
+	std::mutex Mutex;
+
+};
+
+/** Async path query, shared by worker and main thread callback */
+struct FNavigationPathRequest
+{
+	FNavigationPathRequest()
+		: bIsCancelled(false)
+		, bIsFinished(false)
+	{
+	}
+
+	FNavigationPathResult Result;
+
+	FDelegateSafe<void, const FNavigationPathResult&> OnPathFound;
+
+	/** Set on main thread, worker skips search of cancelled request */
+	std::atomic<bool> bIsCancelled;
+
+	/** Set on main thread when result was delivered or dropped */
+	bool bIsFinished;
+};
+
+FNavigationManager::FNavigationManager()
+	: NavigationGrid(std::make_shared<FNavigationGrid>())
+	, NavigationHierarchy(std::make_shared<FNavigationHierarchy>())
+	, PathfinderPool(std::make_shared<FNavigationPathfinderPool>())
+	, NextRequestId(0)
+	, Algorithm(ENavigationAlgorithm::JumpPoint)
+	, HierarchyMinTileDistance(64)
+	, bShouldSmoothPaths(true)
+	, BoundMap(nullptr)
+{
+}
+
+FNavigationManager::~FNavigationManager()
+{
+	if (BoundMap != nullptr)
+	{
+		BoundMap->GetMapTileChangedDelegate().UnBindObject(this, &FNavigationManager::OnMapTileChanged);
+	}
+
+	// Queries still running finish on their own, their results are dropped
+	for (const std::pair<const FNavigationRequestId, std::shared_ptr<FNavigationPathRequest>>& PendingRequest : PendingRequests)
+	{
+		PendingRequest.second->bIsCancelled = true;
+	}
+}
+
+void FNavigationManager::InitializeSubSystem()
+{
+	ISubSystemInstanceInterface::InitializeSubSystem();
+
+	BoundMap = GetMap();
+	if (BoundMap != nullptr)
+	{
+		BoundMap->GetMapTileChangedDelegate().BindObject(this, &FNavigationManager::OnMapTileChanged);
+	}
+	else
+	{
+		LOG_ERROR("FNavigationManager must be subsystem of FMap.");
+	}
+
+	RebuildNavigationGrid();
+}
+
+void FNavigationManager::TickSubSystem()
+{
+	ISubSystemInstanceInterface::TickSubSystem();
+
+	// Forget requests which already got their result
+	for (auto It = PendingRequests.Map.begin(); It != PendingRequests.Map.end();)
+	{
+		if (It->second->bIsFinished)
+		{
+			It = PendingRequests.Map.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
+}
+
+void FNavigationManager::RebuildNavigationGrid()
+{
+	if (BoundMap != nullptr)
+	{
+		// Async queries keep old grid
+		NavigationGrid = std::make_shared<FNavigationGrid>();
+		NavigationGrid->BuildFromMapData(BoundMap->GetMapData());
+
+		// Async queries may still use old hierarchy, so new one is made
+		NavigationHierarchy = std::make_shared<FNavigationHierarchy>();
+		NavigationHierarchy->Build(*NavigationGrid);
+
+		FlowFieldCache.Clear();
+
+		const FVector2D<int32> SizeInTiles = NavigationGrid->GetSizeInTiles();
+		LOG_INFO("Navigation grid built: " << SizeInTiles.X << "x" << SizeInTiles.Y << " tiles, " << NavigationHierarchy->GetNumberOfNodes() << " portals.");
+	}
+}
+
+bool FNavigationManager::FindPath(const FVector2D<int32>& InStartLocation, const FVector2D<int32>& InEndLocation, FNavigationPathResult& OutResult)
+{
+	const std::shared_ptr<FNavigationPathfinder> Pathfinder = PathfinderPool->Acquire();
+
+	FindPathOnGrid(*NavigationGrid, *Pathfinder, Algorithm, bShouldSmoothPaths, InStartLocation, InEndLocation, OutResult, NavigationHierarchy.get(), HierarchyMinTileDistance);
+
+	PathfinderPool->Release(Pathfinder);
+
+	return OutResult.bIsPathFound;
+}
+
+FNavigationRequestId FNavigationManager::RequestPath(const FVector2D<int32>& InStartLocation, const FVector2D<int32>& InEndLocation, FDelegateSafe<void, const FNavigationPathResult&>& OnPathFound)
+{
+	const FNavigationRequestId RequestId = NextRequestId++;
+
+	std::shared_ptr<FNavigationPathRequest> PathRequest = std::make_shared<FNavigationPathRequest>();
+	PathRequest->OnPathFound = std::move(OnPathFound);
+
+	PendingRequests.Emplace(RequestId, PathRequest);
+
+	// Worker captures only shared data, so it's safe when manager is destroyed first
+	std::shared_ptr<const FNavigationGrid> GridSnapshot = NavigationGrid;
+	std::shared_ptr<FNavigationHierarchy> SharedHierarchy = NavigationHierarchy;
+	std::shared_ptr<FNavigationPathfinderPool> SharedPathfinderPool = PathfinderPool;
+	const ENavigationAlgorithm RequestAlgorithm = Algorithm;
+	const bool bRequestShouldSmoothPaths = bShouldSmoothPaths;
+	const int32 RequestHierarchyMinTileDistance = HierarchyMinTileDistance;
+
+	FDelegateSafe<void> AsyncDelegate;
+	AsyncDelegate.BindLambda([PathRequest, GridSnapshot, SharedHierarchy, SharedPathfinderPool, RequestAlgorithm, bRequestShouldSmoothPaths, RequestHierarchyMinTileDistance, InStartLocation, InEndLocation]()
+	{
+		if (!PathRequest->bIsCancelled)
+		{
+			const std::shared_ptr<FNavigationPathfinder> Pathfinder = SharedPathfinderPool->Acquire();
+
+			FindPathOnGrid(*GridSnapshot, *Pathfinder, RequestAlgorithm, bRequestShouldSmoothPaths, InStartLocation, InEndLocation, PathRequest->Result,
+				SharedHierarchy.get(), RequestHierarchyMinTileDistance);
+
+			SharedPathfinderPool->Release(Pathfinder);
+		}
+	});
+
+	FDelegateSafe<void> MainThreadCallback;
+	MainThreadCallback.BindLambda([PathRequest]()
+	{
+		PathRequest->bIsFinished = true;
+
+		if (!PathRequest->bIsCancelled)
+		{
+			PathRequest->OnPathFound.Execute(PathRequest->Result);
+		}
+	});
+
+	FGlobalDefines::GEngine->GetThreadsManager()->AddAsyncDelegate(AsyncDelegate, MainThreadCallback);
+
+	return RequestId;
+}
+
+void FNavigationManager::CancelPathRequest(const FNavigationRequestId InRequestId)
+{
+	std::optional<std::shared_ptr<FNavigationPathRequest>> PathRequest = PendingRequests.FindValueByKey(InRequestId);
+	if (PathRequest.has_value())
+	{
+		PathRequest.value()->bIsCancelled = true;
+
+		PendingRequests.Remove(InRequestId);
+	}
+}
+
+std::shared_ptr<const FNavigationFlowField> FNavigationManager::GetFlowField(const FVector2D<int32>& InGoalLocation)
+{
+	return FlowFieldCache.GetFlowField(*NavigationGrid, NavigationGrid->LocationToTile(InGoalLocation));
+}
+
+void FNavigationManager::FindPathOnGrid(const FNavigationGrid& InGrid, FNavigationPathfinder& InPathfinder, const ENavigationAlgorithm InAlgorithm, const bool bInShouldSmoothPaths,
+	const FVector2D<int32>& InStartLocation, const FVector2D<int32>& InEndLocation, FNavigationPathResult& OutResult,
+	FNavigationHierarchy* InHierarchy, const int32 InHierarchyMinTileDistance)
+{
+	OutResult.Waypoints.Clear();
+
+	CArray<FVector2D<int32>> PathTiles;
+
+	const FVector2D<int32> StartTile = InGrid.LocationToTile(InStartLocation);
+	const FVector2D<int32> EndTile = InGrid.LocationToTile(InEndLocation);
+
+	const int32 TileDistance = FMath::Max(FMath::Abs(EndTile.X - StartTile.X), FMath::Abs(EndTile.Y - StartTile.Y));
+
+	if (InHierarchy != nullptr && TileDistance > InHierarchyMinTileDistance)
+	{
+		// Hierarchy is copied on change same as grid, so both snapshots know about same tiles
+		OutResult.bIsPathFound = InHierarchy->FindPath(StartTile, EndTile, PathTiles, OutResult.PathCost);
+	}
+	else
+	{
+		OutResult.bIsPathFound = InPathfinder.FindPath(InGrid, StartTile, EndTile, InAlgorithm, PathTiles);
+		OutResult.PathCost = InPathfinder.GetLastPathCost();
+	}
+
+	if (OutResult.bIsPathFound)
+	{
+		if (bInShouldSmoothPaths)
+		{
+			CArray<FVector2D<int32>> SmoothedPathTiles;
+			FNavigationPathfinder::SmoothPath(InGrid, PathTiles, SmoothedPathTiles);
+
+			PathTiles = SmoothedPathTiles;
+		}
+
+		// Start tile is skipped as owner already is there, end tile is replaced by exact location
+		for (int32 PathTileIndex = 1; PathTileIndex < PathTiles.Size() - 1; PathTileIndex++)
+		{
+			OutResult.Waypoints.Push(InGrid.TileToLocation(PathTiles[PathTileIndex]));
+		}
+
+		OutResult.Waypoints.Push(InEndLocation);
+	}
+}
+
+FMap* FNavigationManager::GetMap() const
+{
+	return dynamic_cast<FMap*>(GetSubSystemParentInterface());
+}
+
+void FNavigationManager::OnMapTileChanged(const FVector2D<int32> InTile)
+{
+	if (BoundMap != nullptr)
+	{
+		FNavigationGrid* Grid = GetGridForWrite();
+
+		const bool bWasWalkable = Grid->IsWalkable(InTile.X, InTile.Y);
+
+		Grid->UpdateTileFromMapData(BoundMap->GetMapData(), InTile);
+
+		// Only walkability matters, changing one floor to another does not touch flow fields
+		if (bWasWalkable != Grid->IsWalkable(InTile.X, InTile.Y))
+		{
+			FlowFieldCache.OnTileWalkabilityChanged(*Grid, InTile);
+
+			GetHierarchyForWrite()->SetTileWalkable(InTile, Grid->IsWalkable(InTile.X, InTile.Y));
+		}
+	}
+}
+
+FNavigationGrid* FNavigationManager::GetGridForWrite()
+{
+	// Only main thread makes new references, so when it's the only one nobody else can read grid
+	if (NavigationGrid.use_count() > 1)
+	{
+		NavigationGrid = std::make_shared<FNavigationGrid>(*NavigationGrid);
+	}
+
+	return NavigationGrid.get();
+}
+
+FNavigationHierarchy* FNavigationManager::GetHierarchyForWrite()
+{
+	// Same as grid, changes never wait for async queries searching old hierarchy
+	if (NavigationHierarchy.use_count() > 1)
+	{
+		NavigationHierarchy = std::make_shared<FNavigationHierarchy>(*NavigationHierarchy);
+	}
+
+	return NavigationHierarchy.get();
+}
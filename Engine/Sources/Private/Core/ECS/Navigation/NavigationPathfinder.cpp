@@ -0,0 +1,349 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Navigation/NavigationPathfinder.h"
+#include "ECS/Navigation/NavigationGrid.h"
+
+namespace
+{
+	int32 GetDirection(const int32 Value)
+	{
+		return (Value > 0) - (Value < 0);
+	}
+}
+
+FNavigationPathfinder::FNavigationPathfinder()
+	: SearchStamp(0)
+	, LastPathCost(0)
+	, LastNumberOfExpandedTiles(0)
+{
+}
+
+bool FNavigationPathfinder::FindPath(const FNavigationGrid& InGrid, const FVector2D<int32>& InStartTile, const FVector2D<int32>& InEndTile, const ENavigationAlgorithm InAlgorithm, CArray<FVector2D<int32>>& OutPathTiles)
+{
+	OutPathTiles.Clear();
+
+	LastPathCost = 0;
+	LastNumberOfExpandedTiles = 0;
+
+	if (!InGrid.IsWalkable(InStartTile.X, InStartTile.Y) || !InGrid.IsWalkable(InEndTile.X, InEndTile.Y))
+	{
+		return false;
+	}
+
+	if (InStartTile == InEndTile)
+	{
+		OutPathTiles.Push(InStartTile);
+
+		return true;
+	}
+
+	BeginSearch(InGrid);
+
+	const int32 EndTileIndex = InGrid.GetTileIndex(InEndTile.X, InEndTile.Y);
+
+	OpenTile(InGrid.GetTileIndex(InStartTile.X, InStartTile.Y), INDEX_NONE, 0, InStartTile, InEndTile);
+
+	while (!OpenTiles.Vector.empty())
+	{
+		std::pop_heap(OpenTiles.Vector.begin(), OpenTiles.Vector.end());
+		const FOpenTile CurrentOpenTile = OpenTiles.Vector.back();
+		OpenTiles.Vector.pop_back();
+
+		const int32 TileIndex = CurrentOpenTile.TileIndex;
+
+		// Tile could be added again with lower cost, older entries are skipped
+		if (ClosedStamps[TileIndex] == SearchStamp)
+		{
+			continue;
+		}
+
+		ClosedStamps[TileIndex] = SearchStamp;
+		LastNumberOfExpandedTiles++;
+
+		if (TileIndex == EndTileIndex)
+		{
+			LastPathCost = CurrentOpenTile.PathCost;
+
+			BuildPath(InGrid, EndTileIndex, OutPathTiles);
+
+			return true;
+		}
+
+		switch (InAlgorithm)
+		{
+			case ENavigationAlgorithm::AStar:
+			{
+				ExpandAStar(InGrid, TileIndex, InEndTile);
+
+				break;
+			}
+			case ENavigationAlgorithm::JumpPoint:
+			{
+				ExpandJumpPoint(InGrid, TileIndex, InEndTile);
+
+				break;
+			}
+		}
+	}
+
+	return false;
+}
+
+void FNavigationPathfinder::SmoothPath(const FNavigationGrid& InGrid, const CArray<FVector2D<int32>>& InPathTiles, CArray<FVector2D<int32>>& OutPathTiles)
+{
+	OutPathTiles.Clear();
+
+	const int32 NumberOfPathTiles = InPathTiles.Size();
+	if (NumberOfPathTiles > 0)
+	{
+		OutPathTiles.Push(InPathTiles[0]);
+
+		int32 AnchorIndex = 0;
+
+		for (int32 PathTileIndex = 2; PathTileIndex < NumberOfPathTiles; PathTileIndex++)
+		{
+			// Previous tile is always visible from anchor, either it's next to it or it was checked before
+			if (!InGrid.HasLineOfSight(InPathTiles[AnchorIndex], InPathTiles[PathTileIndex]))
+			{
+				AnchorIndex = PathTileIndex - 1;
+
+				OutPathTiles.Push(InPathTiles[AnchorIndex]);
+			}
+		}
+
+		if (NumberOfPathTiles > 1)
+		{
+			OutPathTiles.Push(InPathTiles[NumberOfPathTiles - 1]);
+		}
+	}
+}
+
+int32 FNavigationPathfinder::GetOctileDistance(const FVector2D<int32>& InTileA, const FVector2D<int32>& InTileB)
+{
+	const int32 DistanceX = FMath::Abs(InTileA.X - InTileB.X);
+	const int32 DistanceY = FMath::Abs(InTileA.Y - InTileB.Y);
+	const int32 DiagonalMoves = FMath::Min(DistanceX, DistanceY);
+
+	return (DiagonalMoves * DiagonalMoveCost) + ((FMath::Max(DistanceX, DistanceY) - DiagonalMoves) * StraightMoveCost);
+}
+
+void FNavigationPathfinder::BeginSearch(const FNavigationGrid& InGrid)
+{
+	const int32 NumberOfTiles = InGrid.GetNumberOfTiles();
+	if (VisitedStamps.Size() != NumberOfTiles)
+	{
+		PathCosts.SetNum(NumberOfTiles);
+		ParentTileIndexes.SetNum(NumberOfTiles);
+
+		VisitedStamps.Clear();
+		VisitedStamps.Vector.resize(NumberOfTiles, 0);
+		ClosedStamps.Clear();
+		ClosedStamps.Vector.resize(NumberOfTiles, 0);
+
+		SearchStamp = 0;
+	}
+
+	SearchStamp++;
+
+	// Stamp wrapped around, old values could be taken as valid
+	if (SearchStamp == 0)
+	{
+		std::fill(VisitedStamps.Vector.begin(), VisitedStamps.Vector.end(), 0);
+		std::fill(ClosedStamps.Vector.begin(), ClosedStamps.Vector.end(), 0);
+
+		SearchStamp = 1;
+	}
+
+	OpenTiles.Clear();
+}
+
+void FNavigationPathfinder::OpenTile(const int32 TileIndex, const int32 ParentTileIndex, const int32 InPathCost, const FVector2D<int32>& InTile, const FVector2D<int32>& InEndTile)
+{
+	if (ClosedStamps[TileIndex] != SearchStamp)
+	{
+		if (VisitedStamps[TileIndex] != SearchStamp || InPathCost < PathCosts[TileIndex])
+		{
+			VisitedStamps[TileIndex] = SearchStamp;
+			PathCosts[TileIndex] = InPathCost;
+			ParentTileIndexes[TileIndex] = ParentTileIndex;
+
+			FOpenTile NewOpenTile;
+			NewOpenTile.TotalCost = InPathCost + GetOctileDistance(InTile, InEndTile);
+			NewOpenTile.PathCost = InPathCost;
+			NewOpenTile.TileIndex = TileIndex;
+
+			OpenTiles.Push(NewOpenTile);
+			std::push_heap(OpenTiles.Vector.begin(), OpenTiles.Vector.end());
+		}
+	}
+}
+
+void FNavigationPathfinder::ExpandAStar(const FNavigationGrid& InGrid, const int32 TileIndex, const FVector2D<int32>& InEndTile)
+{
+	const FVector2D<int32> Tile = InGrid.GetTileFromIndex(TileIndex);
+	const int32 PathCost = PathCosts[TileIndex];
+
+	for (int32 DirectionY = -1; DirectionY <= 1; DirectionY++)
+	{
+		for (int32 DirectionX = -1; DirectionX <= 1; DirectionX++)
+		{
+			if ((DirectionX != 0 || DirectionY != 0) && InGrid.CanMove(Tile.X, Tile.Y, DirectionX, DirectionY))
+			{
+				const FVector2D<int32> NeighbourTile(Tile.X + DirectionX, Tile.Y + DirectionY);
+				const int32 MoveCost = (DirectionX != 0 && DirectionY != 0) ? DiagonalMoveCost : StraightMoveCost;
+
+				OpenTile(InGrid.GetTileIndex(NeighbourTile.X, NeighbourTile.Y), TileIndex, PathCost + MoveCost, NeighbourTile, InEndTile);
+			}
+		}
+	}
+}
+
+void FNavigationPathfinder::ExpandJumpPoint(const FNavigationGrid& InGrid, const int32 TileIndex, const FVector2D<int32>& InEndTile)
+{
+	const FVector2D<int32> Tile = InGrid.GetTileFromIndex(TileIndex);
+	const int32 PathCost = PathCosts[TileIndex];
+
+	// Up to 8 directions, start tile searches all of them
+	FVector2D<int32> Directions[8];
+	int32 NumberOfDirections = 0;
+
+	const int32 ParentTileIndex = ParentTileIndexes[TileIndex];
+	if (ParentTileIndex == INDEX_NONE)
+	{
+		for (int32 DirectionY = -1; DirectionY <= 1; DirectionY++)
+		{
+			for (int32 DirectionX = -1; DirectionX <= 1; DirectionX++)
+			{
+				if (DirectionX != 0 || DirectionY != 0)
+				{
+					Directions[NumberOfDirections++] = FVector2D<int32>(DirectionX, DirectionY);
+				}
+			}
+		}
+	}
+	else
+	{
+		const FVector2D<int32> ParentTile = InGrid.GetTileFromIndex(ParentTileIndex);
+		const int32 DirectionX = GetDirection(Tile.X - ParentTile.X);
+		const int32 DirectionY = GetDirection(Tile.Y - ParentTile.Y);
+
+		Directions[NumberOfDirections++] = FVector2D<int32>(DirectionX, DirectionY);
+
+		if (DirectionX != 0 && DirectionY != 0)
+		{
+			// Diagonal moves have no forced neighbours when corners can not be cut
+			Directions[NumberOfDirections++] = FVector2D<int32>(DirectionX, 0);
+			Directions[NumberOfDirections++] = FVector2D<int32>(0, DirectionY);
+		}
+		else
+		{
+			// Side tile is forced when tile behind it is blocked, so it could not be reached diagonally from parent
+			for (int32 Side = -1; Side <= 1; Side += 2)
+			{
+				const int32 SideX = (DirectionX == 0) ? Side : 0;
+				const int32 SideY = (DirectionY == 0) ? Side : 0;
+
+				if (InGrid.IsWalkable(Tile.X + SideX, Tile.Y + SideY) && !InGrid.IsWalkable(Tile.X + SideX - DirectionX, Tile.Y + SideY - DirectionY))
+				{
+					Directions[NumberOfDirections++] = FVector2D<int32>(SideX, SideY);
+					Directions[NumberOfDirections++] = FVector2D<int32>(DirectionX + SideX, DirectionY + SideY);
+				}
+			}
+		}
+	}
+
+	for (int32 DirectionIndex = 0; DirectionIndex < NumberOfDirections; DirectionIndex++)
+	{
+		const FVector2D<int32>& Direction = Directions[DirectionIndex];
+
+		const int32 JumpPointIndex = Jump(InGrid, Tile.X, Tile.Y, Direction.X, Direction.Y, InEndTile);
+		if (JumpPointIndex != INDEX_NONE)
+		{
+			const FVector2D<int32> JumpPointTile = InGrid.GetTileFromIndex(JumpPointIndex);
+
+			// Jump goes in straight line, so octile distance is exact cost
+			OpenTile(JumpPointIndex, TileIndex, PathCost + GetOctileDistance(Tile, JumpPointTile), JumpPointTile, InEndTile);
+		}
+	}
+}
+
+int32 FNavigationPathfinder::Jump(const FNavigationGrid& InGrid, int32 X, int32 Y, const int32 DirectionX, const int32 DirectionY, const FVector2D<int32>& InEndTile)
+{
+	if (DirectionX == 0 || DirectionY == 0)
+	{
+		return JumpStraight(InGrid, X, Y, DirectionX, DirectionY, InEndTile);
+	}
+
+	while (InGrid.CanMove(X, Y, DirectionX, DirectionY))
+	{
+		X += DirectionX;
+		Y += DirectionY;
+
+		// Tile is jump point when any of straight jumps from it finds something
+		if ((X == InEndTile.X && Y == InEndTile.Y)
+			|| JumpStraight(InGrid, X, Y, DirectionX, 0, InEndTile) != INDEX_NONE
+			|| JumpStraight(InGrid, X, Y, 0, DirectionY, InEndTile) != INDEX_NONE)
+		{
+			return InGrid.GetTileIndex(X, Y);
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+int32 FNavigationPathfinder::JumpStraight(const FNavigationGrid& InGrid, int32 X, int32 Y, const int32 DirectionX, const int32 DirectionY, const FVector2D<int32>& InEndTile)
+{
+	while (InGrid.IsWalkable(X + DirectionX, Y + DirectionY))
+	{
+		X += DirectionX;
+		Y += DirectionY;
+
+		if ((X == InEndTile.X && Y == InEndTile.Y) || HasForcedNeighbour(InGrid, X, Y, DirectionX, DirectionY))
+		{
+			return InGrid.GetTileIndex(X, Y);
+		}
+	}
+
+	return INDEX_NONE;
+}
+
+bool FNavigationPathfinder::HasForcedNeighbour(const FNavigationGrid& InGrid, const int32 X, const int32 Y, const int32 DirectionX, const int32 DirectionY)
+{
+	if (DirectionX != 0)
+	{
+		return (InGrid.IsWalkable(X, Y - 1) && !InGrid.IsWalkable(X - DirectionX, Y - 1))
+			|| (InGrid.IsWalkable(X, Y + 1) && !InGrid.IsWalkable(X - DirectionX, Y + 1));
+	}
+
+	return (InGrid.IsWalkable(X - 1, Y) && !InGrid.IsWalkable(X - 1, Y - DirectionY))
+		|| (InGrid.IsWalkable(X + 1, Y) && !InGrid.IsWalkable(X + 1, Y - DirectionY));
+}
+
+void FNavigationPathfinder::BuildPath(const FNavigationGrid& InGrid, const int32 EndTileIndex, CArray<FVector2D<int32>>& OutPathTiles) const
+{
+	for (int32 TileIndex = EndTileIndex; TileIndex != INDEX_NONE; TileIndex = ParentTileIndexes[TileIndex])
+	{
+		const FVector2D<int32> Tile = InGrid.GetTileFromIndex(TileIndex);
+
+		// Tiles in same direction as previous ones are replaced, so only turning tiles stay
+		const int32 NumberOfPathTiles = OutPathTiles.Size();
+		if (NumberOfPathTiles >= 2)
+		{
+			const FVector2D<int32>& LastTile = OutPathTiles[NumberOfPathTiles - 1];
+			const FVector2D<int32>& BeforeLastTile = OutPathTiles[NumberOfPathTiles - 2];
+
+			if (GetDirection(LastTile.X - BeforeLastTile.X) == GetDirection(Tile.X - LastTile.X)
+				&& GetDirection(LastTile.Y - BeforeLastTile.Y) == GetDirection(Tile.Y - LastTile.Y))
+			{
+				OutPathTiles[NumberOfPathTiles - 1] = Tile;
+
+				continue;
+			}
+		}
+
+		OutPathTiles.Push(Tile);
+	}
+
+	std::reverse(OutPathTiles.Vector.begin(), OutPathTiles.Vector.end());
+}
@@ -0,0 +1,281 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "ECS/Systems/ProjectileSystem.h"
+
+#include "Assets/Assets/TextureAsset.h"
+#include "ECS/Collision/BaseCollision.h"
+#include "ECS/Collision/CollisionManager.h"
+#include "ECS/Components/Collision/CollisionComponent.h"
+#include "ECS/Components/TeamComponent.h"
+#include "Renderer/Map/Map.h"
+#include "Renderer/Map/MapManager.h"
+
+FProjectileData::FProjectileData()
+	: Lifetime(1.f)
+	, Damage(0.f)
+	, Team(INDEX_NONE)
+	, Radius(2)
+	, Size(4.f, 4.f)
+	, Texture(nullptr)
+	, Color(FColorRGBA::ColorOrange())
+{
+}
+
+FProjectileSystem::FProjectileSystem(FEntityManager* InEntityManager, const int32 InPoolSize)
+	: FEntitySystem(InEntityManager)
+	, Projectiles(InPoolSize)
+	, NumberOfProjectiles(0)
+	, CollisionManager(nullptr)
+	, bWasPoolFullReported(false)
+{
+}
+
+void FProjectileSystem::Tick(const float DeltaTime)
+{
+	FEntitySystem::Tick(DeltaTime);
+
+	if (CollisionManager == nullptr)
+	{
+		CollisionManager = FindCollisionManager();
+	}
+
+	for (int32 i = 0; i < NumberOfProjectiles;)
+	{
+		FProjectileData& Projectile = Projectiles[i];
+
+		Projectile.Lifetime -= DeltaTime;
+		if (Projectile.Lifetime <= 0.f)
+		{
+			RemoveProjectileAt(i);
+
+			// Last projectile was moved to this index
+			continue;
+		}
+
+		Projectile.Location.X += Projectile.Velocity.X * DeltaTime;
+		Projectile.Location.Y += Projectile.Velocity.Y * DeltaTime;
+
+		if (CollisionManager != nullptr)
+		{
+			const FVector2D<int> HitLocation(static_cast<int>(Projectile.Location.X), static_cast<int>(Projectile.Location.Y));
+
+			FCollisionBase* HitCollision = CollisionManager->FindFirstCollisionOverlappingCircle(HitLocation, Projectile.Radius, [&](const FCollisionBase* Collision) -> bool
+			{
+				return CanHit(Projectile, Collision);
+			});
+
+			if (HitCollision != nullptr)
+			{
+				// Copy, delegate may fire new projectiles which can change pool
+				const FProjectileData HitProjectile = Projectile;
+
+				RemoveProjectileAt(i);
+
+				OnProjectileHit.Execute(HitProjectile, HitCollision->GetCollisionComponent());
+
+				continue;
+			}
+		}
+
+		i++;
+	}
+}
+
+void FProjectileSystem::Render()
+{
+	FEntitySystem::Render();
+
+	if (EntityManager == nullptr || NumberOfProjectiles == 0)
+	{
+		return;
+	}
+
+	const FRenderer* Renderer = EntityManager->GetOwnerWindow()->GetRenderer();
+
+	BuildRenderBatches(FVector2D<float>(Renderer->GetRenderOffset()));
+
+	// Batches keep their buffers, vertices are already in screen space
+	for (const FProjectileRenderBatch& RenderBatch : RenderBatches)
+	{
+		Renderer->DrawGeometry(RenderBatch.Texture, RenderBatch.Vertices, RenderBatch.Indices, false);
+	}
+}
+
+bool FProjectileSystem::FireProjectile(const FProjectileData& InProjectileData)
+{
+	if (NumberOfProjectiles >= static_cast<int32>(Projectiles.size()))
+	{
+		if (!bWasPoolFullReported)
+		{
+			LOG_WARN("Projectile pool is full (" << Projectiles.size() << "), new projectiles are ignored.");
+
+			bWasPoolFullReported = true;
+		}
+
+		return false;
+	}
+
+	Projectiles[NumberOfProjectiles] = InProjectileData;
+	NumberOfProjectiles++;
+
+	return true;
+}
+
+void FProjectileSystem::ClearProjectiles()
+{
+	NumberOfProjectiles = 0;
+}
+
+void FProjectileSystem::SetCollisionManager(FCollisionManager* InCollisionManager)
+{
+	CollisionManager = InCollisionManager;
+}
+
+void FProjectileSystem::BuildRenderBatches(const FVector2D<float>& InRenderOffset)
+{
+	for (FProjectileRenderBatch& RenderBatch : RenderBatches)
+	{
+		RenderBatch.Vertices.clear();
+		RenderBatch.Indices.clear();
+	}
+
+	for (int32 i = 0; i < NumberOfProjectiles; i++)
+	{
+		const FProjectileData& Projectile = Projectiles[i];
+
+		SDL_Texture* Texture = nullptr;
+		SDL_FRect SourceUV = { 0.f, 0.f, 1.f, 1.f };
+
+		if (Projectile.Texture != nullptr)
+		{
+			// Texture may be part of atlas page
+			Texture = Projectile.Texture->GetTexture()->GetSDLTexture();
+			SourceUV = Projectile.Texture->GetTexture()->GetSourceUV();
+		}
+
+		// Usually there is only few textures, linear search is fine
+		FProjectileRenderBatch* RenderBatch = nullptr;
+		for (FProjectileRenderBatch& RenderBatchSearch : RenderBatches)
+		{
+			if (RenderBatchSearch.Texture == Texture)
+			{
+				RenderBatch = &RenderBatchSearch;
+
+				break;
+			}
+		}
+
+		if (RenderBatch == nullptr)
+		{
+			RenderBatches.Push(FProjectileRenderBatch(Texture));
+			RenderBatch = &RenderBatches[RenderBatches.GetLastIndex()];
+		}
+
+		// Sprite faces velocity, default facing right when not moving
+		float ForwardX = 1.f;
+		float ForwardY = 0.f;
+
+		const float Speed = FMath::Sqrt(Projectile.Velocity.X * Projectile.Velocity.X + Projectile.Velocity.Y * Projectile.Velocity.Y);
+		if (Speed > 0.f)
+		{
+			ForwardX = Projectile.Velocity.X / Speed;
+			ForwardY = Projectile.Velocity.Y / Speed;
+		}
+
+		const float HalfLengthX = ForwardX * Projectile.Size.X * 0.5f;
+		const float HalfLengthY = ForwardY * Projectile.Size.X * 0.5f;
+		const float HalfWidthX = -ForwardY * Projectile.Size.Y * 0.5f;
+		const float HalfWidthY = ForwardX * Projectile.Size.Y * 0.5f;
+
+		const float CenterX = Projectile.Location.X + InRenderOffset.X;
+		const float CenterY = Projectile.Location.Y + InRenderOffset.Y;
+
+		const SDL_FColor Color = {
+			static_cast<float>(Projectile.Color.R) / 255.f,
+			static_cast<float>(Projectile.Color.G) / 255.f,
+			static_cast<float>(Projectile.Color.B) / 255.f,
+			static_cast<float>(Projectile.Color.A) / 255.f
+		};
+
+		const int FirstVertexIndex = static_cast<int>(RenderBatch->Vertices.size());
+		const size_t FirstIndexIndex = RenderBatch->Indices.size();
+
+		// Capacity is kept between frames, so after first frame this does not allocate
+		RenderBatch->Vertices.resize(FirstVertexIndex + 4);
+		RenderBatch->Indices.resize(FirstIndexIndex + 6);
+
+		const float MaxU = SourceUV.x + SourceUV.w;
+		const float MaxV = SourceUV.y + SourceUV.h;
+
+		SDL_Vertex* Vertices = &RenderBatch->Vertices[FirstVertexIndex];
+		Vertices[0] = { { CenterX - HalfLengthX - HalfWidthX, CenterY - HalfLengthY - HalfWidthY }, Color, { SourceUV.x, SourceUV.y } };
+		Vertices[1] = { { CenterX + HalfLengthX - HalfWidthX, CenterY + HalfLengthY - HalfWidthY }, Color, { MaxU, SourceUV.y } };
+		Vertices[2] = { { CenterX + HalfLengthX + HalfWidthX, CenterY + HalfLengthY + HalfWidthY }, Color, { MaxU, MaxV } };
+		Vertices[3] = { { CenterX - HalfLengthX + HalfWidthX, CenterY - HalfLengthY + HalfWidthY }, Color, { SourceUV.x, MaxV } };
+
+		int* Indices = &RenderBatch->Indices[FirstIndexIndex];
+		Indices[0] = FirstVertexIndex;
+		Indices[1] = FirstVertexIndex + 1;
+		Indices[2] = FirstVertexIndex + 2;
+		Indices[3] = FirstVertexIndex;
+		Indices[4] = FirstVertexIndex + 2;
+		Indices[5] = FirstVertexIndex + 3;
+	}
+}
+
+bool FProjectileSystem::CanHit(const FProjectileData& InProjectileData, const FCollisionBase* InCollision) const
+{
+	EEntity* HitEntity = InCollision->GetCollisionComponent()->GetEntity();
+	if (HitEntity == nullptr || HitEntity->IsPendingDestroy())
+	{
+		return false;
+	}
+
+	if (HitEntity->GetEntityHandle() == InProjectileData.Owner)
+	{
+		return false;
+	}
+
+	if (InProjectileData.Team != INDEX_NONE)
+	{
+		const UTeamComponent* TeamComponent = HitEntity->GetComponentByClass<UTeamComponent>();
+		if (TeamComponent != nullptr && TeamComponent->GetCurrentTeam() == InProjectileData.Team)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FProjectileSystem::RemoveProjectileAt(const int32 Index)
+{
+	NumberOfProjectiles--;
+
+	if (Index != NumberOfProjectiles)
+	{
+		Projectiles[Index] = Projectiles[NumberOfProjectiles];
+	}
+}
+
+FCollisionManager* FProjectileSystem::FindCollisionManager() const
+{
+	FCollisionManager* FoundCollisionManager = nullptr;
+
+	// Entity manager without window (tools, tests) has no map, collision manager must be set
+	if (EntityManager != nullptr && EntityManager->GetOwnerWindow() != nullptr)
+	{
+		FMapManager* MapManager = EntityManager->GetOwnerWindow()->GetMapManager();
+		if (MapManager != nullptr)
+		{
+			FMap* CurrentMap = MapManager->GetCurrentMap();
+			if (CurrentMap != nullptr)
+			{
+				FoundCollisionManager = CurrentMap->GetSubSystemByClass<FCollisionManager>();
+			}
+		}
+	}
+
+	return FoundCollisionManager;
+}
@@ -28,6 +28,7 @@
 #include "Threads/RenderThread.h"
 #include "Threads/ThreadsManager.h"
 #include "Threads/ThreadData.h"
+#include "Timer/TimerWheel.h"
 
 FEngine::FEngine()
 	: bFrameRateLimited(true)
@@ -47,6 +48,8 @@ FEngine::FEngine()
 	, EngineTickingManager(nullptr)
 	, EngineRenderingManager(nullptr)
 	, ThreadsManager(nullptr)
+	, TimerWheel(nullptr)
+	, RenderThread(nullptr)
 	, RenderThreadData(nullptr)
 #if ENGINE_TESTS_ALLOW_ANY
 	, TestManager(nullptr)
@@ -176,14 +179,21 @@ void FEngine::EngineInit(int Argc, char* Argv[])
 	EngineTickingManager = CreateEngineTickingManager();
 	EngineRenderingManager = CreateEngineRenderingManager();
 	ThreadsManager = CreateThreadsManager();
+	TimerWheel = CreateTimerWheel();
 
 	EventHandler->InitializeInputFromConfig();
 
 	ThreadsManager->Initialize();
 
-	// Add render thread
-	//RenderThreadData = ThreadsManager->CreateThread<FRenderThread, FThreadData>("RenderThreadData");
-	//RenderThread = dynamic_cast<FRenderThread*>(RenderThreadData->GetThread());
+	// Add render thread, rendering is done inline on game thread by default
+	const FEngineLaunchParameter& UseRenderThreadLaunchParameter = GetLaunchParameter(FEngineLaunchParameterCollection::UseRenderThread);
+	if (UseRenderThreadLaunchParameter.IsValid() && (UseRenderThreadLaunchParameter.Value.empty() || UseRenderThreadLaunchParameter.AsBool()))
+	{
+		LOG_INFO("Using pipelined render thread.");
+
+		RenderThreadData = ThreadsManager->CreateThread<FRenderThread, FThreadData>("RenderThread");
+		RenderThread = dynamic_cast<FRenderThread*>(RenderThreadData->GetThread());
+	}
 
 #if ENGINE_NETWORK_LIB_ENABLED
 	const FEngineLaunchParameter& IsServerEngineLaunchParameter = GetLaunchParameter(FEngineLaunchParameterCollection::IsServer);
@@ -283,13 +293,14 @@ void FEngine::EngineTick()
 		}
 	}
 
-	// Tick functions for next tick
-	if (FunctionsToCallOnStartOfNextTick.IsBound())
-	{
-		FunctionsToCallOnStartOfNextTick.Execute();
+	// Fire expired timers, sync timers are called here and async ones are sent to threads
+	TimerWheel->Advance(SDL_GetTicks());
 
-		FunctionsToCallOnStartOfNextTick.UnBindAll();
-	}
+	// Tick functions for next tick, functions added while draining are called in next tick
+	FunctionsToCallOnStartOfNextTick.ConsumeAll([](FFunctorLambda<void>& Function)
+	{
+		Function();
+	});
 
 	TickEngineSubsystems();
 
@@ -302,16 +313,13 @@ void FEngine::EngineTick()
 
 	EngineRender->Tick();
 
-	ThreadsManager->TickThreadCallbacks();
-
-	// Wait for Render thread.
-	// We need to do this to avoid changing data when render is not finished
-	//while (!RenderThread->IsRenderingFrameFinished())
-	//{
-	//	THREAD_WAIT_SHORT_TIME;
-	//}
+	if (RenderThread != nullptr)
+	{
+		// Hand recorded frame to render thread, waits only when previous frame is not submitted yet
+		RenderThread->SubmitFrame();
+	}
 
-	//RenderThread->AllowRenderNextFrame();
+	ThreadsManager->TickThreadCallbacks();
 }
 
 void FEngine::EnginePostSecondTick()
@@ -392,10 +400,23 @@ void FEngine::PreExit()
 
 void FEngine::Clean()
 {
+	if (RenderThread != nullptr)
+	{
+		// Finish submitted frame and go back to inline rendering, so resources destroyed below are not sent to stopped thread
+		RenderThread->WaitForRenderingFrameFinished();
+
+		RenderThread = nullptr;
+		RenderThreadData = nullptr;
+	}
+
 	ThreadsManager->DeInitialize();
 
 	DeInitializeEngineSubsystems();
 
+	// Timers still alive are detached, so they can be safely destroyed later
+	delete TimerWheel;
+	TimerWheel = nullptr;
+
 	delete EngineRender;
 	delete EventHandler;
 	delete AssetsManager;
@@ -565,6 +586,11 @@ FThreadsManager* FEngine::CreateThreadsManager() const
 	return new FThreadsManager();
 }
 
+FTimerWheel* FEngine::CreateTimerWheel() const
+{
+	return new FTimerWheel(SDL_GetTicks());
+}
+
 const std::string& FEngine::GetLaunchFullPath() const
 {
 	return LaunchFullPath;
@@ -577,7 +603,12 @@ const std::string& FEngine::GetLaunchRelativePath() const
 
 void FEngine::AddLambdaToCallOnStartOfNextTick(const FFunctorLambda<void>& Function)
 {
-	FunctionsToCallOnStartOfNextTick.BindLambda(Function);
+	FunctionsToCallOnStartOfNextTick.Push(Function);
+}
+
+void FEngine::ClearFunctionsToCallOnStartOfNextTick()
+{
+	FunctionsToCallOnStartOfNextTick.Clear();
 }
 
 void FEngine::DeInitializeEngineSubsystems()
@@ -603,11 +634,6 @@ void FEngine::DestroyEngineSubsystem(const std::shared_ptr<IEngineSubsystemInter
 	ManagedEngineSubsystems.Remove(InEngineSubsystem);
 }
 
-FDelegate<void>& FEngine::GetFunctionsToCallOnStartOfNextTick()
-{
-	return FunctionsToCallOnStartOfNextTick;
-}
-
 FEventHandler* FEngine::GetEventHandler() const
 {
 #if _DEBUG
@@ -637,6 +663,11 @@ FThreadsManager* FEngine::GetThreadsManager() const
 	return ThreadsManager;
 }
 
+FTimerWheel* FEngine::GetTimerWheel() const
+{
+	return TimerWheel;
+}
+
 #if ENGINE_TESTS_ALLOW_ANY
 FTestManager* FEngine::CreateTestManager() const
 {
@@ -27,7 +27,7 @@ void FGameModeBase::DeInitialize()
 	FGlobalDefines::GEngine->GetThreadsManager()->ResetAllJobs();
 
 	// Also reset Engine queue
-	FGlobalDefines::GEngine->GetFunctionsToCallOnStartOfNextTick().UnBindAll();
+	FGlobalDefines::GEngine->ClearFunctionsToCallOnStartOfNextTick();
 }
 
 void FGameModeBase::Begin()
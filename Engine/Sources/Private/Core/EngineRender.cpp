@@ -37,7 +37,7 @@ void FEngineRender::StartRenderTick()
 	{
 		bIsRenderTickFinished = false;
 
-		// @TODO Move to thread.
+		// With render thread enabled this only records commands, they are submitted in FEngine::EngineTick
 		RenderTick();
 	}
 #if _DEBUG
@@ -205,6 +205,25 @@ void FEngineRender::OnWindowCloseRequested(Uint32 WindowId)
 	}
 }
 
+void FEngineRender::OnRenderTargetsReset(const Uint32 WindowId)
+{
+	if (WindowId == 0)
+	{
+		for (FWindow* Window : ManagedWindows.Vector)
+		{
+			Window->OnRenderTargetsReset();
+		}
+	}
+	else
+	{
+		FWindow* Window = GetWindowById(WindowId);
+		if (Window != nullptr)
+		{
+			Window->OnRenderTargetsReset();
+		}
+	}
+}
+
 void FEngineRender::SetWindowFocus(const Uint32 WindowId, const bool bIsFocused)
 {
 	FWindow* Window = GetWindowById(WindowId);
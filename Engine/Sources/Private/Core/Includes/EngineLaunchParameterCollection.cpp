@@ -6,4 +6,5 @@
 namespace FEngineLaunchParameterCollection
 {
     const std::string IsServer = "IsServer"; // Define and initialize the constant variable
+    const std::string UseRenderThread = "UseRenderThread";
 }
@@ -112,6 +112,16 @@ void FEventHandler::SwitchOnInput(const Uint32 EventType)
 			break;
 		}
 
+		/** Render targets (and with device reset all textures) lost their content */
+		case SDL_EVENT_RENDER_TARGETS_RESET:
+		case SDL_EVENT_RENDER_DEVICE_RESET:
+		{
+			LOG_DEBUG("Render targets reset for window " << Event.render.windowID);
+			FGlobalDefines::GEngine->GetEngineRender()->OnRenderTargetsReset(Event.render.windowID);
+
+			break;
+		}
+
 		/** Keyboard */
 		case SDL_EVENT_KEY_DOWN:
 		{
@@ -4,86 +4,169 @@
 FRenderCommandsWithScopeLock::FRenderCommandsWithScopeLock(FRenderThread* InRenderThread)
 	: RenderThread(InRenderThread)
 {
-	// @TODO: Scope lock removed
+	// Recorded buffer is only used by game thread, lock is not needed
 }
 
 FRenderCommandsWithScopeLock::~FRenderCommandsWithScopeLock()
 {
-	// @TODO: Scope unlock removed
 }
 
 void FRenderCommandsWithScopeLock::GetRenderDelegate(const std::shared_ptr<FRenderableObject>& InRenderableObject, const ERenderOrder RenderOrder) const
 {
-	if (RenderThread->RenderCommands.IsValidKey(RenderOrder))
+	RenderThread->EnqueueRenderCommand(InRenderableObject, RenderOrder);
+}
+
+FScopedRenderResourcesLock::FScopedRenderResourcesLock()
+	: RenderResourcesMutex(nullptr)
+{
+	FRenderThread* RenderThread = (FGlobalDefines::GEngine != nullptr) ? FGlobalDefines::GEngine->GetRenderThread() : nullptr;
+	if (RenderThread != nullptr)
 	{
-		RenderThread->RenderCommands[RenderOrder].Collection.Push(InRenderableObject);
+		RenderResourcesMutex = &RenderThread->RenderResourcesMutex;
+		RenderResourcesMutex->lock();
+	}
+}
+
+FScopedRenderResourcesLock::~FScopedRenderResourcesLock()
+{
+	if (RenderResourcesMutex != nullptr)
+	{
+		RenderResourcesMutex->unlock();
 	}
 }
 
 FRenderThread::FRenderThread(FThreadInputData* InThreadInputData, FThreadData* InThreadData)
 	: FThread(InThreadInputData, InThreadData)
+	, RecordingBufferIndex(0)
+	, bIsRenderingFrameFinished(true)
+	, bIsFrameReadyToRender(false)
 {
 }
 
 FRenderThread::~FRenderThread()
 {
-	RenderCommands.Clear();
+	RenderCommandsBuffers[0].Clear();
+	RenderCommandsBuffers[1].Clear();
 }
 
 void FRenderThread::StartThread()
 {
-	InitializeMapWithDelegates();
+	InitializeMapWithDelegates(RenderCommandsBuffers[0]);
+	InitializeMapWithDelegates(RenderCommandsBuffers[1]);
 
 	FThread::StartThread();
 }
 
+void FRenderThread::StopThread()
+{
+	{
+		std::lock_guard<std::mutex> Lock(FrameMutex);
+
+		FThread::StopThread();
+	}
+
+	FrameCondition.notify_all();
+}
+
 FRenderCommandsWithScopeLock FRenderThread::GetRenderCommands()
 {
 	return FRenderCommandsWithScopeLock(this);
 }
 
-void FRenderThread::TickThread()
+void FRenderThread::EnqueueRenderCommand(const std::shared_ptr<FRenderableObject>& InRenderableObject, const ERenderOrder RenderOrder)
 {
-	bIsRenderingFrameFinished = false;
+	FRenderCommandList& RecordingBuffer = RenderCommandsBuffers[RecordingBufferIndex];
 
-	// Lock RenderCommandsMutex for copy
-	RenderCommandsMutex.lock();
+	if (RecordingBuffer.IsValidKey(RenderOrder))
+	{
+		RecordingBuffer[RenderOrder].Collection.Push(InRenderableObject);
+	}
+}
 
-	// Copy data for render
-	RenderCommandsCopy = std::move(RenderCommands);
+void FRenderThread::SubmitFrame()
+{
+	// Previous frame must be submitted before its buffer can be recorded again
+	WaitForRenderingFrameFinished();
 
-	// After move populate map with required data
-	InitializeMapWithDelegates();
+	{
+		std::lock_guard<std::mutex> Lock(FrameMutex);
+
+		// Render thread takes recorded buffer, game thread records next frame into other one
+		RecordingBufferIndex = 1 - RecordingBufferIndex;
+
+		bIsRenderingFrameFinished = false;
+		bIsFrameReadyToRender = true;
+	}
 
-	RenderCommandsMutex.unlock();
+	FrameCondition.notify_all();
+}
 
-	// Execute
-	for (std::pair<const ERenderOrder, FRenderableObjectsCollection>& RenderCommand : RenderCommandsCopy)
+void FRenderThread::WaitForRenderingFrameFinished()
+{
+	std::unique_lock<std::mutex> Lock(FrameMutex);
+
+	FrameCondition.wait(Lock, [this]()
 	{
-		for (std::shared_ptr<FRenderableObject>& RenderableObject : RenderCommand.second.Collection)
+		return (bIsRenderingFrameFinished || !GetThreadInputData()->IsThreadAlive());
+	});
+}
+
+void FRenderThread::TickThread()
+{
+	int32 SubmittingBufferIndex;
+
+	{
+		std::unique_lock<std::mutex> Lock(FrameMutex);
+
+		FrameCondition.wait(Lock, [this]()
 		{
-			RenderableObject->Render();
+			return (bIsFrameReadyToRender || !GetThreadInputData()->IsThreadAlive());
+		});
+
+		if (!bIsFrameReadyToRender)
+		{
+			// Stopped
+			return;
 		}
+
+		bIsFrameReadyToRender = false;
+
+		// Game thread switched to other buffer in SubmitFrame
+		SubmittingBufferIndex = 1 - RecordingBufferIndex;
 	}
 
-	bIsRenderingFrameFinished = true;
+	{
+		std::lock_guard<std::mutex> Lock(RenderResourcesMutex);
+
+		ExecuteRenderCommands(RenderCommandsBuffers[SubmittingBufferIndex]);
+	}
 
-	while (!bIsRenderingNextFrameAllowed)
 	{
-		THREAD_WAIT_MS(1);
+		std::lock_guard<std::mutex> Lock(FrameMutex);
+
+		bIsRenderingFrameFinished = true;
 	}
 
-	bIsRenderingNextFrameAllowed = false;
+	FrameCondition.notify_all();
 }
 
-void FRenderThread::AllowRenderNextFrame()
+void FRenderThread::InitializeMapWithDelegates(FRenderCommandList& InRenderCommandList)
 {
-	bIsRenderingNextFrameAllowed = true;
+	InRenderCommandList.Emplace(ERenderOrder::Pre, FRenderableObjectsCollection());
+	InRenderCommandList.Emplace(ERenderOrder::Default, FRenderableObjectsCollection());
+	InRenderCommandList.Emplace(ERenderOrder::Post, FRenderableObjectsCollection());
 }
 
-void FRenderThread::InitializeMapWithDelegates()
+void FRenderThread::ExecuteRenderCommands(FRenderCommandList& InRenderCommandList)
 {
-	RenderCommands.Emplace(ERenderOrder::Pre, FRenderableObjectsCollection());
-	RenderCommands.Emplace(ERenderOrder::Default, FRenderableObjectsCollection());
-	RenderCommands.Emplace(ERenderOrder::Post, FRenderableObjectsCollection());
+	for (std::pair<const ERenderOrder, FRenderableObjectsCollection>& RenderCommand : InRenderCommandList)
+	{
+		for (std::shared_ptr<FRenderableObject>& RenderableObject : RenderCommand.second.Collection)
+		{
+			RenderableObject->Render();
+		}
+
+		// Keep allocated memory for next frame
+		RenderCommand.second.Collection.Clear();
+	}
 }
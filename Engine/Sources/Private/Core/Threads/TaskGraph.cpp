@@ -0,0 +1,216 @@
+#include "CoreEngine.h"
+#include "Threads/TaskGraph.h"
+
+#include "Threads/ThreadsManager.h"
+
+FGraphTask::FGraphTask(const std::shared_ptr<FDelegateSafe<>>& InTaskDelegate, const ETaskThread InTaskThread)
+	: TaskDelegate(InTaskDelegate)
+	, TaskThread(InTaskThread)
+	, NumberOfPendingPrerequisites(1)
+	, bSubsequentsStarted(false)
+	, JobState(std::make_shared<FAsyncJobState>())
+{
+}
+
+FGraphTaskHandle::FGraphTaskHandle()
+	: ThreadsManager(nullptr)
+{
+}
+
+FGraphTaskHandle::FGraphTaskHandle(FThreadsManager* InThreadsManager, const std::shared_ptr<FGraphTask>& InGraphTask)
+	: ThreadsManager(InThreadsManager)
+	, GraphTask(InGraphTask)
+{
+}
+
+bool FGraphTaskHandle::IsValid() const
+{
+	return (ThreadsManager != nullptr && GraphTask != nullptr);
+}
+
+bool FGraphTaskHandle::IsFinished() const
+{
+	return GetJobHandle().IsFinished();
+}
+
+void FGraphTaskHandle::Wait() const
+{
+	GetJobHandle().Wait();
+}
+
+FAsyncJobHandle FGraphTaskHandle::GetJobHandle() const
+{
+	if (IsValid())
+	{
+		return FAsyncJobHandle(ThreadsManager, GraphTask->JobState);
+	}
+
+	return FAsyncJobHandle();
+}
+
+FTaskGraph::FTaskGraph(FThreadsManager* InThreadsManager)
+	: ThreadsManager(InThreadsManager)
+{
+}
+
+FGraphTaskHandle FTaskGraph::AddTask(FDelegateSafe<>& TaskDelegate, const CArray<FGraphTaskHandle>& InPrerequisites, const ETaskThread TaskThread)
+{
+	std::shared_ptr<FGraphTask> GraphTask = std::make_shared<FGraphTask>(std::make_shared<FDelegateSafe<>>(std::move(TaskDelegate)), TaskThread);
+
+	for (const FGraphTaskHandle& Prerequisite : InPrerequisites)
+	{
+		if (Prerequisite.IsValid())
+		{
+			std::lock_guard<std::mutex> Lock(Prerequisite.GraphTask->SubsequentsMutex);
+
+			// Finished prerequisites are skipped, others will start this task when done
+			if (!Prerequisite.GraphTask->bSubsequentsStarted)
+			{
+				GraphTask->NumberOfPendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+
+				Prerequisite.GraphTask->Subsequents.Push(GraphTask);
+			}
+		}
+	}
+
+	// Remove setup prerequisite, starts task now if everything before is done
+	OnPrerequisiteFinished(ThreadsManager, GraphTask);
+
+	return FGraphTaskHandle(ThreadsManager, GraphTask);
+}
+
+void FTaskGraph::ParallelFor(const int32 Number, FFunctorLambda<void, int32> Function, const int32 MinBatchSize)
+{
+	ParallelForInternal(ThreadsManager, Number, Function, MinBatchSize);
+}
+
+FGraphTaskHandle FTaskGraph::AddParallelForTask(const int32 Number, FFunctorLambda<void, int32> Function, const CArray<FGraphTaskHandle>& InPrerequisites, const int32 MinBatchSize)
+{
+	std::shared_ptr<FFunctorLambda<void, int32>> SharedFunction = std::make_shared<FFunctorLambda<void, int32>>(std::move(Function));
+	FThreadsManager* CurrentThreadsManager = ThreadsManager;
+
+	FDelegateSafe<> TaskDelegate;
+	TaskDelegate.BindLambda([CurrentThreadsManager, Number, SharedFunction, MinBatchSize]()
+	{
+		ParallelForInternal(CurrentThreadsManager, Number, *SharedFunction, MinBatchSize);
+	});
+
+	return AddTask(TaskDelegate, InPrerequisites);
+}
+
+void FTaskGraph::WaitForAll(const CArray<FGraphTaskHandle>& InTaskHandles)
+{
+	for (const FGraphTaskHandle& TaskHandle : InTaskHandles)
+	{
+		TaskHandle.Wait();
+	}
+}
+
+void FTaskGraph::StartTask(FThreadsManager* InThreadsManager, const std::shared_ptr<FGraphTask>& GraphTask)
+{
+	FDelegateSafe<> ExecuteDelegate;
+	ExecuteDelegate.BindLambda([InThreadsManager, GraphTask]()
+	{
+		ExecuteTask(InThreadsManager, GraphTask);
+	});
+
+	if (GraphTask->TaskThread == ETaskThread::MainThread)
+	{
+		InThreadsManager->AddMainThreadCallback(std::make_shared<FDelegateSafe<>>(std::move(ExecuteDelegate)));
+	}
+	else
+	{
+		// Job shares state with task, so ExecuteJob marks task as finished
+		FAsyncWorkStructure AsyncWorkStructure;
+		AsyncWorkStructure.DelegateToRunAsync = std::make_shared<FDelegateSafe<>>(std::move(ExecuteDelegate));
+		AsyncWorkStructure.JobState = GraphTask->JobState;
+
+		InThreadsManager->AddAsyncWork(std::move(AsyncWorkStructure));
+	}
+}
+
+void FTaskGraph::ExecuteTask(FThreadsManager* InThreadsManager, const std::shared_ptr<FGraphTask>& GraphTask)
+{
+	GraphTask->TaskDelegate->Execute();
+
+	CArray<std::shared_ptr<FGraphTask>> SubsequentsToStart;
+
+	{
+		std::lock_guard<std::mutex> Lock(GraphTask->SubsequentsMutex);
+
+		GraphTask->bSubsequentsStarted = true;
+
+		SubsequentsToStart.Swap(GraphTask->Subsequents.Vector);
+	}
+
+	for (const std::shared_ptr<FGraphTask>& Subsequent : SubsequentsToStart)
+	{
+		OnPrerequisiteFinished(InThreadsManager, Subsequent);
+	}
+
+	// Main thread tasks do not go through FThreadsManager::ExecuteJob
+	if (GraphTask->TaskThread == ETaskThread::MainThread)
+	{
+		GraphTask->JobState->bIsFinished.store(true, std::memory_order_release);
+		GraphTask->JobState->bIsFinished.notify_all();
+	}
+}
+
+void FTaskGraph::OnPrerequisiteFinished(FThreadsManager* InThreadsManager, const std::shared_ptr<FGraphTask>& GraphTask)
+{
+	if (GraphTask->NumberOfPendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		StartTask(InThreadsManager, GraphTask);
+	}
+}
+
+void FTaskGraph::ParallelForInternal(FThreadsManager* InThreadsManager, const int32 Number, FFunctorLambda<void, int32>& Function, const int32 MinBatchSize)
+{
+	if (Number <= 0)
+	{
+		return;
+	}
+
+	// Workers and calling thread
+	const int32 NumberOfThreads = InThreadsManager->WorkerJobQueues.Size() + 1;
+
+	// Few batches per thread so faster threads can take work of slower ones
+	static constexpr int32 BatchesPerThread = 4;
+	const int32 BatchSize = FMath::Max(FMath::Max(MinBatchSize, 1), Number / (NumberOfThreads * BatchesPerThread));
+	const int32 NumberOfBatches = (Number + BatchSize - 1) / BatchSize;
+
+	std::atomic<int32> NextBatchIndex = 0;
+
+	auto ProcessBatches = [&]()
+	{
+		int32 BatchIndex;
+		while ((BatchIndex = NextBatchIndex.fetch_add(1, std::memory_order_relaxed)) < NumberOfBatches)
+		{
+			const int32 FirstIndex = BatchIndex * BatchSize;
+			const int32 LastIndex = FMath::Min(FirstIndex + BatchSize, Number);
+
+			for (int32 Index = FirstIndex; Index < LastIndex; Index++)
+			{
+				Function(Index);
+			}
+		}
+	};
+
+	// Calling thread takes batches too, so one helper less is needed
+	const int32 NumberOfHelpers = FMath::Min(NumberOfBatches, NumberOfThreads) - 1;
+
+	CArray<FAsyncJobHandle> HelperJobHandles;
+
+	for (int32 i = 0; i < NumberOfHelpers; i++)
+	{
+		FDelegateSafe<> HelperDelegate;
+		HelperDelegate.BindLambda(ProcessBatches);
+
+		HelperJobHandles.Push(InThreadsManager->AddAsyncDelegate(HelperDelegate));
+	}
+
+	ProcessBatches();
+
+	// Helpers reference local variables, they must be done before returning. Not started helpers are executed here and exit instantly.
+	FAsyncJobHandle::WaitForAll(HelperJobHandles);
+}
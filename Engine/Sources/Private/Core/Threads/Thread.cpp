@@ -107,28 +107,34 @@ FThreadWorker::FThreadWorker(FThreadInputData* InThreadInputData, FThreadData* I
 {
 }
 
-void FThreadWorker::TickThread()
+void FThreadWorker::InitThread()
 {
-	FThreadsManager* ThreadsManager = GetThreadInputData()->GetThreadsManager();
-	while (GetThreadInputData()->IsThreadAlive() && ThreadsManager->HasAnyJobLeft())
-	{
-		FAsyncWorkStructure AsyncWorkStructure = ThreadsManager->GetFirstAvailableJob();
+	FThread::InitThread();
 
-		// Run job to be done async
-		AsyncWorkStructure.DelegateToRunAsync->Execute();
+	const FThreadWorkerData* ThreadWorkerData = static_cast<FThreadWorkerData*>(GetThreadData());
 
-		if (AsyncWorkStructure.AsyncCallback)
-		{
-			ThreadsManager->MainThreadCallbacksMutex.lock();
+	GetThreadInputData()->GetThreadsManager()->RegisterWorkerQueueForCurrentThread(ThreadWorkerData->GetThreadNumber());
+}
 
-			// Enqueue sync callback on main thread
-			ThreadsManager->MainThreadCallbacks.Push(FMainThreadCallbackStructure(AsyncWorkStructure.AsyncCallback));
+void FThreadWorker::StopThread()
+{
+	FThread::StopThread();
 
-			ThreadsManager->MainThreadCallbacksMutex.unlock();
-		}
+	// Worker may be sleeping, wake it so it can notice stop
+	GetThreadInputData()->GetThreadsManager()->WakeAllWorkers();
+}
+
+void FThreadWorker::TickThread()
+{
+	FThreadsManager* ThreadsManager = GetThreadInputData()->GetThreadsManager();
+
+	// Own queue first, then steal from others
+	while (GetThreadInputData()->IsThreadAlive() && ThreadsManager->TryExecuteSingleJob())
+	{
 	}
 
-	FThread::TickThread();
+	// Sleep until new job is added or thread is stopped
+	ThreadsManager->WaitForWork(GetThreadInputData());
 }
 
 void FThreadWorker::OnFinishThread()
@@ -144,7 +150,14 @@ void FThreadWorker::OnFinishThread()
 
 void FGenericThread::AddTask(const FFunctorLambda<void>& Task)
 {
-	GenericThreadTaskQueue.PushBackSafe(Task);
+	{
+		// Push under condition mutex so thread can not miss it between check and sleep
+		std::lock_guard<std::mutex> Lock(GenericThreadTaskConditionMutex);
+
+		GenericThreadTaskQueue.PushBackSafe(Task);
+	}
+
+	GenericThreadTaskCondition.notify_one();
 }
 
 void FGenericThread::SetShouldRemoveDoneJobs(const bool bShouldRemove)
@@ -166,12 +179,17 @@ FGenericThread::FGenericThread(FThreadInputData* InThreadInputData, FThreadData*
 
 void FGenericThread::TickThread()
 {
-	if (GenericThreadTaskQueue.IsEmpty())
 	{
-		// Default wait if nothing to do
-		THREAD_WAIT_MS(1);
+		// Sleep if nothing to do, woken by AddTask or StopThread
+		std::unique_lock<std::mutex> Lock(GenericThreadTaskConditionMutex);
+
+		GenericThreadTaskCondition.wait(Lock, [this]()
+		{
+			return (!GenericThreadTaskQueue.IsEmpty() || !GetThreadInputData()->IsThreadAlive());
+		});
 	}
-	else
+
+	if (!GenericThreadTaskQueue.IsEmpty())
 	{
 		FFunctorLambda<void>& Task = GenericThreadTaskQueue.PeekFirst();
 		Task.operator()();
@@ -187,3 +205,14 @@ void FGenericThread::StartThread()
 {
 	// Overriden to do not start automatically
 }
+
+void FGenericThread::StopThread()
+{
+	{
+		std::lock_guard<std::mutex> Lock(GenericThreadTaskConditionMutex);
+
+		FThread::StopThread();
+	}
+
+	GenericThreadTaskCondition.notify_all();
+}
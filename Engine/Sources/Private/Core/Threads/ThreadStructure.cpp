@@ -1 +1,60 @@
 #include "CoreEngine.h"
+#include "Threads/ThreadStructure.h"
+
+#include "Threads/ThreadsManager.h"
+
+FAsyncJobHandle::FAsyncJobHandle()
+	: ThreadsManager(nullptr)
+{
+}
+
+FAsyncJobHandle::FAsyncJobHandle(FThreadsManager* InThreadsManager, const std::shared_ptr<FAsyncJobState>& InJobState)
+	: ThreadsManager(InThreadsManager)
+	, JobState(InJobState)
+{
+}
+
+bool FAsyncJobHandle::IsValid() const
+{
+	return (ThreadsManager != nullptr && JobState != nullptr);
+}
+
+bool FAsyncJobHandle::IsFinished() const
+{
+	// Invalid handle has nothing to wait for
+	return (!IsValid() || JobState->bIsFinished.load(std::memory_order_acquire));
+}
+
+void FAsyncJobHandle::Wait() const
+{
+	while (!IsFinished())
+	{
+		// Help with queued work instead of sleeping, it may be even our job
+		if (ThreadsManager->TryExecuteSingleJob())
+		{
+			continue;
+		}
+
+		if (ThreadsManager->IsInMainThread())
+		{
+			// Job may depend on main thread task (see FTaskGraph) so main thread can not sleep
+			if (!ThreadsManager->TryExecuteSingleMainThreadCallback())
+			{
+				std::this_thread::yield();
+			}
+		}
+		else
+		{
+			// Nothing left in queues so job is running on other thread, sleep until it's done
+			JobState->bIsFinished.wait(false, std::memory_order_acquire);
+		}
+	}
+}
+
+void FAsyncJobHandle::WaitForAll(const CArray<FAsyncJobHandle>& InJobHandles)
+{
+	for (const FAsyncJobHandle& JobHandle : InJobHandles)
+	{
+		JobHandle.Wait();
+	}
+}
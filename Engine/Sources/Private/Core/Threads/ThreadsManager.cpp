@@ -1,8 +1,20 @@
 #include "CoreEngine.h"
 #include "Threads/ThreadsManager.h"
 
+namespace
+{
+	/** Manager owning worker running on this thread, nullptr on non worker threads */
+	thread_local FThreadsManager* CurrentThreadWorkerManager = nullptr;
+
+	/** Queue index of worker running on this thread */
+	thread_local int32 CurrentThreadWorkerQueueIndex = INDEX_NONE;
+}
+
 FThreadsManager::FThreadsManager()
-	: StartingNumberOfThreads(1)
+	: NumberOfQueuedJobs(0)
+	, NextQueueIndexForExternalJob(0)
+	, NumberOfSleepingWorkers(0)
+	, StartingNumberOfThreads(1)
 	, DefaultThreadName("DefaultThread_")
 {
 }
@@ -13,6 +25,8 @@ FThreadsManager::~FThreadsManager()
 
 void FThreadsManager::Initialize()
 {
+	MainThreadId = std::this_thread::get_id();
+
 	// Calculate number of cores
 	int32 NumberOfCores = SDL_GetNumLogicalCPUCores();
 
@@ -22,10 +36,12 @@ void FThreadsManager::Initialize()
 		NumberOfCores = 1;
 	}
 
-	// Create available slots for threads
+	// Create available slots for threads, each slot has own job queue
 	for (int32 ThreadIndex = 0; ThreadIndex < NumberOfCores; ThreadIndex++)
 	{
 		AvailableThreadsNumbers.Push(ThreadIndex);
+
+		WorkerJobQueues.Push(std::make_shared<CWorkStealingQueue<FAsyncWorkStructure>>());
 	}
 
 	const int32 Cores = GetNumberOfCores();
@@ -43,42 +59,45 @@ void FThreadsManager::Initialize()
 
 void FThreadsManager::DeInitialize()
 {
-	// Stop created threads
-	for (FThreadData* ThreadWorkerData : AllThreadsArray)
-	{
-		if (ThreadWorkerData->ThreadInputData->IsThreadAlive())
-		{
-			ThreadWorkerData->Thread->StopThread();
-		}
-	}
-
-	LOG_INFO("Number of threads to stop: " << AllThreadsArray.Size());
-
 	COUNTER_START(StopThreadsCoutnerStart);
 
-	for (FThreadData* ThreadData : AllThreadsArray)
 	{
-		if (ThreadData != nullptr && ThreadData->ThreadInputData != nullptr)
+		// Lock so threads can not remove themselves from AllThreadsArray while we iterate it
+		std::lock_guard<std::mutex> Lock(WorkerThreadsArrayMutex);
+
+		LOG_INFO("Number of threads to stop: " << AllThreadsArray.Size());
+
+		// Stop created threads
+		for (FThreadData* ThreadData : AllThreadsArray)
 		{
-			LOG_WARN("Closing threads: " << ThreadData->ThreadInputData->GetThreadName());
+			if (ThreadData != nullptr && ThreadData->ThreadInputData != nullptr)
+			{
+				LOG_WARN("Closing threads: " << ThreadData->ThreadInputData->GetThreadName());
+
+				if (ThreadData->ThreadInputData->IsThreadAlive())
+				{
+					ThreadData->Thread->StopThread();
+				}
+			}
 		}
 	}
 
-	static constexpr int32 TimeToWaitEachLoopIterationInMS = 2;
-	static constexpr int32 TimeToWaitBeforeWarn = 2000;
+	static constexpr std::chrono::milliseconds TimeToWaitBeforeWarn(2000);
 
-	int32 WaitTime = 0;
-
-	// Wait for all threads to finish
-	while (AllThreadsArray.Size())
 	{
-		THREAD_WAIT_MS(TimeToWaitEachLoopIterationInMS);
+		std::unique_lock<std::mutex> Lock(WorkerThreadsArrayMutex);
 
-		WaitTime += TimeToWaitEachLoopIterationInMS;
+		auto AreAllThreadsRemoved = [this]()
+		{
+			return (AllThreadsArray.IsEmpty() && WorkerThreadsArray.IsEmpty());
+		};
 
-		if (WaitTime > TimeToWaitBeforeWarn)
+		// Wait for all threads to finish, each removed thread notifies ThreadRemovedCondition
+		if (!ThreadRemovedCondition.wait_for(Lock, TimeToWaitBeforeWarn, AreAllThreadsRemoved))
 		{
 			LOG_ERROR("Unable to stop all threads!");
+
+			ThreadRemovedCondition.wait(Lock, AreAllThreadsRemoved);
 		}
 	}
 
@@ -112,28 +131,67 @@ void FThreadsManager::TickThreadCallbacks()
 	MainThreadCallbacksCopy.Clear();
 }
 
-void FThreadsManager::AddAsyncDelegate(FDelegateSafe<void>& DelegateToRunAsync)
+FAsyncJobHandle FThreadsManager::AddAsyncDelegate(FDelegateSafe<void>& DelegateToRunAsync)
 {
 	FAsyncWorkStructure AsyncWorkStructure;
 	AsyncWorkStructure.DelegateToRunAsync = std::make_shared<FDelegateSafe<void>>(std::move(DelegateToRunAsync));
 
-	AddAsyncWork(AsyncWorkStructure);
+	return AddAsyncWork(std::move(AsyncWorkStructure));
 }
 
-void FThreadsManager::AddAsyncDelegate(FDelegateSafe<void>& DelegateToRunAsync, FDelegateSafe<void>& AsyncCallback)
+FAsyncJobHandle FThreadsManager::AddAsyncDelegate(FDelegateSafe<void>& DelegateToRunAsync, FDelegateSafe<void>& AsyncCallback)
 {
 	FAsyncWorkStructure AsyncWorkStructure;
 	AsyncWorkStructure.DelegateToRunAsync = std::make_shared<FDelegateSafe<void>>(std::move(DelegateToRunAsync));
 	AsyncWorkStructure.AsyncCallback = std::make_shared<FDelegateSafe<void>>(std::move(AsyncCallback));
 
-	AddAsyncWork(AsyncWorkStructure);
+	return AddAsyncWork(std::move(AsyncWorkStructure));
+}
+
+FAsyncJobHandle FThreadsManager::AddAsyncWork(FAsyncWorkStructure AsyncRunWithCallback)
+{
+	if (AsyncRunWithCallback.JobState == nullptr)
+	{
+		AsyncRunWithCallback.JobState = std::make_shared<FAsyncJobState>();
+	}
+
+	FAsyncJobHandle AsyncJobHandle(this, AsyncRunWithCallback.JobState);
+
+	const int32 NumberOfQueues = WorkerJobQueues.Size();
+	if (ENSURE_VALID(NumberOfQueues > 0))
+	{
+		// Workers keep their own work local, other threads spread work across all queues
+		int32 QueueIndex = GetQueueIndexForCurrentThread();
+		if (QueueIndex == INDEX_NONE)
+		{
+			QueueIndex = static_cast<int32>(NextQueueIndexForExternalJob.fetch_add(1, std::memory_order_relaxed) % static_cast<uint32>(NumberOfQueues));
+		}
+
+		// Increment before push so counter never goes below zero when job is taken instantly
+		NumberOfQueuedJobs.fetch_add(1, std::memory_order_seq_cst);
+
+		WorkerJobQueues[QueueIndex]->Push(std::move(AsyncRunWithCallback));
+
+		WakeWorker();
+	}
+	else
+	{
+		LOG_ERROR("Async work added before FThreadsManager::Initialize.");
+	}
+
+	return AsyncJobHandle;
 }
 
-void FThreadsManager::AddAsyncWork(const FAsyncWorkStructure& AsyncRunWithCallback)
+void FThreadsManager::AddMainThreadCallback(const std::shared_ptr<FDelegateSafe<>>& InCallback)
 {
-	std::lock_guard<std::mutex> MutexScopeLock(AsyncJobQueueMutex);
+	std::lock_guard<std::mutex> Lock(MainThreadCallbacksMutex);
 
-	AsyncJobQueue.PushBack(AsyncRunWithCallback);
+	MainThreadCallbacks.Push(FMainThreadCallbackStructure(InCallback));
+}
+
+bool FThreadsManager::IsInMainThread() const
+{
+	return (std::this_thread::get_id() == MainThreadId);
 }
 
 void FThreadsManager::TryStopThread(FThreadData* ThreadData)
@@ -148,9 +206,19 @@ void FThreadsManager::TryStopThread(FThreadData* ThreadData)
 
 void FThreadsManager::ResetAllJobs()
 {
-	std::lock_guard<std::mutex> MutexScopeLock(AsyncJobQueueMutex);
+	FAsyncWorkStructure RemovedAsyncWorkStructure;
 
-	AsyncJobQueue.Clear();
+	for (const std::shared_ptr<CWorkStealingQueue<FAsyncWorkStructure>>& WorkerJobQueue : WorkerJobQueues)
+	{
+		while (WorkerJobQueue->Steal(RemovedAsyncWorkStructure))
+		{
+			NumberOfQueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+
+			// Release anyone waiting for this job
+			RemovedAsyncWorkStructure.JobState->bIsFinished.store(true, std::memory_order_release);
+			RemovedAsyncWorkStructure.JobState->bIsFinished.notify_all();
+		}
+	}
 }
 
 int32 FThreadsManager::GetNumberOfLogicalCPU()
@@ -158,9 +226,20 @@ int32 FThreadsManager::GetNumberOfLogicalCPU()
 	return SDL_GetNumLogicalCPUCores();
 }
 
-FThreadWorkerData* FThreadsManager::CreateThreadWorker(const std::string& NewThreadName)
+FThreadWorkerData* FThreadsManager::CreateThreadWorker(const std::string& NewThreadName, const int32 ThreadNumber)
 {
-	return CreateThread<FThreadWorker, FThreadWorkerData>(NewThreadName);
+	FThreadWorkerData* ThreadData = new FThreadWorkerData(this, NewThreadName);
+
+	// Must be set before start, worker uses it to find own queue
+	ThreadData->ThreadNumber = ThreadNumber;
+
+	ThreadData->Create<FThreadWorker>();
+
+	AllThreadsArray.Push(ThreadData);
+
+	ThreadData->Thread->StartThread();
+
+	return ThreadData;
 }
 
 void FThreadsManager::StartNewThread()
@@ -174,8 +253,7 @@ void FThreadsManager::StartNewThread()
 
 		const std::string NewThreadName = DefaultThreadName + std::to_string(NewThreadIndex + 1);
 
-		FThreadWorkerData* ThreadData = CreateThreadWorker(NewThreadName);
-		ThreadData->ThreadNumber = NewThreadIndex;
+		FThreadWorkerData* ThreadData = CreateThreadWorker(NewThreadName, NewThreadIndex);
 
 		WorkerThreadsArray.Push(ThreadData);
 	}
@@ -218,35 +296,143 @@ int32 FThreadsManager::GetNumberOfCores()
 	return SDL_GetNumLogicalCPUCores();
 }
 
-FAsyncWorkStructure FThreadsManager::GetFirstAvailableJob()
+bool FThreadsManager::TryGetJob(const int32 QueueIndex, FAsyncWorkStructure& OutAsyncWorkStructure)
 {
-	// @TODO Remove mutex and find and smart way of distributing tasks
+	bool bHasJob = false;
+
+	const int32 NumberOfQueues = WorkerJobQueues.Size();
 
-	std::lock_guard<std::mutex> Lock(AsyncJobQueueMutex);
+	// Own queue first - newest job, most likely still in cache
+	if (WorkerJobQueues.IsValidIndex(QueueIndex))
+	{
+		bHasJob = WorkerJobQueues[QueueIndex]->Pop(OutAsyncWorkStructure);
+	}
 
-	if (AsyncJobQueue.Size() == 0)
+	if (!bHasJob && NumberOfQueuedJobs.load(std::memory_order_relaxed) > 0)
 	{
-		FAsyncWorkStructure AsyncWorkStructure;
-		AsyncWorkStructure.DelegateToRunAsync = std::make_shared<FDelegateSafe<>>();
-		AsyncWorkStructure.AsyncCallback = std::make_shared<FDelegateSafe<>>();
+		// Start from next queue so thieves do not all hit the same victim
+		const int32 FirstVictimIndex = (QueueIndex == INDEX_NONE) ? 0 : (QueueIndex + 1);
 
-		return AsyncWorkStructure;
+		for (int32 i = 0; i < NumberOfQueues && !bHasJob; i++)
+		{
+			const int32 VictimIndex = (FirstVictimIndex + i) % NumberOfQueues;
+			if (VictimIndex != QueueIndex)
+			{
+				bHasJob = WorkerJobQueues[VictimIndex]->Steal(OutAsyncWorkStructure);
+			}
+		}
 	}
-	else
+
+	if (bHasJob)
 	{
-		// Get first element
-		FAsyncWorkStructure AsyncWorkStructure = AsyncJobQueue.PeekFirst();
+		NumberOfQueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+	}
 
-		// Remove first element from list
-		AsyncJobQueue.DequeFront();
+	return bHasJob;
+}
+
+bool FThreadsManager::TryExecuteSingleJob()
+{
+	FAsyncWorkStructure AsyncWorkStructure;
+
+	const bool bHasJob = TryGetJob(GetQueueIndexForCurrentThread(), AsyncWorkStructure);
+	if (bHasJob)
+	{
+		ExecuteJob(AsyncWorkStructure);
+	}
+
+	return bHasJob;
+}
+
+bool FThreadsManager::TryExecuteSingleMainThreadCallback()
+{
+	std::shared_ptr<FDelegateSafe<>> Callback;
+
+	{
+		std::lock_guard<std::mutex> Lock(MainThreadCallbacksMutex);
+
+		if (MainThreadCallbacks.IsEmpty())
+		{
+			return false;
+		}
+
+		Callback = MainThreadCallbacks[0].AsyncCallback;
+
+		MainThreadCallbacks.RemoveAt(0);
+	}
+
+	Callback->Execute();
+
+	return true;
+}
+
+void FThreadsManager::ExecuteJob(FAsyncWorkStructure& AsyncWorkStructure)
+{
+	// Run job to be done async
+	AsyncWorkStructure.DelegateToRunAsync->Execute();
 
-		return AsyncWorkStructure;
+	if (AsyncWorkStructure.AsyncCallback)
+	{
+		// Enqueue sync callback on main thread
+		AddMainThreadCallback(AsyncWorkStructure.AsyncCallback);
 	}
+
+	AsyncWorkStructure.JobState->bIsFinished.store(true, std::memory_order_release);
+	AsyncWorkStructure.JobState->bIsFinished.notify_all();
+}
+
+void FThreadsManager::RegisterWorkerQueueForCurrentThread(const int32 QueueIndex)
+{
+	CurrentThreadWorkerManager = this;
+	CurrentThreadWorkerQueueIndex = QueueIndex;
+}
+
+int32 FThreadsManager::GetQueueIndexForCurrentThread() const
+{
+	return (CurrentThreadWorkerManager == this) ? CurrentThreadWorkerQueueIndex : INDEX_NONE;
+}
+
+void FThreadsManager::WaitForWork(const FThreadInputData* InThreadInputData)
+{
+	std::unique_lock<std::mutex> Lock(WorkAvailableMutex);
+
+	// Must be visible before job count is checked, see WakeWorker
+	NumberOfSleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+
+	WorkAvailableCondition.wait(Lock, [this, InThreadInputData]()
+	{
+		return (NumberOfQueuedJobs.load(std::memory_order_seq_cst) > 0 || !InThreadInputData->IsThreadAlive());
+	});
+
+	NumberOfSleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void FThreadsManager::WakeWorker()
+{
+	// Job count was incremented before this check, so either worker sees the job or we see sleeping worker
+	if (NumberOfSleepingWorkers.load(std::memory_order_seq_cst) > 0)
+	{
+		{
+			// Lock to make sure worker is inside of wait and not between check and wait
+			std::lock_guard<std::mutex> Lock(WorkAvailableMutex);
+		}
+
+		WorkAvailableCondition.notify_one();
+	}
+}
+
+void FThreadsManager::WakeAllWorkers()
+{
+	{
+		std::lock_guard<std::mutex> Lock(WorkAvailableMutex);
+	}
+
+	WorkAvailableCondition.notify_all();
 }
 
 bool FThreadsManager::HasAnyJobLeft() const
 {
-	return (AsyncJobQueue.Size() > 0);
+	return (NumberOfQueuedJobs.load(std::memory_order_relaxed) > 0);
 }
 
 bool FThreadsManager::InternalRemoveWorkerThread(const FThread* InThread)
@@ -260,6 +446,9 @@ bool FThreadsManager::InternalRemoveWorkerThread(const FThread* InThread)
 
 	bWasRemoved = true;
 
+	// Notify under lock, manager may be destroyed right after DeInitialize sees empty arrays
+	ThreadRemovedCondition.notify_all();
+
 	return bWasRemoved;
 }
 
@@ -274,5 +463,7 @@ bool FThreadsManager::InternalRemoveThread(const FThread* InThread)
 
 	bWasRemoved = true;
 
+	ThreadRemovedCondition.notify_all();
+
 	return bWasRemoved;
 }
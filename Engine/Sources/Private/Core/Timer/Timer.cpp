@@ -3,6 +3,8 @@
 #include "CoreEngine.h"
 #include "Timer/Timer.h"
 
+#include "Threads/ThreadsManager.h"
+
 static constexpr int32 TimeConversionMultiplier = 1000;
 
 FTimerCollector::FTimerCollector()
@@ -19,14 +21,33 @@ FTimerCollector* FTimerCollector::Get()
 
 void FTimerCollector::RegisterTimer(FTimer* Timer)
 {
+	std::lock_guard<std::mutex> Lock(TimersMutex);
+
+	Timer->TimerCollectorIndex = Timers.Size();
+
 	Timers.Push(Timer);
 }
 
 void FTimerCollector::UnRegisterTimer(FTimer* Timer)
 {
-	Timers.Remove(Timer);
+	std::lock_guard<std::mutex> Lock(TimersMutex);
+
+	if (Timers.IsValidIndex(Timer->TimerCollectorIndex))
+	{
+		// Swap with last to remove in O(1)
+		FTimer* LastTimer = Timers[Timers.Size() - 1];
+		LastTimer->TimerCollectorIndex = Timer->TimerCollectorIndex;
+		Timers[Timer->TimerCollectorIndex] = LastTimer;
 
-	PausedTimers.Remove(Timer);
+		Timers.RemoveAt(Timers.Size() - 1);
+
+		Timer->TimerCollectorIndex = INDEX_NONE;
+	}
+
+	if (bAreTimersPaused)
+	{
+		PausedTimers.Remove(Timer);
+	}
 }
 
 void FTimerCollector::PauseAllTimers()
@@ -35,6 +56,8 @@ void FTimerCollector::PauseAllTimers()
 	{
 		bAreTimersPaused = true;
 
+		std::lock_guard<std::mutex> Lock(TimersMutex);
+
 		for (FTimer* CurrentTimer : Timers)
 		{
 			if (CurrentTimer != nullptr && CurrentTimer->IsActive() && CurrentTimer->IsPausableByTimerCollector())
@@ -65,10 +88,14 @@ void FTimerCollector::ResumeAllTimers()
 FTimer::FTimer(FDelegateSafe<void, FOptionalTimerParams*>& InOnFinishDelegate, const float Time, std::shared_ptr<FOptionalTimerParams> InOptionalTimerParams, const bool bInRunAsyncOnFinish)
 	: bRunAsyncOnFinish(bInRunAsyncOnFinish)
 	, bIsTimerActive(false)
-	, OnFinishDelegate(std::move(InOnFinishDelegate))
+	, OnFinishDelegate(std::make_shared<FDelegateSafe<void, FOptionalTimerParams*>>(std::move(InOnFinishDelegate)))
 	, OptionalTimerParams(std::move(InOptionalTimerParams))
+	, bIsTimerDestroyed(std::make_shared<std::atomic_bool>(false))
 	, TimeLeftRaw(TimeFloatToMs(Time))
 	, InitialTimerTime(TimeLeftRaw)
+	, TimeStartOfTimer(0)
+	, TimerIDRaw(0)
+	, TimerCollectorIndex(INDEX_NONE)
 {
 	FTimerCollector::Get()->RegisterTimer(this);
 
@@ -78,10 +105,14 @@ FTimer::FTimer(FDelegateSafe<void, FOptionalTimerParams*>& InOnFinishDelegate, c
 FTimer::FTimer(FDelegateSafe<void, FOptionalTimerParams*>& InOnFinishDelegate, const Uint32 Time, std::shared_ptr<FOptionalTimerParams> InOptionalTimerParams, bool bInRunAsyncOnFinish)
 	: bRunAsyncOnFinish(bInRunAsyncOnFinish)
 	, bIsTimerActive(false)
-	, OnFinishDelegate(std::move(InOnFinishDelegate))
+	, OnFinishDelegate(std::make_shared<FDelegateSafe<void, FOptionalTimerParams*>>(std::move(InOnFinishDelegate)))
 	, OptionalTimerParams(std::move(InOptionalTimerParams))
+	, bIsTimerDestroyed(std::make_shared<std::atomic_bool>(false))
 	, TimeLeftRaw(Time)
 	, InitialTimerTime(TimeLeftRaw)
+	, TimeStartOfTimer(0)
+	, TimerIDRaw(0)
+	, TimerCollectorIndex(INDEX_NONE)
 {
 	FTimerCollector::Get()->RegisterTimer(this);
 
@@ -90,52 +121,75 @@ FTimer::FTimer(FDelegateSafe<void, FOptionalTimerParams*>& InOnFinishDelegate, c
 
 FTimer::~FTimer()
 {
+	// Async delegates already queued can not be removed, they will skip call
+	bIsTimerDestroyed->store(true);
+
 	FTimerCollector::Get()->UnRegisterTimer(this);
 
 	PauseTimer();
+
+	// Wheel keeps raw pointer, make sure it's removed even if timer was marked inactive
+	CancelInTimerWheel();
 }
 
-Uint32 FTimer::OnTimerFinished(void* InOptionalTimerParams, SDL_TimerID InTimerID, Uint32 InInterval)
+void FTimer::OnTimerWheelEntryExpired()
 {
-	FOptionalTimerParams* OptionalTimerParams = static_cast<FOptionalTimerParams*>(InOptionalTimerParams);
+	bIsTimerActive = false;
 
-	OptionalTimerParams->Timer->bIsTimerActive = false;
+	FThreadsManager* ThreadsManager = (FGlobalDefines::GEngine != nullptr) ? FGlobalDefines::GEngine->GetThreadsManager() : nullptr;
 
-	if (OptionalTimerParams->Timer->bRunAsyncOnFinish)
+	if (bRunAsyncOnFinish && ThreadsManager != nullptr)
 	{
-		OptionalTimerParams->Timer->OnFinishDelegate.Execute(OptionalTimerParams);
+		// Timer can be destroyed before async delegate runs, so delegate and params are shared with it instead of using this
+		FDelegateSafe<void> AsyncDelegate;
+		AsyncDelegate.BindLambda([OnFinishDelegate = OnFinishDelegate, OptionalTimerParams = OptionalTimerParams, bIsTimerDestroyed = bIsTimerDestroyed]()
+		{
+			if (!bIsTimerDestroyed->load())
+			{
+				OnFinishDelegate->Execute(OptionalTimerParams.get());
+			}
+		});
+
+		ThreadsManager->AddAsyncDelegate(AsyncDelegate);
 	}
 	else
 	{
-		// @TODO May be critical if two timers happen in same time
-		FGlobalDefines::GEngine->AddLambdaToCallOnStartOfNextTick([OptionalTimerParams]()
-		{
-			OptionalTimerParams->Timer->OnSynchronousTimerFinished();
-		});
+		// Called on main thread from FTimerWheel::Advance at start of tick
+		OnSynchronousTimerFinished();
 	}
-
-	return 0;
 }
 
 void FTimer::OnSynchronousTimerFinished()
 {
-	OnFinishDelegate.Execute(OptionalTimerParams.get());
+	OnFinishDelegate->Execute(OptionalTimerParams.get());
 }
 
 void FTimer::StartTimer(const bool bRestartTimer)
 {
 	if (!bIsTimerActive)
 	{
-		bIsTimerActive = true;
-
-		if (bRestartTimer)
+		FTimerWheel* TimerWheel = (FGlobalDefines::GEngine != nullptr) ? FGlobalDefines::GEngine->GetTimerWheel() : nullptr;
+		if (TimerWheel != nullptr)
 		{
-			TimeLeftRaw = InitialTimerTime;
-		}
+			static std::atomic<SDL_TimerID> NextTimerId = 1;
 
-		TimeStartOfTimer = SDL_GetTicks();
+			bIsTimerActive = true;
+
+			if (bRestartTimer)
+			{
+				TimeLeftRaw = InitialTimerTime;
+			}
+
+			TimeStartOfTimer = SDL_GetTicks();
 
-		TimerIDRaw = SDL_AddTimer(TimeLeftRaw, OnTimerFinished, OptionalTimerParams.get());
+			TimerIDRaw = NextTimerId++;
+
+			TimerWheel->Schedule(this, TimeStartOfTimer + TimeLeftRaw);
+		}
+		else
+		{
+			LOG_ERROR("Timer wheel is not available. Timer will be inactive!");
+		}
 	}
 }
 
@@ -145,15 +199,13 @@ void FTimer::PauseTimer()
 	{
 		bIsTimerActive = false;
 
-		const bool bWasRemoved = SDL_RemoveTimer(TimerIDRaw);
+		const bool bWasRemoved = CancelInTimerWheel();
 
 		if (bWasRemoved)
 		{
-			TimeLeftRaw = static_cast<Uint32>(SDL_GetTicks() - TimeStartOfTimer);
-		}
-		else
-		{
-			LOG_ERROR("Unable to remove timer.");
+			const Uint32 TimeElapsed = GetTimeMSElapsedSinceStart();
+
+			TimeLeftRaw = (TimeElapsed < TimeLeftRaw) ? (TimeLeftRaw - TimeElapsed) : 0;
 		}
 	}
 }
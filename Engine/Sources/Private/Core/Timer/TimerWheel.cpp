@@ -0,0 +1,277 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "Timer/TimerWheel.h"
+
+FTimerWheelEntry::FTimerWheelEntry()
+	: TimerWheel(nullptr)
+	, ExpireTime(0)
+{
+}
+
+bool FTimerWheelEntry::CancelInTimerWheel()
+{
+	FTimerWheel* CurrentTimerWheel = TimerWheel.load();
+	if (CurrentTimerWheel != nullptr)
+	{
+		return CurrentTimerWheel->Cancel(this);
+	}
+
+	return false;
+}
+
+FTimerWheel::FTimerWheel(const Uint64 InStartTime)
+	: CurrentTime(InStartTime)
+	, NumberOfScheduledEntries(0)
+{
+	for (FTimerWheelLink& Slot : Slots)
+	{
+		Slot.Previous = &Slot;
+		Slot.Next = &Slot;
+	}
+
+	ExpiredList.Previous = &ExpiredList;
+	ExpiredList.Next = &ExpiredList;
+}
+
+FTimerWheel::~FTimerWheel()
+{
+	std::lock_guard<std::mutex> Lock(WheelMutex);
+
+	// Entries are not owned, just detach them so they do not try to cancel from destroyed wheel
+	auto DetachAll = [](FTimerWheelLink& Head)
+	{
+		FTimerWheelLink* Link = Head.Next;
+		while (Link != &Head)
+		{
+			FTimerWheelLink* NextLink = Link->Next;
+
+			FTimerWheelEntry* Entry = static_cast<FTimerWheelEntry*>(Link);
+			Entry->TimerWheel = nullptr;
+			Entry->Previous = nullptr;
+			Entry->Next = nullptr;
+
+			Link = NextLink;
+		}
+	};
+
+	for (FTimerWheelLink& Slot : Slots)
+	{
+		DetachAll(Slot);
+	}
+
+	DetachAll(ExpiredList);
+}
+
+void FTimerWheel::Schedule(FTimerWheelEntry* Entry, const Uint64 InExpireTime)
+{
+	std::lock_guard<std::mutex> Lock(WheelMutex);
+
+	if (Entry->TimerWheel == this)
+	{
+		Unlink(Entry);
+	}
+	else if (Entry->TimerWheel != nullptr)
+	{
+		LOG_ERROR("Entry is already scheduled in other timer wheel.");
+
+		return;
+	}
+	else
+	{
+		Entry->TimerWheel = this;
+
+		NumberOfScheduledEntries++;
+	}
+
+	Entry->ExpireTime = InExpireTime;
+
+	AddToSlot(Entry);
+}
+
+bool FTimerWheel::Cancel(FTimerWheelEntry* Entry)
+{
+	std::lock_guard<std::mutex> Lock(WheelMutex);
+
+	if (Entry->TimerWheel == this)
+	{
+		Unlink(Entry);
+
+		Entry->TimerWheel = nullptr;
+
+		NumberOfScheduledEntries--;
+
+		return true;
+	}
+
+	return false;
+}
+
+void FTimerWheel::Advance(const Uint64 InCurrentTime)
+{
+	std::unique_lock<std::mutex> Lock(WheelMutex);
+
+	int32 NumberOfExpiredEntries = 0;
+
+	while (CurrentTime <= InCurrentTime)
+	{
+		if (NumberOfScheduledEntries == NumberOfExpiredEntries)
+		{
+			// Nothing left in slots, skip empty time
+			CurrentTime = InCurrentTime + 1;
+
+			break;
+		}
+
+		const int32 FirstLevelIndex = static_cast<int32>(CurrentTime & (FirstLevelSize - 1));
+		if (FirstLevelIndex == 0)
+		{
+			// First level made full lap, bring down entries for next lap. Higher levels are cascaded when lower made full lap as well.
+			for (int32 Level = 1; Level < NumberOfLevels; Level++)
+			{
+				if (Cascade(Level) != 0)
+				{
+					break;
+				}
+			}
+		}
+
+		FTimerWheelLink* Slot = GetSlot(0, FirstLevelIndex);
+
+		for (FTimerWheelLink* Link = Slot->Next; Link != Slot; Link = Link->Next)
+		{
+			NumberOfExpiredEntries++;
+		}
+
+		MoveSlotToExpiredList(Slot);
+
+		CurrentTime++;
+	}
+
+	// Fire one by one without lock, so callbacks can schedule or cancel (including other expired entries)
+	while (ExpiredList.Next != &ExpiredList)
+	{
+		FTimerWheelEntry* Entry = static_cast<FTimerWheelEntry*>(ExpiredList.Next);
+
+		Unlink(Entry);
+
+		Entry->TimerWheel = nullptr;
+
+		NumberOfScheduledEntries--;
+
+		Lock.unlock();
+
+		Entry->OnTimerWheelEntryExpired();
+
+		Lock.lock();
+	}
+}
+
+void FTimerWheel::AddToSlot(FTimerWheelEntry* Entry)
+{
+	// Expired entries are added to slot processed next
+	Uint64 SlotTime = FMath::Max(Entry->ExpireTime, CurrentTime);
+
+	Uint64 TimeToExpire = SlotTime - CurrentTime;
+	if (TimeToExpire > MaxScheduleTime)
+	{
+		// Too far, place at end of range, it will be cascaded again using real expire time
+		SlotTime = CurrentTime + MaxScheduleTime;
+		TimeToExpire = MaxScheduleTime;
+	}
+
+	if (TimeToExpire < FirstLevelSize)
+	{
+		LinkAfter(GetSlot(0, static_cast<int32>(SlotTime & (FirstLevelSize - 1)))->Previous, Entry);
+	}
+	else
+	{
+		for (int32 Level = 1; Level < NumberOfLevels; Level++)
+		{
+			const int32 Shift = FirstLevelBits + (LevelBits * (Level - 1));
+
+			if (TimeToExpire < (static_cast<Uint64>(1) << (Shift + LevelBits)))
+			{
+				LinkAfter(GetSlot(Level, static_cast<int32>((SlotTime >> Shift) & (LevelSize - 1)))->Previous, Entry);
+
+				break;
+			}
+		}
+	}
+}
+
+int32 FTimerWheel::Cascade(const int32 Level)
+{
+	const int32 Shift = FirstLevelBits + (LevelBits * (Level - 1));
+	const int32 SlotIndex = static_cast<int32>((CurrentTime >> Shift) & (LevelSize - 1));
+
+	FTimerWheelLink* Slot = GetSlot(Level, SlotIndex);
+	if (Slot->Next == Slot)
+	{
+		return SlotIndex;
+	}
+
+	// Detach whole list first, entries may be added back to same level
+	FTimerWheelLink* Link = Slot->Next;
+	Slot->Previous->Next = nullptr;
+	Slot->Previous = Slot;
+	Slot->Next = Slot;
+
+	while (Link != nullptr)
+	{
+		FTimerWheelLink* NextLink = Link->Next;
+
+		AddToSlot(static_cast<FTimerWheelEntry*>(Link));
+
+		Link = NextLink;
+	}
+
+	return SlotIndex;
+}
+
+FTimerWheelLink* FTimerWheel::GetSlot(const int32 Level, const int32 SlotIndex)
+{
+	if (Level == 0)
+	{
+		return &Slots[SlotIndex];
+	}
+
+	return &Slots[FirstLevelSize + (LevelSize * (Level - 1)) + SlotIndex];
+}
+
+void FTimerWheel::LinkAfter(FTimerWheelLink* Head, FTimerWheelLink* Link)
+{
+	Link->Previous = Head;
+	Link->Next = Head->Next;
+
+	Head->Next->Previous = Link;
+	Head->Next = Link;
+}
+
+void FTimerWheel::Unlink(FTimerWheelLink* Link)
+{
+	Link->Previous->Next = Link->Next;
+	Link->Next->Previous = Link->Previous;
+
+	Link->Previous = nullptr;
+	Link->Next = nullptr;
+}
+
+void FTimerWheel::MoveSlotToExpiredList(FTimerWheelLink* Slot)
+{
+	if (Slot->Next != Slot)
+	{
+		FTimerWheelLink* First = Slot->Next;
+		FTimerWheelLink* Last = Slot->Previous;
+
+		// Append to end of expired list
+		First->Previous = ExpiredList.Previous;
+		ExpiredList.Previous->Next = First;
+
+		Last->Next = &ExpiredList;
+		ExpiredList.Previous = Last;
+
+		Slot->Previous = Slot;
+		Slot->Next = Slot;
+	}
+}
@@ -9,13 +9,31 @@ FEngineMap::FEngineMap(FMapAsset* InMapAsset, FMapManager* InMapManager) : FMap(
 {
 }
 
+void FEngineMap::Initialize()
+{
+	FMap::Initialize();
+
+	MapTileChangedDelegate.BindObject(this, &FEngineMap::OnMapTileChanged);
+
+	MapManager->GetOwnerWindow()->OnRenderTargetsResetDelegate.BindObject(this, &FEngineMap::OnRenderTargetsReset);
+}
+
+void FEngineMap::DeInitialize()
+{
+	MapManager->GetOwnerWindow()->OnRenderTargetsResetDelegate.UnBindObject(this, &FEngineMap::OnRenderTargetsReset);
+
+	MapTileChangedDelegate.UnBindObject(this, &FEngineMap::OnMapTileChanged);
+
+	FMap::DeInitialize();
+}
+
 void FEngineMap::Render()
 {
 	FMap::Render();
 
 	if (bIsActive)
 	{
-		const FVector2D<float> OwnerWindowSize = MapManager->GetOwnerWindow()->GetWindowSize();
+		const FVector2D<int32> OwnerWindowSize = MapManager->GetOwnerWindow()->GetWindowSize();
 		const FVector2D<float> MapLocationFloat = MapRenderOffset;
 		const FVector2D<float> MapAssetsTileSizeFloat = MapData.AssetsTileSize;
 
@@ -28,57 +46,43 @@ void FEngineMap::Render()
 
 		// Max render tile offset - Everything after that vector will not be rendered
 		MapLocationTileOffsetMax = MapLocationTileOffsetMin;
-		MapLocationTileOffsetMax.X += FMath::CeilToInt(OwnerWindowSize.X / MapAssetsTileSizeFloat.X);
-		MapLocationTileOffsetMax.Y += FMath::CeilToInt(OwnerWindowSize.Y / MapAssetsTileSizeFloat.Y);
-
-		SDL_Renderer* WindowRenderer = MapManager->GetOwnerWindow()->GetRenderer()->GetSDLRenderer();
+		MapLocationTileOffsetMax.X += FMath::CeilToInt(static_cast<float>(OwnerWindowSize.X) / MapAssetsTileSizeFloat.X);
+		MapLocationTileOffsetMax.Y += FMath::CeilToInt(static_cast<float>(OwnerWindowSize.Y) / MapAssetsTileSizeFloat.Y);
 
-		SDL_FRect Source, Destination;
-		Source.x = 0;
-		Source.y = 0;
-		Source.h = MapData.AssetsTileSize.Y;
-		Source.w = MapData.AssetsTileSize.X;
-		Destination.h = MapData.AssetsTileSize.Y;
-		Destination.w = MapData.AssetsTileSize.X;
-
-		const int VerticalArraySize = MapData.MapArray.Size();
-
-		for (int VerticalIndex = 0; VerticalIndex < VerticalArraySize; VerticalIndex++)
+		// Map size could change since last frame, for example when map was loaded again
+		if (!ChunkRenderer.IsInitializedFor(MapData))
 		{
-			// Optimization - Do not render offscreen
-			if (VerticalIndex >= MapLocationTileOffsetMin.Y && VerticalIndex <= MapLocationTileOffsetMax.Y)
-			{
-				const FMapRow& MapRow = MapData.MapArray[VerticalIndex];
-
-				const int HorizontalArraySize = MapRow.Array.Size();
-
-				for (int HorizontalIndex = 0; HorizontalIndex < HorizontalArraySize; HorizontalIndex++)
-				{
-					// Optimization - Do not render offscreen
-					if (HorizontalIndex >= MapLocationTileOffsetMin.X && HorizontalIndex <= MapLocationTileOffsetMax.X)
-					{
-						const int AssetIndex = MapRow.Array[HorizontalIndex];
-
-						if (AssetIndex >= 0)
-						{
-							const FMapSubAssetSettings CurrentAssetSettings = MapData.MapSubAssetSettingsArray[AssetIndex];
-
-							Destination.x = MapRenderOffset.X + HorizontalIndex * MapData.AssetsTileSize.X;
-							Destination.y = MapRenderOffset.Y + VerticalIndex * MapData.AssetsTileSize.Y;
-
-							CurrentAssetSettings.GetTextureAsset()->GetTexture()->Draw(WindowRenderer, Source, Destination);
-						}
-						else
-						{
-							// Do sth when index is not found
-
-							// @TODO ...
-						}
-					}
-				}
-			}
+			ChunkRenderer.Initialize(MapManager->GetOwnerWindow()->GetRenderer()->GetSDLRenderer(), MapData);
 		}
 
+		ChunkRenderer.Render(MapData, MapRenderOffset, OwnerWindowSize);
+
 		RenderSubSystems();
 	}
 }
+
+void FEngineMap::ClearData()
+{
+	FMap::ClearData();
+
+	ChunkRenderer.Clear();
+}
+
+void FEngineMap::ReadAsset()
+{
+	FMap::ReadAsset();
+
+	// Tiles could change without changing size of map
+	ChunkRenderer.MarkAllChunksDirty();
+}
+
+void FEngineMap::OnMapTileChanged(const FVector2D<int32> InTile)
+{
+	ChunkRenderer.MarkTileDirty(InTile);
+}
+
+void FEngineMap::OnRenderTargetsReset()
+{
+	// Chunk textures are render targets, their content is lost
+	ChunkRenderer.MarkAllChunksDirty();
+}
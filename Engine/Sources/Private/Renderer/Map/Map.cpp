@@ -56,7 +56,12 @@ void FMap::Render()
 {
 	if (bIsActive)
 	{
+		FRenderer* Renderer = MapManager->GetOwnerWindow()->GetRenderer();
+
+		// Sprites of all entities are drawn together in few geometries
+		Renderer->BeginSpriteBatch();
 		EntityManager->Render();
+		Renderer->EndSpriteBatch();
 
 		RenderSubSystems();
 	}
@@ -198,6 +203,11 @@ FDelegate<void, FVector2D<int32>>& FMap::GetMapLocationChangeDelegate()
 	return MapLocationChangeDelegate;
 }
 
+FDelegate<void, FVector2D<int32>>& FMap::GetMapTileChangedDelegate()
+{
+	return MapTileChangedDelegate;
+}
+
 void FMap::ChangeTileAtLocation(const FVector2D<int32>& Location, const int32 MapAssetIndexToSet)
 {
 	const bool bDoesAssetIndexExists = MapData.MapSubAssetSettingsArray.IsValidIndex(MapAssetIndexToSet);
@@ -217,6 +227,8 @@ void FMap::ChangeTileAtLocation(const FVector2D<int32>& Location, const int32 Ma
 			if (MapRow.Array.IsValidIndex(TileLocation.X))
 			{
 				MapRow.Array[TileLocation.X] = MapAssetIndexToSet;
+
+				MapTileChangedDelegate.Execute(TileLocation);
 			}
 		}
 	}
@@ -0,0 +1,333 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "Renderer/Map/MapChunkRenderer.h"
+
+#include "Assets/Assets/MapAsset.h"
+#include "Assets/TypesForAssets/Texture.h"
+#include "Renderer/Renderer.h"
+
+namespace
+{
+	struct FTileDraw
+	{
+		SDL_Texture* Texture;
+		SDL_FRect Source;
+		SDL_FRect Destination;
+	};
+
+	/**
+	 * Collects draws of tiles in chunk, destination is relative to InOrigin
+	 * @returns number of times texture changes between following draws
+	 */
+	int32 GatherTileDraws(const FMapData& InMapData, const FVector2D<int32>& InMinTile, const FVector2D<int32>& InSize, const FVector2D<float>& InOrigin, std::vector<FTileDraw>& OutTileDraws)
+	{
+		int32 NumberOfTextureSwitches = 0;
+		SDL_Texture* LastTexture = nullptr;
+
+		for (int32 Y = InMinTile.Y; Y < InMinTile.Y + InSize.Y; Y++)
+		{
+			const FMapRow& MapRow = InMapData.MapArray[Y];
+
+			for (int32 X = InMinTile.X; X < InMinTile.X + InSize.X && X < MapRow.Array.Size(); X++)
+			{
+				const int32 AssetIndex = MapRow.Array[X];
+
+				if (InMapData.MapSubAssetSettingsArray.IsValidIndex(AssetIndex))
+				{
+					const FMapSubAssetSettings& AssetSettings = InMapData.MapSubAssetSettingsArray[AssetIndex];
+
+					const FTexture* Texture = AssetSettings.GetTextureAsset()->GetTexture();
+					const SDL_FRect& TextureSourceRect = Texture->GetSourceRect();
+
+					// Top left part of texture stretched to tile, texture may be in atlas so source can not go outside of it
+					FTileDraw TileDraw;
+					TileDraw.Texture = Texture->GetSDLTexture();
+					TileDraw.Source.x = TextureSourceRect.x;
+					TileDraw.Source.y = TextureSourceRect.y;
+					TileDraw.Source.w = FMath::Min(static_cast<float>(InMapData.AssetsTileSize.X), TextureSourceRect.w);
+					TileDraw.Source.h = FMath::Min(static_cast<float>(InMapData.AssetsTileSize.Y), TextureSourceRect.h);
+					TileDraw.Destination.x = InOrigin.X + static_cast<float>(X * InMapData.AssetsTileSize.X);
+					TileDraw.Destination.y = InOrigin.Y + static_cast<float>(Y * InMapData.AssetsTileSize.Y);
+					TileDraw.Destination.w = static_cast<float>(InMapData.AssetsTileSize.X);
+					TileDraw.Destination.h = static_cast<float>(InMapData.AssetsTileSize.Y);
+
+					if (TileDraw.Texture != LastTexture)
+					{
+						LastTexture = TileDraw.Texture;
+						NumberOfTextureSwitches++;
+					}
+
+					OutTileDraws.push_back(TileDraw);
+				}
+			}
+		}
+
+		return NumberOfTextureSwitches;
+	}
+}
+
+FMapChunkRenderer::FMapChunkRenderer()
+	: Renderer(nullptr)
+	, ChunkSizeInTiles(DefaultChunkSizeInTiles)
+	, NumberOfChunkTextures(0)
+	, FrameNumber(0)
+	, bIsRenderTargetSupported(true)
+	, LastNumberOfDrawCalls(0)
+	, LastNumberOfBakedChunks(0)
+	, LastNumberOfTextureSwitches(0)
+{
+}
+
+FMapChunkRenderer::~FMapChunkRenderer()
+{
+	Clear();
+}
+
+void FMapChunkRenderer::Initialize(SDL_Renderer* InRenderer, const FMapData& InMapData, const int32 InChunkSizeInTiles)
+{
+	Clear();
+
+	Renderer = InRenderer;
+	ChunkSizeInTiles = FMath::Max(InChunkSizeInTiles, 1);
+	TileSize = InMapData.AssetsTileSize;
+
+	MapSizeInTiles.Y = InMapData.MapArray.Size();
+	MapSizeInTiles.X = (MapSizeInTiles.Y > 0) ? InMapData.MapArray[0].Array.Size() : 0;
+
+	NumberOfChunks.X = (MapSizeInTiles.X + ChunkSizeInTiles - 1) / ChunkSizeInTiles;
+	NumberOfChunks.Y = (MapSizeInTiles.Y + ChunkSizeInTiles - 1) / ChunkSizeInTiles;
+
+	FMapChunk EmptyChunk;
+	EmptyChunk.Texture = nullptr;
+	EmptyChunk.LastVisibleFrame = 0;
+	EmptyChunk.bIsDirty = true;
+
+	Chunks.Vector.resize(NumberOfChunks.X * NumberOfChunks.Y, EmptyChunk);
+}
+
+void FMapChunkRenderer::Clear()
+{
+	for (FMapChunk& Chunk : Chunks.Vector)
+	{
+		// Texture may be still used by frame recorded for render thread
+		FRenderer::DestroyTextureDeferred(Chunk.Texture);
+	}
+
+	Chunks.Clear();
+	NumberOfChunks = FVector2D<int32>(0, 0);
+	MapSizeInTiles = FVector2D<int32>(0, 0);
+	NumberOfChunkTextures = 0;
+}
+
+bool FMapChunkRenderer::IsInitializedFor(const FMapData& InMapData) const
+{
+	const int32 MapHeight = InMapData.MapArray.Size();
+	const int32 MapWidth = (MapHeight > 0) ? InMapData.MapArray[0].Array.Size() : 0;
+
+	return Renderer != nullptr && MapSizeInTiles.X == MapWidth && MapSizeInTiles.Y == MapHeight && TileSize == InMapData.AssetsTileSize;
+}
+
+void FMapChunkRenderer::MarkTileDirty(const FVector2D<int32>& InTile)
+{
+	if (InTile.X >= 0 && InTile.X < MapSizeInTiles.X && InTile.Y >= 0 && InTile.Y < MapSizeInTiles.Y)
+	{
+		Chunks[((InTile.Y / ChunkSizeInTiles) * NumberOfChunks.X) + (InTile.X / ChunkSizeInTiles)].bIsDirty = true;
+	}
+}
+
+void FMapChunkRenderer::MarkAllChunksDirty()
+{
+	for (FMapChunk& Chunk : Chunks.Vector)
+	{
+		Chunk.bIsDirty = true;
+	}
+}
+
+void FMapChunkRenderer::Render(const FMapData& InMapData, const FVector2D<int32>& InMapRenderOffset, const FVector2D<int32>& InWindowSize)
+{
+	LastNumberOfDrawCalls = 0;
+	LastNumberOfBakedChunks = 0;
+	LastNumberOfTextureSwitches = 0;
+
+	FrameNumber++;
+
+	if (Chunks.Size() == 0)
+	{
+		return;
+	}
+
+	const FVector2D<int32> ChunkSizeInPixels(ChunkSizeInTiles * TileSize.X, ChunkSizeInTiles * TileSize.Y);
+
+	// Range of chunks overlapping window
+	const int32 MinChunkX = FMath::Max(FMath::FloorToInt(static_cast<float>(-InMapRenderOffset.X) / static_cast<float>(ChunkSizeInPixels.X)), 0);
+	const int32 MinChunkY = FMath::Max(FMath::FloorToInt(static_cast<float>(-InMapRenderOffset.Y) / static_cast<float>(ChunkSizeInPixels.Y)), 0);
+	const int32 MaxChunkX = FMath::Min(FMath::FloorToInt(static_cast<float>(InWindowSize.X - InMapRenderOffset.X) / static_cast<float>(ChunkSizeInPixels.X)), NumberOfChunks.X - 1);
+	const int32 MaxChunkY = FMath::Min(FMath::FloorToInt(static_cast<float>(InWindowSize.Y - InMapRenderOffset.Y) / static_cast<float>(ChunkSizeInPixels.Y)), NumberOfChunks.Y - 1);
+
+	for (int32 ChunkY = MinChunkY; ChunkY <= MaxChunkY; ChunkY++)
+	{
+		for (int32 ChunkX = MinChunkX; ChunkX <= MaxChunkX; ChunkX++)
+		{
+			FMapChunk& Chunk = Chunks[(ChunkY * NumberOfChunks.X) + ChunkX];
+			Chunk.LastVisibleFrame = FrameNumber;
+
+			if (bIsRenderTargetSupported && (Chunk.bIsDirty || Chunk.Texture == nullptr))
+			{
+				BakeChunk(InMapData, ChunkX, ChunkY, Chunk);
+			}
+
+			if (bIsRenderTargetSupported)
+			{
+				const FVector2D<int32> ChunkSize = GetChunkSize(ChunkX, ChunkY);
+
+				SDL_FRect Destination;
+				Destination.x = static_cast<float>(InMapRenderOffset.X + (ChunkX * ChunkSizeInPixels.X));
+				Destination.y = static_cast<float>(InMapRenderOffset.Y + (ChunkY * ChunkSizeInPixels.Y));
+				Destination.w = static_cast<float>(ChunkSize.X * TileSize.X);
+				Destination.h = static_cast<float>(ChunkSize.Y * TileSize.Y);
+
+				FRenderer::ExecuteOrEnqueue([SDLRenderer = Renderer, Texture = Chunk.Texture, Destination]()
+				{
+					SDL_RenderTexture(SDLRenderer, Texture, nullptr, &Destination);
+				});
+
+				LastNumberOfDrawCalls++;
+			}
+			else
+			{
+				DrawChunkTiles(InMapData, ChunkX, ChunkY, InMapRenderOffset);
+			}
+		}
+	}
+
+	if (NumberOfChunkTextures > MaxNumberOfChunkTextures)
+	{
+		ReleaseChunkTextures();
+	}
+}
+
+bool FMapChunkRenderer::BakeChunk(const FMapData& InMapData, const int32 ChunkX, const int32 ChunkY, FMapChunk& InChunk)
+{
+	const FVector2D<int32> ChunkSize = GetChunkSize(ChunkX, ChunkY);
+
+	if (InChunk.Texture == nullptr)
+	{
+		{
+			// Render thread may be using renderer
+			FScopedRenderResourcesLock RenderResourcesLock;
+
+			InChunk.Texture = SDL_CreateTexture(Renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, ChunkSize.X * TileSize.X, ChunkSize.Y * TileSize.Y);
+			if (InChunk.Texture != nullptr)
+			{
+				// Empty tiles stay transparent
+				SDL_SetTextureBlendMode(InChunk.Texture, SDL_BLENDMODE_BLEND);
+			}
+		}
+
+		if (InChunk.Texture == nullptr)
+		{
+			LOG_WARN("Can not create map chunk texture, tiles will be drawn one by one. (" << SDL_GetError() << ")");
+
+			bIsRenderTargetSupported = false;
+
+			return false;
+		}
+
+		NumberOfChunkTextures++;
+	}
+
+	const FVector2D<int32> MinTile(ChunkX * ChunkSizeInTiles, ChunkY * ChunkSizeInTiles);
+	const FVector2D<float> Origin(static_cast<float>(-MinTile.X * TileSize.X), static_cast<float>(-MinTile.Y * TileSize.Y));
+
+	std::vector<FTileDraw> TileDraws;
+	TileDraws.reserve(ChunkSize.X * ChunkSize.Y);
+	LastNumberOfTextureSwitches += GatherTileDraws(InMapData, MinTile, ChunkSize, Origin, TileDraws);
+
+	// Recorded in same order as draws, so chunk is baked before it's drawn in this frame
+	FRenderer::ExecuteOrEnqueue([SDLRenderer = Renderer, ChunkTexture = InChunk.Texture, TileDraws = std::move(TileDraws)]()
+	{
+		SDL_Texture* PreviousRenderTarget = SDL_GetRenderTarget(SDLRenderer);
+
+		Uint8 R, G, B, A;
+		SDL_GetRenderDrawColor(SDLRenderer, &R, &G, &B, &A);
+
+		SDL_SetRenderTarget(SDLRenderer, ChunkTexture);
+		SDL_SetRenderDrawColor(SDLRenderer, 0, 0, 0, 0);
+		SDL_RenderClear(SDLRenderer);
+
+		for (const FTileDraw& TileDraw : TileDraws)
+		{
+			SDL_RenderTexture(SDLRenderer, TileDraw.Texture, &TileDraw.Source, &TileDraw.Destination);
+		}
+
+		SDL_SetRenderTarget(SDLRenderer, PreviousRenderTarget);
+		SDL_SetRenderDrawColor(SDLRenderer, R, G, B, A);
+	});
+
+	LastNumberOfDrawCalls += ChunkSize.X * ChunkSize.Y;
+	LastNumberOfBakedChunks++;
+
+	InChunk.bIsDirty = false;
+
+	return true;
+}
+
+void FMapChunkRenderer::DrawChunkTiles(const FMapData& InMapData, const int32 ChunkX, const int32 ChunkY, const FVector2D<int32>& InMapRenderOffset)
+{
+	std::vector<FTileDraw> TileDraws;
+	LastNumberOfTextureSwitches += GatherTileDraws(InMapData, FVector2D<int32>(ChunkX * ChunkSizeInTiles, ChunkY * ChunkSizeInTiles), GetChunkSize(ChunkX, ChunkY), FVector2D<float>(InMapRenderOffset), TileDraws);
+
+	LastNumberOfDrawCalls += static_cast<int32>(TileDraws.size());
+
+	FRenderer::ExecuteOrEnqueue([SDLRenderer = Renderer, TileDraws = std::move(TileDraws)]()
+	{
+		for (const FTileDraw& TileDraw : TileDraws)
+		{
+			SDL_RenderTexture(SDLRenderer, TileDraw.Texture, &TileDraw.Source, &TileDraw.Destination);
+		}
+	});
+}
+
+FVector2D<int32> FMapChunkRenderer::GetChunkSize(const int32 ChunkX, const int32 ChunkY) const
+{
+	return FVector2D<int32>(
+		FMath::Min(ChunkSizeInTiles, MapSizeInTiles.X - (ChunkX * ChunkSizeInTiles)),
+		FMath::Min(ChunkSizeInTiles, MapSizeInTiles.Y - (ChunkY * ChunkSizeInTiles))
+	);
+}
+
+void FMapChunkRenderer::ReleaseChunkTextures()
+{
+	CArray<int32> ChunkIndexesWithTexture;
+
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Size(); ChunkIndex++)
+	{
+		// Chunks visible in this frame are never released
+		if (Chunks[ChunkIndex].Texture != nullptr && Chunks[ChunkIndex].LastVisibleFrame != FrameNumber)
+		{
+			ChunkIndexesWithTexture.Push(ChunkIndex);
+		}
+	}
+
+	std::sort(ChunkIndexesWithTexture.Vector.begin(), ChunkIndexesWithTexture.Vector.end(), [this](const int32 ChunkIndexA, const int32 ChunkIndexB)
+	{
+		return Chunks[ChunkIndexA].LastVisibleFrame < Chunks[ChunkIndexB].LastVisibleFrame;
+	});
+
+	for (const int32 ChunkIndex : ChunkIndexesWithTexture.Vector)
+	{
+		if (NumberOfChunkTextures <= MaxNumberOfChunkTextures)
+		{
+			break;
+		}
+
+		FMapChunk& Chunk = Chunks[ChunkIndex];
+
+		FRenderer::DestroyTextureDeferred(Chunk.Texture);
+		Chunk.Texture = nullptr;
+		Chunk.bIsDirty = true;
+
+		NumberOfChunkTextures--;
+	}
+}
@@ -21,11 +21,25 @@ FRenderer::FRenderer(FWindow* InWindow)
 	: Window(InWindow)
 	, Renderer(SDL_CreateRenderer(InWindow->GetSdlWindow(), nullptr))
 	, bNeedsRepaint(false)
+	, SpriteBatchDepth(0)
+	, NumberOfSprites(0)
+	, NumberOfSpriteSubmissions(0)
+	, LastNumberOfSprites(0)
+	, LastNumberOfSpriteSubmissions(0)
 {
 	if (Renderer != nullptr)
 	{
 		LOG_INFO("Renderer created!");
 
+		if (GetRenderThread() != nullptr)
+		{
+			const char* RendererName = SDL_GetRendererName(Renderer);
+			if (RendererName == nullptr || SDL_strcmp(RendererName, SDL_SOFTWARE_RENDERER) != 0)
+			{
+				LOG_WARN("Render thread is used with '" << ((RendererName != nullptr) ? RendererName : "unknown") << "' renderer, only software renderer is safe to use outside of main thread.");
+			}
+		}
+
 		SDL_SetRenderDrawColor(Renderer, 34, 91, 211, 255);
 	}
 	else
@@ -48,18 +62,23 @@ void FRenderer::PreRender()
 	{
 		Repaint();
 	}
-	
-	SDL_RenderClear(Renderer);
+
+	LastNumberOfSprites = NumberOfSprites;
+	LastNumberOfSpriteSubmissions = NumberOfSpriteSubmissions;
+	NumberOfSprites = 0;
+	NumberOfSpriteSubmissions = 0;
+
+	ExecuteOrEnqueue([SDLRenderer = Renderer]()
+	{
+		SDL_RenderClear(SDLRenderer);
+	}, ERenderOrder::Pre);
 }
 
 void FRenderer::Render()
 {
 	while (!PointsToDrawDeque.IsEmpty())
 	{
-		const FColorPoint& ColorPoint = PointsToDrawDeque.PeekFirst();
-		
-		SDL_SetRenderDrawColor(Renderer, ColorPoint.Color.R, ColorPoint.Color.G, ColorPoint.Color.B, ColorPoint.Color.A);
-		SDL_RenderPoint(Renderer, ColorPoint.Location.X, ColorPoint.Location.Y);
+		DrawPointAtAbsolute(PointsToDrawDeque.PeekFirst());
 
 		PointsToDrawDeque.DequeFront();
 	}
@@ -67,14 +86,29 @@ void FRenderer::Render()
 
 void FRenderer::PostRender()
 {
+	if (SpriteBatchDepth > 0)
+	{
+		LOG_WARN("Sprite batch was not ended before end of frame.");
+
+		SpriteBatchDepth = 0;
+	}
+
+	FlushSpriteBatch();
+
 	PaintDefaultBackground();
 
-	SDL_RenderPresent(Renderer);
+	ExecuteOrEnqueue([SDLRenderer = Renderer]()
+	{
+		SDL_RenderPresent(SDLRenderer);
+	}, ERenderOrder::Post);
 }
 
 void FRenderer::PaintDefaultBackground()
 {
-	SDL_SetRenderDrawColor(Renderer, 34, 34, 34, 255); // Background color
+	ExecuteOrEnqueue([SDLRenderer = Renderer]()
+	{
+		SDL_SetRenderDrawColor(SDLRenderer, 34, 34, 34, 255); // Background color
+	}, ERenderOrder::Post);
 }
 
 void FRenderer::Repaint()
@@ -84,7 +118,10 @@ void FRenderer::Repaint()
 
 void FRenderer::RepaintWindow()
 {
-    SDL_UpdateWindowSurface(GetSdlWindow());
+	ExecuteOrEnqueue([SDLWindow = GetSdlWindow()]()
+	{
+		SDL_UpdateWindowSurface(SDLWindow);
+	}, ERenderOrder::Pre);
 }
 
 void FRenderer::MarkNeedsRepaint()
@@ -114,81 +151,235 @@ void FRenderer::SetWindowSize(const int32 X, const int32 Y, const bool bUpdateSD
 
 void FRenderer::DrawTexture(const FTextureAsset* Texture, const FVector2D<float> Location, const FVector2D<float> Size, const bool bIsLocationRelative) const
 {
-	DrawTexture(Texture->GetTexture()->GetSDLTexture(), Location, Size, bIsLocationRelative);
+	const FTexture* SourceTexture = Texture->GetTexture();
+
+	FSpriteDrawRequest Sprite;
+	Sprite.Texture = SourceTexture->GetSDLTexture();
+	Sprite.SourceUV = SourceTexture->GetSourceUV();
+	Sprite.Destination = { Location.X, Location.Y, Size.X, Size.Y };
+
+	DrawSprite(Sprite, bIsLocationRelative);
+}
+
+void FRenderer::DrawTexture(SDL_Texture* Texture, const FVector2D<float> Location, const FVector2D<float> Size, const bool bIsLocationRelative) const
+{
+	FSpriteDrawRequest Sprite;
+	Sprite.Texture = Texture;
+	Sprite.Destination = { Location.X, Location.Y, Size.X, Size.Y };
+
+	DrawSprite(Sprite, bIsLocationRelative);
+}
+
+void FRenderer::DrawTextureAdvanced(const FTextureAsset* Texture, const FVector2D<float> Location, const FVector2D<float> Size, 
+	const double Rotation, const FVector2D<float> CenterOfRotation, SDL_FlipMode Flip, const bool bIsLocationRelative) const
+{
+	const FTexture* SourceTexture = Texture->GetTexture();
+
+	FSpriteDrawRequest Sprite;
+	Sprite.Texture = SourceTexture->GetSDLTexture();
+	Sprite.SourceUV = SourceTexture->GetSourceUV();
+	Sprite.Destination = { Location.X, Location.Y, Size.X, Size.Y };
+	Sprite.Rotation = Rotation;
+	Sprite.CenterOfRotation = CenterOfRotation;
+	Sprite.Flip = Flip;
+
+	DrawSprite(Sprite, bIsLocationRelative);
+}
+
+void FRenderer::DrawTextureAdvanced(SDL_Texture* Texture, const FVector2D<float> Location, const FVector2D<float> Size, 
+	const double Rotation, const FVector2D<float> CenterOfRotation, SDL_FlipMode Flip, const bool bIsLocationRelative) const
+{
+	FSpriteDrawRequest Sprite;
+	Sprite.Texture = Texture;
+	Sprite.Destination = { Location.X, Location.Y, Size.X, Size.Y };
+	Sprite.Rotation = Rotation;
+	Sprite.CenterOfRotation = CenterOfRotation;
+	Sprite.Flip = Flip;
+
+	DrawSprite(Sprite, bIsLocationRelative);
+}
+
+void FRenderer::BeginSpriteBatch()
+{
+	SpriteBatchDepth++;
 }
 
-void FRenderer::DrawTexture(SDL_Texture* Texture, FVector2D<float> Location, const FVector2D<float> Size, const bool bIsLocationRelative) const
+void FRenderer::EndSpriteBatch()
+{
+	if (SpriteBatchDepth > 0)
+	{
+		SpriteBatchDepth--;
+
+		if (SpriteBatchDepth == 0)
+		{
+			FlushSpriteBatch();
+		}
+	}
+	else
+	{
+		LOG_WARN("EndSpriteBatch called without BeginSpriteBatch.");
+	}
+}
+
+void FRenderer::FlushSpriteBatch() const
+{
+	if (SpriteBatch.GetNumberOfQueuedSprites() == 0)
+	{
+		return;
+	}
+
+	NumberOfSprites += SpriteBatch.GetNumberOfQueuedSprites();
+
+	SpriteBatch.BuildGeometries();
+
+	const bool bIsRenderThreadUsed = (GetRenderThread() != nullptr);
+
+	for (int32 i = 0; i < SpriteBatch.GetNumberOfGeometries(); i++)
+	{
+		const FSpriteBatchGeometry& Geometry = SpriteBatch.GetGeometry(i);
+
+		if (bIsRenderThreadUsed)
+		{
+			// Recorded lambda needs own copy, buffers of batch are reused by next flush
+			ExecuteOrEnqueue([SDLRenderer = Renderer, Texture = Geometry.Texture, Vertices = Geometry.Vertices, Indices = Geometry.Indices]()
+			{
+				SDL_RenderGeometry(SDLRenderer, Texture, Vertices.data(), static_cast<int>(Vertices.size()), Indices.data(), static_cast<int>(Indices.size()));
+			});
+		}
+		else
+		{
+			SDL_RenderGeometry(Renderer, Geometry.Texture, Geometry.Vertices.data(), static_cast<int>(Geometry.Vertices.size()), Geometry.Indices.data(), static_cast<int>(Geometry.Indices.size()));
+		}
+
+		NumberOfSpriteSubmissions++;
+	}
+}
+
+void FRenderer::DrawSprite(FSpriteDrawRequest InSprite, const bool bIsLocationRelative) const
 {
 	if (bIsLocationRelative)
 	{
-		Location = ConvertLocationToScreenSpace(Location);
+		const FVector2D<float> Location = ConvertLocationToScreenSpace(FVector2D<float>(InSprite.Destination.x, InSprite.Destination.y));
+
+		InSprite.Destination.x = Location.X;
+		InSprite.Destination.y = Location.Y;
 	}
 
-	SDL_FRect Rect;
-	Rect.x = Location.X;
-	Rect.y = Location.Y;
-	Rect.w = Size.X;
-	Rect.h = Size.Y;
+	SpriteBatch.AddSprite(InSprite);
 
-	SDL_RenderTexture(Renderer, Texture, nullptr, &Rect);
+	if (!IsSpriteBatching())
+	{
+		FlushSpriteBatch();
+	}
 }
 
-void FRenderer::DrawTextureAdvanced(const FTextureAsset* Texture, const FVector2D<float> Location, const FVector2D<float> Size, 
-	const double Rotation, const FVector2D<float> CenterOfRotation, SDL_FlipMode Flip, const bool bIsLocationRelative) const
+SDL_FRect FRenderer::ConvertSourceRectToUV(SDL_Texture* Texture, const SDL_FRect& SourceRect)
 {
-	DrawTextureAdvanced(Texture->GetTexture()->GetSDLTexture(), Location, Size, Rotation, CenterOfRotation, Flip, bIsLocationRelative);
+	float TextureWidth = 0.f;
+	float TextureHeight = 0.f;
+
+	if (Texture != nullptr && SDL_GetTextureSize(Texture, &TextureWidth, &TextureHeight) && TextureWidth > 0.f && TextureHeight > 0.f)
+	{
+		return { SourceRect.x / TextureWidth, SourceRect.y / TextureHeight, SourceRect.w / TextureWidth, SourceRect.h / TextureHeight };
+	}
+
+	return { 0.f, 0.f, 1.f, 1.f };
 }
 
-void FRenderer::DrawTextureAdvanced(SDL_Texture* Texture, FVector2D<float> Location, const FVector2D<float> Size, 
-	const double Rotation, const FVector2D<float> CenterOfRotation, SDL_FlipMode Flip, const bool bIsLocationRelative) const
+void FRenderer::DrawGeometry(SDL_Texture* Texture, std::vector<SDL_Vertex>&& Vertices, std::vector<int>&& Indices, const bool bIsLocationRelative) const
 {
+	FlushSpriteBatch();
+
+	if (Vertices.empty())
+	{
+		return;
+	}
+
 	if (bIsLocationRelative)
 	{
-		Location = ConvertLocationToScreenSpace(Location);
+		const FVector2D<float> Offset = FVector2D<float>(RenderOffset);
+
+		for (SDL_Vertex& Vertex : Vertices)
+		{
+			Vertex.position.x += Offset.X;
+			Vertex.position.y += Offset.Y;
+		}
 	}
 
-	SDL_FRect Rect;
-	Rect.x = Location.X;
-	Rect.y = Location.Y;
-	Rect.w = Size.X;
-	Rect.h = Size.Y;
+	ExecuteOrEnqueue([SDLRenderer = Renderer, Texture, Vertices = std::move(Vertices), Indices = std::move(Indices)]()
+	{
+		SDL_RenderGeometry(SDLRenderer, Texture, Vertices.data(), static_cast<int>(Vertices.size()), Indices.data(), static_cast<int>(Indices.size()));
+	});
+}
 
-	
-	SDL_RenderTextureRotated(Renderer, Texture, nullptr, &Rect, Rotation, CenterOfRotation, Flip);
+void FRenderer::DrawGeometry(SDL_Texture* Texture, const std::vector<SDL_Vertex>& Vertices, const std::vector<int>& Indices, const bool bIsLocationRelative) const
+{
+	if (bIsLocationRelative || GetRenderThread() != nullptr)
+	{
+		DrawGeometry(Texture, std::vector<SDL_Vertex>(Vertices), std::vector<int>(Indices), bIsLocationRelative);
+
+		return;
+	}
+
+	FlushSpriteBatch();
+
+	if (!Vertices.empty())
+	{
+		SDL_RenderGeometry(Renderer, Texture, Vertices.data(), static_cast<int>(Vertices.size()), Indices.data(), static_cast<int>(Indices.size()));
+	}
 }
 
 void FRenderer::OverrideTextureColor(SDL_Texture* Texture, const FColorRGBA& Color)
 {
-	SDL_SetTextureColorMod(Texture, Color.R, Color.G, Color.B);
+	// Color mod is used by draws recorded after this call, so it's recorded as well
+	ExecuteOrEnqueue([Texture, Color]()
+	{
+		SDL_SetTextureColorMod(Texture, Color.R, Color.G, Color.B);
+	});
 }
 
 void FRenderer::OverrideTextureColorReset(SDL_Texture* Texture)
 {
 	static FColorRGBA Color = FColorRGBA::ColorWhite();
 
-	SDL_SetTextureColorMod(Texture, Color.R, Color.G, Color.B);
+	OverrideTextureColor(Texture, Color);
 }
 
-void FRenderer::DrawPointAtRelative(const FColorPoint& ColorPoint) const
+void FRenderer::DestroyTextureDeferred(SDL_Texture* Texture)
 {
-	SDL_SetRenderDrawColor(Renderer, ColorPoint.Color.R, ColorPoint.Color.G, ColorPoint.Color.B, ColorPoint.Color.A);
+	if (Texture != nullptr)
+	{
+		// Post is executed after all draws of frame which is recorded now
+		ExecuteOrEnqueue([Texture]()
+		{
+			SDL_DestroyTexture(Texture);
+		}, ERenderOrder::Post);
+	}
+}
 
+void FRenderer::DrawPointAtRelative(const FColorPoint& ColorPoint) const
+{
 	const FVector2D<int> DrawLocation = ConvertLocationToScreenSpace(ColorPoint.Location);
 
-	SDL_RenderPoint(Renderer, DrawLocation.X, DrawLocation.Y);
+	DrawPointAtAbsolute(FColorPoint(DrawLocation, ColorPoint.Color));
 }
 
 void FRenderer::DrawPointAtAbsolute(const FColorPoint& ColorPoint) const
 {
-	SDL_SetRenderDrawColor(Renderer, ColorPoint.Color.R, ColorPoint.Color.G, ColorPoint.Color.B, ColorPoint.Color.A);
+	FlushSpriteBatch();
+
+	ExecuteOrEnqueue([SDLRenderer = Renderer, ColorPoint]()
+	{
+		SDL_SetRenderDrawColor(SDLRenderer, ColorPoint.Color.R, ColorPoint.Color.G, ColorPoint.Color.B, ColorPoint.Color.A);
 
-	SDL_RenderPoint(Renderer, ColorPoint.Location.X, ColorPoint.Location.Y);
+		SDL_RenderPoint(SDLRenderer, ColorPoint.Location.X, ColorPoint.Location.Y);
+	});
 }
 
 void FRenderer::DrawPointsAt(const CArray<FVector2D<float>>& Points, const FColorRGBA& AllPointsColor, const bool bIsLocationRelative) const
 {
-	SDL_SetRenderDrawColor(Renderer, AllPointsColor.R, AllPointsColor.G, AllPointsColor.B, AllPointsColor.A);
-	
+	FlushSpriteBatch();
+
 	const auto AllPointsNum = static_cast<Uint32>(Points.Size());
 
 	if (AllPointsNum == 0)
@@ -214,34 +405,41 @@ void FRenderer::DrawPointsAt(const CArray<FVector2D<float>>& Points, const FColo
 			PointsArray[Index] = { Points[Index].X, Points[Index].Y };
 		}
 	}
-	
-	SDL_RenderPoints(Renderer, PointsArray.data(), static_cast<int>(PointsArray.size()));
+
+	ExecuteOrEnqueue([SDLRenderer = Renderer, PointsArray = std::move(PointsArray), AllPointsColor]()
+	{
+		SDL_SetRenderDrawColor(SDLRenderer, AllPointsColor.R, AllPointsColor.G, AllPointsColor.B, AllPointsColor.A);
+
+		SDL_RenderPoints(SDLRenderer, PointsArray.data(), static_cast<int>(PointsArray.size()));
+	});
 }
 
 void FRenderer::DrawPointsAt(const CArray<SDL_FPoint>& Points, const FColorRGBA& AllPointsColor, const bool bIsLocationRelative) const
 {
-	SDL_SetRenderDrawColor(Renderer, AllPointsColor.R, AllPointsColor.G, AllPointsColor.B, AllPointsColor.A);
+	FlushSpriteBatch();
+
+	std::vector<SDL_FPoint> NewPoints = Points.Vector;
 
 	if (bIsLocationRelative)
 	{
-		CArray<SDL_FPoint> NewPoints = Points;
 		for (SDL_FPoint& NewPoint : NewPoints)
 		{
 			NewPoint.x += RenderOffset.X;
 			NewPoint.y += RenderOffset.Y;
 		}
-
-		SDL_RenderPoints(Renderer, NewPoints.Vector.data(), static_cast<int>(NewPoints.Size()));
 	}
-	else
+
+	ExecuteOrEnqueue([SDLRenderer = Renderer, NewPoints = std::move(NewPoints), AllPointsColor]()
 	{
-		SDL_RenderPoints(Renderer, Points.Vector.data(), static_cast<int>(Points.Size()));
-	}
+		SDL_SetRenderDrawColor(SDLRenderer, AllPointsColor.R, AllPointsColor.G, AllPointsColor.B, AllPointsColor.A);
+
+		SDL_RenderPoints(SDLRenderer, NewPoints.data(), static_cast<int>(NewPoints.size()));
+	});
 }
 
 void FRenderer::DrawRectangle(FVector2D<float> RectLocation, const FVector2D<float> RectSize, const FColorRGBA& InColor, const bool bIsLocationRelative) const
 {
-	SDL_SetRenderDrawColor(Renderer, InColor.R, InColor.G, InColor.B, InColor.A);
+	FlushSpriteBatch();
 
 	if (bIsLocationRelative)
 	{
@@ -253,13 +451,18 @@ void FRenderer::DrawRectangle(FVector2D<float> RectLocation, const FVector2D<flo
 	Rect.y = RectLocation.Y;
 	Rect.w = RectSize.X;
 	Rect.h = RectSize.Y;
-	
-	SDL_RenderFillRect(Renderer, &Rect);
+
+	ExecuteOrEnqueue([SDLRenderer = Renderer, Rect, InColor]()
+	{
+		SDL_SetRenderDrawColor(SDLRenderer, InColor.R, InColor.G, InColor.B, InColor.A);
+
+		SDL_RenderFillRect(SDLRenderer, &Rect);
+	});
 }
 
 void FRenderer::DrawRectangleOutline(FVector2D<float> RectLocation, const FVector2D<float> RectSize, const FColorRGBA& InColor, const bool bIsLocationRelative) const
 {
-	SDL_SetRenderDrawColor(Renderer, InColor.R, InColor.G, InColor.B, InColor.A);
+	FlushSpriteBatch();
 
 	if (bIsLocationRelative)
 	{
@@ -271,59 +474,74 @@ void FRenderer::DrawRectangleOutline(FVector2D<float> RectLocation, const FVecto
 	Rect.y = RectLocation.Y;
 	Rect.w = RectSize.X;
 	Rect.h = RectSize.Y;
-	
-	SDL_RenderRect(Renderer, &Rect);
+
+	ExecuteOrEnqueue([SDLRenderer = Renderer, Rect, InColor]()
+	{
+		SDL_SetRenderDrawColor(SDLRenderer, InColor.R, InColor.G, InColor.B, InColor.A);
+
+		SDL_RenderRect(SDLRenderer, &Rect);
+	});
 }
 
 void FRenderer::DrawCircle(FVector2D<int> Location, const int Radius, const bool bIsLocationRelative) const
 {
+	FlushSpriteBatch();
+
 	if (bIsLocationRelative)
 	{
 		Location = ConvertLocationToScreenSpace(Location);
 	}
 
-	int nx = Radius - 1;
-	int ny = 0;
-	int dx = 1;
-	int dy = 1;
-	int err = dx - (Radius << 1);
-
-	while (nx >= ny)
+	ExecuteOrEnqueue([SDLRenderer = Renderer, Location, Radius]()
 	{
-		SDL_RenderPoint(Renderer, Location.X + nx, Location.Y + ny);
-		SDL_RenderPoint(Renderer, Location.X + ny, Location.Y + nx);
-		SDL_RenderPoint(Renderer, Location.X - ny, Location.Y + nx);
-		SDL_RenderPoint(Renderer, Location.X - nx, Location.Y + ny);
-		SDL_RenderPoint(Renderer, Location.X - nx, Location.Y - ny);
-		SDL_RenderPoint(Renderer, Location.X - ny, Location.Y - nx);
-		SDL_RenderPoint(Renderer, Location.X + ny, Location.Y - nx);
-		SDL_RenderPoint(Renderer, Location.X + nx, Location.Y - ny);
+		int nx = Radius - 1;
+		int ny = 0;
+		int dx = 1;
+		int dy = 1;
+		int err = dx - (Radius << 1);
 
-		if (err <= 0)
+		while (nx >= ny)
 		{
-			ny++;
-			err += dy;
-			dy += 2;
+			SDL_RenderPoint(SDLRenderer, Location.X + nx, Location.Y + ny);
+			SDL_RenderPoint(SDLRenderer, Location.X + ny, Location.Y + nx);
+			SDL_RenderPoint(SDLRenderer, Location.X - ny, Location.Y + nx);
+			SDL_RenderPoint(SDLRenderer, Location.X - nx, Location.Y + ny);
+			SDL_RenderPoint(SDLRenderer, Location.X - nx, Location.Y - ny);
+			SDL_RenderPoint(SDLRenderer, Location.X - ny, Location.Y - nx);
+			SDL_RenderPoint(SDLRenderer, Location.X + ny, Location.Y - nx);
+			SDL_RenderPoint(SDLRenderer, Location.X + nx, Location.Y - ny);
+
+			if (err <= 0)
+			{
+				ny++;
+				err += dy;
+				dy += 2;
+			}
+
+			if (err > 0)
+			{
+				nx--;
+				dx += 2;
+				err += dx - (Radius << 1);
+			}
 		}
-
-		if (err > 0)
-		{
-			nx--;
-			dx += 2;
-			err += dx - (Radius << 1);
-		}
-	}
+	});
 }
 
 void FRenderer::DrawLine(FVector2D<int> From, FVector2D<int> To, const bool bIsLocationRelative) const
 {
+	FlushSpriteBatch();
+
 	if (bIsLocationRelative)
 	{
 		From = ConvertLocationToScreenSpace(From);
 		To = ConvertLocationToScreenSpace(To);
 	}
 
-	SDL_RenderLine(GetSDLRenderer(), From.X, From.Y, To.X, To.Y);
+	ExecuteOrEnqueue([SDLRenderer = Renderer, From, To]()
+	{
+		SDL_RenderLine(SDLRenderer, From.X, From.Y, To.X, To.Y);
+	});
 }
 
 FVector2D<float> FRenderer::ConvertLocationToScreenSpace(const FVector2D<float>& InLocation) const
@@ -335,3 +553,9 @@ void FRenderer::SetRenderOffset(const FVector2D<int>& NewRenderOffset)
 {
 	RenderOffset = NewRenderOffset;
 }
+
+FRenderThread* FRenderer::GetRenderThread()
+{
+	// Engine is not created when renderer resources are used by tests
+	return (FGlobalDefines::GEngine != nullptr) ? FGlobalDefines::GEngine->GetRenderThread() : nullptr;
+}
@@ -0,0 +1,201 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "Renderer/SpriteBatch.h"
+
+FSpriteDrawRequest::FSpriteDrawRequest()
+	: Texture(nullptr)
+	, SourceUV({ 0.f, 0.f, 1.f, 1.f })
+	, Destination({ 0.f, 0.f, 0.f, 0.f })
+	, Rotation(0.0)
+	, Flip(SDL_FLIP_NONE)
+	, Color(FColorRGBA::ColorWhite())
+	, Layer(0)
+{
+}
+
+FSpriteBatch::FSpriteBatch()
+	: NumberOfGeometries(0)
+{
+}
+
+void FSpriteBatch::AddSprite(const FSpriteDrawRequest& InSprite)
+{
+	Sprites.Push(InSprite);
+}
+
+void FSpriteBatch::BuildGeometries()
+{
+	for (int32 i = 0; i < NumberOfGeometries; i++)
+	{
+		Geometries[i].Vertices.clear();
+		Geometries[i].Indices.clear();
+	}
+
+	NumberOfGeometries = 0;
+
+	if (Sprites.Size() == 0)
+	{
+		return;
+	}
+
+	// Group sprites by layer and texture. Usually there is only few groups and following sprites share group, linear search is fine
+	Groups.Clear();
+	SpriteGroupIndexes.SetNum(Sprites.Size());
+
+	int32 LastGroupIndex = INDEX_NONE;
+
+	for (int32 SpriteIndex = 0; SpriteIndex < Sprites.Size(); SpriteIndex++)
+	{
+		const FSpriteDrawRequest& Sprite = Sprites[SpriteIndex];
+
+		if (LastGroupIndex == INDEX_NONE || Groups[LastGroupIndex].Texture != Sprite.Texture || Groups[LastGroupIndex].Layer != Sprite.Layer)
+		{
+			LastGroupIndex = INDEX_NONE;
+
+			for (int32 GroupIndex = 0; GroupIndex < Groups.Size(); GroupIndex++)
+			{
+				if (Groups[GroupIndex].Texture == Sprite.Texture && Groups[GroupIndex].Layer == Sprite.Layer)
+				{
+					LastGroupIndex = GroupIndex;
+
+					break;
+				}
+			}
+
+			if (LastGroupIndex == INDEX_NONE)
+			{
+				Groups.Push({ Sprite.Layer, Sprite.Texture, 0, 0 });
+				LastGroupIndex = Groups.GetLastIndex();
+			}
+		}
+
+		Groups[LastGroupIndex].NumberOfSprites++;
+		SpriteGroupIndexes[SpriteIndex] = LastGroupIndex;
+	}
+
+	// Only groups are sorted, each becomes one geometry
+	GroupOrder.SetNum(Groups.Size());
+	for (int32 GroupIndex = 0; GroupIndex < Groups.Size(); GroupIndex++)
+	{
+		GroupOrder[GroupIndex] = GroupIndex;
+	}
+
+	// Groups are created in order of their first sprite, so inside layer they keep order sprites were added in
+	std::sort(GroupOrder.Vector.begin(), GroupOrder.Vector.end(), [this](const int32 A, const int32 B)
+	{
+		if (Groups[A].Layer != Groups[B].Layer)
+		{
+			return Groups[A].Layer < Groups[B].Layer;
+		}
+
+		return A < B;
+	});
+
+	while (Geometries.Size() < Groups.Size())
+	{
+		Geometries.Push(FSpriteBatchGeometry());
+	}
+
+	for (const int32 GroupIndex : GroupOrder)
+	{
+		FSpriteGroup& Group = Groups[GroupIndex];
+		Group.GeometryIndex = NumberOfGeometries;
+
+		FSpriteBatchGeometry& Geometry = Geometries[NumberOfGeometries];
+		Geometry.Texture = Group.Texture;
+		Geometry.Layer = Group.Layer;
+
+		// Capacity is kept between builds, so after first frame this does not allocate
+		Geometry.Vertices.resize(Group.NumberOfSprites * 4);
+		Geometry.Indices.resize(Group.NumberOfSprites * 6);
+
+		// Used as number of sprites written below
+		Group.NumberOfSprites = 0;
+
+		NumberOfGeometries++;
+	}
+
+	// Sprites are visited in order they were added, so they keep it inside geometry
+	for (int32 SpriteIndex = 0; SpriteIndex < Sprites.Size(); SpriteIndex++)
+	{
+		FSpriteGroup& Group = Groups[SpriteGroupIndexes[SpriteIndex]];
+		FSpriteBatchGeometry& Geometry = Geometries[Group.GeometryIndex];
+
+		const int FirstVertexIndex = Group.NumberOfSprites * 4;
+
+		BuildSpriteVertices(Sprites[SpriteIndex], &Geometry.Vertices[FirstVertexIndex]);
+
+		int* Indices = &Geometry.Indices[Group.NumberOfSprites * 6];
+		Indices[0] = FirstVertexIndex;
+		Indices[1] = FirstVertexIndex + 1;
+		Indices[2] = FirstVertexIndex + 2;
+		Indices[3] = FirstVertexIndex;
+		Indices[4] = FirstVertexIndex + 2;
+		Indices[5] = FirstVertexIndex + 3;
+
+		Group.NumberOfSprites++;
+	}
+
+	Sprites.Clear();
+}
+
+void FSpriteBatch::BuildSpriteVertices(const FSpriteDrawRequest& InSprite, SDL_Vertex* OutVertices)
+{
+	const SDL_FRect& Destination = InSprite.Destination;
+
+	// Corners relative to center of rotation
+	const float Left = -InSprite.CenterOfRotation.X;
+	const float Top = -InSprite.CenterOfRotation.Y;
+	const float Right = Left + Destination.w;
+	const float Bottom = Top + Destination.h;
+
+	const float PivotX = Destination.x + InSprite.CenterOfRotation.X;
+	const float PivotY = Destination.y + InSprite.CenterOfRotation.Y;
+
+	SDL_FPoint Positions[4] = { { Left, Top }, { Right, Top }, { Right, Bottom }, { Left, Bottom } };
+
+	if (InSprite.Rotation != 0.0)
+	{
+		// Clockwise on screen as Y goes down, same as SDL_RenderTextureRotated
+		const double AngleInRadians = FMath::DegreesToRadians(InSprite.Rotation);
+		const float Cos = static_cast<float>(FMath::Cos(AngleInRadians));
+		const float Sin = static_cast<float>(FMath::Sin(AngleInRadians));
+
+		for (SDL_FPoint& Position : Positions)
+		{
+			const float X = Position.x;
+			const float Y = Position.y;
+
+			Position.x = X * Cos - Y * Sin;
+			Position.y = X * Sin + Y * Cos;
+		}
+	}
+
+	float MinU = InSprite.SourceUV.x;
+	float MaxU = InSprite.SourceUV.x + InSprite.SourceUV.w;
+	float MinV = InSprite.SourceUV.y;
+	float MaxV = InSprite.SourceUV.y + InSprite.SourceUV.h;
+
+	if ((InSprite.Flip & SDL_FLIP_HORIZONTAL) != 0)
+	{
+		std::swap(MinU, MaxU);
+	}
+
+	if ((InSprite.Flip & SDL_FLIP_VERTICAL) != 0)
+	{
+		std::swap(MinV, MaxV);
+	}
+
+	const SDL_FColor Color = {
+		static_cast<float>(InSprite.Color.R) / 255.f,
+		static_cast<float>(InSprite.Color.G) / 255.f,
+		static_cast<float>(InSprite.Color.B) / 255.f,
+		static_cast<float>(InSprite.Color.A) / 255.f
+	};
+
+	OutVertices[0] = { { PivotX + Positions[0].x, PivotY + Positions[0].y }, Color, { MinU, MinV } };
+	OutVertices[1] = { { PivotX + Positions[1].x, PivotY + Positions[1].y }, Color, { MaxU, MinV } };
+	OutVertices[2] = { { PivotX + Positions[2].x, PivotY + Positions[2].y }, Color, { MaxU, MaxV } };
+	OutVertices[3] = { { PivotX + Positions[3].x, PivotY + Positions[3].y }, Color, { MinU, MaxV } };
+}
@@ -39,11 +39,15 @@ void FBorderWidget::Render()
 void FBorderWidget::SetBorderDisplayMethod(const EBorderDisplayMethod NewBorderDisplayMethod)
 {
 	CurrentBorderDisplayMethod = NewBorderDisplayMethod;
+
+	InvalidateRenderCache();
 }
 
 void FBorderWidget::SetColor(const FColorRGBA& NewColor)
 {
 	CurrentWidgetColor = NewColor;
+
+	InvalidateRenderCache();
 }
 
 EBorderDisplayMethod FBorderWidget::GetBorderDisplayMethod() const
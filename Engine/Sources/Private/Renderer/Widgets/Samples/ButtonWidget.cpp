@@ -54,49 +54,49 @@ void FButtonWidget::NativeHoverOutsideTick()
 {
 	FInteractionBaseWidget::NativeHoverOutsideTick();
 
-	ButtonRenderColor = ButtonNormalColor;
+	SetButtonRenderColor(ButtonNormalColor);
 }
 
 void FButtonWidget::NativePressLeft()
 {
 	FInteractionBaseWidget::NativePressLeft();
 	
-	ButtonRenderColor = ButtonClickColor;
+	SetButtonRenderColor(ButtonClickColor);
 }
 
 void FButtonWidget::NativeReleaseLeft()
 {
 	FInteractionBaseWidget::NativeReleaseLeft();
 	
-	ButtonRenderColor = ButtonNormalColor;
+	SetButtonRenderColor(ButtonNormalColor);
 }
 
 void FButtonWidget::NativePressRight()
 {
 	FInteractionBaseWidget::NativePressRight();
 
-	ButtonRenderColor = ButtonClickColor;
+	SetButtonRenderColor(ButtonClickColor);
 }
 
 void FButtonWidget::NativeReleaseRight()
 {
 	FInteractionBaseWidget::NativeReleaseRight();
 
-	ButtonRenderColor = ButtonNormalColor;
+	SetButtonRenderColor(ButtonNormalColor);
 }
 
 void FButtonWidget::NativeMouseEnterWidget()
 {
 	FInteractionBaseWidget::NativeMouseEnterWidget();
 	
-	ButtonRenderColor = ButtonHoverColor;
+	SetButtonRenderColor(ButtonHoverColor);
 }
 
 void FButtonWidget::NativeMouseExitWidget()
 {
 	FInteractionBaseWidget::NativeMouseExitWidget();
 	
-	ButtonRenderColor = ButtonNormalColor;
+	SetButtonRenderColor(ButtonNormalColor);
 }
 
 void FButtonWidget::UseDefaultSize()
@@ -112,7 +112,13 @@ void FButtonWidget::SetScaleHorizontally(const bool bInScaleHorizontally)
 
 void FButtonWidget::SetButtonRenderColor(const FColorRGBA& Color)
 {
-	ButtonRenderColor = Color;
+	// Called each tick while not hovered, so cache is invalidated only on change
+	if (!(ButtonRenderColor == Color))
+	{
+		ButtonRenderColor = Color;
+
+		InvalidateRenderCache();
+	}
 }
 
 void FButtonWidget::SetButtonNormalColor(const FColorRGBA& Color)
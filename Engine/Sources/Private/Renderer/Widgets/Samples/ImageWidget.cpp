@@ -96,6 +96,8 @@ void FImageWidget::SetImage(FTextureAsset* NewTexture)
 		{
 			ScaleWidgetToTextureSize();
 		}
+
+		InvalidateRenderCache();
 	}
 	else
 	{
@@ -79,6 +79,11 @@ void FMouseSparkWidget::Tick()
 
 		Points[i] = Sparks[i].Location;
 	}
+
+	if (!Points.IsEmpty())
+	{
+		InvalidateRenderCache();
+	}
 }
 
 void FMouseSparkWidget::Render()
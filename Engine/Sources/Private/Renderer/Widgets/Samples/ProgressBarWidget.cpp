@@ -65,11 +65,15 @@ void FProgressBarWidget::SetProgressBarOrientation(const EProgressBarOrientation
 void FProgressBarWidget::SetProgressBarColorFill(const FColorRGBA& NewColor)
 {
 	ProgressBarColorFill = NewColor;
+
+	InvalidateRenderCache();
 }
 
 void FProgressBarWidget::SetProgressBarColorNotFill(const FColorRGBA& NewColor)
 {
 	ProgressBarColorNotFill = NewColor;
+
+	InvalidateRenderCache();
 }
 
 void FProgressBarWidget::UpdateCurrentProgressBarSizeAndLocation()
@@ -94,4 +98,6 @@ void FProgressBarWidget::UpdateCurrentProgressBarSizeAndLocation()
 			break;
 		}
 	}
+
+	InvalidateRenderCache();
 }
@@ -4,6 +4,7 @@
 #include "Renderer/Widgets/Samples/TextWidget.h"
 #include "Assets/TypesForAssets/Font.h"
 #include "Assets/Assets/FontAsset.h"
+#include "Assets/TypesForAssets/GlyphCache.h"
 
 static const char* DefaultText = "Default text"; 
 static const char* DefaultFont = "OpenSans";
@@ -35,6 +36,8 @@ FTextWidget::FTextWidget(IWidgetManagementInterface* InWidgetManagementInterface
 	, TextBackgroundRenderColor({ 255, 0, 0})
 	, SDLRect(new SDL_FRect)
 	, TextTexture(nullptr)
+	, TextGeometriesLocation({ 0.f, 0.f })
+	, bIsUsingGlyphs(false)
 	, LastTextTextureSize({ 0, 0 })
 	, CurrentTextRenderMode(ETextRenderMode::None)
 	, DesiredTextRenderMode(ETextRenderMode::Blended)
@@ -54,7 +57,7 @@ FTextWidget::FTextWidget(IWidgetManagementInterface* InWidgetManagementInterface
 FTextWidget::~FTextWidget()
 {
 #if defined(ENGINE_USING_VIDEO) && ENGINE_USING_VIDEO
-	SDL_DestroyTexture(TextTexture);
+	FRenderer::DestroyTextureDeferred(TextTexture);
 #endif
 
 	delete SDLRect;
@@ -63,7 +66,28 @@ FTextWidget::~FTextWidget()
 void FTextWidget::Render()
 {
 #if defined(ENGINE_USING_VIDEO) && ENGINE_USING_VIDEO
-	SDL_RenderTexture(GetRenderer()->GetSDLRenderer(), TextTexture, nullptr, SDLRect);
+	if (bIsUsingGlyphs)
+	{
+		const FRenderer* Renderer = GetRenderer();
+
+		if (CurrentTextRenderMode == ETextRenderMode::Shaded)
+		{
+			Renderer->DrawRectangle(FVector2D<float>(SDLRect->x, SDLRect->y), FVector2D<float>(SDLRect->w, SDLRect->h), TextBackgroundRenderColor, false);
+		}
+
+		// Quads are already at widget location, so without render thread nothing is copied
+		for (const FSpriteBatchGeometry& Geometry : TextGeometries)
+		{
+			Renderer->DrawGeometry(Geometry.Texture, Geometry.Vertices, Geometry.Indices, false);
+		}
+	}
+	else
+	{
+		FRenderer::ExecuteOrEnqueue([SDLRenderer = GetRenderer()->GetSDLRenderer(), Texture = TextTexture, Rect = *SDLRect]()
+		{
+			SDL_RenderTexture(SDLRenderer, Texture, nullptr, &Rect);
+		});
+	}
 #endif
 
 	FWidget::Render();
@@ -85,6 +109,8 @@ void FTextWidget::UpdateWidgetLocation()
 
 	SDLRect->x = LocationCache.X;
 	SDLRect->y = LocationCache.Y;
+
+	MoveTextGeometriesToWidgetLocation();
 }
 
 void FTextWidget::UpdateWidgetSize(const bool bWasSentFromRebuild)
@@ -108,6 +134,8 @@ void FTextWidget::UpdateAnchor(const bool bIsFromRebuild)
 	SDLRect->y = LocationCache.Y;
 	SDLRect->w = SizeCache.X;
 	SDLRect->h = SizeCache.Y;
+
+	MoveTextGeometriesToWidgetLocation();
 }
 
 void FTextWidget::SetText(const std::string& InText)
@@ -230,6 +258,13 @@ int32 FTextWidget::CalculateDefaultSizeForRenderText(FVector2D<int32>& InOutSize
 {
 	bool bIsRendering = false;
 
+	// Cached metrics are used when possible, so measuring text does not need TTF
+	FGlyphCache* GlyphCache = GetGlyphCache();
+	if (GlyphCache != nullptr && GlyphCache->MeasureText(RenderedText, InOutSize))
+	{
+		return true;
+	}
+
 	TTF_Font* Font = FontAsset->GetFont(TextSize)->GetFont();
 	if (Font != nullptr)
 	{
@@ -269,51 +304,140 @@ void FTextWidget::RedrawText()
 
 		AutoAdjustSize();
 
-		SDL_Surface* SdlSurface = nullptr;
-		TTF_Font* Font = FontAsset->GetFont(TextSize)->GetFont();
-		if (Font != nullptr)
+		if (!RedrawTextWithGlyphs())
+		{
+			RedrawTextTexture();
+		}
+	}
+	else
+	{
+		if (FontAsset == nullptr)
+		{
+			LOG_ERROR("FontAsset for Text widget is null");
+		}
+
+		if (DesiredText.empty())
+		{
+			LOG_ERROR("Desired text is empty, if you intend to hide widget, use SetVisibility.");
+		}
+	}
+}
+
+bool FTextWidget::RedrawTextWithGlyphs()
+{
+	FGlyphCache* GlyphCache = GetGlyphCache();
+	if (GlyphCache == nullptr)
+	{
+		return false;
+	}
+
+	FVector2D<int32> TextSizeInPixels;
+	if (!GlyphCache->BuildTextGeometry(RenderedText, TextRenderColor, TextGeometries, TextSizeInPixels))
+	{
+		return false;
+	}
+
+	TextGeometriesLocation = FVector2D<float>(0.f, 0.f);
+
+	RenderedTextSize = TextSize;
+	CurrentTextRenderMode = DesiredTextRenderMode;
+	bIsUsingGlyphs = true;
+
+	// Texture from before is not needed anymore
+	FRenderer::DestroyTextureDeferred(TextTexture);
+	TextTexture = nullptr;
+	LastTextTextureSize = FVector2D<int32>(0, 0);
+
+	// Update widget size, text may be cut to fit
+	const std::string TextBeforeAdjust = RenderedText;
+
+	AutoAdjustSizeToText(GetClippingMethod() == EClipping::Cut);
+
+	if (RenderedText != TextBeforeAdjust)
+	{
+		GlyphCache->BuildTextGeometry(RenderedText, TextRenderColor, TextGeometries, TextSizeInPixels);
+
+		TextGeometriesLocation = FVector2D<float>(0.f, 0.f);
+	}
+
+	MoveTextGeometriesToWidgetLocation();
+
+	return true;
+}
+
+void FTextWidget::MoveTextGeometriesToWidgetLocation()
+{
+	const FVector2D<float> Offset(SDLRect->x - TextGeometriesLocation.X, SDLRect->y - TextGeometriesLocation.Y);
+	if (Offset.X == 0.f && Offset.Y == 0.f)
+	{
+		return;
+	}
+
+	for (FSpriteBatchGeometry& Geometry : TextGeometries)
+	{
+		for (SDL_Vertex& Vertex : Geometry.Vertices)
 		{
-			RenderedTextSize = TextSize;
+			Vertex.position.x += Offset.X;
+			Vertex.position.y += Offset.Y;
+		}
+	}
+
+	TextGeometriesLocation = FVector2D<float>(SDLRect->x, SDLRect->y);
+}
+
+void FTextWidget::RedrawTextTexture()
+{
+	SDL_Surface* SdlSurface = nullptr;
+	TTF_Font* Font = FontAsset->GetFont(TextSize)->GetFont();
+	if (Font != nullptr)
+	{
+		RenderedTextSize = TextSize;
 
 #if defined(ENGINE_USING_VIDEO) && ENGINE_USING_VIDEO
-			switch (DesiredTextRenderMode)
+		switch (DesiredTextRenderMode)
+		{
+			case ETextRenderMode::Solid:
 			{
-				case ETextRenderMode::Solid:
-				{
-					SdlSurface = TTF_RenderText_Solid(Font, RenderedText.c_str(), 0, TextRenderColor);
+				SdlSurface = TTF_RenderText_Solid(Font, RenderedText.c_str(), 0, TextRenderColor);
 
-					break;
-				}
-				case ETextRenderMode::Blended:
-				{
-					SdlSurface = TTF_RenderText_Blended(Font, RenderedText.c_str(), 0, TextRenderColor);
+				break;
+			}
+			case ETextRenderMode::Blended:
+			{
+				SdlSurface = TTF_RenderText_Blended(Font, RenderedText.c_str(), 0, TextRenderColor);
 
-					break;
-				}
-				case ETextRenderMode::Shaded:
-				{
-					SdlSurface = TTF_RenderText_Shaded(Font, RenderedText.c_str(), 0, TextRenderColor, TextBackgroundRenderColor);
+				break;
+			}
+			case ETextRenderMode::Shaded:
+			{
+				SdlSurface = TTF_RenderText_Shaded(Font, RenderedText.c_str(), 0, TextRenderColor, TextBackgroundRenderColor);
 
-					break;
-				}
-				default: ;
+				break;
 			}
+			default: ;
+		}
 #endif
 
-			CurrentTextRenderMode = DesiredTextRenderMode;
-		}
+		CurrentTextRenderMode = DesiredTextRenderMode;
+	}
 
-		if (SdlSurface != nullptr)
-		{
-			SDL_LockSurface(SdlSurface); // Lock surface for safe pixel access
+	if (SdlSurface != nullptr)
+	{
+		bIsUsingGlyphs = false;
+
+		SDL_LockSurface(SdlSurface); // Lock surface for safe pixel access
 
-			FVector2D<int32> WidgetSize = GetWidgetSize();
+		FVector2D<int32> WidgetSize = GetWidgetSize();
+
+		{
+			// Render thread may be using renderer
+			FScopedRenderResourcesLock RenderResourcesLock;
 
 			// If we have texture and X or Y size has changed and we need texture of different size
 			if (TextTexture == nullptr || (WidgetSize.X != LastTextTextureSize.X || WidgetSize.Y != LastTextTextureSize.Y))
 			{
-				// Destroy old texture
-				SDL_DestroyTexture(TextTexture);
+				// Destroy old texture, it may be still used by recorded frame
+				FRenderer::DestroyTextureDeferred(TextTexture);
 
 				// Create new texture
 				TextTexture = SDL_CreateTextureFromSurface(GetRenderer()->GetSDLRenderer(), SdlSurface);
@@ -332,24 +456,25 @@ void FTextWidget::RedrawText()
 					LOG_ERROR("SDL_UpdateTexture error: " << SDL_GetError());
 				}
 			}
+		}
 
-			SDL_UnlockSurface(SdlSurface);
-			SDL_DestroySurface(SdlSurface);
+		SDL_UnlockSurface(SdlSurface);
+		SDL_DestroySurface(SdlSurface);
 
-			// Update widget size	
-			AutoAdjustSizeToText(GetClippingMethod() == EClipping::Cut);
-		}
+		// Update widget size	
+		AutoAdjustSizeToText(GetClippingMethod() == EClipping::Cut);
 	}
-	else
-	{
-		if (FontAsset == nullptr)
-		{
-			LOG_ERROR("FontAsset for Text widget is null");
-		}
+}
 
-		if (DesiredText.empty())
-		{
-			LOG_ERROR("Desired text is empty, if you intend to hide widget, use SetVisibility.");
-		}
+FGlyphCache* FTextWidget::GetGlyphCache() const
+{
+	// Solid text is not antialiased, so it's still rendered as whole
+	const bool bCanUseGlyphs = (DesiredTextRenderMode == ETextRenderMode::Blended || DesiredTextRenderMode == ETextRenderMode::Shaded);
+
+	if (FontAsset == nullptr || !bCanUseGlyphs)
+	{
+		return nullptr;
 	}
+
+	return FontAsset->GetFont(TextSize)->GetGlyphCache(GetRenderer()->GetSDLRenderer());
 }
@@ -4,6 +4,8 @@
 #include "Renderer/Widgets/Widget.h"
 
 #include "Renderer/Widgets/WidgetInputManager.h"
+#include "Renderer/Widgets/WidgetManager.h"
+#include "Renderer/Widgets/WidgetRenderCache.h"
 
 FWidget::FWidget(IWidgetManagementInterface* InWidgetManagementInterface, std::string InWidgetName, const int InWidgetOrder)
 	: IWidgetPositionInterface(InWidgetManagementInterface)
@@ -16,6 +18,7 @@ FWidget::FWidget(IWidgetManagementInterface* InWidgetManagementInterface, std::s
 	, WidgetManagementInterface(InWidgetManagementInterface)
 	, bIsPendingDelete(false)
 	, WidgetInputManager(nullptr)
+	, RenderCache(nullptr)
 #if WITH_WIDGET_DEBUGGER
 	, bIsWidgetBeingDebugged(false)
 #endif
@@ -32,6 +35,8 @@ FWidget::FWidget(IWidgetManagementInterface* InWidgetManagementInterface, std::s
 
 FWidget::~FWidget()
 {
+	delete RenderCache;
+
 #if ENGINE_MEMORY_ALLOCATION_DEBUG_WIDGETS
 	LOG_INFO("Widget destroyed: '" << WidgetName);
 #endif
@@ -49,9 +54,12 @@ void FWidget::ReceiveRender()
 	bWasRenderedThisFrame = ShouldBeRendered();
 	if (bWasRenderedThisFrame)
 	{
-		Render();
+		if (RenderCache == nullptr || !RenderWithCache())
+		{
+			Render();
 
-		RenderWidgets();
+			RenderWidgets();
+		}
 	}
 
 #if WITH_WIDGET_DEBUGGER
@@ -60,6 +68,14 @@ void FWidget::ReceiveRender()
 		FRenderer* Renderer = GetRenderer();
 		Renderer->DrawRectangleOutline(GetWidgetLocation(), GetWidgetSize(), FColorRGBA::ColorRed(), false);
 	}
+	else if (bWasRenderedThisFrame && RenderCache != nullptr && GetWindow()->GetWidgetManager()->IsRenderCacheOverlayEnabled())
+	{
+		// Green when texture was reused, orange when subtree was drawn again
+		const FColorRGBA OverlayColor = RenderCache->WasLastDrawRedrawn() ? FColorRGBA::ColorOrange() : FColorRGBA::ColorGreen();
+
+		FRenderer* Renderer = GetRenderer();
+		Renderer->DrawRectangleOutline(GetWidgetLocation(), GetWidgetSize(), OverlayColor, false);
+	}
 #endif
 }
 
@@ -73,14 +89,21 @@ void FWidget::Init()
 
 	bWasInitCalled = true;
 
-	FEventHandler* EventHandler = FGlobalDefines::GEngine->GetEventHandler();
-	SetupInput(EventHandler);
+	// Engine may not exist when widgets are only laid out, for example in tests
+	if (FGlobalDefines::GEngine != nullptr)
+	{
+		FEventHandler* EventHandler = FGlobalDefines::GEngine->GetEventHandler();
+		SetupInput(EventHandler);
+	}
 }
 
 void FWidget::PreDeInit()
 {
-	FEventHandler* EventHandler = FGlobalDefines::GEngine->GetEventHandler();
-	ClearInput(EventHandler);
+	if (FGlobalDefines::GEngine != nullptr)
+	{
+		FEventHandler* EventHandler = FGlobalDefines::GEngine->GetEventHandler();
+		ClearInput(EventHandler);
+	}
 
 	// Unregister widget
 	if (WidgetManagementInterface != nullptr)
@@ -114,10 +137,14 @@ void FWidget::ClearInput(FEventHandler* EventHandler)
 void FWidget::OnWidgetOrderChanged()
 {
 	WidgetManagementInterface->ChangeWidgetOrder(this);
+
+	InvalidateRenderCache();
 }
 
 void FWidget::OnWidgetVisibilityChanged()
 {
+	InvalidateRenderCache();
+
 	if (WidgetVisibility == EWidgetVisibility::Hidden)
 	{
 		OnVisibilityChangedToHidden();
@@ -131,6 +158,27 @@ void FWidget::OnChildSizeChanged()
 	UpdateSizeToFitChildren();
 }
 
+void FWidget::UpdateWidgetLocation()
+{
+	IWidgetPositionInterface::UpdateWidgetLocation();
+
+	InvalidateRenderCache();
+}
+
+void FWidget::UpdateWidgetSize(const bool bWasSentFromRebuild)
+{
+	IWidgetPositionInterface::UpdateWidgetSize(bWasSentFromRebuild);
+
+	InvalidateRenderCache();
+}
+
+void FWidget::OnClippingMethodChanged(const EClipping NewClippingMethod)
+{
+	IWidgetPositionInterface::OnClippingMethodChanged(NewClippingMethod);
+
+	InvalidateRenderCache();
+}
+
 void FWidget::OnMouseMove(FVector2D<int> InMousePosition, EInputState InputState)
 {
 }
@@ -204,7 +252,10 @@ void FWidget::DestroyWidget()
 
 		ClearChildren();
 
-		FGlobalDefines::GEngine->GetFunctionsToCallOnStartOfNextTick().BindObject(this, &FWidget::FinalizeDestroyWidget);
+		FGlobalDefines::GEngine->AddLambdaToCallOnStartOfNextTick([this]()
+		{
+			FinalizeDestroyWidget();
+		});
 	}
 }
 
@@ -247,6 +298,9 @@ void FWidget::SetWidgetVisibility(const EWidgetVisibility InWidgetVisibility)
 		OnWidgetVisibilityChanged();
 
 		RequestWidgetRebuild();
+
+		// Size of this widget does not change, but parent aligns only visible children
+		WidgetManagementInterface->RequestWidgetRebuild();
 	}
 }
 
@@ -267,6 +321,59 @@ void FWidget::SetShouldChangeSizeOnChildChange(const bool bInShouldChangeSizeOnC
 	bShouldChangeSizeToFitChildren = bInShouldChangeSizeOnChildChange;
 }
 
+void FWidget::SetRenderCacheEnabled(const bool bInIsRenderCacheEnabled)
+{
+	if (bInIsRenderCacheEnabled && RenderCache == nullptr)
+	{
+		RenderCache = new FWidgetRenderCache();
+	}
+	else if (!bInIsRenderCacheEnabled && RenderCache != nullptr)
+	{
+		delete RenderCache;
+		RenderCache = nullptr;
+	}
+
+	// Cached parents contain this widget drawn with or without cache, both look the same but it's cheap to be sure
+	InvalidateRenderCache();
+}
+
+void FWidget::InvalidateRenderCache()
+{
+	// Each cached widget up to root contains pixels of this widget
+	FWidget* CurrentWidget = this;
+	for (int32 Depth = 0; Depth < WIDGET_MAX_DEPTH && CurrentWidget != nullptr; Depth++)
+	{
+		if (CurrentWidget->RenderCache != nullptr)
+		{
+			CurrentWidget->RenderCache->MarkDirty();
+		}
+
+		CurrentWidget = dynamic_cast<FWidget*>(CurrentWidget->WidgetManagementInterface);
+	}
+}
+
+void FWidget::OnRenderTargetsReset()
+{
+	// Texture is still valid, only its pixels are lost
+	if (RenderCache != nullptr)
+	{
+		RenderCache->MarkDirty();
+	}
+
+	for (FWidget* ManagedWidget : ManagedWidgets)
+	{
+		ManagedWidget->OnRenderTargetsReset();
+	}
+}
+
+void FWidget::RequestWidgetRebuild()
+{
+	// Rebuild changes layout or look, for example text is drawn again
+	InvalidateRenderCache();
+
+	IWidgetPositionInterface::RequestWidgetRebuild();
+}
+
 FVector2D<int> FWidget::GetWidgetManagerOffset() const
 {
 	return GetWidgetLocation(EWidgetOrientation::Absolute);
@@ -290,6 +397,12 @@ FWindow* FWidget::GetOwnerWindow() const
 
 void FWidget::OnWindowChanged()
 {
+	// Texture belongs to renderer of previous window
+	if (RenderCache != nullptr)
+	{
+		RenderCache->Release();
+	}
+
 	for (FWidget* ManagedWidget : ManagedWidgets)
 	{
 		ManagedWidget->OnWindowChanged();
@@ -461,6 +574,36 @@ void FWidget::SetIsWidgetBeingDebugged(const bool bNewValue)
 }
 #endif
 
+bool FWidget::RenderWithCache()
+{
+	FRenderer* Renderer = GetRenderer();
+
+	// Sprites queued before must be drawn before render target changes
+	Renderer->FlushSpriteBatch();
+
+	if (RenderCache->IsDirty())
+	{
+		if (!RenderCache->BeginRedraw(Renderer->GetSDLRenderer(), GetWidgetLocation(), GetWidgetSize()))
+		{
+			return false;
+		}
+
+		Render();
+
+		RenderWidgets();
+
+		Renderer->FlushSpriteBatch();
+
+		RenderCache->EndRedraw();
+	}
+
+	RenderCache->Draw();
+
+	GetWindow()->GetWidgetManager()->AddRenderCacheDraw(RenderCache->WasLastDrawRedrawn());
+
+	return true;
+}
+
 void FWidget::OnVisibilityChangedToHidden()
 {
 	bWasRenderedThisFrame = false;
@@ -7,6 +7,7 @@
 #include "Renderer/Widgets/Samples/ButtonWidget.h"
 #include "Renderer/Widgets/Samples/TextWidget.h"
 #include "Renderer/Widgets/Samples/VerticalBoxWidget.h"
+#include "Renderer/Widgets/WidgetRenderCache.h"
 
 FWidgetDebugger::FWidgetDebugger(FWindow* InWindow)
 	: Window(InWindow)
@@ -59,6 +60,15 @@ void FWidgetDebugger::RefreshDisplayedWidgets()
 		VerticalBox->SetVerticalBoxAlignMethod(EVerticalBoxAlignMethod::AlignToLeft);
 		VerticalBox->SetWidgetSizePercent({ 1, 1 }, EWidgetSizeType::ParentPercentage);
 
+		FButtonWidget* RenderCacheOverlayButton = VerticalBox->CreateWidget<FButtonWidget>("Button_RenderCacheOverlay");
+		RenderCacheOverlayButton->CreateWidget<FTextWidget>()->SET_TEXT_ADV("Render cache overlay: " << (WindowWidgetManager->IsRenderCacheOverlayEnabled() ? "On" : "Off"));
+		RenderCacheOverlayButton->OnLeftClickRelease.BindLambda([&, WindowWidgetManager]()
+		{
+			WindowWidgetManager->SetRenderCacheOverlayEnabled(!WindowWidgetManager->IsRenderCacheOverlayEnabled());
+
+			RefreshDisplayedWidgets();
+		});
+
 		CArray<FWidget*> Widgets = WindowWidgetManager->GetManagedWidgets();
 
 		CreateDebuggersForWidgets(VerticalBox, Widgets, 0);
@@ -91,6 +101,11 @@ void FWidgetDebugger::CreateDebuggersForWidgets(FVerticalBoxWidget* InVerticalBo
 		FinalWidgetName += " - ";
 		FinalWidgetName += WidgetName;
 
+		if (Widget->IsRenderCacheEnabled())
+		{
+			FinalWidgetName += " [Cached]";
+		}
+
 		FButtonWidget* Button = InVerticalBox->CreateWidget<FButtonWidget>();
 		Button->OnLeftClickRelease.BindLambda([&, Widget]()
 		{
@@ -130,6 +145,36 @@ void FWidgetDebugger::CreateSingleDebuggerForWidget(FWidget* Widget)
 		VerticalBox->CreateWidget<FTextWidget>()->SET_TEXT_ADV("Children count: " << Widget->GetChildrenCount());
 		VerticalBox->CreateWidget<FTextWidget>()->SET_TEXT_ADV("NeedsWidgetRebuild: " << Widget->NeedsWidgetRebuild());
 
+		if (const FWidgetRenderCache* RenderCache = Widget->GetRenderCache())
+		{
+			VerticalBox->CreateWidget<FTextWidget>()->SET_TEXT_ADV("Render cache hits: " << RenderCache->GetNumberOfHits());
+			VerticalBox->CreateWidget<FTextWidget>()->SET_TEXT_ADV("Render cache redraws: " << RenderCache->GetNumberOfRedraws());
+		}
+
+		FWidgetManager* WindowWidgetManager = Window->GetWidgetManager();
+		VerticalBox->CreateWidget<FTextWidget>()->SET_TEXT_ADV("Window render cache hits: " << WindowWidgetManager->GetLastNumberOfRenderCacheHits()
+			<< ", redraws: " << WindowWidgetManager->GetLastNumberOfRenderCacheRedraws());
+
+		const FWidgetLayoutStats& LayoutStats = WindowWidgetManager->GetLastLayoutStats();
+		VerticalBox->CreateWidget<FTextWidget>()->SET_TEXT_ADV("Window layout passes: " << LayoutStats.NumberOfLayoutPasses
+			<< ", measured: " << LayoutStats.NumberOfMeasuredWidgets << ", arranged: " << LayoutStats.NumberOfArrangedWidgets);
+
+		FButtonWidget* ButtonRenderCache = VerticalBox->CreateWidget<FButtonWidget>("Button_RenderCache");
+		ButtonRenderCache->CreateWidget<FTextWidget>()->SetText(Widget->IsRenderCacheEnabled() ? "Disable render cache" : "Enable render cache");
+		ButtonRenderCache->OnLeftClickRelease.BindLambda([&, Widget]()
+		{
+			Widget->SetRenderCacheEnabled(!Widget->IsRenderCacheEnabled());
+
+			CreateSingleDebuggerForWidget(Widget);
+		});
+
+		FButtonWidget* ButtonRefresh = VerticalBox->CreateWidget<FButtonWidget>("Button_Refresh");
+		ButtonRefresh->CreateWidget<FTextWidget>()->SetText("Refresh");
+		ButtonRefresh->OnLeftClickRelease.BindLambda([&, Widget]()
+		{
+			CreateSingleDebuggerForWidget(Widget);
+		});
+
 		FButtonWidget* Button = VerticalBox->CreateWidget<FButtonWidget>("Button_Rebuild");
 		Button->CreateWidget<FTextWidget>()->SetText("Rebuild");
 		Button->OnLeftClickRelease.BindLambda([&, Widget]()
@@ -6,6 +6,9 @@
 
 FWidgetManager::FWidgetManager(FWindow* InOwnerWindow)
 	: OwnerWindow(InOwnerWindow)
+	, NumberOfRenderCacheHits(0)
+	, NumberOfRenderCacheRedraws(0)
+	, bIsRenderCacheOverlayEnabled(false)
 {
 }
 
@@ -24,20 +27,25 @@ void FWidgetManager::DeInit()
 
 void FWidgetManager::ReceiveTick()
 {
-	for (FWidget* ManagedWidget : ManagedWidgets)
-	{
-		if (ManagedWidget->NeedsWidgetRebuild())
-		{
-			FWidgetGeometry WidgetGeometry;
-			ManagedWidget->GenerateWidgetGeometry(WidgetGeometry);
+	LastLayoutStats = LayoutStats;
+	LayoutStats = FWidgetLayoutStats();
 
-			ManagedWidget->RebuildWidget();
-		}
-	}
+	UpdateWidgetsLayout(LayoutStats);
 
 	TickWidgets();
 }
 
+void FWidgetManager::RenderWidgets()
+{
+	NumberOfRenderCacheHits = 0;
+	NumberOfRenderCacheRedraws = 0;
+
+	// Changes made by tick and input are laid out before they are drawn, not in next frame
+	UpdateWidgetsLayout(LayoutStats);
+
+	IWidgetManagementInterface::RenderWidgets();
+}
+
 FVector2D<int> FWidgetManager::GetWidgetManagerOffset() const
 {
 	return 0;
@@ -83,3 +91,23 @@ void FWidgetManager::OnWindowSizeChanged()
 		Widget->RequestWidgetRebuild();
 	}
 }
+
+void FWidgetManager::OnRenderTargetsReset()
+{
+	for (FWidget* Widget : ManagedWidgets)
+	{
+		Widget->OnRenderTargetsReset();
+	}
+}
+
+void FWidgetManager::AddRenderCacheDraw(const bool bWasRedrawn)
+{
+	if (bWasRedrawn)
+	{
+		NumberOfRenderCacheRedraws++;
+	}
+	else
+	{
+		NumberOfRenderCacheHits++;
+	}
+}
@@ -0,0 +1,140 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#include "CoreEngine.h"
+#include "Renderer/Widgets/WidgetRenderCache.h"
+
+#include "Renderer/Renderer.h"
+
+FWidgetRenderCache::FWidgetRenderCache()
+	: Renderer(nullptr)
+	, Texture(nullptr)
+	, RestoreState(std::make_shared<FRenderTargetRestoreState>())
+	, bIsDirty(true)
+	, bIsRedrawn(false)
+	, bIsRenderTargetSupported(true)
+	, bWasLastDrawRedrawn(false)
+	, NumberOfHits(0)
+	, NumberOfRedraws(0)
+{
+}
+
+FWidgetRenderCache::~FWidgetRenderCache()
+{
+	Release();
+}
+
+bool FWidgetRenderCache::BeginRedraw(SDL_Renderer* InRenderer, const FVector2D<int32>& InLocation, const FVector2D<int32>& InSize)
+{
+	if (!bIsRenderTargetSupported || InRenderer == nullptr || InSize.X <= 0 || InSize.Y <= 0)
+	{
+		return false;
+	}
+
+	if (Texture != nullptr && (Renderer != InRenderer || TextureSize != InSize))
+	{
+		Release();
+	}
+
+	if (Texture == nullptr)
+	{
+		{
+			// Render thread may be using renderer
+			FScopedRenderResourcesLock RenderResourcesLock;
+
+			Texture = SDL_CreateTexture(InRenderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, InSize.X, InSize.Y);
+			if (Texture != nullptr)
+			{
+				// Subtree is blended over transparent texture, so color is already multiplied by alpha
+				SDL_SetTextureBlendMode(Texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+			}
+		}
+
+		if (Texture == nullptr)
+		{
+			LOG_WARN("Can not create widget render cache texture, widgets will be drawn directly. (" << SDL_GetError() << ")");
+
+			bIsRenderTargetSupported = false;
+
+			return false;
+		}
+
+		Renderer = InRenderer;
+		TextureSize = InSize;
+	}
+
+	Location = InLocation;
+	Size = InSize;
+
+	// Cleared before subtree is drawn, so changes made while drawing are drawn in next frame
+	bIsDirty = false;
+	bIsRedrawn = true;
+
+	NumberOfRedraws++;
+
+	FRenderer::ExecuteOrEnqueue([SDLRenderer = Renderer, CacheTexture = Texture, RestoreState = RestoreState, Location = Location, Size = Size]()
+	{
+		RestoreState->PreviousRenderTarget = SDL_GetRenderTarget(SDLRenderer);
+
+		Uint8 R, G, B, A;
+		SDL_GetRenderDrawColor(SDLRenderer, &R, &G, &B, &A);
+
+		// Viewport is kept by texture, moving it by location keeps absolute locations of widgets inside of texture
+		SDL_SetRenderTarget(SDLRenderer, CacheTexture);
+
+		const SDL_Rect Viewport = { -Location.X, -Location.Y, Location.X + Size.X, Location.Y + Size.Y };
+		SDL_SetRenderViewport(SDLRenderer, &Viewport);
+
+		SDL_SetRenderDrawColor(SDLRenderer, 0, 0, 0, 0);
+		SDL_RenderClear(SDLRenderer);
+
+		SDL_SetRenderDrawColor(SDLRenderer, R, G, B, A);
+	});
+
+	return true;
+}
+
+void FWidgetRenderCache::EndRedraw()
+{
+	FRenderer::ExecuteOrEnqueue([SDLRenderer = Renderer, RestoreState = RestoreState]()
+	{
+		SDL_SetRenderTarget(SDLRenderer, RestoreState->PreviousRenderTarget);
+	});
+}
+
+void FWidgetRenderCache::Draw()
+{
+	if (Texture == nullptr)
+	{
+		return;
+	}
+
+	bWasLastDrawRedrawn = bIsRedrawn;
+	bIsRedrawn = false;
+
+	if (!bWasLastDrawRedrawn)
+	{
+		NumberOfHits++;
+	}
+
+	const SDL_FRect Destination = { static_cast<float>(Location.X), static_cast<float>(Location.Y), static_cast<float>(Size.X), static_cast<float>(Size.Y) };
+
+	FRenderer::ExecuteOrEnqueue([SDLRenderer = Renderer, CacheTexture = Texture, Destination]()
+	{
+		SDL_RenderTexture(SDLRenderer, CacheTexture, nullptr, &Destination);
+	});
+}
+
+void FWidgetRenderCache::Release()
+{
+	if (Texture != nullptr)
+	{
+		FRenderer::DestroyTextureDeferred(Texture);
+
+		Texture = nullptr;
+	}
+
+	Renderer = nullptr;
+	TextureSize = FVector2D<int32>();
+
+	bIsDirty = true;
+}
@@ -5,7 +5,9 @@
 
 IWidgetManagementInterface::IWidgetManagementInterface()
 	: LastWidgetNumber(0)
-	, bIsWidgetRequestingRebuild(false)
+	, bIsLayoutMeasureDirty(false)
+	, bIsLayoutArrangeDirty(false)
+	, bHasChildWithDirtyLayout(false)
 {
 	OnAnyChildChangedDelegate.BindObject(this, &IWidgetManagementInterface::OnAnyChildChanged);
 }
@@ -62,34 +64,41 @@ void IWidgetManagementInterface::RenderWidgets()
 
 void IWidgetManagementInterface::RequestWidgetRebuild()
 {
-	if (!bIsWidgetRequestingRebuild)
-	{
-		// Parent is required as otherwise we will not be able to ever rebuild
-		IWidgetManagementInterface* Parent = GetParent();
-		if (Parent != nullptr)
-		{
-			bIsWidgetRequestingRebuild = true;
+	bIsLayoutMeasureDirty = true;
 
-			if (!Parent->NeedsWidgetRebuild())
-			{
-				Parent->RequestWidgetRebuild();
-			}
+	RequestWidgetArrange();
+}
 
-			// Propagate to children
-			for (FWidget* ManagedWidget : ManagedWidgets)
-			{
-				if (!ManagedWidget->NeedsWidgetRebuild())
-				{
-					ManagedWidget->RequestWidgetRebuild();
-				}
-			}
-		}
+void IWidgetManagementInterface::RequestWidgetArrange()
+{
+	bIsLayoutArrangeDirty = true;
+
+	// Parents which already know about dirty child have parents knowing it as well
+	IWidgetManagementInterface* Parent = GetParent();
+	for (int32 Depth = 0; Depth < WIDGET_MAX_DEPTH && Parent != nullptr && !Parent->bHasChildWithDirtyLayout; Depth++)
+	{
+		Parent->bHasChildWithDirtyLayout = true;
+
+		Parent = Parent->GetParent();
 	}
 }
 
 void IWidgetManagementInterface::MarkAsWidgetRebuild()
 {
-	bIsWidgetRequestingRebuild = false;
+	bIsLayoutMeasureDirty = false;
+	bIsLayoutArrangeDirty = false;
+}
+
+void IWidgetManagementInterface::UpdateWidgetsLayout(FWidgetLayoutStats& InOutStats)
+{
+	for (int32 Pass = 0; Pass < MaxLayoutPasses && bHasChildWithDirtyLayout; Pass++)
+	{
+		InOutStats.NumberOfLayoutPasses++;
+
+		UpdateChildrenLayout(InOutStats);
+	}
+
+	MarkAsWidgetRebuild();
 }
 
 void IWidgetManagementInterface::GenerateWidgetGeometry(FWidgetGeometry& InWidgetGeometry)
@@ -98,7 +107,29 @@ void IWidgetManagementInterface::GenerateWidgetGeometry(FWidgetGeometry& InWidge
 
 void IWidgetManagementInterface::RebuildWidget()
 {
-	MarkAsWidgetRebuild();
+}
+
+bool IWidgetManagementInterface::UpdateChildrenLayout(FWidgetLayoutStats& InOutStats)
+{
+	bool bIsAnyChildGeometryChanged = false;
+
+	if (bHasChildWithDirtyLayout)
+	{
+		// Cleared first, children requesting layout again while being laid out set it again
+		bHasChildWithDirtyLayout = false;
+
+		for (ContainerInt i = 0; i < ManagedWidgets.Size(); i++)
+		{
+			FWidget* ManagedWidget = ManagedWidgets[i];
+
+			if (ManagedWidget->NeedsWidgetRebuild() && ManagedWidget->UpdateWidgetLayout(InOutStats))
+			{
+				bIsAnyChildGeometryChanged = true;
+			}
+		}
+	}
+
+	return bIsAnyChildGeometryChanged;
 }
 
 bool IWidgetManagementInterface::AddChild(FWidget* InWidget)
@@ -11,13 +11,17 @@ IWidgetPositionInterface::IWidgetPositionInterface(IWidgetManagementInterface* I
 	, CurrentAnchor(EAnchor::None)
 	, ClippingMethodInterface(EClipping::Cut)
 	, bShouldChangeSizeToFitChildren(true)
+	, LastLayoutGeometrySize(INDEX_NONE, INDEX_NONE)
+	, LastLayoutWidgetSize(INDEX_NONE, INDEX_NONE)
+	, LastArrangeLocation(INDEX_NONE, INDEX_NONE)
+	, ChildrenAnchorLocation(INDEX_NONE, INDEX_NONE)
+	, ChildrenAnchorSize(INDEX_NONE, INDEX_NONE)
+	, bIsUpdatingLayout(false)
 {
 }
 
 void IWidgetPositionInterface::GenerateWidgetGeometry(FWidgetGeometry& InWidgetGeometry)
 {
-	GenerateChildWidgetGeometry();
-
 	const FWidgetMargin& CurrentPadding = GetWidgetMargin();
 	InWidgetGeometry.Size = GetWidgetSize() + CurrentPadding.Get();
 
@@ -45,11 +49,84 @@ void IWidgetPositionInterface::RebuildWidget()
 	UpdateWidgetLocation();
 	UpdateAnchor(true);
 
-	GenerateChildWidgetGeometry();
-
 	IWidgetManagementInterface::RebuildWidget();
 }
 
+bool IWidgetPositionInterface::UpdateWidgetLayout(FWidgetLayoutStats& InOutStats)
+{
+	// Measure children first, geometry of this widget is made of their geometry
+	const bool bIsAnyChildGeometryChanged = UpdateChildrenLayout(InOutStats);
+	const bool bIsMeasureNeeded = (bIsAnyChildGeometryChanged || IsLayoutMeasureDirty());
+	const bool bIsArrangeNeeded = (bIsMeasureNeeded || IsLayoutArrangeDirty());
+
+	// Cleared before arrange, so layout requested by arrange is done in next pass
+	MarkAsWidgetRebuild();
+
+	if (bIsMeasureNeeded)
+	{
+		GenerateChildWidgetGeometry();
+
+		InOutStats.NumberOfMeasuredWidgets++;
+	}
+
+	if (bIsArrangeNeeded)
+	{
+		ArrangeWidget(InOutStats);
+	}
+
+	const FVector2D<int32>& CurrentWidgetSize = GetWidgetSize();
+	if (CurrentWidgetSize != LastLayoutWidgetSize)
+	{
+		LastLayoutWidgetSize = CurrentWidgetSize;
+
+		// Anchored children are moved by arrange, only children sized by this widget need layout
+		for (FWidget* ManagedWidget : ManagedWidgets)
+		{
+			if (ManagedWidget->IsLayoutDependentOnParentSize())
+			{
+				// Rebuild does not update size in percent
+				ManagedWidget->UpdateSizeInPercent(false);
+				ManagedWidget->RequestWidgetRebuild();
+			}
+		}
+	}
+
+	FWidgetGeometry CurrentGeometry;
+	GenerateWidgetGeometry(CurrentGeometry);
+
+	const bool bIsGeometryChanged = (CurrentGeometry.Size != LastLayoutGeometrySize);
+	LastLayoutGeometrySize = CurrentGeometry.Size;
+
+	return bIsGeometryChanged;
+}
+
+void IWidgetPositionInterface::ArrangeWidget(FWidgetLayoutStats& InOutStats)
+{
+	bIsUpdatingLayout = true;
+
+	RebuildWidget();
+
+	bIsUpdatingLayout = false;
+
+	LastArrangeLocation = GetWidgetLocation(EWidgetOrientation::Absolute);
+
+	InOutStats.NumberOfArrangedWidgets++;
+
+	// Children moved by this widget are not dirty, but their children are placed relative to them
+	for (IWidgetPositionInterface* ChildWidget : ManagedWidgets)
+	{
+		if (ChildWidget->GetChildrenCount() > 0 && ChildWidget->GetWidgetLocation(EWidgetOrientation::Absolute) != ChildWidget->LastArrangeLocation)
+		{
+			ChildWidget->ArrangeWidget(InOutStats);
+		}
+	}
+}
+
+bool IWidgetPositionInterface::IsLayoutDependentOnParentSize() const
+{
+	return (WidgetSizeType == EWidgetSizeType::ParentPercentage);
+}
+
 bool IWidgetPositionInterface::IsLocationInsideWidget(const FVector2D<int32>& TestLocation) const
 {
 	const FVector2D<int32> WidgetLocation = GetWidgetLocation(EWidgetOrientation::Absolute);
@@ -108,9 +185,10 @@ void IWidgetPositionInterface::SetWidgetLocation(const FVector2D<int32> InWidget
 		SetAnchor(EAnchor::None);
 	}
 
-	if (!bWasSentFromRebuild)
+	// Location does not change size, parents do not need to measure again
+	if (!bWasSentFromRebuild && !bIsUpdatingLayout)
 	{
-		RequestWidgetRebuild();
+		RequestWidgetArrange();
 	}
 
 	UpdateWidgetLocation();
@@ -123,6 +201,8 @@ const FVector2D<int32>& IWidgetPositionInterface::GetWidgetSize() const
 
 void IWidgetPositionInterface::SetWidgetSize(const FVector2D<int32> InSizeInPixels, const bool bWasSentFromRebuild)
 {
+	const bool bIsSizeChanged = (WidgetSizeType != EWidgetSizeType::Pixels || WidgetSizeInPixelsInterface != InSizeInPixels);
+
 	WidgetSizeType = EWidgetSizeType::Pixels;
 	WidgetSizeInPixelsInterface = InSizeInPixels;
 
@@ -136,7 +216,8 @@ void IWidgetPositionInterface::SetWidgetSize(const FVector2D<int32> InSizeInPixe
 		GetParent()->OnChildSizeChanged();
 	}
 
-	if (!bWasSentFromRebuild)
+	// Layout which is arranging this widget compares geometry after arrange
+	if (!bWasSentFromRebuild && !bIsUpdatingLayout && bIsSizeChanged)
 	{
 		RequestWidgetRebuild();
 	}
@@ -392,6 +473,18 @@ void IWidgetPositionInterface::OnClippingMethodChanged(EClipping NewClippingMeth
 
 void IWidgetPositionInterface::UpdateAnchorForChildren(const bool bIsFromRebuild)
 {
+	const FVector2D<int32> CurrentLocation = GetWidgetLocation(EWidgetOrientation::Absolute);
+	const FVector2D<int32>& CurrentSize = GetWidgetSize();
+
+	// Children anchored in rebuild depend only on location and size of this widget
+	if (bIsFromRebuild && CurrentLocation == ChildrenAnchorLocation && CurrentSize == ChildrenAnchorSize)
+	{
+		return;
+	}
+
+	ChildrenAnchorLocation = CurrentLocation;
+	ChildrenAnchorSize = CurrentSize;
+
 	for (FWidget* Widget : ManagedWidgets)
 	{
 		Widget->UpdateAnchor(bIsFromRebuild);
@@ -463,39 +556,18 @@ void IWidgetPositionInterface::UpdateWidgetSizePixels(const bool bWasSentFromReb
 
 void IWidgetPositionInterface::GenerateChildWidgetGeometry()
 {
-	const bool bAnyChanged = RebuildChildren();
-	if (bAnyChanged)
-	{
-		ChildrenGeometry.Clear();
-
-		for (FWidget* ManagedWidget : ManagedWidgets)
-		{
-			FWidgetGeometry ChildWidgetGeometry;
-			ManagedWidget->GenerateWidgetGeometry(ChildWidgetGeometry);
-
-			ChildrenGeometry.Push(ChildWidgetGeometry);
-		}
-
-		DesiredWidgetGeometry = FWidgetGeometry();
-
-		// When we have children size we can create desired geometry
-		GenerateDesiredWidgetGeometry();
-	}
-}
-
-bool IWidgetPositionInterface::RebuildChildren()
-{
-	bool bAnyChildChanged = false;
+	ChildrenGeometry.Clear();
 
 	for (FWidget* ManagedWidget : ManagedWidgets)
 	{
-		if (ManagedWidget->NeedsWidgetRebuild())
-		{
-			ManagedWidget->RebuildWidget();
+		FWidgetGeometry ChildWidgetGeometry;
+		ManagedWidget->GenerateWidgetGeometry(ChildWidgetGeometry);
 
-			bAnyChildChanged = true;
-		}
+		ChildrenGeometry.Push(ChildWidgetGeometry);
 	}
 
-	return bAnyChildChanged;
+	DesiredWidgetGeometry = FWidgetGeometry();
+
+	// When we have children size we can create desired geometry
+	GenerateDesiredWidgetGeometry();
 }
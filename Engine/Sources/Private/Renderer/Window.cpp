@@ -235,6 +235,13 @@ void FWindow::OnWindowSizeChanged(const Sint32 X, const Sint32 Y)
 	SetWindowSize(X, Y, false);
 }
 
+void FWindow::OnRenderTargetsReset()
+{
+	WidgetManager->OnRenderTargetsReset();
+
+	OnRenderTargetsResetDelegate.Execute();
+}
+
 void FWindow::SetWindowFocus(const bool bInNewFocus)
 {
 	bIsWindowFocused = bInNewFocus;
@@ -26,7 +26,7 @@ public:
 	/** Get texture */
 	FTexture* GetTexture() const;
 
-	/** Call to create texture in SDL. Requires SDL_Renderer. */
+	/** Call to create texture in SDL. Requires SDL_Renderer. Small textures are packed into atlas of renderer. */
 	void PrepareTexture(SDL_Renderer* InRenderer);
 
 	bool IsTexturePrepared() const;
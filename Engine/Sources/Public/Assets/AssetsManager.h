@@ -13,6 +13,7 @@ enum class EAssetType : Uint8;
 class FAssetBase;
 class FFontAsset;
 class FFont;
+class FTextureAtlas;
 
 struct ENGINE_API FAssetsStructure
 {
@@ -184,6 +185,13 @@ public:
 
 	std::string ConvertRelativeToFullPath(const std::string& InPathRelative) const;
 
+	/** @returns atlas for small textures of renderer, created on first use. nullptr when atlas is disabled */
+	std::shared_ptr<FTextureAtlas> GetTextureAtlas(SDL_Renderer* InRenderer);
+
+	/** When disabled textures loaded after this call get own SDL texture */
+	void SetTextureAtlasEnabled(const bool bInIsTextureAtlasEnabled) { bIsTextureAtlasEnabled = bInIsTextureAtlasEnabled; }
+	NO_DISCARD bool IsTextureAtlasEnabled() const { return bIsTextureAtlasEnabled; }
+
 #if PLATFORM_ANDROID
 	const CArray<std::string>& GetAndroidManifestFiles() const { return AndroidManifestFilesRaw; }
 	const std::shared_ptr<FIterateDirectoryData> GetAndroidIterateDirectoryData() const { return AndroidIterateDirectoryData; }
@@ -193,6 +201,11 @@ private:
 	/** All types of assets sorted by type */
 	CMap<EAssetType, FAssetsStructure> AssetsByType;
 
+	/** Atlas of each renderer, textures keep atlas alive as long as they use it */
+	CMap<SDL_Renderer*, std::shared_ptr<FTextureAtlas>> TextureAtlases;
+
+	bool bIsTextureAtlasEnabled;
+
 	/** IniManager which can load, create, save and edit ini files. */
 	FIniManager* IniManager;
 
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 
+class FGlyphCache;
+
 /**
  * For loading storing and using font.
  */
@@ -19,6 +21,9 @@ public:
 	void Reinitialize();
 
 	NO_DISCARD std::string GetFontAssetName() const;
+
+	/** @returns cache of glyphs for renderer, created on first use. nullptr when font is not loaded */
+	NO_DISCARD FGlyphCache* GetGlyphCache(SDL_Renderer* InRenderer);
 	
 protected:
 	virtual void InitializeFont();
@@ -28,5 +33,8 @@ protected:
 	
 	FFontAsset* FontAsset;
 	int FontSize;
+
+	/** Glyph atlas of each renderer using this font */
+	CMap<SDL_Renderer*, FGlyphCache*> GlyphCaches;
 	
 };
@@ -0,0 +1,92 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Assets/TypesForAssets/TextureAtlas.h"
+
+struct FSpriteBatchGeometry;
+
+/** Cached image and metrics of single glyph */
+struct FGlyph
+{
+	FGlyph()
+		: OffsetX(0)
+		, Advance(0)
+		, bHasImage(false)
+		, bIsCacheFailed(false)
+	{
+	}
+
+	/** Place of glyph image in atlas, image is full line high */
+	FTextureAtlasRegion Region;
+
+	/** Image starts this far from pen location */
+	int32 OffsetX;
+
+	/** Pen moves by this after glyph */
+	int32 Advance;
+
+	/** False for glyphs without image */
+	bool bHasImage;
+
+	/** Glyph has image but there was no place for it in atlas */
+	bool bIsCacheFailed;
+};
+
+/**
+ * Glyphs of single font and size rasterized once into atlas pages.
+ * Text is laid out from cached metrics and kerning and drawn as quads, so changing text rasterizes only glyphs never seen before.
+ * Glyphs are white, color is given by vertices.
+ */
+class ENGINE_API FGlyphCache
+{
+public:
+	FGlyphCache(TTF_Font* InFont, SDL_Renderer* InRenderer);
+
+	/** @returns glyph, rasterized on first use */
+	const FGlyph& GetGlyph(const Uint32 InCodepoint);
+
+	/** @returns kerning between pair of glyphs, asked from font on first use */
+	int32 GetKerning(const Uint32 InPreviousCodepoint, const Uint32 InCodepoint);
+
+	/**
+	 * Measures UTF-8 text
+	 * @returns false if any glyph could not be cached, text should be rendered without cache then
+	 */
+	bool MeasureText(const std::string& InText, FVector2D<int32>& OutSize);
+
+	/**
+	 * Builds quads of UTF-8 text with top left corner at 0, one geometry for each atlas page used
+	 * @returns false if any glyph could not be cached, text should be rendered without cache then
+	 */
+	bool BuildTextGeometry(const std::string& InText, const FColorRGBA& InColor, CArray<FSpriteBatchGeometry>& OutGeometries, FVector2D<int32>& OutSize);
+
+	NO_DISCARD int32 GetLineHeight() const { return LineHeight; }
+
+	/** @returns number of glyphs rasterized so far, each is rasterized once */
+	NO_DISCARD int32 GetNumberOfRasterizedGlyphs() const { return NumberOfRasterizedGlyphs; }
+
+	/** Glyph pages are small, most fonts fit in single page */
+	static constexpr int32 GlyphPageSize = 512;
+
+protected:
+	/** Calls InFunction(Glyph, PenX) for each glyph of text, @returns false if any glyph is not cached */
+	template<typename TFunction>
+	bool ForEachGlyph(const std::string& InText, TFunction InFunction, int32& OutWidth);
+
+protected:
+	TTF_Font* Font;
+
+	FTextureAtlas TextureAtlas;
+
+	CUnorderedMap<Uint32, FGlyph> Glyphs;
+
+	/** Kerning of pair, previous codepoint in high bits */
+	CUnorderedMap<uint64, int32> Kernings;
+
+	int32 LineHeight;
+
+	int32 NumberOfRasterizedGlyphs;
+
+};
@@ -3,18 +3,39 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Assets/TypesForAssets/TextureAtlas.h"
 
 class FTexture
 {
 public:
-	FTexture(const std::string& InTexturePath, SDL_Renderer* Renderer);
+	/** Small textures are packed into atlas when it's given, others get own SDL texture */
+	FTexture(const std::string& InTexturePath, SDL_Renderer* Renderer, const std::shared_ptr<FTextureAtlas>& InTextureAtlas = nullptr);
 	~FTexture();
 
-	void Draw(SDL_Renderer* Renderer, SDL_FRect SourceRect, SDL_FRect DestinationRect) const;
+	/** Source rect is relative to this texture, it's moved to place of texture in atlas */
+	void Draw(SDL_Renderer* Renderer, SDL_FRect InSourceRect, SDL_FRect DestinationRect) const;
 
+	/** @returns SDL texture to draw with, when texture is in atlas it's page shared with other textures so GetSourceRect must be used */
 	SDL_Texture* GetSDLTexture() const;
 
+	/** @returns pixels of this texture in SDL texture */
+	const SDL_FRect& GetSourceRect() const { return SourceRect; }
+
+	/** @returns source rect in texture coordinates (0 - 1) of SDL texture */
+	const SDL_FRect& GetSourceUV() const { return SourceUV; }
+
+	FVector2D<float> GetSize() const { return FVector2D<float>(SourceRect.w, SourceRect.h); }
+
+	bool IsInAtlas() const { return TextureAtlas != nullptr; }
+
 protected:
 	SDL_Texture* SDLTexture;
+
+	SDL_FRect SourceRect;
+	SDL_FRect SourceUV;
+
+	/** Set when texture is packed in atlas */
+	std::shared_ptr<FTextureAtlas> TextureAtlas;
+	FTextureAtlasRegion AtlasRegion;
 	
 };
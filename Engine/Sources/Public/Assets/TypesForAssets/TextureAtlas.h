@@ -0,0 +1,74 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Assets/TypesForAssets/TextureAtlasPacker.h"
+
+/** Place of texture on atlas page */
+struct FTextureAtlasRegion
+{
+	FTextureAtlasRegion()
+		: PageTexture(nullptr)
+		, PageIndex(INDEX_NONE)
+		, Rect({ 0.f, 0.f, 0.f, 0.f })
+	{
+	}
+
+	SDL_Texture* PageTexture;
+	int32 PageIndex;
+
+	/** Pixels of texture on page, padding excluded */
+	SDL_FRect Rect;
+};
+
+/**
+ * Shared pages with many small textures, so sprites and tiles using them are drawn without switching textures.
+ * Textures are packed when they are loaded, each one is surrounded by copy of its edge pixels so filtering does not take neighbours.
+ * Page is emptied once all textures on it are released.
+ */
+class ENGINE_API FTextureAtlas
+{
+public:
+	FTextureAtlas(SDL_Renderer* InRenderer, const int32 InPageSize = FTextureAtlasPacker::DefaultPageSize);
+	~FTextureAtlas();
+
+	/**
+	 * Copies surface to free place on one of pages, new page is created when it does not fit on any
+	 * @returns false when surface is bigger than MaxTextureSize or page could not be created
+	 */
+	bool AddSurface(SDL_Surface* InSurface, FTextureAtlasRegion& OutRegion);
+
+	/** Called when texture is no longer used */
+	void ReleaseRegion(const FTextureAtlasRegion& InRegion);
+
+	NO_DISCARD int32 GetNumberOfPages() const { return Pages.Size(); }
+
+	/** Bigger textures are not worth packing, they get own texture */
+	static constexpr int32 MaxTextureSize = 256;
+
+	/** Edge pixels copied around each texture */
+	static constexpr int32 Padding = 1;
+
+protected:
+	struct FAtlasPage
+	{
+		SDL_Texture* Texture;
+		FTextureAtlasPacker Packer;
+		int32 NumberOfRegions;
+	};
+
+	/** Creates page texture, @returns INDEX_NONE on failure */
+	int32 AddPage();
+
+	/** @returns copy of surface in page format with edge pixels repeated around */
+	static SDL_Surface* CreatePaddedSurface(SDL_Surface* InSurface);
+
+protected:
+	SDL_Renderer* Renderer;
+
+	CArray<FAtlasPage> Pages;
+
+	int32 PageSize;
+
+};
@@ -0,0 +1,57 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Skyline packer of rectangles on single atlas page.
+ * Keeps top edge of used area as list of horizontal segments and puts each rectangle where its bottom is lowest.
+ * Rectangles can not be removed one by one, page is reset when all of them are no longer used.
+ */
+class ENGINE_API FTextureAtlasPacker
+{
+public:
+	FTextureAtlasPacker(const FVector2D<int32>& InPageSize = FVector2D<int32>(DefaultPageSize, DefaultPageSize));
+
+	/**
+	 * Finds place for rectangle of given size
+	 * @returns false if it does not fit on this page
+	 */
+	bool Insert(const FVector2D<int32>& InSize, FVector2D<int32>& OutLocation);
+
+	/** Makes whole page free again */
+	void Reset();
+
+	NO_DISCARD const FVector2D<int32>& GetPageSize() const { return PageSize; }
+
+	/** @returns area of inserted rectangles */
+	NO_DISCARD int64 GetUsedArea() const { return UsedArea; }
+
+	/** @returns used area divided by page area */
+	NO_DISCARD float GetOccupancy() const;
+
+	static constexpr int32 DefaultPageSize = 2048;
+
+protected:
+	/** Top edge of used area from X to X + Width */
+	struct FSkylineSegment
+	{
+		int32 X;
+		int32 Y;
+		int32 Width;
+	};
+
+	/** @returns Y where rectangle starting at segment fits or INDEX_NONE */
+	NO_DISCARD int32 FindY(const int32 SegmentIndex, const FVector2D<int32>& InSize) const;
+
+	void AddSegment(const int32 SegmentIndex, const FVector2D<int32>& InLocation, const FVector2D<int32>& InSize);
+
+protected:
+	CArray<FSkylineSegment> Skyline;
+
+	FVector2D<int32> PageSize;
+
+	int64 UsedArea;
+
+};
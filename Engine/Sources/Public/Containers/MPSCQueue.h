@@ -0,0 +1,222 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "ContainerBase.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <optional>
+
+/*
+ * Multiple producers, single consumer queue.
+ * Any thread can Push without locking, only one thread (owner) can Pop.
+ * Lock free bounded ring buffer (each slot has sequence number), when ring is full elements go to locked overflow queue so nothing is lost.
+ * Order is kept per producer unless ring overflows.
+ */
+template<typename TType, typename TSizeType = ContainerInt>
+class CMPSCQueue : public CContainerBase<TType, TSizeType>
+{
+public:
+	/** InCapacity is rounded up to power of two */
+	CMPSCQueue(const TSizeType InCapacity = 4096)
+		: EnqueuePosition(0)
+		, NumberOfOverflowElements(0)
+		, DequeuePosition(0)
+	{
+		Capacity = 1;
+		while (Capacity < static_cast<size_t>(InCapacity))
+		{
+			Capacity <<= 1;
+		}
+
+		CapacityMask = Capacity - 1;
+
+		Cells = std::make_unique<FCell[]>(Capacity);
+
+		for (size_t i = 0; i < Capacity; i++)
+		{
+			Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	/** Begin CContainerBase interface */
+	/** @Note: Approximate when other threads are pushing. */
+	NO_DISCARD TSizeType Size() const override
+	{
+		const size_t CurrentEnqueuePosition = EnqueuePosition.load(std::memory_order_relaxed);
+		const size_t CurrentDequeuePosition = DequeuePosition.load(std::memory_order_relaxed);
+
+		// Consumer may move past loaded enqueue position when called from other thread
+		const size_t NumberInRing = (CurrentEnqueuePosition > CurrentDequeuePosition) ? (CurrentEnqueuePosition - CurrentDequeuePosition) : 0;
+
+		return static_cast<TSizeType>(NumberInRing + NumberOfOverflowElements.load(std::memory_order_relaxed));
+	}
+	/** @Note: Approximate when other threads are pushing. */
+	NO_DISCARD bool IsEmpty() const override
+	{
+		return (Size() == 0);
+	}
+	/** End CContainerBase interface */
+
+	/** Add element, can be called from any thread */
+	void Push(TType Value)
+	{
+		size_t Position = EnqueuePosition.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			FCell& Cell = Cells[Position & CapacityMask];
+
+			const size_t Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			const intptr_t Difference = static_cast<intptr_t>(Sequence) - static_cast<intptr_t>(Position);
+
+			if (Difference == 0)
+			{
+				// Slot is free, try to claim it
+				if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					Cell.Value.emplace(std::move(Value));
+
+					// Publish to consumer
+					Cell.Sequence.store(Position + 1, std::memory_order_release);
+
+					return;
+				}
+			}
+			else if (Difference < 0)
+			{
+				// Ring is full, consumer did not take element from this slot yet
+				std::lock_guard<std::mutex> Lock(OverflowMutex);
+
+				OverflowQueue.push_back(std::move(Value));
+
+				NumberOfOverflowElements.fetch_add(1, std::memory_order_release);
+
+				return;
+			}
+			else
+			{
+				// Other producer took this slot
+				Position = EnqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/** Take oldest element, must be called only from consumer thread. @returns true if OutValue was set. */
+	bool Pop(TType& OutValue)
+	{
+		return ConsumeSingle([&OutValue](TType& Value)
+		{
+			OutValue = std::move(Value);
+		});
+	}
+
+	/** Calls Function with oldest element and removes it, must be called only from consumer thread. @returns true if element was consumed */
+	template<typename TFunction>
+	bool ConsumeSingle(TFunction&& Function)
+	{
+		const size_t Position = DequeuePosition.load(std::memory_order_relaxed);
+		FCell& Cell = Cells[Position & CapacityMask];
+
+		const size_t Sequence = Cell.Sequence.load(std::memory_order_acquire);
+		if (static_cast<intptr_t>(Sequence) - static_cast<intptr_t>(Position + 1) == 0)
+		{
+			Function(*Cell.Value);
+			Cell.Value.reset();
+
+			DequeuePosition.store(Position + 1, std::memory_order_relaxed);
+
+			// Release slot for producers, next use of this slot is one lap later
+			Cell.Sequence.store(Position + Capacity, std::memory_order_release);
+
+			return true;
+		}
+
+		// Ring is empty (or next element is not published yet), check overflow
+		if (NumberOfOverflowElements.load(std::memory_order_acquire) > 0)
+		{
+			std::optional<TType> OverflowValue;
+
+			{
+				std::lock_guard<std::mutex> Lock(OverflowMutex);
+
+				if (!OverflowQueue.empty())
+				{
+					OverflowValue.emplace(std::move(OverflowQueue.front()));
+					OverflowQueue.pop_front();
+
+					NumberOfOverflowElements.fetch_sub(1, std::memory_order_relaxed);
+				}
+			}
+
+			if (OverflowValue.has_value())
+			{
+				// Called without lock so Function can push new elements
+				Function(*OverflowValue);
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * Calls Function for elements which were in queue when this function started, must be called only from consumer thread.
+	 * Elements added by Function (or other threads while draining) wait for next call.
+	 * @returns number of processed elements
+	 */
+	template<typename TFunction>
+	TSizeType ConsumeAll(TFunction&& Function)
+	{
+		const TSizeType NumberOfElementsToConsume = Size();
+
+		TSizeType NumberOfConsumedElements = 0;
+
+		while (NumberOfConsumedElements < NumberOfElementsToConsume && ConsumeSingle(Function))
+		{
+			NumberOfConsumedElements++;
+		}
+
+		return NumberOfConsumedElements;
+	}
+
+	/** Removes all elements, must be called only from consumer thread. @returns number of removed elements */
+	TSizeType Clear()
+	{
+		return ConsumeAll([](TType&) {});
+	}
+
+protected:
+	struct FCell
+	{
+		/** Equals position when slot is free for producer, position + 1 when value is ready for consumer */
+		std::atomic<size_t> Sequence;
+
+		std::optional<TType> Value;
+	};
+
+	/** Ring buffer */
+	std::unique_ptr<FCell[]> Cells;
+
+	size_t Capacity;
+	size_t CapacityMask;
+
+	/** Next position for producers, on own cache line as all producers write it */
+	alignas(64) std::atomic<size_t> EnqueuePosition;
+
+	/** Elements added when ring was full */
+	std::deque<TType> OverflowQueue;
+
+	/** Mutex for OverflowQueue */
+	std::mutex OverflowMutex;
+
+	/** Size of OverflowQueue readable without lock */
+	std::atomic<TSizeType> NumberOfOverflowElements;
+
+	/** Next position for consumer, written only by consumer thread */
+	alignas(64) std::atomic<size_t> DequeuePosition;
+
+};
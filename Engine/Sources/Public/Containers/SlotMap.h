@@ -0,0 +1,171 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "ContainerBase.h"
+
+#include <vector>
+
+/**
+ * Key of element in CSlotMap.
+ * Generation is increased each time slot is released, so keys of removed elements never find new element in same slot.
+ */
+struct FSlotMapKey
+{
+	FSlotMapKey()
+		: Index(INDEX_NONE)
+		, Generation(0)
+	{
+	}
+
+	FSlotMapKey(const int32 InIndex, const uint32 InGeneration)
+		: Index(InIndex)
+		, Generation(InGeneration)
+	{
+	}
+
+	/** @returns true if key was given by slot map, it does not mean element still exists */
+	NO_DISCARD bool IsSet() const { return (Index != INDEX_NONE); }
+
+	friend bool operator==(const FSlotMapKey& L, const FSlotMapKey& R)
+	{
+		return (L.Index == R.Index && L.Generation == R.Generation);
+	}
+	friend bool operator!=(const FSlotMapKey& L, const FSlotMapKey& R)
+	{
+		return !(L == R);
+	}
+
+	int32 Index;
+	uint32 Generation;
+};
+
+/**
+ * Slot map - O(1) add, remove and lookup with generational keys.
+ * Released slots are reused, stale keys are detected by generation.
+ * Not thread safe.
+ */
+template<typename TType, typename TSizeType = ContainerInt>
+class CSlotMap : public CContainerBase<TType, TSizeType>
+{
+public:
+	CSlotMap()
+		: NumberOfElements(0)
+	{
+	}
+
+	/** Begin CContainerBase interface */
+	NO_DISCARD TSizeType Size() const override
+	{
+		return NumberOfElements;
+	}
+	NO_DISCARD bool IsEmpty() const override
+	{
+		return (NumberOfElements == 0);
+	}
+	/** End CContainerBase interface */
+
+	/** @returns key of added element */
+	FSlotMapKey Add(TType Value)
+	{
+		int32 SlotIndex;
+
+		if (FreeSlotIndexes.empty())
+		{
+			SlotIndex = static_cast<int32>(Slots.size());
+
+			// Generation starts at 1 so default key is never valid
+			Slots.push_back({ std::move(Value), 1, true });
+		}
+		else
+		{
+			SlotIndex = FreeSlotIndexes.back();
+			FreeSlotIndexes.pop_back();
+
+			FSlot& Slot = Slots[SlotIndex];
+			Slot.Value = std::move(Value);
+			Slot.bIsUsed = true;
+		}
+
+		NumberOfElements++;
+
+		return FSlotMapKey(SlotIndex, Slots[SlotIndex].Generation);
+	}
+
+	/** @returns true if element was found and removed */
+	bool Remove(const FSlotMapKey& Key)
+	{
+		if (Contains(Key))
+		{
+			FSlot& Slot = Slots[Key.Index];
+			Slot.Value = TType();
+			Slot.bIsUsed = false;
+			Slot.Generation++;
+
+			FreeSlotIndexes.push_back(Key.Index);
+
+			NumberOfElements--;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	NO_DISCARD bool Contains(const FSlotMapKey& Key) const
+	{
+		return (Key.Index >= 0 && Key.Index < static_cast<int32>(Slots.size()) && Slots[Key.Index].bIsUsed && Slots[Key.Index].Generation == Key.Generation);
+	}
+
+	/** @returns element or nullptr if key is stale */
+	NO_DISCARD TType* Find(const FSlotMapKey& Key)
+	{
+		return Contains(Key) ? &Slots[Key.Index].Value : nullptr;
+	}
+
+	NO_DISCARD const TType* Find(const FSlotMapKey& Key) const
+	{
+		return Contains(Key) ? &Slots[Key.Index].Value : nullptr;
+	}
+
+	/** Pre allocate slots */
+	void Reserve(const TSizeType Number)
+	{
+		Slots.reserve(Number);
+	}
+
+	/** Removes all elements, keys given before are invalid after this call */
+	void Clear()
+	{
+		for (ContainerInt i = 0; i < static_cast<ContainerInt>(Slots.size()); i++)
+		{
+			FSlot& Slot = Slots[i];
+			if (Slot.bIsUsed)
+			{
+				Slot.Value = TType();
+				Slot.bIsUsed = false;
+				Slot.Generation++;
+
+				FreeSlotIndexes.push_back(i);
+			}
+		}
+
+		NumberOfElements = 0;
+	}
+
+protected:
+	struct FSlot
+	{
+		TType Value;
+		uint32 Generation;
+		bool bIsUsed;
+	};
+
+	std::vector<FSlot> Slots;
+
+	/** Indexes of unused slots, last released is reused first */
+	std::vector<int32> FreeSlotIndexes;
+
+	TSizeType NumberOfElements;
+
+};
@@ -0,0 +1,139 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "ContainerBase.h"
+
+#include <vector>
+
+/**
+ * Sparse set - values stored contiguously (dense) and accessed by integer key in O(1).
+ * Sparse array maps key to index in dense arrays, remove swaps last element into removed place so dense arrays stay packed.
+ * @Note Order of elements changes on remove. Pointers to elements are invalidated by Add and Remove.
+ */
+template<typename TType, typename TSizeType = ContainerInt>
+class CSparseSet : public CContainerBase<TType, TSizeType>
+{
+public:
+	/** Begin CContainerBase interface */
+	NO_DISCARD TSizeType Size() const override
+	{
+		return static_cast<TSizeType>(DenseValues.size());
+	}
+	NO_DISCARD bool IsEmpty() const override
+	{
+		return DenseValues.empty();
+	}
+	/** End CContainerBase interface */
+
+	NO_DISCARD bool Contains(const TSizeType Key) const
+	{
+		return (Key >= 0 && Key < static_cast<TSizeType>(Sparse.size()) && Sparse[Key] != INDEX_NONE);
+	}
+
+	/** Add value for key, if key already exists value is replaced. @returns added value */
+	template<typename... TInParams>
+	TType& Add(const TSizeType Key, TInParams&&... InParams)
+	{
+		if (Contains(Key))
+		{
+			TType& Value = DenseValues[Sparse[Key]];
+			Value = TType(std::forward<TInParams>(InParams)...);
+
+			return Value;
+		}
+
+		if (Key >= static_cast<TSizeType>(Sparse.size()))
+		{
+			Sparse.resize(Key + 1, INDEX_NONE);
+		}
+
+		Sparse[Key] = static_cast<TSizeType>(DenseValues.size());
+
+		DenseKeys.push_back(Key);
+
+		return DenseValues.emplace_back(std::forward<TInParams>(InParams)...);
+	}
+
+	/** @returns true if key was found and removed */
+	bool Remove(const TSizeType Key)
+	{
+		if (Contains(Key))
+		{
+			const TSizeType DenseIndex = Sparse[Key];
+			const TSizeType LastDenseIndex = static_cast<TSizeType>(DenseValues.size()) - 1;
+
+			if (DenseIndex != LastDenseIndex)
+			{
+				// Move last element into removed place
+				DenseValues[DenseIndex] = std::move(DenseValues[LastDenseIndex]);
+				DenseKeys[DenseIndex] = DenseKeys[LastDenseIndex];
+
+				Sparse[DenseKeys[DenseIndex]] = DenseIndex;
+			}
+
+			DenseValues.pop_back();
+			DenseKeys.pop_back();
+
+			Sparse[Key] = INDEX_NONE;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	/** @returns value for key or nullptr if not present */
+	NO_DISCARD TType* Find(const TSizeType Key)
+	{
+		return Contains(Key) ? &DenseValues[Sparse[Key]] : nullptr;
+	}
+
+	NO_DISCARD const TType* Find(const TSizeType Key) const
+	{
+		return Contains(Key) ? &DenseValues[Sparse[Key]] : nullptr;
+	}
+
+	/** @returns key of element at dense index */
+	NO_DISCARD TSizeType GetKeyAt(const TSizeType DenseIndex) const
+	{
+		return DenseKeys[DenseIndex];
+	}
+
+	/** @returns element at dense index */
+	NO_DISCARD TType& GetValueAt(const TSizeType DenseIndex)
+	{
+		return DenseValues[DenseIndex];
+	}
+
+	/** Pre allocate dense arrays */
+	void Reserve(const TSizeType Number)
+	{
+		DenseValues.reserve(Number);
+		DenseKeys.reserve(Number);
+	}
+
+	void Clear()
+	{
+		DenseValues.clear();
+		DenseKeys.clear();
+		Sparse.clear();
+	}
+
+	/** Iterators over dense values */
+	typename std::vector<TType>::iterator begin() { return DenseValues.begin(); }
+	typename std::vector<TType>::iterator end() { return DenseValues.end(); }
+	typename std::vector<TType>::const_iterator begin() const { return DenseValues.begin(); }
+	typename std::vector<TType>::const_iterator end() const { return DenseValues.end(); }
+
+protected:
+	/** Packed values */
+	std::vector<TType> DenseValues;
+
+	/** Key of each value in DenseValues */
+	std::vector<TSizeType> DenseKeys;
+
+	/** Index in dense arrays for each key, INDEX_NONE if key is not present */
+	std::vector<TSizeType> Sparse;
+
+};
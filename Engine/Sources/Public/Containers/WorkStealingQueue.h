@@ -0,0 +1,120 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "ContainerBase.h"
+
+#include <atomic>
+#include <deque>
+
+/*
+ * Double ended queue for work stealing.
+ * Owner thread pushes and pops from back (LIFO, hot cache),
+ * other threads steal from front (FIFO, oldest work first).
+ * Thread safe, each queue has its own lock so threads only contend when stealing from the same queue.
+ */
+template<typename TType, typename TSizeType = ContainerInt>
+class CWorkStealingQueue : public CContainerBase<TType, TSizeType>
+{
+public:
+	CWorkStealingQueue()
+		: NumberOfElements(0)
+	{
+	}
+
+	/** Begin CContainerBase interface */
+	/** @Note: Approximate when other threads are using this queue, does not lock. */
+	NO_DISCARD TSizeType Size() const override
+	{
+		return NumberOfElements.load(std::memory_order_relaxed);
+	}
+	/** @Note: Approximate when other threads are using this queue, does not lock. */
+	NO_DISCARD bool IsEmpty() const override
+	{
+		return (Size() == 0);
+	}
+	/** End CContainerBase interface */
+
+	/** Add element at end, should be called from owner thread or when distributing work. */
+	void Push(TType Value)
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		Deque.push_back(std::move(Value));
+
+		NumberOfElements.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/** Take newest element, should be called from owner thread. @returns true if OutValue was set. */
+	bool Pop(TType& OutValue)
+	{
+		// Fast path without lock
+		if (IsEmpty())
+		{
+			return false;
+		}
+
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		if (Deque.empty())
+		{
+			return false;
+		}
+
+		OutValue = std::move(Deque.back());
+		Deque.pop_back();
+
+		NumberOfElements.fetch_sub(1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	/** Take oldest element, called by other threads. @returns true if OutValue was set. */
+	bool Steal(TType& OutValue)
+	{
+		// Fast path without lock
+		if (IsEmpty())
+		{
+			return false;
+		}
+
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		if (Deque.empty())
+		{
+			return false;
+		}
+
+		OutValue = std::move(Deque.front());
+		Deque.pop_front();
+
+		NumberOfElements.fetch_sub(1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	/** Removes all elements, @returns number of removed elements */
+	TSizeType Clear()
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+
+		const TSizeType NumberOfRemovedElements = static_cast<TSizeType>(Deque.size());
+
+		Deque.clear();
+
+		NumberOfElements.store(0, std::memory_order_relaxed);
+
+		return NumberOfRemovedElements;
+	}
+
+protected:
+	/** C++ deque. */
+	std::deque<TType> Deque;
+
+	/** Mutex for Deque */
+	std::mutex Mutex;
+
+	/** Number of elements in Deque, readable without lock */
+	std::atomic<TSizeType> NumberOfElements;
+
+};
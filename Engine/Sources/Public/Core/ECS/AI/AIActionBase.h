@@ -43,7 +43,7 @@ public:
 	/** @return owner AI tree */
 	FAITree* GetTree() const;
 
-	/** @return Entity owner for this action */
+	/** @returns owner entity of tree or nullptr if it was destroyed */
 	EEntity* GetOwnerEntity() const;
 
 protected:
@@ -29,7 +29,7 @@ public:
 	void EndAction() override;
 	/** End FAIActionBase */
 
-	/** Default implementation, will walk into given point */
+	/** Default implementation, will walk into given point avoiding map collision when map has FNavigationManager */
 	virtual void SetTargetLocation(const FVector2D<int32>& InLocation);
 
 	void OnStoppedMovement();
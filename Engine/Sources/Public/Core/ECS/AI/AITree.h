@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "AIActionBase.h"
+#include "ECS/EntityHandle.h"
 
 class FAIMemorySet;
 class FAIActionBase;
@@ -17,6 +18,7 @@ class FAIActionBase;
 class ENGINE_API FAITree
 {
 public:
+	/** Owner must be registered in entity manager, create trees in EEntity::SetupAIActions */
 	FAITree(EEntity* InOwnerEntity);
 	virtual ~FAITree();
 
@@ -59,8 +61,11 @@ public:
 	/** Start, stop actions and tick them. */
 	virtual void Tick();
 
+	/** @returns owner entity or nullptr if it was destroyed */
 	EEntity* GetOwnerEntity() const;
 
+	const FEntityHandle& GetOwnerEntityHandle() const { return OwnerEntityHandle; }
+
 	void SetIsTreeEnabled(const bool bInEnable);
 
 	/** Will activate action if not running and ready */
@@ -88,7 +93,7 @@ protected:
 
 private:
 	/** Owner entity */
-	EEntity* OwnerEntity;
+	FEntityHandle OwnerEntityHandle;
 
 	/** If true Tick will choose action when previous finished. */
 	bool bIsTreeEnabled;
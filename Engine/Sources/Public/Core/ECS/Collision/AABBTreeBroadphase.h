@@ -0,0 +1,155 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CollisionBroadphase.h"
+
+#include <vector>
+
+/**
+ * Dynamic AABB tree broadphase.
+ * Leaves store fattened bounds (bounds + margin), moving object is reinserted only when it leaves its fat bounds.
+ * Pairs are found with exact bounds, so they do not depend on margin.
+ * Tree is kept balanced with rotations, so queries are O(log n) for objects of any size.
+ */
+class ENGINE_API FAABBTreeBroadphase : public ICollisionBroadphaseInterface
+{
+public:
+	FAABBTreeBroadphase(const float InFatMargin = DefaultFatMargin);
+
+	/** Begin ICollisionBroadphaseInterface */
+	FBroadphaseProxyId CreateProxy(const FCollisionAABB& InBounds, FCollisionBase* InCollision, const FCollisionFilter& InFilter = FCollisionFilter()) override;
+	void DestroyProxy(const FBroadphaseProxyId ProxyId) override;
+	void SetProxyFilter(const FBroadphaseProxyId ProxyId, const FCollisionFilter& InFilter) override;
+	void MoveProxy(const FBroadphaseProxyId ProxyId, const FCollisionAABB& InBounds) override;
+	NO_DISCARD FCollisionBase* GetCollision(const FBroadphaseProxyId ProxyId) const override;
+	void Query(const FCollisionAABB& InBounds, CArray<FBroadphaseProxyId>& OutProxyIds) const override;
+	void QuerySegment(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, CArray<FBroadphaseProxyId>& OutProxyIds) const override;
+	void UpdatePairs(CArray<FBroadphasePair>& OutPairs) override;
+	NO_DISCARD int32 GetNumberOfProxies() const override { return NumberOfProxies; }
+	void DebugRender(const FRenderer* Renderer) const override;
+	/** End ICollisionBroadphaseInterface */
+
+	NO_DISCARD const FCollisionAABB& GetFatBounds(const FBroadphaseProxyId ProxyId) const { return Nodes[ProxyId].Bounds; }
+
+	/** @returns height of tree, 0 for single leaf, INDEX_NONE when empty */
+	NO_DISCARD int32 GetHeight() const;
+
+	/** @returns number of reinserts since creation, moves inside of fat bounds are not counted */
+	NO_DISCARD int32 GetNumberOfReinserts() const { return NumberOfReinserts; }
+
+	/** Forget moved proxies without finding pairs, for trees which are only queried and never call UpdatePairs */
+	void DiscardMovedProxies();
+
+	static constexpr float DefaultFatMargin = 8.f;
+
+protected:
+	struct FAABBTreeNode
+	{
+		/** Fat bounds for leaf, bounds of children for branch */
+		FCollisionAABB Bounds;
+
+		/** Exact bounds of leaf, used to find pairs */
+		FCollisionAABB ProxyBounds;
+
+		/** Set for leaves */
+		FCollisionBase* Collision;
+
+		/** Filter of leaf */
+		FCollisionFilter Filter;
+
+		/** Parent node or next free node when node is not used */
+		int32 ParentOrNext;
+
+		int32 Child1;
+		int32 Child2;
+
+		/** 0 for leaf, INDEX_NONE for free node */
+		int32 Height;
+
+		/** True if in MovedProxies */
+		bool bIsMoved;
+
+		NO_DISCARD bool IsLeaf() const { return (Child1 == INDEX_NONE); }
+	};
+
+	int32 AllocateNode();
+	void FreeNode(const int32 NodeIndex);
+
+	void InsertLeaf(const int32 LeafIndex);
+	void RemoveLeaf(const int32 LeafIndex);
+
+	/** Rotate tree at node if it is unbalanced. @returns index of node which is now in place of NodeIndex */
+	int32 Balance(const int32 NodeIndex);
+
+	/** Recalculate bounds and height of parents, balancing on the way up */
+	void RefitFrom(int32 NodeIndex);
+
+	void MarkMoved(const FBroadphaseProxyId ProxyId);
+
+	template<typename TFunction>
+	void QueryInternal(const FCollisionAABB& InBounds, TFunction&& Function) const
+	{
+		TraverseInternal([&](const FCollisionAABB& NodeBounds) { return NodeBounds.Overlaps(InBounds); }, Function);
+	}
+
+	/** Calls Function(LeafIndex) for each leaf which fat bounds pass IsOverlapping(FCollisionAABB), branches are entered only when they pass */
+	template<typename TOverlapFunction, typename TFunction>
+	void TraverseInternal(TOverlapFunction&& IsOverlapping, TFunction&& Function) const
+	{
+		if (RootIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		if (!IsOverlapping(Nodes[RootIndex].Bounds))
+		{
+			return;
+		}
+
+		// Only overlapping nodes are pushed
+		QueryStack.clear();
+		QueryStack.push_back(RootIndex);
+
+		while (!QueryStack.empty())
+		{
+			const int32 NodeIndex = QueryStack.back();
+			QueryStack.pop_back();
+
+			const FAABBTreeNode& Node = Nodes[NodeIndex];
+			if (Node.IsLeaf())
+			{
+				Function(NodeIndex);
+			}
+			else
+			{
+				if (IsOverlapping(Nodes[Node.Child1].Bounds))
+				{
+					QueryStack.push_back(Node.Child1);
+				}
+
+				if (IsOverlapping(Nodes[Node.Child2].Bounds))
+				{
+					QueryStack.push_back(Node.Child2);
+				}
+			}
+		}
+	}
+
+protected:
+	std::vector<FAABBTreeNode> Nodes;
+
+	int32 RootIndex;
+	int32 FreeListIndex;
+	int32 NumberOfProxies;
+	int32 NumberOfReinserts;
+
+	float FatMargin;
+
+	/** Proxies created or moved since last UpdatePairs */
+	CArray<FBroadphaseProxyId> MovedProxies;
+
+	/** Reused by queries to avoid allocations */
+	mutable std::vector<int32> QueryStack;
+
+};
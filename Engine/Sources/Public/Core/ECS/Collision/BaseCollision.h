@@ -2,7 +2,8 @@
 
 #pragma once
 
-struct FCollisionTile;
+#include "CollisionBroadphase.h"
+
 class UCollisionComponent;
 class FCollisionManager;
 
@@ -28,15 +29,30 @@ public:
 
 	UCollisionComponent* GetCollisionComponent() const { return CollisionComponent; }
 
-	const CArray<FCollisionTile*>& GetCurrentlyLocatedTiles() const { return CurrentlyLocatedTiles; }
+	/** @returns id in broadphase of FCollisionManager or INDEX_NONE if not registered */
+	FBroadphaseProxyId GetBroadphaseProxyId() const { return BroadphaseProxyId; }
+
+	/** Layers (for example team or channel) of this object, used by pairs and spatial queries of FCollisionManager */
+	void SetCollisionLayer(const FCollisionLayerMask InCollisionLayer) { CollisionFilter.Layer = InCollisionLayer; }
+	FCollisionLayerMask GetCollisionLayer() const { return CollisionFilter.Layer; }
+
+	/** Use FCollisionManager::SetCollisionFilter when object is registered, broadphase keeps copy of filter */
+	void SetCollisionFilter(const FCollisionFilter& InCollisionFilter) { CollisionFilter = InCollisionFilter; }
+	const FCollisionFilter& GetCollisionFilter() const { return CollisionFilter; }
 
 protected:
 	ECollisionType CollisionType;
 
+	/** Collision objects in contact with this one, used to find contacts of moved object */
 	CArray<FCollisionBase*> OtherCollidersCurrentlyColliding;
 
-	CArray<FCollisionTile*> CurrentlyLocatedTiles;
-
 	UCollisionComponent* CollisionComponent;
 
+	FBroadphaseProxyId BroadphaseProxyId;
+
+	FCollisionFilter CollisionFilter;
+
+	/** True if in FCollisionManager::MovedCollisions */
+	bool bIsMovedSinceUpdate;
+
 };
@@ -0,0 +1,239 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <algorithm>
+
+class FCollisionBase;
+class FRenderer;
+
+/** Id of object inside of broadphase */
+typedef int32 FBroadphaseProxyId;
+
+/** Bit mask of collision layers, each bit is one layer */
+typedef uint32 FCollisionLayerMask;
+
+/**
+ * Decides which objects can collide, checked by broadphase before pair is reported, so filtered pairs never reach narrowphase.
+ * Layers are configured in CollisionSettings.ini, see FCollisionManager::MakeCollisionFilter.
+ */
+struct ENGINE_API FCollisionFilter
+{
+	FCollisionFilter()
+		: Layer(DefaultLayer)
+		, Mask(AllLayers)
+		, bIsStatic(false)
+	{
+	}
+
+	FCollisionFilter(const FCollisionLayerMask InLayer, const FCollisionLayerMask InMask, const bool bInIsStatic = false)
+		: Layer(InLayer)
+		, Mask(InMask)
+		, bIsStatic(bInIsStatic)
+	{
+	}
+
+	/** Layer of each object must be in mask of other one, static objects never collide with each other */
+	NO_DISCARD bool CanCollide(const FCollisionFilter& Other) const
+	{
+		return (!(bIsStatic && Other.bIsStatic) && (Layer & Other.Mask) != 0 && (Other.Layer & Mask) != 0);
+	}
+
+	bool operator==(const FCollisionFilter& Other) const
+	{
+		return (Layer == Other.Layer && Mask == Other.Mask && bIsStatic == Other.bIsStatic);
+	}
+
+	/** Layers this object is in */
+	FCollisionLayerMask Layer;
+
+	/** Layers this object collides with */
+	FCollisionLayerMask Mask;
+
+	/** Static objects (for example map blockers) are not expected to move */
+	bool bIsStatic;
+
+	static constexpr FCollisionLayerMask DefaultLayer = 1;
+	static constexpr FCollisionLayerMask AllLayers = 0xFFFFFFFF;
+};
+
+/** Type of broadphase used by FCollisionManager, selected with 'Broadphase' in CollisionSettings.ini */
+enum class ECollisionBroadphaseType : uint8
+{
+	/** Uniform grid of CollisionTileSize cells covering map */
+	Grid,
+	/** Dynamic AABB tree, objects of any size and outside of map */
+	AABBTree
+};
+
+/** Axis aligned bounding box */
+struct ENGINE_API FCollisionAABB
+{
+	FCollisionAABB()
+	{
+	}
+
+	FCollisionAABB(const FVector2D<float>& InMin, const FVector2D<float>& InMax)
+		: Min(InMin)
+		, Max(InMax)
+	{
+	}
+
+	/** Touching boxes overlap, broadphase should rather report too much than miss pair */
+	NO_DISCARD bool Overlaps(const FCollisionAABB& Other) const
+	{
+		return (Min.X <= Other.Max.X && Other.Min.X <= Max.X && Min.Y <= Other.Max.Y && Other.Min.Y <= Max.Y);
+	}
+
+	NO_DISCARD bool Contains(const FCollisionAABB& Other) const
+	{
+		return (Min.X <= Other.Min.X && Min.Y <= Other.Min.Y && Other.Max.X <= Max.X && Other.Max.Y <= Max.Y);
+	}
+
+	/**
+	 * Clips segment with box (slab test), touching counts as crossing.
+	 * @param OutEnterFraction fraction of segment (0-1) where it enters box, 0 if it starts inside
+	 * @returns true if segment crosses box
+	 */
+	NO_DISCARD bool ClipSegment(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, float& OutEnterFraction) const
+	{
+		float ExitFraction = 1.f;
+		OutEnterFraction = 0.f;
+
+		return ClipSegmentAxis(InStart.X, InEnd.X - InStart.X, Min.X, Max.X, OutEnterFraction, ExitFraction)
+			&& ClipSegmentAxis(InStart.Y, InEnd.Y - InStart.Y, Min.Y, Max.Y, OutEnterFraction, ExitFraction);
+	}
+
+	NO_DISCARD bool IntersectsSegment(const FVector2D<float>& InStart, const FVector2D<float>& InEnd) const
+	{
+		float EnterFraction;
+		return ClipSegment(InStart, InEnd, EnterFraction);
+	}
+
+	NO_DISCARD float GetPerimeter() const
+	{
+		return 2.f * ((Max.X - Min.X) + (Max.Y - Min.Y));
+	}
+
+	NO_DISCARD FCollisionAABB Expanded(const float Margin) const
+	{
+		return FCollisionAABB(FVector2D<float>(Min.X - Margin, Min.Y - Margin), FVector2D<float>(Max.X + Margin, Max.Y + Margin));
+	}
+
+	static FCollisionAABB Combine(const FCollisionAABB& A, const FCollisionAABB& B)
+	{
+		return FCollisionAABB(
+			FVector2D<float>(FMath::Min(A.Min.X, B.Min.X), FMath::Min(A.Min.Y, B.Min.Y)),
+			FVector2D<float>(FMath::Max(A.Max.X, B.Max.X), FMath::Max(A.Max.Y, B.Max.Y))
+		);
+	}
+
+	FVector2D<float> Min;
+	FVector2D<float> Max;
+
+protected:
+	static bool ClipSegmentAxis(const float Start, const float Delta, const float AxisMin, const float AxisMax, float& InOutEnterFraction, float& InOutExitFraction)
+	{
+		if (Delta == 0.f)
+		{
+			return (AxisMin <= Start && Start <= AxisMax);
+		}
+
+		float EnterFraction = (AxisMin - Start) / Delta;
+		float ExitFraction = (AxisMax - Start) / Delta;
+		if (EnterFraction > ExitFraction)
+		{
+			std::swap(EnterFraction, ExitFraction);
+		}
+
+		InOutEnterFraction = FMath::Max(InOutEnterFraction, EnterFraction);
+		InOutExitFraction = FMath::Min(InOutExitFraction, ExitFraction);
+
+		return (InOutEnterFraction <= InOutExitFraction);
+	}
+};
+
+/** Two proxies with overlapping bounds, ProxyA is always lower id */
+struct FBroadphasePair
+{
+	FBroadphasePair()
+		: ProxyA(INDEX_NONE)
+		, ProxyB(INDEX_NONE)
+	{
+	}
+
+	FBroadphasePair(const FBroadphaseProxyId InProxyA, const FBroadphaseProxyId InProxyB)
+		: ProxyA(FMath::Min(InProxyA, InProxyB))
+		, ProxyB(FMath::Max(InProxyA, InProxyB))
+	{
+	}
+
+	bool operator<(const FBroadphasePair& Other) const
+	{
+		return (ProxyA < Other.ProxyA) || (ProxyA == Other.ProxyA && ProxyB < Other.ProxyB);
+	}
+	bool operator==(const FBroadphasePair& Other) const
+	{
+		return (ProxyA == Other.ProxyA && ProxyB == Other.ProxyB);
+	}
+
+	/** @returns unique key of pair */
+	NO_DISCARD uint64 GetKey() const
+	{
+		return (static_cast<uint64>(static_cast<uint32>(ProxyA)) << 32) | static_cast<uint32>(ProxyB);
+	}
+
+	FBroadphaseProxyId ProxyA;
+	FBroadphaseProxyId ProxyB;
+};
+
+/**
+ * Broadphase finds pairs of objects which might collide, FCollisionManager checks exact shapes (narrowphase) only for those pairs.
+ * Not thread safe.
+ */
+class ENGINE_API ICollisionBroadphaseInterface
+{
+public:
+	virtual ~ICollisionBroadphaseInterface() = default;
+
+	/** @returns id of new proxy, proxy is used in next UpdatePairs */
+	virtual FBroadphaseProxyId CreateProxy(const FCollisionAABB& InBounds, FCollisionBase* InCollision, const FCollisionFilter& InFilter = FCollisionFilter()) = 0;
+	virtual void DestroyProxy(const FBroadphaseProxyId ProxyId) = 0;
+
+	/** Change filter of proxy, proxy is used in next UpdatePairs */
+	virtual void SetProxyFilter(const FBroadphaseProxyId ProxyId, const FCollisionFilter& InFilter) = 0;
+
+	/** Update bounds of proxy, proxy is used in next UpdatePairs */
+	virtual void MoveProxy(const FBroadphaseProxyId ProxyId, const FCollisionAABB& InBounds) = 0;
+
+	NO_DISCARD virtual FCollisionBase* GetCollision(const FBroadphaseProxyId ProxyId) const = 0;
+
+	/** Adds to OutProxyIds each proxy which bounds overlap InBounds, each proxy is added once */
+	virtual void Query(const FCollisionAABB& InBounds, CArray<FBroadphaseProxyId>& OutProxyIds) const = 0;
+
+	/** Adds to OutProxyIds each proxy which bounds are crossed by segment, each proxy is added once, order is not defined */
+	virtual void QuerySegment(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, CArray<FBroadphaseProxyId>& OutProxyIds) const = 0;
+
+	/**
+	 * Fills OutPairs with pairs of overlapping proxies where at least one proxy was created or moved since last call.
+	 * Only proxies which filters can collide are paired.
+	 * Pairs are sorted and unique so result does not depend on order of moves.
+	 */
+	virtual void UpdatePairs(CArray<FBroadphasePair>& OutPairs) = 0;
+
+	NO_DISCARD virtual int32 GetNumberOfProxies() const = 0;
+
+	virtual void DebugRender(const FRenderer* /*Renderer*/) const
+	{
+	}
+
+protected:
+	static void SortAndRemoveDuplicatePairs(CArray<FBroadphasePair>& InOutPairs)
+	{
+		std::sort(InOutPairs.Vector.begin(), InOutPairs.Vector.end());
+		InOutPairs.Vector.erase(std::unique(InOutPairs.Vector.begin(), InOutPairs.Vector.end()), InOutPairs.Vector.end());
+	}
+
+};
@@ -0,0 +1,102 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FCircle;
+struct FRectangle;
+
+/** Circles as structure of arrays, layout used by batched kernels */
+struct ENGINE_API FCollisionCircleBatch
+{
+	void Add(const FCircle& InCircle);
+
+	/** Adds circle moved by -InOrigin, so values stay small for any location in world */
+	void Add(const FCircle& InCircle, const FVector2D<int>& InOrigin);
+
+	void Add(const float InX, const float InY, const float InRadius)
+	{
+		X.Push(InX);
+		Y.Push(InY);
+		Radius.Push(InRadius);
+	}
+
+	void Reserve(const int32 Number);
+	void Clear();
+
+	NO_DISCARD int32 Size() const { return X.Size(); }
+
+	CArray<float> X;
+	CArray<float> Y;
+	CArray<float> Radius;
+};
+
+/** Rectangles as structure of arrays, layout used by batched kernels */
+struct ENGINE_API FCollisionRectangleBatch
+{
+	void Add(const FRectangle& InRectangle);
+
+	/** Adds rectangle moved by -InOrigin, so values stay small for any location in world */
+	void Add(const FRectangle& InRectangle, const FVector2D<int>& InOrigin);
+
+	void Add(const float InMinX, const float InMinY, const float InMaxX, const float InMaxY)
+	{
+		MinX.Push(InMinX);
+		MinY.Push(InMinY);
+		MaxX.Push(InMaxX);
+		MaxY.Push(InMaxY);
+	}
+
+	void Reserve(const int32 Number);
+	void Clear();
+
+	NO_DISCARD int32 Size() const { return MinX.Size(); }
+
+	CArray<float> MinX;
+	CArray<float> MinY;
+	CArray<float> MaxX;
+	CArray<float> MaxY;
+};
+
+/**
+ * Batched intersection tests of one shape against many candidates or of pairs of shapes.
+ * Uses squared distances, AVX2 (ENGINE_USE_AVX2) or SSE2 when available, scalar code otherwise.
+ * Results match FCollisionGlobals for shapes passing Is*Exact checks when they are added to batches relative to location of one of them,
+ * so large world coordinates stay exact. Other shapes should be checked by FCollisionGlobals.
+ * OutResults is resized to number of candidates, 1 for intersecting candidate, 0 otherwise.
+ */
+class ENGINE_API FCollisionKernels
+{
+public:
+	static void CircleAgainstCircles(const FCircle& InCircle, const FCollisionCircleBatch& Candidates, CArray<uint8>& OutResults);
+	static void CircleAgainstRectangles(const FCircle& InCircle, const FCollisionRectangleBatch& Candidates, CArray<uint8>& OutResults);
+	static void RectangleAgainstRectangles(const FRectangle& InRectangle, const FCollisionRectangleBatch& Candidates, CArray<uint8>& OutResults);
+	static void RectangleAgainstCircles(const FRectangle& InRectangle, const FCollisionCircleBatch& Candidates, CArray<uint8>& OutResults);
+
+	/** Pair tests, result at index is test of shapes at same index of both batches, which must have same size */
+	static void CirclesAgainstCircles(const FCollisionCircleBatch& CirclesA, const FCollisionCircleBatch& CirclesB, CArray<uint8>& OutResults);
+	static void CirclesAgainstRectangles(const FCollisionCircleBatch& Circles, const FCollisionRectangleBatch& Rectangles, CArray<uint8>& OutResults);
+	static void RectanglesAgainstRectangles(const FCollisionRectangleBatch& RectanglesA, const FCollisionRectangleBatch& RectanglesB, CArray<uint8>& OutResults);
+
+	/** @returns true if float tests of shapes added relative to one of them are exact */
+	static bool IsCirclePairExact(const FCircle& CircleA, const FCircle& CircleB);
+	static bool IsCircleAndRectanglePairExact(const FCircle& InCircle, const FRectangle& InRectangle);
+	static bool IsRectanglePairExact(const FRectangle& RectangleA, const FRectangle& RectangleB);
+
+	/** @returns true if distance from origin of batch is exact in tests with squares (circles) */
+	static bool IsExactDistance(const int64 Value) { return (Value >= -MaxExactDistance && Value <= MaxExactDistance); }
+
+	/** @returns true if coordinate relative to origin of batch is exact in tests without squares (rectangles) */
+	static bool IsExactCoordinate(const int64 Value) { return (Value >= -MaxExactCoordinate && Value <= MaxExactCoordinate); }
+
+	/** @returns name of instructions used by kernels: AVX2, SSE2 or Scalar */
+	static const char* GetInstructionSetName();
+
+	/** Squares of distances up to this value and sums of two such squares are below 2^24, so they are exact in float */
+	static constexpr int64 MaxExactDistance = 2048;
+
+	/** Integers up to this value are exact in float, enough for tests without squares */
+	static constexpr int64 MaxExactCoordinate = 1 << 24;
+
+};
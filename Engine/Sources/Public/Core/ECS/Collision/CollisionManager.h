@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "ECS/SubSystems/SubSystemInstanceInterface.h"
+#include "ECS/Collision/CollisionBroadphase.h"
+#include "ECS/Collision/CollisionNarrowphase.h"
+#include "ECS/Collision/CollisionQuery.h"
 
 class FIniObject;
 struct FCircle;
@@ -12,26 +15,35 @@ class FCollisionBase;
 class FSquareCollision;
 class FCircleCollision;
 
-/** Single tile of specified size in specified location */
-struct ENGINE_API FCollisionTile
+/** Two intersecting collision objects, kept in contact cache of FCollisionManager */
+struct ENGINE_API FCollisionContact
 {
-	FVector2D<int> TileLocation;
-	FVector2D<int> TileSize;
-
-	/** Array with collision objects inside of tile */
-	CArray<FCollisionBase*> CollisionObjects;
-};
-
-/** Row of tiles */
-struct ENGINE_API FCollisionMeshRow
-{
-	/** Array of collision in single horizontal row. */
-	CArray<FCollisionTile*> CollisionTiles;
+	FCollisionContact()
+		: CollisionA(nullptr)
+		, CollisionB(nullptr)
+		, BeginTick(0)
+		, LastUpdateTick(0)
+	{
+	}
+
+	/** Collision with lower broadphase id */
+	FCollisionBase* CollisionA;
+	FCollisionBase* CollisionB;
+
+	/** Tick of FCollisionManager in which contact began */
+	uint64 BeginTick;
+
+	/** Last tick of FCollisionManager in which contact was checked */
+	uint64 LastUpdateTick;
 };
 
 /**
  * Collision manager
- * Collision is managed using tiles for collision detection of collidable objects in same tile.
+ * Broadphase (grid or AABB tree, see CollisionSettings.ini) finds pairs of collision objects which might intersect, then exact shapes of those pairs are checked.
+ * Intersecting pairs are kept in contact cache. On tick only contacts of objects which moved since last tick are updated,
+ * so cost depends on number of moving objects, not on number of all objects.
+ * Begin and end are called once per contact, stay is called on each tick in which contact was updated and is still intersecting.
+ * Exact shapes are checked by FCollisionNarrowphase on worker threads, callbacks are always called on main thread.
  */
 class ENGINE_API FCollisionManager : public ISubSystemInstanceInterface
 {
@@ -51,56 +63,171 @@ public:
 
 	bool IsDebugEnabled() const { return bIsDebugEnabled; }
 
-protected:
-	void BuildCollision();
-	void CreateCollisionTiles();
+	/**
+	 * Creates filter for layer from CollisionSettings.ini, unknown layer is logged and default filter is returned.
+	 * @param bInIsStatic static objects never collide with each other
+	 */
+	NO_DISCARD FCollisionFilter MakeCollisionFilter(const std::string& InLayerName, const bool bInIsStatic = false) const;
 
-	void OnCollisionCreated();
+	/** @returns bit of layer from CollisionSettings.ini (for spatial queries) or 0 if layer is unknown */
+	NO_DISCARD FCollisionLayerMask GetCollisionLayerMask(const std::string& InLayerName) const;
 
-	void PutCollisionIntoMesh(FCollisionBase* InCollision, const bool bIsDelayed = false);
-	void RemoveCollisionFromMesh(FCollisionBase* InCollision);
-	void UpdateCollisionOnMesh(FCollisionBase* InCollision);
+	/** Changes filter of collision, contacts are updated on next tick */
+	void SetCollisionFilter(FCollisionBase* InCollision, const FCollisionFilter& InFilter);
 
-	bool IsIntersecting(FCollisionBase* CollisionA, FCollisionBase* CollisionB);
+	/** @returns number of pairs checked by narrowphase in last tick */
+	NO_DISCARD int32 GetNumberOfPairTests() const { return NarrowphasePairs.Size(); }
 
-	CArray<FCollisionTile*> GetTilesFromCollision(FCollisionBase* InCollision);
+	NO_DISCARD ECollisionBroadphaseType GetBroadphaseType() const { return BroadphaseType; }
 
-	CArray<FCollisionTile*> GetTilesIntersectingRectangle(const FVector2D<int>& InLocation, const FVector2D<int>& InSize) const;
-	CArray<FCollisionTile*> GetTilesIntersectingCircle(const FVector2D<int>& InLocation, const int InRadius) const;
+	/** @returns broadphase or nullptr before subsystem is initialized */
+	NO_DISCARD ICollisionBroadphaseInterface* GetBroadphase() const { return Broadphase.get(); }
 
-	/** Handle collision custom types */
+	/** @returns bounds of collision object used by broadphase */
+	NO_DISCARD FCollisionAABB GetCollisionBounds(FCollisionBase* InCollision) const;
+
+	/** @returns contact of two collision objects or nullptr if they are not intersecting */
+	NO_DISCARD const FCollisionContact* FindContact(FCollisionBase* CollisionA, FCollisionBase* CollisionB) const;
+
+	NO_DISCARD int32 GetNumberOfContacts() const { return ContactCache.Size(); }
+
+	/** Called when collision objects start intersecting */
+	FDelegate<void, const FCollisionContact&> OnContactBegin;
+
+	/** Called when collision objects are still intersecting after one of them moved */
+	FDelegate<void, const FCollisionContact&> OnContactStay;
+
+	/** Called when collision objects stop intersecting, one of them is disabled or unregistered */
+	FDelegate<void, const FCollisionContact&> OnContactEnd;
+
+	/**
+	 * Spatial queries answered from broadphase, see FCollisionQuery.
+	 * Only enabled collisions in any layer of LayerMask are returned, buffers are cleared first.
+	 * Before subsystem is initialized nothing is found.
+	 */
+	void OverlapCircle(const FVector2D<int>& InLocation, const int InRadius, const FCollisionLayerMask LayerMask, CArray<FCollisionBase*>& OutCollisions) const;
+	void OverlapRectangle(const FVector2D<int>& InTopLeft, const FVector2D<int>& InSize, const FCollisionLayerMask LayerMask, CArray<FCollisionBase*>& OutCollisions) const;
+	bool RaycastFirst(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, const FCollisionLayerMask LayerMask, FCollisionRayHit& OutHit) const;
+	void RaycastAll(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, const FCollisionLayerMask LayerMask, CArray<FCollisionRayHit>& OutHits) const;
+	void FindNearest(const FVector2D<int>& InLocation, const int32 MaxCount, const float MaxDistance, const FCollisionLayerMask LayerMask, CArray<FCollisionNearestResult>& OutResults) const;
+
+	/** @returns spatial queries or nullptr before subsystem is initialized */
+	NO_DISCARD const FCollisionQuery* GetCollisionQuery() const { return CollisionQuery.get(); }
+
+	/**
+	 * Finds first enabled collision overlapping circle for which Predicate(FCollisionBase*) returns true.
+	 * Nothing is allocated (after first call), so it is cheap enough for many small objects like projectiles.
+	 * @returns collision or nullptr
+	 */
+	template<typename TPredicate>
+	FCollisionBase* FindFirstCollisionOverlappingCircle(const FVector2D<int>& InLocation, const int InRadius, TPredicate&& Predicate) const
+	{
+		if (Broadphase == nullptr)
+		{
+			return nullptr;
+		}
+
+		const FCollisionAABB CircleBounds(
+			FVector2D<float>(static_cast<float>(InLocation.X - InRadius), static_cast<float>(InLocation.Y - InRadius)),
+			FVector2D<float>(static_cast<float>(InLocation.X + InRadius), static_cast<float>(InLocation.Y + InRadius))
+		);
+
+		QueryProxyIdsCache.Clear();
+		Broadphase->Query(CircleBounds, QueryProxyIdsCache);
+
+		for (const FBroadphaseProxyId ProxyId : QueryProxyIdsCache)
+		{
+			FCollisionBase* Collision = Broadphase->GetCollision(ProxyId);
+
+			if (IsCollisionEnabled(Collision) && Predicate(Collision) && FCollisionQuery::IsCircleOverlapping(InLocation, InRadius, Collision))
+			{
+				return Collision;
+			}
+		}
+
+		return nullptr;
+	}
+
+protected:
+	void LoadSettings();
+	void LoadCollisionLayers();
+	void CreateBroadphase();
+
+	void AddToBroadphase(FCollisionBase* InCollision);
+
+	/** Updates contacts of moved objects and begins contacts for new pairs found by broadphase */
+	void UpdateCollisionPairs();
+
+	static bool IsCollisionEnabled(const FCollisionBase* InCollision);
+
+	/** Handle collision custom types, called from worker threads of narrowphase */
 	virtual bool IsIntersectingCustomTypes(FCollisionBase* CollisionA, FCollisionBase* CollisionB);
 
 	/** Handle collision custom types */
-	virtual CArray<FCollisionTile*> GetTilesIntersectingCustomType(FCollisionBase* Collision);
+	virtual FCollisionAABB GetCustomTypeBounds(FCollisionBase* InCollision) const;
+
+	/** Callbacks might end contact (for example by unregistering collision), remaining callbacks of ended contact are skipped */
+	void BeginContact(const uint64 ContactKey, FCollisionBase* CollisionA, FCollisionBase* CollisionB);
+	void StayContact(const uint64 ContactKey);
+
+	/** Removes contact from cache and calls end */
+	void EndContact(const uint64 ContactKey);
+
+	/** Ends all contacts of collision */
+	void EndAllContacts(FCollisionBase* InCollision);
 
-	void OnCollisionBegin(FCollisionBase* CollisionA, FCollisionBase* CollisionB);
-	void OnCollisionEnd(FCollisionBase* InCollision);
+	static uint64 GetContactKey(const FCollisionBase* CollisionA, const FCollisionBase* CollisionB);
 
 private:
-	/** Circle collision array */
-	CArray<FCollisionBase*> AllCollisionArray;
+	/** Finds pairs, created in InitializeSubSystem */
+	std::shared_ptr<ICollisionBroadphaseInterface> Broadphase;
 
-	/** Collision tiles */
-	CArray<FCollisionMeshRow*> CollisionRows;
+	ECollisionBroadphaseType BroadphaseType;
 
-	/** Collision waiting for collision mesh to be built */
-	CArray<FCollisionBase*> CollisionWaitingForAddArray;
+	/** Pairs from last broadphase update, kept to reuse memory */
+	CArray<FBroadphasePair> BroadphasePairs;
 
-	/** Collision waiting for collision mesh to be built */
-	CArray<FCollisionBase*> CollisionWaitingForRemovalArray;
+	/** Spatial queries over Broadphase, created with it */
+	std::shared_ptr<FCollisionQuery> CollisionQuery;
 
-	/** Collision of single tile */
-	FVector2D<int> CollisionTileSize;
+	/** Checks exact shapes, created in InitializeSubSystem */
+	std::shared_ptr<FCollisionNarrowphase> Narrowphase;
+
+	/** Pairs for narrowphase, existing contacts first then new pairs from broadphase */
+	CArray<FCollisionNarrowphasePair> NarrowphasePairs;
+
+	/** Contact key of each pair in NarrowphasePairs */
+	CArray<uint64> NarrowphasePairKeys;
+
+	/** Number of existing contacts at start of NarrowphasePairs */
+	int32 NumberOfContactNarrowphasePairs;
 
-	/** Size of map in pixels for async work */
-	FVector2D<int> MapSizeInPixelsCache;
+	/** Result of narrowphase, indexes in NarrowphasePairs */
+	CArray<int32> IntersectingPairIndexes;
 
-	/** Called when collision is created */
-	FDelegateSafe<void> OnCollisionTilesCreated;
+	/** Contacts of moved objects with disabled or filtered out collision */
+	CArray<uint64> DisabledContactKeys;
 
-	/** True if collision tiles are ready */
-	bool bIsCollisionReady;
+	/** Intersecting pairs, key from FBroadphasePair::GetKey */
+	CUnorderedMap<uint64, FCollisionContact> ContactCache;
+
+	/** Incremented on each TickSubSystem */
+	uint64 CollisionTick;
+
+	/** Objects moved since last UpdateCollisionPairs */
+	CArray<FCollisionBase*> MovedCollisions;
+
+	/** Collision registered before broadphase was created */
+	CArray<FCollisionBase*> CollisionWaitingForAddArray;
+
+	/** Size of grid cell for grid broadphase */
+	FVector2D<int> CollisionTileSize;
+
+	/** Filter of each layer by name, from CollisionSettings.ini */
+	CUnorderedMap<std::string, FCollisionFilter> CollisionLayerFilters;
+
+	/** Margin of fat bounds for AABB tree broadphase */
+	float AABBTreeFatMargin;
 
 	/** If true debug will be enabled on manager and components */
 	bool bIsDebugEnabled;
@@ -108,9 +235,18 @@ private:
 	/** ini with settings for collision */
 	std::shared_ptr<FIniObject> EngineCollisionSettingsIniObject;
 
+	/** Layer used when CollisionSettings.ini has no layers */
+	static constexpr const char* DefaultCollisionLayerName = "Default";
+
+	/** Layers are bits of FCollisionLayerMask */
+	static constexpr int32 MaxNumberOfCollisionLayers = 32;
+
+	/** Used by FindFirstCollisionOverlappingCircle */
+	mutable CArray<FBroadphaseProxyId> QueryProxyIdsCache;
+
 };
 
-class FCollisionGlobals
+class ENGINE_API FCollisionGlobals
 {
 public:
 	static bool RectanglesIntersect(const FRectangleWithDiagonal& RectangleA, const FRectangleWithDiagonal& RectangleB);
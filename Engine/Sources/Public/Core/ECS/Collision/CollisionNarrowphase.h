@@ -0,0 +1,194 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECS/Collision/CollisionKernels.h"
+#include "Threads/TaskGraph.h"
+
+class FCollisionBase;
+class FThreadsManager;
+
+/** Pair of collision objects to check in narrowphase */
+struct FCollisionNarrowphasePair
+{
+	FCollisionNarrowphasePair()
+		: CollisionA(nullptr)
+		, CollisionB(nullptr)
+	{
+	}
+
+	FCollisionNarrowphasePair(FCollisionBase* InCollisionA, FCollisionBase* InCollisionB)
+		: CollisionA(InCollisionA)
+		, CollisionB(InCollisionB)
+	{
+	}
+
+	FCollisionBase* CollisionA;
+	FCollisionBase* CollisionB;
+};
+
+/** Result of pair in FCollisionNarrowphaseBatchData */
+enum class ECollisionNarrowphasePairResult : uint8
+{
+	NotIntersecting,
+	Intersecting,
+	/** Custom collision type, checked by callback */
+	Unchecked
+};
+
+/** Shapes of one batch of pairs grouped by types for FCollisionKernels, each batch has its own so workers do not share memory */
+struct FCollisionNarrowphaseBatchData
+{
+	void Clear();
+
+	FCollisionCircleBatch CirclesA;
+	FCollisionCircleBatch CirclesB;
+	CArray<int32> CirclePairIndexes;
+
+	FCollisionCircleBatch MixedCircles;
+	FCollisionRectangleBatch MixedRectangles;
+	CArray<int32> MixedPairIndexes;
+
+	FCollisionRectangleBatch RectanglesA;
+	FCollisionRectangleBatch RectanglesB;
+	CArray<int32> RectanglePairIndexes;
+
+	CArray<uint8> KernelResults;
+
+	/** Result of each pair in batch, indexed from first pair of batch */
+	CArray<ECollisionNarrowphasePairResult> PairResults;
+
+	/** Indexes of intersecting pairs of batch */
+	CArray<int32> IntersectingPairIndexes;
+};
+
+/**
+ * Narrowphase checks exact shapes of pairs found by broadphase.
+ * Many pairs are split into batches executed on workers of FThreadsManager, each batch writes indexes of intersecting pairs into its own buffer.
+ * Buffers are merged in batch order, so result is always same as from serial check.
+ */
+class ENGINE_API FCollisionNarrowphase
+{
+public:
+	/** @param InThreadsManager used for parallel checks, nullptr to always check on calling thread */
+	FCollisionNarrowphase(FThreadsManager* InThreadsManager);
+
+	/**
+	 * Calls IsPairIntersecting(FCollisionBase*, FCollisionBase*) for each pair, it must be thread safe.
+	 * OutIntersectingPairIndexes is filled with sorted indexes of intersecting pairs.
+	 */
+	template<typename TFunction>
+	void FindIntersectingPairs(const CArray<FCollisionNarrowphasePair>& InPairs, TFunction&& IsPairIntersecting, CArray<int32>& OutIntersectingPairIndexes)
+	{
+		CheckPairRanges(InPairs.Size(), [&](const int32 FirstPairIndex, const int32 EndPairIndex, FCollisionNarrowphaseBatchData& /*BatchData*/, CArray<int32>& OutIndexes)
+		{
+			for (int32 PairIndex = FirstPairIndex; PairIndex < EndPairIndex; PairIndex++)
+			{
+				if (IsPairIntersecting(InPairs[PairIndex].CollisionA, InPairs[PairIndex].CollisionB))
+				{
+					OutIndexes.Push(PairIndex);
+				}
+			}
+		}, OutIntersectingPairIndexes);
+	}
+
+	/**
+	 * Same result as FindIntersectingPairs with IsIntersecting, but circles and squares are checked by FCollisionKernels in batches grouped by types of pair.
+	 * IsCustomPairIntersecting(FCollisionBase*, FCollisionBase*) is called only for pairs with custom type, it must be thread safe.
+	 */
+	template<typename TFunction>
+	void FindIntersectingShapes(const CArray<FCollisionNarrowphasePair>& InPairs, TFunction&& IsCustomPairIntersecting, CArray<int32>& OutIntersectingPairIndexes)
+	{
+		CheckPairRanges(InPairs.Size(), [&](const int32 FirstPairIndex, const int32 EndPairIndex, FCollisionNarrowphaseBatchData& BatchData, CArray<int32>& OutIndexes)
+		{
+			// Serial range is split too, so shapes of batch stay in cache between gathering and kernels
+			for (int32 FirstChunkPairIndex = FirstPairIndex; FirstChunkPairIndex < EndPairIndex; FirstChunkPairIndex += PairsPerBatch)
+			{
+				const int32 EndChunkPairIndex = FMath::Min(FirstChunkPairIndex + PairsPerBatch, EndPairIndex);
+
+				CheckShapesWithKernels(InPairs, FirstChunkPairIndex, EndChunkPairIndex, BatchData);
+
+				for (int32 PairIndex = FirstChunkPairIndex; PairIndex < EndChunkPairIndex; PairIndex++)
+				{
+					const ECollisionNarrowphasePairResult PairResult = BatchData.PairResults[PairIndex - FirstChunkPairIndex];
+
+					if (PairResult == ECollisionNarrowphasePairResult::Intersecting ||
+						(PairResult == ECollisionNarrowphasePairResult::Unchecked && IsCustomPairIntersecting(InPairs[PairIndex].CollisionA, InPairs[PairIndex].CollisionB)))
+					{
+						OutIndexes.Push(PairIndex);
+					}
+				}
+			}
+		}, OutIntersectingPairIndexes);
+	}
+
+	/** Exact check of circles and squares, custom types are not supported */
+	static bool IsIntersecting(FCollisionBase* CollisionA, FCollisionBase* CollisionB);
+
+	/** Less pairs are checked on calling thread, as starting workers costs more than checks */
+	void SetMinPairsForParallel(const int32 InMinPairsForParallel) { MinPairsForParallel = InMinPairsForParallel; }
+	NO_DISCARD int32 GetMinPairsForParallel() const { return MinPairsForParallel; }
+
+	static constexpr int32 DefaultMinPairsForParallel = 1024;
+	static constexpr int32 PairsPerBatch = 256;
+
+protected:
+	/** Calls CheckRange(FirstPairIndex, EndPairIndex, BatchData, OutIndexes) on calling thread or for each batch on workers and merges indexes */
+	template<typename TFunction>
+	void CheckPairRanges(const int32 NumberOfPairs, TFunction&& CheckRange, CArray<int32>& OutIntersectingPairIndexes)
+	{
+		OutIntersectingPairIndexes.Clear();
+
+		if (TaskGraph == nullptr || NumberOfPairs < MinPairsForParallel)
+		{
+			CheckRange(0, NumberOfPairs, SerialBatchData, OutIntersectingPairIndexes);
+
+			return;
+		}
+
+		const int32 NumberOfBatches = (NumberOfPairs + PairsPerBatch - 1) / PairsPerBatch;
+		if (static_cast<int32>(BatchesData.size()) < NumberOfBatches)
+		{
+			BatchesData.resize(NumberOfBatches);
+		}
+
+		TaskGraph->ParallelFor(NumberOfBatches, [&](const int32 BatchIndex)
+		{
+			FCollisionNarrowphaseBatchData& BatchData = BatchesData[BatchIndex];
+			BatchData.IntersectingPairIndexes.Clear();
+
+			const int32 FirstPairIndex = BatchIndex * PairsPerBatch;
+			const int32 EndPairIndex = FMath::Min(FirstPairIndex + PairsPerBatch, NumberOfPairs);
+
+			CheckRange(FirstPairIndex, EndPairIndex, BatchData, BatchData.IntersectingPairIndexes);
+		});
+
+		// Batches cover increasing ranges, so merged indexes are sorted
+		for (int32 BatchIndex = 0; BatchIndex < NumberOfBatches; BatchIndex++)
+		{
+			const std::vector<int32>& BatchIndexes = BatchesData[BatchIndex].IntersectingPairIndexes.Vector;
+
+			OutIntersectingPairIndexes.Vector.insert(OutIntersectingPairIndexes.Vector.end(), BatchIndexes.begin(), BatchIndexes.end());
+		}
+	}
+
+	/**
+	 * Fills PairResults of batch data for pairs in range.
+	 * Pairs too far or too big for exact float test are checked by IsIntersecting, custom types are left unchecked.
+	 */
+	static void CheckShapesWithKernels(const CArray<FCollisionNarrowphasePair>& InPairs, const int32 FirstPairIndex, const int32 EndPairIndex, FCollisionNarrowphaseBatchData& BatchData);
+
+protected:
+	/** nullptr if created without threads manager */
+	std::shared_ptr<FTaskGraph> TaskGraph;
+
+	/** Data of each batch, kept to reuse memory */
+	std::vector<FCollisionNarrowphaseBatchData> BatchesData;
+
+	/** Data used when pairs are checked on calling thread */
+	FCollisionNarrowphaseBatchData SerialBatchData;
+
+	int32 MinPairsForParallel;
+
+};
@@ -0,0 +1,136 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECS/Collision/BaseCollision.h"
+#include "ECS/Collision/CollisionKernels.h"
+
+class ICollisionBroadphaseInterface;
+struct FRectangleWithDiagonal;
+
+/** Selects collision objects returned by spatial queries */
+struct ENGINE_API FCollisionQueryFilter
+{
+	FCollisionQueryFilter(const FCollisionLayerMask InLayerMask = FCollisionFilter::AllLayers)
+		: LayerMask(InLayerMask)
+	{
+	}
+
+	/** @returns true if collision is in any layer of mask and its collision is enabled */
+	NO_DISCARD bool IsPassing(const FCollisionBase* InCollision) const;
+
+	FCollisionLayerMask LayerMask;
+};
+
+/** Collision object crossed by ray */
+struct ENGINE_API FCollisionRayHit
+{
+	FCollisionRayHit()
+		: Collision(nullptr)
+		, Fraction(0.f)
+	{
+	}
+
+	FCollisionBase* Collision;
+
+	/** Fraction of ray (0-1) where it enters collision, 0 if ray starts inside */
+	float Fraction;
+
+	FVector2D<float> Location;
+};
+
+/** Collision object found by nearest query */
+struct ENGINE_API FCollisionNearestResult
+{
+	FCollisionNearestResult()
+		: Collision(nullptr)
+		, Distance(0.f)
+	{
+	}
+
+	FCollisionNearestResult(FCollisionBase* InCollision, const float InDistance)
+		: Collision(InCollision)
+		, Distance(InDistance)
+	{
+	}
+
+	FCollisionBase* Collision;
+
+	/** Distance from query location to shape, 0 if location is inside */
+	float Distance;
+};
+
+/**
+ * Spatial queries answered from broadphase, so cost depends on number of objects near query, not on number of all objects.
+ * Results are written into caller buffers which are cleared first, nothing is allocated once buffers are big enough.
+ * Exact shapes of circles and squares are checked, overlaps by FCollisionKernels, custom collision types are not supported.
+ * Not thread safe.
+ */
+class ENGINE_API FCollisionQuery
+{
+public:
+	FCollisionQuery(const ICollisionBroadphaseInterface* InBroadphase);
+
+	/** Finds collisions overlapping circle */
+	void OverlapCircle(const FVector2D<int>& InLocation, const int InRadius, const FCollisionQueryFilter& InFilter, CArray<FCollisionBase*>& OutCollisions) const;
+
+	/** Finds collisions overlapping rectangle, for example box selection */
+	void OverlapRectangle(const FVector2D<int>& InTopLeft, const FVector2D<int>& InSize, const FCollisionQueryFilter& InFilter, CArray<FCollisionBase*>& OutCollisions) const;
+
+	/**
+	 * Finds first collision crossed by segment from start to end
+	 * @returns true if anything was hit
+	 */
+	bool RaycastFirst(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, const FCollisionQueryFilter& InFilter, FCollisionRayHit& OutHit) const;
+
+	/** Finds all collisions crossed by segment from start to end, sorted from closest to start */
+	void RaycastAll(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, const FCollisionQueryFilter& InFilter, CArray<FCollisionRayHit>& OutHits) const;
+
+	/**
+	 * Finds up to MaxCount collisions closest to location, not further than MaxDistance, sorted from closest.
+	 * Search area starts small and is doubled until enough collisions are found.
+	 */
+	void FindNearest(const FVector2D<int>& InLocation, const int32 MaxCount, const float MaxDistance, const FCollisionQueryFilter& InFilter, CArray<FCollisionNearestResult>& OutResults) const;
+
+	static bool IsCircleOverlapping(const FVector2D<int>& InLocation, const int InRadius, FCollisionBase* InCollision);
+	static bool IsRectangleOverlapping(const FRectangleWithDiagonal& InRectangle, FCollisionBase* InCollision);
+
+	/** @returns true if segment crosses collision, OutFraction is set to fraction where it enters */
+	static bool RaycastCollision(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, FCollisionBase* InCollision, float& OutFraction);
+
+	/** @returns distance from location to shape of collision, 0 if inside, negative for unsupported types */
+	static float GetDistanceToCollision(const FVector2D<int>& InLocation, FCollisionBase* InCollision);
+
+	/** First search radius of FindNearest */
+	static constexpr float InitialNearestSearchRadius = 64.f;
+
+protected:
+	/** Clears candidates of overlap query */
+	void ClearCandidates() const;
+
+	/** @returns index of candidate, its result is false until set */
+	int32 AddCandidate(FCollisionBase* InCollision) const;
+
+	/** Copies results of kernel for candidates at indexes */
+	void StoreKernelResults(const CArray<int32>& InCandidateIndexes) const;
+
+	/** Pushes overlapping candidates in order they were added */
+	void PushOverlappingCandidates(CArray<FCollisionBase*>& OutCollisions) const;
+
+protected:
+	const ICollisionBroadphaseInterface* Broadphase;
+
+	/** Reused by queries to avoid allocations */
+	mutable CArray<FBroadphaseProxyId> ProxyIdsCache;
+
+	/** Candidates of overlap queries, shapes near query are checked in batches by FCollisionKernels */
+	mutable CArray<FCollisionBase*> CandidatesCache;
+	mutable CArray<uint8> CandidateResultsCache;
+	mutable FCollisionCircleBatch CircleCandidatesCache;
+	mutable CArray<int32> CircleCandidateIndexesCache;
+	mutable FCollisionRectangleBatch RectangleCandidatesCache;
+	mutable CArray<int32> RectangleCandidateIndexesCache;
+	mutable CArray<uint8> KernelResultsCache;
+
+};
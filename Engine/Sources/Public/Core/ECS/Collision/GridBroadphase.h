@@ -0,0 +1,113 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CollisionBroadphase.h"
+
+#include <vector>
+
+/**
+ * Uniform grid broadphase, proxy is stored in every cell its bounds cover.
+ * Cheap for many similar objects, big objects are stored in many cells.
+ * Objects outside of world size are kept in border cells.
+ */
+class ENGINE_API FGridBroadphase : public ICollisionBroadphaseInterface
+{
+public:
+	FGridBroadphase(const FVector2D<int>& InCellSize, const FVector2D<int>& InWorldSize);
+
+	/** Begin ICollisionBroadphaseInterface */
+	FBroadphaseProxyId CreateProxy(const FCollisionAABB& InBounds, FCollisionBase* InCollision, const FCollisionFilter& InFilter = FCollisionFilter()) override;
+	void DestroyProxy(const FBroadphaseProxyId ProxyId) override;
+	void SetProxyFilter(const FBroadphaseProxyId ProxyId, const FCollisionFilter& InFilter) override;
+	void MoveProxy(const FBroadphaseProxyId ProxyId, const FCollisionAABB& InBounds) override;
+	NO_DISCARD FCollisionBase* GetCollision(const FBroadphaseProxyId ProxyId) const override;
+	void Query(const FCollisionAABB& InBounds, CArray<FBroadphaseProxyId>& OutProxyIds) const override;
+	void QuerySegment(const FVector2D<float>& InStart, const FVector2D<float>& InEnd, CArray<FBroadphaseProxyId>& OutProxyIds) const override;
+	void UpdatePairs(CArray<FBroadphasePair>& OutPairs) override;
+	NO_DISCARD int32 GetNumberOfProxies() const override { return NumberOfProxies; }
+	void DebugRender(const FRenderer* Renderer) const override;
+	/** End ICollisionBroadphaseInterface */
+
+	NO_DISCARD const FVector2D<int>& GetCellSize() const { return CellSize; }
+
+protected:
+	struct FGridProxy
+	{
+		FCollisionAABB Bounds;
+
+		FCollisionBase* Collision;
+
+		FCollisionFilter Filter;
+
+		/** Range of cells (inclusive) containing this proxy */
+		int32 MinCellX;
+		int32 MinCellY;
+		int32 MaxCellX;
+		int32 MaxCellY;
+
+		bool bIsUsed;
+
+		/** True if in MovedProxies */
+		bool bIsMoved;
+	};
+
+	/** Calculate range of cells covered by bounds, clamped to grid */
+	void GetCellRange(const FCollisionAABB& InBounds, int32& OutMinCellX, int32& OutMinCellY, int32& OutMaxCellX, int32& OutMaxCellY) const;
+
+	void AddToCells(const FBroadphaseProxyId ProxyId);
+	void RemoveFromCells(const FBroadphaseProxyId ProxyId);
+
+	void MarkMoved(const FBroadphaseProxyId ProxyId);
+
+	template<typename TFunction>
+	void QueryInternal(const FCollisionAABB& InBounds, TFunction&& Function) const
+	{
+		int32 MinCellX, MinCellY, MaxCellX, MaxCellY;
+		GetCellRange(InBounds, MinCellX, MinCellY, MaxCellX, MaxCellY);
+
+		// Proxy can be in many cells, stamp is used to report it once
+		CurrentQueryStamp++;
+
+		for (int32 CellY = MinCellY; CellY <= MaxCellY; CellY++)
+		{
+			for (int32 CellX = MinCellX; CellX <= MaxCellX; CellX++)
+			{
+				for (const FBroadphaseProxyId ProxyId : Cells[CellY * NumberOfCellsX + CellX])
+				{
+					if (ProxyQueryStamps[ProxyId] != CurrentQueryStamp)
+					{
+						ProxyQueryStamps[ProxyId] = CurrentQueryStamp;
+
+						if (Proxies[ProxyId].Bounds.Overlaps(InBounds))
+						{
+							Function(ProxyId);
+						}
+					}
+				}
+			}
+		}
+	}
+
+protected:
+	std::vector<FGridProxy> Proxies;
+	std::vector<FBroadphaseProxyId> FreeProxyIds;
+
+	/** Proxy ids in each cell, row by row */
+	std::vector<CArray<FBroadphaseProxyId>> Cells;
+
+	FVector2D<int> CellSize;
+
+	int32 NumberOfCellsX;
+	int32 NumberOfCellsY;
+
+	int32 NumberOfProxies;
+
+	/** Proxies created or moved since last UpdatePairs */
+	CArray<FBroadphaseProxyId> MovedProxies;
+
+	/** Last query which reported proxy */
+	mutable std::vector<uint32> ProxyQueryStamps;
+	mutable uint32 CurrentQueryStamp;
+
+};
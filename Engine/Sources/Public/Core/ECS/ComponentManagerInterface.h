@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "ComponentTypeId.h"
+
 class UBaseComponent;
 
 class ENGINE_API IComponentManagerInterface
@@ -18,6 +20,13 @@ public:
 
 		ComponentsMap.Emplace(ComponentName, NewComponent);
 
+		// First component of each exact type is found by GetComponentByClass without casting
+		const FComponentTypeId TypeId = FComponentTypeIdGenerator::Get<TComponentClass>();
+		if (!ComponentsByTypeId.ContainsKey(TypeId))
+		{
+			ComponentsByTypeId.Emplace(TypeId, NewComponent.get());
+		}
+
 		if (bShouldCallBeginPlayOnNewComponents)
 		{
 			NewComponent.get()->BeginPlay();
@@ -55,10 +64,16 @@ public:
 		return nullptr;
 	}
 
-	/** Another way of getting component, still try to avoid calling it often. */
+	/** Another way of getting component. Exact class is found by type id, base classes and sub components fall back to dynamic_cast scan. */
 	template<typename TComponentClass>
 	TComponentClass* GetComponentByClass()
 	{
+		const FComponentTypeId TypeId = FComponentTypeIdGenerator::Get<TComponentClass>();
+		if (ComponentsByTypeId.ContainsKey(TypeId))
+		{
+			return static_cast<TComponentClass*>(ComponentsByTypeId[TypeId]);
+		}
+
 		for (std::pair<const std::string, std::shared_ptr<UBaseComponent>>& ComponentPair : ComponentsMap)
 		{
 			TComponentClass* ComponentCasted = dynamic_cast<TComponentClass*>(ComponentPair.second.get());
@@ -109,12 +124,18 @@ public:
 	void Cleanup();
 
 protected:
+	/** Removes component from ComponentsByTypeId */
+	void RemoveComponentFromTypeIdLookup(const UBaseComponent* Component);
+
 	/** Parent pointer - might be null! @see bool bDoesHaveComponentManagerInterfaceParent */
 	IComponentManagerInterface* ComponentManagerInterfaceParent;
 
 	/** Components accessible by strings passed when creating components which are component names. */
 	CUnorderedMap<std::string, std::shared_ptr<UBaseComponent>> ComponentsMap;
 
+	/** Components by FComponentTypeId of class used to create them, see GetComponentByClass */
+	CUnorderedMap<FComponentTypeId, UBaseComponent*> ComponentsByTypeId;
+
 	/** Cached in constructor (ComponentManagerInterfaceParent != nullptr) */
 	bool bDoesHaveComponentManagerInterfaceParent;
 
@@ -0,0 +1,193 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SparseSet.h"
+#include "ComponentTypeId.h"
+
+/** Index of entity inside of FComponentStorage */
+typedef int32 FStorageEntityId;
+
+/** Type erased pool, used by FComponentStorage to remove components of destroyed entities */
+class IComponentPoolInterface
+{
+public:
+	virtual ~IComponentPoolInterface() = default;
+
+	virtual bool RemoveComponent(const FStorageEntityId EntityId) = 0;
+	NO_DISCARD virtual bool HasComponent(const FStorageEntityId EntityId) const = 0;
+	NO_DISCARD virtual ContainerInt GetNumberOfComponents() const = 0;
+
+	virtual void Clear() = 0;
+
+};
+
+/** All components of single type stored contiguously */
+template<typename TComponentClass>
+class FComponentPool : public IComponentPoolInterface
+{
+public:
+	/** Begin IComponentPoolInterface interface */
+	bool RemoveComponent(const FStorageEntityId EntityId) override
+	{
+		return Components.Remove(EntityId);
+	}
+	NO_DISCARD bool HasComponent(const FStorageEntityId EntityId) const override
+	{
+		return Components.Contains(EntityId);
+	}
+	NO_DISCARD ContainerInt GetNumberOfComponents() const override
+	{
+		return Components.Size();
+	}
+	void Clear() override
+	{
+		Components.Clear();
+	}
+	/** End IComponentPoolInterface interface */
+
+	template<typename... TInParams>
+	TComponentClass& AddComponent(const FStorageEntityId EntityId, TInParams&&... InParams)
+	{
+		return Components.Add(EntityId, std::forward<TInParams>(InParams)...);
+	}
+
+	NO_DISCARD TComponentClass* GetComponent(const FStorageEntityId EntityId)
+	{
+		return Components.Find(EntityId);
+	}
+
+	/** @returns packed components, use GetKeyAt to get entity of component */
+	CSparseSet<TComponentClass>& GetComponents() { return Components; }
+
+protected:
+	CSparseSet<TComponentClass> Components;
+
+};
+
+/**
+ * Optional structure of arrays component storage owned by FEntityManager.
+ * Components here are plain data (no virtual Tick), same types live contiguously and are updated in batches by FEntitySystem.
+ * It is separate from UBaseComponent hierarchy, entities can use both. See EEntity::AddStoredComponent.
+ * Not thread safe, use from game thread (or from ParallelFor in systems for read / per element write).
+ */
+class ENGINE_API FComponentStorage
+{
+public:
+	FComponentStorage();
+	~FComponentStorage();
+
+	/** @returns id of new entity, ids of destroyed entities are reused */
+	FStorageEntityId CreateEntity();
+
+	/** Removes all components of entity and releases id */
+	void DestroyEntity(const FStorageEntityId EntityId);
+
+	NO_DISCARD bool IsEntityValid(const FStorageEntityId EntityId) const;
+
+	NO_DISCARD int32 GetNumberOfEntities() const { return NumberOfEntities; }
+
+	/** Add (or replace) component of entity, constructed from InParams */
+	template<typename TComponentClass, typename... TInParams>
+	TComponentClass& AddComponent(const FStorageEntityId EntityId, TInParams&&... InParams)
+	{
+		return GetPool<TComponentClass>().AddComponent(EntityId, std::forward<TInParams>(InParams)...);
+	}
+
+	template<typename TComponentClass>
+	bool RemoveComponent(const FStorageEntityId EntityId)
+	{
+		IComponentPoolInterface* Pool = FindPool(FComponentTypeIdGenerator::Get<TComponentClass>());
+
+		return (Pool != nullptr && Pool->RemoveComponent(EntityId));
+	}
+
+	/** @returns component or nullptr if entity does not have it. Pointer is invalidated when components of this type are added or removed. */
+	template<typename TComponentClass>
+	NO_DISCARD TComponentClass* GetComponent(const FStorageEntityId EntityId)
+	{
+		IComponentPoolInterface* Pool = FindPool(FComponentTypeIdGenerator::Get<TComponentClass>());
+
+		return (Pool != nullptr) ? static_cast<FComponentPool<TComponentClass>*>(Pool)->GetComponent(EntityId) : nullptr;
+	}
+
+	template<typename TComponentClass>
+	NO_DISCARD bool HasComponent(const FStorageEntityId EntityId)
+	{
+		IComponentPoolInterface* Pool = FindPool(FComponentTypeIdGenerator::Get<TComponentClass>());
+
+		return (Pool != nullptr && Pool->HasComponent(EntityId));
+	}
+
+	/** @returns pool for given type, created if missing */
+	template<typename TComponentClass>
+	FComponentPool<TComponentClass>& GetPool()
+	{
+		const FComponentTypeId TypeId = FComponentTypeIdGenerator::Get<TComponentClass>();
+
+		if (TypeId >= Pools.Size())
+		{
+			Pools.SetNum(TypeId + 1);
+		}
+
+		std::shared_ptr<IComponentPoolInterface>& Pool = Pools.Vector[TypeId];
+		if (Pool == nullptr)
+		{
+			Pool = std::make_shared<FComponentPool<TComponentClass>>();
+		}
+
+		return *static_cast<FComponentPool<TComponentClass>*>(Pool.get());
+	}
+
+	/**
+	 * Calls Function(EntityId, TFirstComponent&, TOtherComponents&...) for each entity having all given components.
+	 * Iterates packed array of TFirstComponent, so put least common component first.
+	 * Adding or removing components of iterated types inside of Function is not allowed.
+	 */
+	template<typename TFirstComponent, typename... TOtherComponents, typename TFunction>
+	void ForEach(TFunction&& Function)
+	{
+		CSparseSet<TFirstComponent>& FirstComponents = GetPool<TFirstComponent>().GetComponents();
+
+		// Pools are resolved once, so loop only does sparse lookups
+		std::tuple<FComponentPool<TOtherComponents>&...> OtherPools(GetPool<TOtherComponents>()...);
+
+		const ContainerInt NumberOfComponents = FirstComponents.Size();
+		for (ContainerInt i = 0; i < NumberOfComponents; i++)
+		{
+			const FStorageEntityId EntityId = FirstComponents.GetKeyAt(i);
+
+			std::tuple<TOtherComponents*...> OtherComponents(std::get<FComponentPool<TOtherComponents>&>(OtherPools).GetComponent(EntityId)...);
+
+			// Skip entities without all components
+			if (((std::get<TOtherComponents*>(OtherComponents) != nullptr) && ...))
+			{
+				Function(EntityId, FirstComponents.GetValueAt(i), *std::get<TOtherComponents*>(OtherComponents)...);
+			}
+		}
+	}
+
+	/** Removes all entities and components */
+	void Clear();
+
+protected:
+	/** @returns pool or nullptr if no component of this type was added yet */
+	NO_DISCARD IComponentPoolInterface* FindPool(const FComponentTypeId TypeId) const
+	{
+		return (TypeId < Pools.Size()) ? Pools.Vector[TypeId].get() : nullptr;
+	}
+
+protected:
+	/** Pools indexed by FComponentTypeId, nullptr for types not used by this storage */
+	CArray<std::shared_ptr<IComponentPoolInterface>> Pools;
+
+	/** True for each id which is used by entity */
+	std::vector<bool> EntitiesAlive;
+
+	/** Ids released by DestroyEntity */
+	CArray<FStorageEntityId> FreeEntityIds;
+
+	int32 NumberOfEntities;
+
+};
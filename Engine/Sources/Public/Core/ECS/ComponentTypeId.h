@@ -0,0 +1,29 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+/** Index of component type, see FComponentTypeIdGenerator */
+typedef int32 FComponentTypeId;
+
+/**
+ * Gives each component type unique sequential id without strings or RTTI.
+ * Id is assigned once per type on first use and can be used as array index.
+ */
+class ENGINE_API FComponentTypeIdGenerator
+{
+public:
+	template<typename TComponentClass>
+	static FComponentTypeId Get()
+	{
+		static const FComponentTypeId TypeId = GenerateNextTypeId();
+
+		return TypeId;
+	}
+
+	/** @returns number of ids given so far */
+	NO_DISCARD static int32 GetNumberOfTypes();
+
+protected:
+	static FComponentTypeId GenerateNextTypeId();
+
+};
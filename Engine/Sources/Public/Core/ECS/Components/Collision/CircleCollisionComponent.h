@@ -21,11 +21,10 @@ public:
 	void BeginPlay() override;
 	void Render() override;
 
-	void OnLocationChanged() override;
-
 protected:
 	virtual int GetCircleRadius() const;
 	FVector2D<int> GetLocationForCollision() const override;
+	void UpdateCollisionLocation() override;
 
 private:
 	FCircleCollision* CircleCollision;
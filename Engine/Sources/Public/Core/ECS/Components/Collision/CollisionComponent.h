@@ -23,18 +23,32 @@ public:
 
 	bool IsCollisionEnabled() const { return bCollisionsEnabled; }
 
+	/** Set layer from CollisionSettings.ini for all collision objects of this component */
+	void SetCollisionLayer(const std::string& InCollisionLayerName);
+	const std::string& GetCollisionLayerName() const { return CollisionLayerName; }
+
+	/** Static collisions (for example map blockers) are never paired with other static collisions */
+	void SetCollisionStatic(const bool bInIsStatic);
+	bool IsCollisionStatic() const { return bIsCollisionStatic; }
+
 	void AddCollision(FCollisionBase* CollisionObject);
 	void RemoveCollision(FCollisionBase* CollisionObject);
 
 	/** Notify manager about changed collision */
 	void OnLocationChanged() override;
 
+	/** Use manager other than one of current map (for example without window), call before BeginPlay */
+	void SetCollisionManager(FCollisionManager* InCollisionManager);
+
 	const CArray<FCollisionBase*>& GetCollisionObjectsArray() const;
 
 	void OnCollisionBegin(UCollisionComponent* OtherCollision);
+	void OnCollisionStay(UCollisionComponent* OtherCollision);
 	void OnCollisionEnd(UCollisionComponent* OtherCollision);
 
 	FDelegate<void, UCollisionComponent*> OnCollisionEnter;
+	/** Called on collision tick when this or other component moved and they are still colliding */
+	FDelegate<void, UCollisionComponent*> OnCollisionStaying;
 	FDelegate<void, UCollisionComponent*> OnCollisionExit;
 	
 protected:
@@ -43,6 +57,15 @@ protected:
 
 	virtual FVector2D<int> GetLocationForCollision() const;
 
+	/** Move collision shapes to new absolute location, called before CollisionManager is notified */
+	virtual void UpdateCollisionLocation();
+
+	/** Send notification about changed collision objects to CollisionManager, call after collision shapes are updated */
+	void NotifyCollisionChanged();
+
+	/** Send layer and static flag of this component to CollisionManager */
+	void UpdateCollisionFilter(FCollisionBase* CollisionObject);
+
 #if _DEBUG
 	static FColorRGBA GetCollisionDebugColor();
 #endif
@@ -63,4 +86,10 @@ private:
 
 	/** See bool above */
 	bool bCollisionsEnabledInitial;
+
+	/** Static collision is not paired with other static collisions */
+	bool bIsCollisionStatic;
+
+	/** Layer of collision objects from CollisionSettings.ini */
+	std::string CollisionLayerName;
 };
@@ -21,11 +21,12 @@ public:
 	void BeginPlay() override;
 	void Render() override;
 
-	void OnLocationChanged() override;
 	void OnRotationChanged() override;
 	void OnSizeChanged() override;
 
 protected:
+	void UpdateCollisionLocation() override;
+
 	FSquareCollision* SquareCollision;
 
 };
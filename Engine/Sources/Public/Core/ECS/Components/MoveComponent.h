@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECS/Component.h"
+#include "ECS/Navigation/NavigationManager.h"
 
 class UParentComponent;
 class UArrowComponent;
@@ -32,6 +33,7 @@ public:
 
 	/** Begin UComponent */
 	void BeginPlay() override;
+	void EndPlay() override;
 	void Tick(const float DeltaTime) override;
 	void Render() override;
 	/** End UComponent */
@@ -43,10 +45,28 @@ public:
 	/** Reset stop distance to default auto calculated value */
 	void ResetStoppingDistance();
 
-	/** Set where unit should go. */
+	/** Set where unit should go. Unit goes in straight line. */
 	void SetTargetMoveLocation(const FVector2D<int> NewTargetLocation);
 
-	/** Cancel moving to TargetLocation */
+	/** Set locations unit should go through, one after another. */
+	void SetMovePath(const CArray<FVector2D<int>>& InWaypoints);
+
+	/**
+	 * Unit goes to location avoiding map collision, path is found by FNavigationManager of map on worker thread.
+	 * Without FNavigationManager unit goes in straight line.
+	 */
+	void MoveToLocation(const FVector2D<int> InLocation);
+
+	/**
+	 * Unit goes to location following flow field shared with all units going to same tile, cost of each tick is constant.
+	 * Best when many units are sent to same place. Without FNavigationManager unit goes in straight line.
+	 */
+	void MoveToLocationWithFlowField(const FVector2D<int> InLocation);
+
+	/** @returns true if path was requested and result did not arrive yet */
+	bool IsWaitingForPath() const { return (PathRequestId != INDEX_NONE); }
+
+	/** Cancel moving to TargetLocation and waiting for path */
 	void AbortMovement();
 
 	void SetShouldRotateInstant(const bool bInShouldRotateInstant);
@@ -71,6 +91,30 @@ protected:
 
 	bool IsInMapBounds(const FVector2D<int>& Location) const;
 
+	/** Starts moving to given location, does not change waypoints */
+	void StartMovementToLocation(const FVector2D<int>& NewTargetLocation);
+
+	/** Goes to next waypoint or stops if it was last one */
+	void OnTargetLocationReached();
+
+	/** @returns true if TargetLocation is end of movement, not one of waypoints */
+	bool IsMovingToLastLocation() const;
+
+	/**
+	 * Sets TargetLocation to center of next tile from flow field
+	 * @returns false if movement was stopped as goal can not be reached
+	 */
+	bool UpdateFlowFieldTarget();
+
+	FNavigationManager* GetNavigationManager() const;
+	void CancelPathRequest();
+
+	/** Called on main thread when navigation finished path request */
+	void OnPathFound(const FNavigationPathResult& InResult);
+
+	/** Called when navigation could not find path */
+	virtual void OnPathNotFound();
+
 	/** Called when unit moves out of map bounds */
 	virtual void OnRequestedLocationOutOfBounds();
 
@@ -80,6 +124,17 @@ protected:
 	/** Location desired by unit. This is the place where we want to move to. */
 	FVector2D<int> TargetLocation;
 
+	/** Locations to go through, TargetLocation is one of them */
+	CArray<FVector2D<int>> MoveWaypoints;
+	int32 CurrentWaypointIndex;
+
+	/** Request of path from FNavigationManager, INDEX_NONE if not waiting */
+	FNavigationRequestId PathRequestId;
+
+	/** Flow field followed instead of waypoints, nullptr if not used */
+	std::shared_ptr<const FNavigationFlowField> FlowField;
+	FVector2D<int> FlowFieldGoalLocation;
+
 	/** If true, component owner is moving */
 	bool bIsMoving;
 
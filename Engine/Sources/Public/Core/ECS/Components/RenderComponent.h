@@ -4,6 +4,7 @@
 
 #include "ParentComponent.h"
 #include "ECS/Component.h"
+#include "ECS/Collision/CollisionBroadphase.h"
 
 enum class ERenderType : uint8
 {
@@ -33,6 +34,12 @@ public:
 	void Render() override;
 	/** End UBaseComponent */
 
+	/** Begin FTransform2DInterface */
+	void OnLocationChanged() override;
+	void OnRotationChanged() override;
+	void OnSizeChanged() override;
+	/** End FTransform2DInterface */
+
 	/** Set image from AssetCollectionItem. */
 	void SetImage(const FAssetCollectionItem& AssetCollectionItem);
 
@@ -48,11 +55,33 @@ public:
 	void SetRenderLocationType(const ERenderType InRenderType);
 	void SetRenderCenterType(const ERenderCenterType InRenderCenterType);
 
+	/** Sprites of lower layers are drawn first, see FSpriteBatch */
+	void SetRenderLayer(const int32 InRenderLayer) { RenderLayer = InRenderLayer; }
+	NO_DISCARD int32 GetRenderLayer() const { return RenderLayer; }
+
+	/** @returns area covered by sprite, rotated sprite is bounded by circle around its center of rotation */
+	NO_DISCARD FCollisionAABB GetRenderBounds() const;
+
 protected:
+	/** @returns top left corner of sprite */
+	NO_DISCARD FVector2D<int> GetRenderLocation() const;
+
+	/** @returns center of rotation relative to top left corner of sprite */
+	NO_DISCARD FVector2D<int> GetRenderCenterOfRotation() const;
+
+	/** Tell entity to update its render bounds, see FEntityRenderCulling */
+	void MarkRenderBoundsDirty() const;
+
+protected:
+	/** Entity using bounds of this component for culling, set from BeginPlay to EndPlay */
+	EEntity* OwnerEntity;
+
 	/** Image to render */
 	FTextureAsset* TextureAsset;
 
 	ERenderCenterType CurrentRenderCenterType;
 	ERenderType CurrentRenderType;
 
+	int32 RenderLayer;
+
 };
@@ -23,6 +23,7 @@ struct EProjectileMovementParams
 
 /**
  * Simple projectile component
+ * Full entity with components, for many projectiles (bullets) use FProjectileSystem instead.
  */
 class EProjectileEntity : public EEntity
 {
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 
 struct FOptionalTimerParams;
+struct FProjectileData;
+class FProjectileSystem;
 
 /**
  * Base class for weapons with some basic functionality
@@ -27,6 +29,15 @@ public:
 	float GetAttackCooldown() const { return CooldownAttackTime; }
 
 protected:
+	/**
+	 * Fire projectile into FProjectileSystem of entity manager (created on first use).
+	 * Owner and team are filled from entity this weapon is attached to (or weapon itself) when not set.
+	 * @returns false if projectile pool is full
+	 */
+	bool FireProjectile(FProjectileData InProjectileData);
+
+	FProjectileSystem* GetProjectileSystem() const;
+
 	virtual void PerformAttack();
 	void AttackCooldownFinished(FOptionalTimerParams* OptionalTimerParams);
 
@@ -6,18 +6,25 @@
 #include "Core/ECS/BaseComponent.h"
 #include "Core/ECS/ComponentAnimation.h"
 #include "Core/ECS/AI/AITree.h"
+#include "Core/ECS/ComponentStorage.h"
+#include "Core/ECS/EntityHandle.h"
+#include "Core/ECS/EntityRenderCulling.h"
 
 class FGameModeBase;
 class FWindowAdvanced;
 class FMap;
 class FGameModeManager;
 class FEntityManager;
+class URenderComponent;
 
 /**
  * Generic entity class
  */
 class ENGINE_API EEntity : public FObject, public IComponentManagerInterface
 {
+	friend FEntityManager;
+	friend FEntityRenderCulling;
+
 public:
 	EEntity(FEntityManager* InEntityManager);
 	~EEntity() override = default;
@@ -37,16 +44,39 @@ public:
 	/** Called every frame for rendering purposes */
 	virtual void Render();
 
-	/** Called every frame from engine code. */
+	/** Called every frame from engine code, only when entity is visible (see FEntityRenderCulling). */
 	void ReceiveRender();
 
+	/**
+	 * Area drawn by entity, used to skip rendering of entities outside of camera.
+	 * By default it's sum of bounds of registered render components. Override when Render draws outside of them.
+	 * @returns false if entity has no bounds, it's rendered always then
+	 */
+	virtual bool GetRenderBounds(FCollisionAABB& OutBounds) const;
+
+	/** Render bounds will be read again before next render, called by render components when they move */
+	void MarkRenderBoundsDirty();
+
+	/** Render components are registered in BeginPlay, their bounds are used by GetRenderBounds */
+	void RegisterRenderComponent(URenderComponent* InRenderComponent);
+	void UnRegisterRenderComponent(URenderComponent* InRenderComponent);
+
+	/** @returns handle which can be kept instead of pointer to this entity */
+	const FEntityHandle& GetEntityHandle() const { return EntityHandle; }
+
+	/** @returns true if FEntityManager::DestroyEntity was called, entity will be deleted at end of tick */
+	bool IsPendingDestroy() const { return bIsPendingDestroy; }
+
 	/** Tells us if we are attached to other entity */
 	bool IsAttached() const;
 	/** Removes attachment */
 	void ResetAttachment();
 	/** Attach to other entity */
 	void AttachToEntity(EEntity* InEntityToAttachTo);
-	EEntity* GetEntityAttachment() const { return EntityAttachment; }
+	/** @returns entity we are attached to or nullptr if not attached or it was destroyed */
+	EEntity* GetEntityAttachment() const { return EntityAttachment.Get(); }
+	/** @returns handle of entity we are attached to, invalid if not attached */
+	const FEntityHandle& GetEntityAttachmentHandle() const { return EntityAttachment; }
 		
 	virtual void SetRootComponent(UParentComponent* NewComponent);
 	virtual UParentComponent* GetRootComponent() const;
@@ -87,6 +117,29 @@ public:
 		return ComponentAnimationPtr;
 	}
 
+	/** Add plain data component to FComponentStorage of entity manager, it will be updated by entity systems instead of entity tick */
+	template<typename TComponentClass, typename... TInParams>
+	TComponentClass& AddStoredComponent(TInParams&&... InParams)
+	{
+		return GetComponentStorage().AddComponent<TComponentClass>(GetOrCreateStorageEntityId(), std::forward<TInParams>(InParams)...);
+	}
+
+	/** @returns stored component or nullptr. Do not keep pointer, it changes when components of same type are added or removed. */
+	template<typename TComponentClass>
+	TComponentClass* GetStoredComponent() const
+	{
+		return (StorageEntityId != INDEX_NONE) ? GetComponentStorage().GetComponent<TComponentClass>(StorageEntityId) : nullptr;
+	}
+
+	template<typename TComponentClass>
+	bool RemoveStoredComponent()
+	{
+		return (StorageEntityId != INDEX_NONE) && GetComponentStorage().RemoveComponent<TComponentClass>(StorageEntityId);
+	}
+
+	/** @returns id in FComponentStorage or INDEX_NONE if entity has no stored components */
+	FStorageEntityId GetStorageEntityId() const { return StorageEntityId; }
+
 	/** Destroy component animation */
 	void DestroyComponentAnimation(FComponentAnimation* InComponentAnimation);
 
@@ -149,6 +202,12 @@ protected:
 	void OnComponentCreated(const std::string& ComponentName, UBaseComponent* NewComponent) override;
 	/** End IComponentManagerInterface */
 
+	FComponentStorage& GetComponentStorage() const;
+	FStorageEntityId GetOrCreateStorageEntityId();
+
+	/** @returns root component of attached entity or nullptr if attached entity was destroyed */
+	UParentComponent* GetEntityAttachmentRootComponent() const;
+
 	virtual void OnAttachedToEntity();
 	virtual void OnDeAttachedFromEntity();
 
@@ -174,8 +233,14 @@ private:
 	/** Used to avoid double calling BeginPlay */
 	bool bWasBeginPlayCalled;
 
+	/** Set by FEntityManager::DestroyEntity */
+	bool bIsPendingDestroy;
+
+	/** Handle to this entity, set by FEntityManager when registered */
+	FEntityHandle EntityHandle;
+
 	/** Entity which this entity is attached to */
-	EEntity* EntityAttachment;
+	FEntityHandle EntityAttachment;
 
 	/** EntityAttachment's root component cache */
 	UParentComponent* EntityAttachmentRootComponent;
@@ -186,4 +251,13 @@ private:
 	/** Used to define relative rotation to attached entity */
 	int32 AttachmentRelativeRotation;
 
+	/** Id in FComponentStorage, created with first stored component */
+	FStorageEntityId StorageEntityId;
+
+	/** Render components which bounds are used by GetRenderBounds */
+	CArray<URenderComponent*> RegisteredRenderComponents;
+
+	/** Set by FEntityRenderCulling */
+	FEntityRenderCullingState RenderCullingState;
+
 };
@@ -0,0 +1,54 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SlotMap.h"
+
+class EEntity;
+class FEntityManager;
+
+/**
+ * Weak reference to entity, use it instead of raw EEntity* when entity can be destroyed while reference is kept.
+ * Lookup is O(1), after entity is destroyed Get() returns nullptr (even if slot was reused by new entity).
+ */
+class ENGINE_API FEntityHandle
+{
+public:
+	FEntityHandle();
+	FEntityHandle(FEntityManager* InEntityManager, const FSlotMapKey& InKey);
+
+	/** @returns entity or nullptr if entity was destroyed or handle is not set */
+	NO_DISCARD EEntity* Get() const;
+
+	/** @returns entity casted to TEntityClass or nullptr */
+	template<typename TEntityClass>
+	NO_DISCARD TEntityClass* Get() const
+	{
+		return dynamic_cast<TEntityClass*>(Get());
+	}
+
+	/** @returns true if entity still exists and is not pending destroy */
+	NO_DISCARD bool IsValid() const;
+
+	void Reset();
+
+	NO_DISCARD FEntityManager* GetEntityManager() const { return EntityManager; }
+	NO_DISCARD const FSlotMapKey& GetKey() const { return Key; }
+
+	friend bool operator==(const FEntityHandle& L, const FEntityHandle& R)
+	{
+		return (L.EntityManager == R.EntityManager && L.Key == R.Key);
+	}
+	friend bool operator!=(const FEntityHandle& L, const FEntityHandle& R)
+	{
+		return !(L == R);
+	}
+
+protected:
+	FEntityManager* EntityManager;
+
+	/** Key in entity slot map of EntityManager */
+	FSlotMapKey Key;
+
+};
@@ -4,6 +4,10 @@
 
 #include "Components/ParentComponent.h"
 #include "ECS/Entity.h"
+#include "ECS/ComponentStorage.h"
+#include "ECS/EntitySystem.h"
+#include "ECS/EntityHandle.h"
+#include "ECS/EntityRenderCulling.h"
 
 class FMap;
 
@@ -19,8 +23,13 @@ public:
 	template <typename TEntityClass>
 	void RegisterNewEntity(TEntityClass* NewEntity)
 	{
+		NewEntity->EntityHandle = FEntityHandle(this, EntitySlots.Add(NewEntity));
+
 		Entities.Push(NewEntity);
 
+		// Before BeginPlay, render components register in it
+		RenderCulling.AddEntity(NewEntity);
+
 		NewEntity->BeginPlay();
 
 		OnEntityCreated(NewEntity);
@@ -64,13 +73,33 @@ public:
 		return std::move(EntitiesCreated);
 	}
 
+	/**
+	 * Mark entity for destruction, handles to it are invalid right after this call.
+	 * Entity is skipped in tick and render, EndPlay and delete happens at end of Tick (see FlushPendingDestroyEntities).
+	 * @returns false if entity was not found or is already pending destroy
+	 */
 	bool DestroyEntity(const EEntity* Entity);
+	bool DestroyEntity(const FEntityHandle& EntityHandle);
+
+	/** Destroy entities marked by DestroyEntity, called automatically at end of Tick */
+	void FlushPendingDestroyEntities();
+
+	/** @returns entity or nullptr if handle is stale, O(1) */
+	NO_DISCARD EEntity* GetEntityByHandle(const FEntityHandle& EntityHandle) const;
+
+	/** @returns number of entities which are not pending destroy */
+	NO_DISCARD ContainerInt GetNumberOfEntities() const { return EntitySlots.Size(); }
 
 	template<typename TEntityClass>
 	TEntityClass* GetEntityByType() const
 	{
 		for (EEntity* Entity : Entities)
 		{
+			if (Entity->IsPendingDestroy())
+			{
+				continue;
+			}
+
 			if (TEntityClass* EntitySearch = dynamic_cast<TEntityClass*>(Entity))
 			{
 				return EntitySearch;
@@ -82,7 +111,51 @@ public:
 
 	FWindow* GetOwnerWindow() const { return OwnerWindow; }
 
+	/** Create system which will be ticked and rendered after entities */
+	template<typename TEntitySystemClass, typename... TInParams>
+	TEntitySystemClass* CreateEntitySystem(TInParams... InParams)
+	{
+		ASSERT_IS_BASE_OF(FEntitySystem, TEntitySystemClass, "Class mismatch, CreateEntitySystem requries class to inherit from FEntitySystem.");
+
+		std::shared_ptr<TEntitySystemClass> NewEntitySystem = std::make_shared<TEntitySystemClass>(this, InParams ...);
+
+		EntitySystems.Push(NewEntitySystem);
+
+		return NewEntitySystem.get();
+	}
+
+	bool DestroyEntitySystem(const FEntitySystem* InEntitySystem);
+
+	/** @returns first system of given class or nullptr */
+	template<typename TEntitySystemClass>
+	TEntitySystemClass* GetEntitySystemByClass() const
+	{
+		for (const std::shared_ptr<FEntitySystem>& EntitySystem : EntitySystems)
+		{
+			if (TEntitySystemClass* EntitySystemSearch = dynamic_cast<TEntitySystemClass*>(EntitySystem.get()))
+			{
+				return EntitySystemSearch;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/** Structure of arrays storage for components updated by entity systems */
+	NO_DISCARD FComponentStorage& GetComponentStorage() { return ComponentStorage; }
+
+	/** Spatial index of entity render bounds, used by Render to skip entities outside of camera */
+	NO_DISCARD FEntityRenderCulling& GetRenderCulling() { return RenderCulling; }
+
+	/** @returns world area visible in window, window rectangle moved by render offset of map (see ECameraManager) */
+	NO_DISCARD virtual FCollisionAABB GetCameraBounds() const;
+
+	/** @returns number of entities rendered in last Render, entities outside of camera are not counted */
+	NO_DISCARD int32 GetLastNumberOfRenderedEntities() const { return LastNumberOfRenderedEntities; }
+
 	virtual void Tick(float DeltaTime);
+
+	/** Renders entities visible by camera and then entity systems */
 	virtual void Render();
 
 	FDelegate<> OnEntityManagerDestroyed;
@@ -92,9 +165,29 @@ protected:
 	virtual void OnEntityPreDestroyed(EEntity* Entity);
 
 private:
-	/** Array with entites */
+	/** Array with entites in creation order, pending destroy entities are removed at FlushPendingDestroyEntities */
 	CArray<EEntity*> Entities;
 
+	/** Entities by handle, slot is released as soon as entity is marked for destroy */
+	CSlotMap<EEntity*> EntitySlots;
+
+	/** Entities marked by DestroyEntity waiting for FlushPendingDestroyEntities */
+	CArray<EEntity*> PendingDestroyEntities;
+
+	/** Packed components used by EntitySystems */
+	FComponentStorage ComponentStorage;
+
+	/** Systems ticked after entities, in order of creation */
+	CArray<std::shared_ptr<FEntitySystem>> EntitySystems;
+
+	/** Render bounds of all entities */
+	FEntityRenderCulling RenderCulling;
+
+	/** Reused by Render to avoid allocations */
+	CArray<EEntity*> VisibleEntities;
+
+	int32 LastNumberOfRenderedEntities;
+
 	/** Owner window */
 	FWindow* OwnerWindow;
 
@@ -0,0 +1,91 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECS/Collision/AABBTreeBroadphase.h"
+
+class EEntity;
+
+/** Culling data kept by each entity, used only by FEntityRenderCulling */
+struct ENGINE_API FEntityRenderCullingState
+{
+	FEntityRenderCullingState()
+		: ProxyId(INDEX_NONE)
+		, UnboundedIndex(INDEX_NONE)
+		, RenderOrder(0)
+		, bIsBoundsDirty(false)
+	{
+	}
+
+	/** Proxy in tree, INDEX_NONE for entities without render bounds */
+	FBroadphaseProxyId ProxyId;
+
+	/** Index in array of entities without render bounds, INDEX_NONE if entity has proxy */
+	int32 UnboundedIndex;
+
+	/** Visible entities are rendered in order of registration */
+	uint64 RenderOrder;
+
+	/** True if entity waits for UpdateDirtyEntities */
+	bool bIsBoundsDirty;
+};
+
+/**
+ * Finds entities visible by camera, so cost of rendering depends on number of visible entities instead of all entities.
+ * Render bounds of entities are kept in AABB tree, bounds are read again only for entities marked dirty (moved, resized, rotated).
+ * Entities without render bounds (see EEntity::GetRenderBounds) can not be culled, they are always visible.
+ */
+class ENGINE_API FEntityRenderCulling
+{
+public:
+	FEntityRenderCulling();
+
+	/** Entity is visible until its bounds are read in next UpdateDirtyEntities */
+	void AddEntity(EEntity* InEntity);
+	void RemoveEntity(EEntity* InEntity);
+
+	/** Forget all entities without touching them, for example when they are already deleted */
+	void Clear();
+
+	/** Bounds of entity will be read again before next query */
+	void MarkEntityBoundsDirty(EEntity* InEntity);
+
+	/** Read bounds of entities marked dirty and move their proxies */
+	void UpdateDirtyEntities();
+
+	/** Fills OutEntities with entities overlapping InCameraBounds and entities without bounds, in order of registration */
+	void QueryVisibleEntities(const FCollisionAABB& InCameraBounds, CArray<EEntity*>& OutEntities);
+
+	NO_DISCARD int32 GetNumberOfEntities() const { return NumberOfEntities; }
+
+	/** @returns number of entities which are never culled */
+	NO_DISCARD int32 GetNumberOfUnboundedEntities() const { return UnboundedEntities.Size(); }
+
+	NO_DISCARD const FAABBTreeBroadphase& GetTree() const { return Tree; }
+
+protected:
+	void AddUnboundedEntity(EEntity* InEntity);
+	void RemoveUnboundedEntity(EEntity* InEntity);
+
+	void SetProxyEntity(const FBroadphaseProxyId ProxyId, EEntity* InEntity);
+
+protected:
+	/** Tree is only queried, pairs are never updated */
+	FAABBTreeBroadphase Tree;
+
+	/** Entity of each proxy indexed by proxy id, ids of branches are nullptr */
+	CArray<EEntity*> ProxyEntities;
+
+	CArray<EEntity*> UnboundedEntities;
+
+	CArray<EEntity*> DirtyEntities;
+
+	/** Reused by queries to avoid allocations */
+	CArray<FBroadphaseProxyId> ProxyIdsCache;
+
+	uint64 NextRenderOrder;
+
+	int32 NumberOfEntities;
+
+};
@@ -0,0 +1,31 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FEntityManager;
+class FComponentStorage;
+
+/**
+ * System updating components from FComponentStorage in batches.
+ * Override Tick / Render and use GetComponentStorage().ForEach<...>() to iterate packed components.
+ * Created with FEntityManager::CreateEntitySystem, ticked after entities.
+ */
+class ENGINE_API FEntitySystem
+{
+public:
+	FEntitySystem(FEntityManager* InEntityManager);
+	virtual ~FEntitySystem() = default;
+
+	virtual void Tick(const float DeltaTime);
+	virtual void Render();
+
+	NO_DISCARD FEntityManager* GetEntityManager() const { return EntityManager; }
+	NO_DISCARD FComponentStorage& GetComponentStorage() const;
+
+protected:
+	/** Owner */
+	FEntityManager* EntityManager;
+
+};
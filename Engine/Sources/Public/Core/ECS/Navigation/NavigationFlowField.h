@@ -0,0 +1,153 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FNavigationGrid;
+
+/**
+ * Flow field to single goal tile, shared by all units going there.
+ * Integration field keeps cost of shortest path from each tile to goal (same costs as FNavigationPathfinder),
+ * direction field keeps direction to next tile of that path, so following it costs O(1) per tile.
+ * When walkability of tile changes only tiles whose paths are affected are computed again.
+ */
+class ENGINE_API FNavigationFlowField
+{
+public:
+	FNavigationFlowField();
+
+	/** Computes whole field for goal tile */
+	void Build(const FNavigationGrid& InGrid, const FVector2D<int32>& InGoalTile);
+
+	/** Repairs field after walkability of tile changed in grid, grid must have same size as when field was built */
+	void OnTileWalkabilityChanged(const FNavigationGrid& InGrid, const FVector2D<int32>& InTile);
+
+	NO_DISCARD bool IsInBounds(const int32 X, const int32 Y) const
+	{
+		return (X >= 0 && X < SizeInTiles.X && Y >= 0 && Y < SizeInTiles.Y);
+	}
+
+	/** @returns true if goal can be reached from tile */
+	NO_DISCARD bool IsReachable(const int32 X, const int32 Y) const
+	{
+		return IsInBounds(X, Y) && IntegrationCosts[GetTileIndex(X, Y)] != UnreachableCost;
+	}
+
+	/** @returns cost of shortest path from tile to goal or UnreachableCost */
+	NO_DISCARD int32 GetIntegrationCost(const int32 X, const int32 Y) const
+	{
+		return IsInBounds(X, Y) ? IntegrationCosts[GetTileIndex(X, Y)] : UnreachableCost;
+	}
+
+	/** @returns direction to next tile of path to goal, zero on goal and on tiles which can not reach goal */
+	NO_DISCARD FVector2D<int32> GetFlowDirection(const int32 X, const int32 Y) const;
+
+	/** @returns tile containing absolute location, may be out of bounds */
+	NO_DISCARD FVector2D<int32> LocationToTile(const FVector2D<int32>& InLocation) const;
+
+	/** @returns absolute location of tile center */
+	NO_DISCARD FVector2D<int32> TileToLocation(const FVector2D<int32>& InTile) const;
+
+	NO_DISCARD FVector2D<int32> GetGoalTile() const { return GoalTile; }
+	NO_DISCARD int32 GetNumberOfTiles() const { return IntegrationCosts.Size(); }
+
+	/** @returns number of tiles computed by last build or repair */
+	NO_DISCARD int32 GetLastNumberOfUpdatedTiles() const { return LastNumberOfUpdatedTiles; }
+
+	static constexpr int32 UnreachableCost = std::numeric_limits<int32>::max();
+
+protected:
+	struct FOpenTile
+	{
+		int32 Cost;
+		int32 TileIndex;
+
+		/** Lower cost first */
+		bool operator<(const FOpenTile& Other) const
+		{
+			return (Cost > Other.Cost);
+		}
+	};
+
+	NO_DISCARD int32 GetTileIndex(const int32 X, const int32 Y) const { return (Y * SizeInTiles.X) + X; }
+
+	/** Sets cost and direction of tile if cost is lower than current one */
+	void OpenTile(const int32 TileIndex, const int32 InCost, const uint8 InDirectionIndex);
+
+	/** Sets tile cost from its neighbours, if lower than current one */
+	void OpenTileFromNeighbours(const FNavigationGrid& InGrid, const int32 X, const int32 Y);
+
+	/** Propagates costs of open tiles */
+	void ProcessOpenTiles(const FNavigationGrid& InGrid);
+
+	/** Forgets costs of tile and all tiles whose paths go through it */
+	void ResetTileWithDependentTiles(const int32 X, const int32 Y, CArray<int32>& OutResetTileIndexes);
+
+protected:
+	CArray<int32> IntegrationCosts;
+
+	/** Index of direction to next tile, GoalDirectionIndex or NoDirectionIndex */
+	CArray<uint8> DirectionIndexes;
+
+	/** Binary heap, may contain outdated entries which are skipped */
+	CArray<FOpenTile> OpenTiles;
+
+	FVector2D<int32> SizeInTiles;
+	FVector2D<int32> TileSize;
+	FVector2D<int32> GoalTile;
+
+	int32 LastNumberOfUpdatedTiles;
+
+};
+
+/**
+ * Flow fields of most recently used goals.
+ * Fields which are evicted but still followed by units keep being repaired until last user drops them.
+ */
+class ENGINE_API FNavigationFlowFieldCache
+{
+public:
+	FNavigationFlowFieldCache();
+
+	/** @returns field for goal tile, built if it's not cached */
+	std::shared_ptr<FNavigationFlowField> GetFlowField(const FNavigationGrid& InGrid, const FVector2D<int32>& InGoalTile);
+
+	/** Repairs all fields still in use */
+	void OnTileWalkabilityChanged(const FNavigationGrid& InGrid, const FVector2D<int32>& InTile);
+
+	/** Forgets all fields, for example when grid was rebuilt */
+	void Clear();
+
+	/** Number of fields kept when nobody uses them */
+	void SetCapacity(const int32 InCapacity);
+	NO_DISCARD int32 GetCapacity() const { return Capacity; }
+
+	NO_DISCARD int32 GetNumberOfCachedFields() const { return CachedFlowFields.Size(); }
+
+	/** @returns how many fields were built, for statistics */
+	NO_DISCARD int32 GetNumberOfBuilds() const { return NumberOfBuilds; }
+
+	static constexpr int32 DefaultCapacity = 8;
+
+protected:
+	struct FCachedFlowField
+	{
+		std::shared_ptr<FNavigationFlowField> FlowField;
+		uint64 LastUseStamp;
+	};
+
+	/** Evicts least recently used fields above capacity */
+	void EvictFlowFields();
+
+protected:
+	CArray<FCachedFlowField> CachedFlowFields;
+
+	/** Evicted fields which might still be followed */
+	CArray<std::weak_ptr<FNavigationFlowField>> EvictedFlowFields;
+
+	uint64 UseStamp;
+	int32 Capacity;
+	int32 NumberOfBuilds;
+
+};
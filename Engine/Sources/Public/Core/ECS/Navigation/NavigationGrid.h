@@ -0,0 +1,82 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMapData;
+
+/**
+ * Walkability of map tiles used by pathfinding.
+ * One byte per tile, tile is walkable if it has asset without collision.
+ */
+class ENGINE_API FNavigationGrid
+{
+public:
+	FNavigationGrid();
+
+	/** Creates grid with all tiles walkable */
+	void Initialize(const FVector2D<int32>& InSizeInTiles, const FVector2D<int32>& InTileSize);
+
+	/** Creates grid from tiles and collision settings of map */
+	void BuildFromMapData(const FMapData& InMapData);
+
+	/** Reads single tile again from map, for example after tile was changed */
+	void UpdateTileFromMapData(const FMapData& InMapData, const FVector2D<int32>& InTile);
+
+	NO_DISCARD bool IsInBounds(const int32 X, const int32 Y) const
+	{
+		return (X >= 0 && X < SizeInTiles.X && Y >= 0 && Y < SizeInTiles.Y);
+	}
+
+	/** @returns false for tiles outside of grid */
+	NO_DISCARD bool IsWalkable(const int32 X, const int32 Y) const
+	{
+		return IsInBounds(X, Y) && WalkableTiles[GetTileIndex(X, Y)] != 0;
+	}
+
+	void SetWalkable(const int32 X, const int32 Y, const bool bIsWalkable);
+
+	/** @returns true if move to neighbour tile is possible, diagonal move needs both tiles next to it walkable so corners are never cut */
+	NO_DISCARD bool CanMove(const int32 X, const int32 Y, const int32 DirectionX, const int32 DirectionY) const
+	{
+		if (DirectionX != 0 && DirectionY != 0)
+		{
+			return IsWalkable(X + DirectionX, Y + DirectionY) && IsWalkable(X + DirectionX, Y) && IsWalkable(X, Y + DirectionY);
+		}
+
+		return IsWalkable(X + DirectionX, Y + DirectionY);
+	}
+
+	NO_DISCARD int32 GetTileIndex(const int32 X, const int32 Y) const { return (Y * SizeInTiles.X) + X; }
+	NO_DISCARD FVector2D<int32> GetTileFromIndex(const int32 TileIndex) const { return { TileIndex % SizeInTiles.X, TileIndex / SizeInTiles.X }; }
+
+	/** @returns tile containing absolute location, may be out of bounds */
+	NO_DISCARD FVector2D<int32> LocationToTile(const FVector2D<int32>& InLocation) const;
+
+	/** @returns absolute location of tile center */
+	NO_DISCARD FVector2D<int32> TileToLocation(const FVector2D<int32>& InTile) const;
+
+	/**
+	 * @returns true if segment between centers of tiles crosses only walkable tiles.
+	 * When segment goes exactly through corner both tiles next to it must be walkable, same as diagonal move.
+	 */
+	NO_DISCARD bool HasLineOfSight(const FVector2D<int32>& InStartTile, const FVector2D<int32>& InEndTile) const;
+
+	NO_DISCARD FVector2D<int32> GetSizeInTiles() const { return SizeInTiles; }
+	NO_DISCARD FVector2D<int32> GetTileSize() const { return TileSize; }
+	NO_DISCARD int32 GetNumberOfTiles() const { return WalkableTiles.Size(); }
+
+	/** @returns true if tile of map has asset without collision */
+	static bool IsMapTileWalkable(const FMapData& InMapData, const int32 X, const int32 Y);
+
+protected:
+	/** 1 for walkable tile, 0 for blocked, row by row */
+	CArray<uint8> WalkableTiles;
+
+	FVector2D<int32> SizeInTiles;
+
+	/** Size of tile in pixels */
+	FVector2D<int32> TileSize;
+
+};
@@ -0,0 +1,219 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECS/Navigation/NavigationGrid.h"
+
+/**
+ * Hierarchical pathfinding (HPA*) for long paths on big maps.
+ * Grid is split into square clusters, walkable openings between clusters get portal tiles.
+ * Portals of each cluster are connected with costs of shortest paths inside cluster, so long query searches small graph of portals
+ * and only start, end and used connections are searched on tiles. Tile paths of connections are kept once found.
+ * Changing tile builds again only portals on borders of its cluster and connections of that cluster and its neighbours.
+ * Portal path between pair of clusters is cached and reused by next queries between same clusters while graph is not changed.
+ * Paths are close to shortest (portals are placed on openings, not on every tile), moves between clusters are not diagonal.
+ * Thread safe, queries run at same time on shared lock, each with its own search buffers. Changes wait for running queries,
+ * so FNavigationManager changes copy of hierarchy when async queries still use it, same as grid.
+ */
+class ENGINE_API FNavigationHierarchy
+{
+public:
+	FNavigationHierarchy();
+
+	/** Copies clusters, portals and cached paths, search buffers are not copied */
+	FNavigationHierarchy(const FNavigationHierarchy& Other);
+
+	/** Copies grid and builds clusters, portals and connections */
+	void Build(const FNavigationGrid& InGrid, const int32 InClusterSize = DefaultClusterSize);
+
+	/** Changes walkability of tile in copy of grid and rebuilds affected clusters */
+	void SetTileWalkable(const FVector2D<int32>& InTile, const bool bIsWalkable);
+
+	/**
+	 * Finds path from start to end tile.
+	 * OutPathTiles is filled with start tile, tiles where path changes direction and end tile, same as in FNavigationPathfinder.
+	 * @returns true if path was found
+	 */
+	bool FindPath(const FVector2D<int32>& InStartTile, const FVector2D<int32>& InEndTile, CArray<FVector2D<int32>>& OutPathTiles, int32& OutPathCost);
+
+	/** Enables reusing portal paths between pairs of clusters */
+	void SetUseAbstractPathCache(const bool bInUseAbstractPathCache);
+
+	NO_DISCARD int32 GetClusterSize() const { return ClusterSize; }
+	NO_DISCARD int32 GetNumberOfClusters() const { return Clusters.Size(); }
+
+	/** @returns number of portal tiles */
+	NO_DISCARD int32 GetNumberOfNodes() const;
+
+	/** @returns number of connections between portals, inside and between clusters */
+	NO_DISCARD int32 GetNumberOfEdges() const;
+
+	/** @returns number of queries which used cached portal path */
+	NO_DISCARD int32 GetNumberOfCacheHits() const;
+
+	static constexpr int32 DefaultClusterSize = 16;
+
+	/** Openings up to this width get one portal in the middle, wider ones get portals on both ends */
+	static constexpr int32 MaxOpeningWidthForSinglePortal = 6;
+
+	static constexpr int32 AbstractPathCacheCapacity = 256;
+
+protected:
+	struct FEdge
+	{
+		int32 ToNodeId;
+		int32 Cost;
+
+		/** Connection inside cluster, false for step between portals of neighbouring clusters */
+		bool bIsIntraClusterEdge;
+
+		/** Tiles of intra cluster connection, filled when it's used first time */
+		CArray<FVector2D<int32>> TilePath;
+	};
+
+	struct FNode
+	{
+		FVector2D<int32> Tile;
+		int32 ClusterIndex;
+
+		/** Number of openings using this tile as portal, node is removed when it drops to 0 */
+		int32 NumberOfEntrances;
+
+		CArray<FEdge> Edges;
+	};
+
+	/** Pair of portal tiles on both sides of opening */
+	struct FEntrance
+	{
+		int32 NodeIdA;
+		int32 NodeIdB;
+	};
+
+	struct FCluster
+	{
+		FVector2D<int32> Min;
+		FVector2D<int32> Size;
+
+		CArray<int32> NodeIds;
+
+		/** Openings to cluster on the right and below */
+		CArray<FEntrance> EastEntrances;
+		CArray<FEntrance> SouthEntrances;
+	};
+
+	struct FCachedAbstractPath
+	{
+		CArray<int32> NodeIds;
+		uint64 GraphVersion;
+		uint64 LastUseStamp;
+	};
+
+	struct FOpenEntry
+	{
+		int32 TotalCost;
+		int32 Cost;
+		int32 Index;
+
+		/** Lower total cost first */
+		bool operator<(const FOpenEntry& Other) const
+		{
+			return (TotalCost > Other.TotalCost) || (TotalCost == Other.TotalCost && Cost < Other.Cost);
+		}
+	};
+
+	/** Buffers of one search, each query running at same time has its own */
+	struct FSearchScratch
+	{
+		FSearchScratch()
+			: AbstractSearchStamp(0)
+		{
+		}
+
+		/** Cost from query start and to query end for portals of their clusters, UnreachableCost for others */
+		CArray<int32> NodeStartCosts;
+		CArray<int32> NodeEndCosts;
+
+		/** Local searches */
+		CArray<int32> LocalCosts;
+		CArray<int32> LocalParents;
+		CArray<FOpenEntry> LocalOpenEntries;
+
+		/** Portal graph search, two last entries are query start and end */
+		CArray<int32> AbstractCosts;
+		CArray<int32> AbstractParents;
+		CArray<uint32> AbstractVisitedStamps;
+		CArray<uint32> AbstractClosedStamps;
+		CArray<FOpenEntry> AbstractOpenEntries;
+		uint32 AbstractSearchStamp;
+	};
+
+	NO_DISCARD int32 GetClusterIndex(const int32 X, const int32 Y) const { return ((Y / ClusterSize) * NumberOfClusters.X) + (X / ClusterSize); }
+
+	/** Finds openings on border and adds their portals */
+	void BuildEntrances(const int32 ClusterIndex, const bool bIsEastBorder);
+	void RemoveEntrances(CArray<FEntrance>& InEntrances);
+
+	/** Connects all portals of cluster with shortest paths inside it */
+	void BuildIntraClusterEdges(const int32 ClusterIndex);
+
+	int32 AddNode(const FVector2D<int32>& InTile, const int32 ClusterIndex);
+	void ReleaseNode(const int32 NodeId);
+	void RemoveInterClusterEdge(const int32 FromNodeId, const int32 ToNodeId);
+
+	/** Dijkstra limited to cluster, fills LocalCosts and LocalParents, stops when end tile is reached if given */
+	void RunLocalSearch(FSearchScratch& InScratch, const FCluster& InCluster, const FVector2D<int32>& InSourceTile, const FVector2D<int32>* InEndTile = nullptr) const;
+	NO_DISCARD int32 GetLocalCost(const FSearchScratch& InScratch, const FCluster& InCluster, const FVector2D<int32>& InTile) const;
+
+	/** Appends tiles from InTile to source of last local search */
+	void AppendLocalPathToSource(const FSearchScratch& InScratch, const FCluster& InCluster, const FVector2D<int32>& InTile, CArray<FVector2D<int32>>& OutTiles) const;
+
+	/** Searches portal graph, start and end are connected with costs in NodeStartCosts and NodeEndCosts */
+	bool FindAbstractPath(FSearchScratch& InScratch, const FVector2D<int32>& InStartTile, const FVector2D<int32>& InEndTile, const int32 StartClusterIndex, CArray<int32>& OutNodeIds) const;
+
+	FEdge* FindEdge(const int32 FromNodeId, const int32 ToNodeId);
+
+	/** Writes tiles of path through given portals, @returns cost */
+	int32 RefinePath(FSearchScratch& InScratch, const FVector2D<int32>& InStartTile, const FVector2D<int32>& InEndTile, const CArray<int32>& InNodeIds, CArray<FVector2D<int32>>& OutTiles);
+
+	/** Search buffers are reused by next queries */
+	std::shared_ptr<FSearchScratch> AcquireScratch();
+	void ReleaseScratch(const std::shared_ptr<FSearchScratch>& InScratch);
+
+protected:
+	/** Copy of navigation grid, so hierarchy can be used by worker threads */
+	FNavigationGrid Grid;
+
+	int32 ClusterSize;
+	FVector2D<int32> NumberOfClusters;
+
+	CArray<FCluster> Clusters;
+
+	CArray<FNode> Nodes;
+	CArray<int32> FreeNodeIds;
+	CUnorderedMap<int32, int32> NodeIdByTileIndex;
+
+	/** Used by changes, which have exclusive lock */
+	FSearchScratch BuildScratch;
+
+	/** Buffers of finished queries */
+	CArray<std::shared_ptr<FSearchScratch>> FreeScratches;
+	std::mutex ScratchMutex;
+
+	/** Portal paths by pair of start and end cluster */
+	CUnorderedMap<uint64, FCachedAbstractPath> AbstractPathCache;
+	bool bUseAbstractPathCache;
+	uint64 CacheUseStamp;
+
+	/** Changed with every change of tiles, cached paths of older version are not used */
+	uint64 GraphVersion;
+
+	int32 NumberOfCacheHits;
+
+	/** Shared by queries, exclusive for changes */
+	mutable std::shared_mutex Mutex;
+
+	/** Guards portal path cache and tile paths of connections, which are filled by queries */
+	mutable std::mutex CacheMutex;
+
+};
@@ -0,0 +1,139 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECS/SubSystems/SubSystemInstanceInterface.h"
+#include "ECS/Navigation/NavigationFlowField.h"
+#include "ECS/Navigation/NavigationPathfinder.h"
+
+class FMap;
+class FNavigationGrid;
+class FNavigationHierarchy;
+class FNavigationPathfinderPool;
+struct FNavigationPathRequest;
+
+/** Id of async path request, INDEX_NONE is invalid */
+typedef int32 FNavigationRequestId;
+
+/** Path found by FNavigationManager */
+struct ENGINE_API FNavigationPathResult
+{
+	FNavigationPathResult()
+		: bIsPathFound(false)
+		, PathCost(0)
+	{
+	}
+
+	bool bIsPathFound;
+
+	/** Absolute locations to walk through after start, last one is requested end location */
+	CArray<FVector2D<int32>> Waypoints;
+
+	/** Cost of path before smoothing, see FNavigationPathfinder */
+	int32 PathCost;
+};
+
+/**
+ * Navigation of map
+ * Builds walkability grid from tiles and collision settings of map, then answers path queries with A* or jump point search.
+ * Long queries use navigation hierarchy instead, it's updated in place when tiles change.
+ * Async queries run on worker threads on snapshot of grid, so changing tiles never waits for queries.
+ * Result is delivered on main thread to requester, unless request was cancelled.
+ * Many units going to same place should share flow field instead, it's built once per goal and kept in LRU cache.
+ */
+class ENGINE_API FNavigationManager : public ISubSystemInstanceInterface
+{
+public:
+	FNavigationManager();
+	~FNavigationManager() override;
+
+	/** Begin ISubSystemInstanceInterface */
+	void InitializeSubSystem() override;
+	void TickSubSystem() override;
+	/** End ISubSystemInstanceInterface */
+
+	/** Reads whole grid from map again */
+	void RebuildNavigationGrid();
+
+	/**
+	 * Finds path on calling thread
+	 * @returns true if path was found
+	 */
+	bool FindPath(const FVector2D<int32>& InStartLocation, const FVector2D<int32>& InEndLocation, FNavigationPathResult& OutResult);
+
+	/** Finds path on worker thread, OnPathFound is called on main thread with result (also when path is not found) */
+	FNavigationRequestId RequestPath(const FVector2D<int32>& InStartLocation, const FVector2D<int32>& InEndLocation, FDelegateSafe<void, const FNavigationPathResult&>& OnPathFound);
+
+	/** Result of cancelled request is never delivered */
+	void CancelPathRequest(const FNavigationRequestId InRequestId);
+
+	/**
+	 * @returns flow field to tile of goal location, built on calling thread if it's not cached.
+	 * Field is repaired on main thread when map tiles change, as long as anybody keeps it.
+	 */
+	std::shared_ptr<const FNavigationFlowField> GetFlowField(const FVector2D<int32>& InGoalLocation);
+
+	FNavigationFlowFieldCache& GetFlowFieldCache() { return FlowFieldCache; }
+
+	void SetAlgorithm(const ENavigationAlgorithm InAlgorithm) { Algorithm = InAlgorithm; }
+	NO_DISCARD ENavigationAlgorithm GetAlgorithm() const { return Algorithm; }
+
+	/** When enabled waypoints which can be skipped by walking in straight line are removed */
+	void SetShouldSmoothPaths(const bool bInShouldSmoothPaths) { bShouldSmoothPaths = bInShouldSmoothPaths; }
+	NO_DISCARD bool ShouldSmoothPaths() const { return bShouldSmoothPaths; }
+
+	/** Queries with start and end further apart than this number of tiles (on any axis) use navigation hierarchy */
+	void SetHierarchyMinTileDistance(const int32 InHierarchyMinTileDistance) { HierarchyMinTileDistance = InHierarchyMinTileDistance; }
+	NO_DISCARD int32 GetHierarchyMinTileDistance() const { return HierarchyMinTileDistance; }
+
+	NO_DISCARD const FNavigationGrid* GetNavigationGrid() const { return NavigationGrid.get(); }
+	NO_DISCARD FNavigationHierarchy* GetNavigationHierarchy() const { return NavigationHierarchy.get(); }
+
+	/** @returns number of async requests waiting for result */
+	NO_DISCARD int32 GetNumberOfPendingRequests() const { return PendingRequests.Size(); }
+
+	/** Finds path on given grid, used by sync and async queries, hierarchy is optional and used for queries longer than InHierarchyMinTileDistance */
+	static void FindPathOnGrid(const FNavigationGrid& InGrid, FNavigationPathfinder& InPathfinder, const ENavigationAlgorithm InAlgorithm, const bool bInShouldSmoothPaths,
+		const FVector2D<int32>& InStartLocation, const FVector2D<int32>& InEndLocation, FNavigationPathResult& OutResult,
+		FNavigationHierarchy* InHierarchy = nullptr, const int32 InHierarchyMinTileDistance = 0);
+
+protected:
+	FMap* GetMap() const;
+
+	/** Called by map each time tile is changed */
+	void OnMapTileChanged(FVector2D<int32> InTile);
+
+	/** Grid which can be changed, copied first when async queries still use it */
+	FNavigationGrid* GetGridForWrite();
+
+	/** Hierarchy which can be changed, copied first when async queries still use it */
+	FNavigationHierarchy* GetHierarchyForWrite();
+
+protected:
+	/** Snapshot of grid shared with async queries */
+	std::shared_ptr<FNavigationGrid> NavigationGrid;
+
+	/** Snapshot of clusters and portals for long queries shared with async queries, queries on same snapshot run at same time */
+	std::shared_ptr<FNavigationHierarchy> NavigationHierarchy;
+
+	/** Pathfinders are reused by queries, so their buffers are not allocated again */
+	std::shared_ptr<FNavigationPathfinderPool> PathfinderPool;
+
+	CUnorderedMap<FNavigationRequestId, std::shared_ptr<FNavigationPathRequest>> PendingRequests;
+
+	/** Flow fields of recently used goals */
+	FNavigationFlowFieldCache FlowFieldCache;
+
+	FNavigationRequestId NextRequestId;
+
+	ENavigationAlgorithm Algorithm;
+
+	int32 HierarchyMinTileDistance;
+
+	bool bShouldSmoothPaths;
+
+	/** Map we are bound to */
+	FMap* BoundMap;
+
+};
@@ -0,0 +1,101 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FNavigationGrid;
+
+enum class ENavigationAlgorithm : uint8
+{
+	/** Expands every neighbour tile, cost grows with searched area */
+	AStar,
+	/** Jump point search, skips straight runs of tiles and expands only jump points. Same paths as A*, usually much faster on open maps. */
+	JumpPoint,
+};
+
+/**
+ * Finds shortest paths on FNavigationGrid, moving in 8 directions.
+ * Diagonal move is only allowed when both tiles next to it are walkable, so paths never cut corners of walls.
+ * Costs are integers, straight move costs StraightMoveCost and diagonal DiagonalMoveCost.
+ * Buffers are sized to grid and reused by next searches, so one pathfinder should be used by one thread at a time.
+ */
+class ENGINE_API FNavigationPathfinder
+{
+public:
+	FNavigationPathfinder();
+
+	/**
+	 * Finds shortest path from start to end tile.
+	 * OutPathTiles is filled with start tile, tiles where path changes direction and end tile.
+	 * @returns true if path was found
+	 */
+	bool FindPath(const FNavigationGrid& InGrid, const FVector2D<int32>& InStartTile, const FVector2D<int32>& InEndTile, const ENavigationAlgorithm InAlgorithm, CArray<FVector2D<int32>>& OutPathTiles);
+
+	/** @returns cost of last found path */
+	NO_DISCARD int32 GetLastPathCost() const { return LastPathCost; }
+
+	/** @returns number of tiles taken from open list by last search */
+	NO_DISCARD int32 GetLastNumberOfExpandedTiles() const { return LastNumberOfExpandedTiles; }
+
+	/**
+	 * Removes path tiles which can be skipped by walking in straight line (any angle).
+	 * First and last tile are always kept.
+	 */
+	static void SmoothPath(const FNavigationGrid& InGrid, const CArray<FVector2D<int32>>& InPathTiles, CArray<FVector2D<int32>>& OutPathTiles);
+
+	/** @returns cost of 8 direction move between tiles, lower bound of path cost */
+	static int32 GetOctileDistance(const FVector2D<int32>& InTileA, const FVector2D<int32>& InTileB);
+
+	static constexpr int32 StraightMoveCost = 10;
+	static constexpr int32 DiagonalMoveCost = 14;
+
+protected:
+	struct FOpenTile
+	{
+		int32 TotalCost;
+		int32 PathCost;
+		int32 TileIndex;
+
+		/** Lower total cost first, on equal cost tile further from start first */
+		bool operator<(const FOpenTile& Other) const
+		{
+			return (TotalCost > Other.TotalCost) || (TotalCost == Other.TotalCost && PathCost < Other.PathCost);
+		}
+	};
+
+	/** Resizes buffers to grid and starts new search without clearing them */
+	void BeginSearch(const FNavigationGrid& InGrid);
+
+	/** Sets cost of tile if lower than current and adds it to open list */
+	void OpenTile(const int32 TileIndex, const int32 ParentTileIndex, const int32 InPathCost, const FVector2D<int32>& InTile, const FVector2D<int32>& InEndTile);
+
+	void ExpandAStar(const FNavigationGrid& InGrid, const int32 TileIndex, const FVector2D<int32>& InEndTile);
+	void ExpandJumpPoint(const FNavigationGrid& InGrid, const int32 TileIndex, const FVector2D<int32>& InEndTile);
+
+	/** Jumps from tile in direction, @returns jump point or INDEX_NONE */
+	static int32 Jump(const FNavigationGrid& InGrid, int32 X, int32 Y, const int32 DirectionX, const int32 DirectionY, const FVector2D<int32>& InEndTile);
+	static int32 JumpStraight(const FNavigationGrid& InGrid, int32 X, int32 Y, const int32 DirectionX, const int32 DirectionY, const FVector2D<int32>& InEndTile);
+
+	/** @returns true if tile reached by straight move has neighbour which can not be reached cheaper without it */
+	static bool HasForcedNeighbour(const FNavigationGrid& InGrid, const int32 X, const int32 Y, const int32 DirectionX, const int32 DirectionY);
+
+	/** Writes turning tiles of path ending at tile into OutPathTiles */
+	void BuildPath(const FNavigationGrid& InGrid, const int32 EndTileIndex, CArray<FVector2D<int32>>& OutPathTiles) const;
+
+protected:
+	/** Binary heap, may contain outdated entries which are skipped */
+	CArray<FOpenTile> OpenTiles;
+
+	CArray<int32> PathCosts;
+	CArray<int32> ParentTileIndexes;
+
+	/** Tile data is valid only if its stamp equals SearchStamp, so buffers are not cleared between searches */
+	CArray<uint32> VisitedStamps;
+	CArray<uint32> ClosedStamps;
+	uint32 SearchStamp;
+
+	int32 LastPathCost;
+	int32 LastNumberOfExpandedTiles;
+
+};
@@ -0,0 +1,132 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECS/EntitySystem.h"
+#include "ECS/EntityHandle.h"
+
+class FTextureAsset;
+class FCollisionManager;
+class FCollisionBase;
+class UCollisionComponent;
+
+/** Plain data of single projectile */
+struct ENGINE_API FProjectileData
+{
+	FProjectileData();
+
+	FVector2D<float> Location;
+
+	/** Pixels per second, projectile sprite is rotated to face this direction */
+	FVector2D<float> Velocity;
+
+	/** Seconds left before projectile is removed */
+	float Lifetime;
+
+	float Damage;
+
+	/** Team of shooter, entities with same team in UTeamComponent are not hit. INDEX_NONE hits any team. */
+	int32 Team;
+
+	/** Radius used for hit check */
+	int32 Radius;
+
+	/** Render size */
+	FVector2D<float> Size;
+
+	/** Sprite, when nullptr rectangle of Color is rendered */
+	FTextureAsset* Texture;
+
+	FColorRGBA Color;
+
+	/** Entity which fired projectile, it is never hit by own projectiles */
+	FEntityHandle Owner;
+};
+
+/** Vertices and indices of all projectiles using same texture */
+struct FProjectileRenderBatch
+{
+	FProjectileRenderBatch()
+		: Texture(nullptr)
+	{
+	}
+
+	explicit FProjectileRenderBatch(SDL_Texture* InTexture)
+		: Texture(InTexture)
+	{
+	}
+
+	SDL_Texture* Texture;
+
+	std::vector<SDL_Vertex> Vertices;
+	std::vector<int> Indices;
+};
+
+/**
+ * Projectiles stored as plain data in preallocated pool.
+ * All projectiles are moved in single loop, hits are checked using FCollisionManager of current map and all projectiles of same texture are rendered in single draw.
+ * Use instead of EProjectileEntity when there are many projectiles, get it with FEntityManager::GetEntitySystemByClass.
+ */
+class ENGINE_API FProjectileSystem : public FEntitySystem
+{
+public:
+	FProjectileSystem(FEntityManager* InEntityManager, const int32 InPoolSize = DefaultPoolSize);
+
+	/** Begin FEntitySystem interface */
+	void Tick(const float DeltaTime) override;
+	void Render() override;
+	/** End FEntitySystem interface */
+
+	/** Add projectile to pool. @returns false if pool is full */
+	bool FireProjectile(const FProjectileData& InProjectileData);
+
+	/** Remove all projectiles */
+	void ClearProjectiles();
+
+	NO_DISCARD int32 GetNumberOfProjectiles() const { return NumberOfProjectiles; }
+	NO_DISCARD int32 GetPoolSize() const { return static_cast<int32>(Projectiles.size()); }
+
+	/** @returns active projectile at index, index is in range [0, GetNumberOfProjectiles()) and changes when projectiles are removed */
+	NO_DISCARD const FProjectileData& GetProjectileAt(const int32 Index) const { return Projectiles[Index]; }
+
+	/** Collision used for hits, found from current map when not set */
+	void SetCollisionManager(FCollisionManager* InCollisionManager);
+
+	/**
+	 * Fill render batches with vertices of active projectiles, called by Render.
+	 * @param InRenderOffset added to vertices, so batches are drawn in screen space without copying them
+	 */
+	void BuildRenderBatches(const FVector2D<float>& InRenderOffset = FVector2D<float>());
+
+	NO_DISCARD const CArray<FProjectileRenderBatch>& GetRenderBatches() const { return RenderBatches; }
+
+	/** Called when projectile hits collision, projectile is removed after this call */
+	FDelegate<void, const FProjectileData&, UCollisionComponent*> OnProjectileHit;
+
+	static constexpr int32 DefaultPoolSize = 65536;
+
+protected:
+	/** @returns true if projectile should hit given collision */
+	virtual bool CanHit(const FProjectileData& InProjectileData, const FCollisionBase* InCollision) const;
+
+	/** Swap with last active projectile */
+	void RemoveProjectileAt(const int32 Index);
+
+	FCollisionManager* FindCollisionManager() const;
+
+protected:
+	/** Pool, first NumberOfProjectiles are active */
+	std::vector<FProjectileData> Projectiles;
+
+	int32 NumberOfProjectiles;
+
+	FCollisionManager* CollisionManager;
+
+	/** Kept between frames so vertex arrays keep capacity */
+	CArray<FProjectileRenderBatch> RenderBatches;
+
+	/** Logged once, pool full is usually config issue */
+	bool bWasPoolFullReported;
+
+};
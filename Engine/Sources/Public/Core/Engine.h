@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Includes/EngineErrorCodes.h"
 #include "Includes/EngineLaunchParameterCollection.h"
+#include "Containers/MPSCQueue.h"
 
 class IEngineSubsystemInterface;
 class FIniObject;
@@ -12,6 +13,7 @@ enum class EEngineErrorCode;
 class FEngineRenderingManager;
 class FEngineTickingManager;
 class ITickInterface;
+class FTimerWheel;
 
 class ENGINE_API FEngine
 {
@@ -116,9 +118,12 @@ public:
 	NO_DISCARD const std::string& GetLaunchFullPath() const;
 	NO_DISCARD const std::string& GetLaunchRelativePath() const;
 
-	/** Call to add function to execute on next tick, FFunctorBase will be cleaned after executing. */
+	/** Call to add function to execute on main thread on start of next tick. Thread safe, can be called from any thread. */
 	void AddLambdaToCallOnStartOfNextTick(const FFunctorLambda<void>& Function);
 
+	/** Removes all functions waiting for next tick without calling them, must be called from main thread */
+	void ClearFunctionsToCallOnStartOfNextTick();
+
 	void DeInitializeEngineSubsystems();
 
 	void TickEngineSubsystems();
@@ -156,8 +161,6 @@ public:
 		return Out;
 	}
 
-	FDelegate<>& GetFunctionsToCallOnStartOfNextTick();
-
 	NO_DISCARD FEventHandler* GetEventHandler() const;
 
 	/** Use this if you changed to your own. Will return casted. */
@@ -180,6 +183,9 @@ public:
 	NO_DISCARD FEngineRenderingManager* GetEngineRenderingManager() const;
 	NO_DISCARD FThreadsManager* GetThreadsManager() const;
 
+	/** @returns wheel used by all FTimer, advanced at start of each tick */
+	NO_DISCARD FTimerWheel* GetTimerWheel() const;
+
 protected:
 	void UpdateFrameRateCounter();
 
@@ -189,6 +195,7 @@ protected:
 	NO_DISCARD virtual FEngineTickingManager* CreateEngineTickingManager() const;
 	NO_DISCARD virtual FEngineRenderingManager* CreateEngineRenderingManager() const;
 	NO_DISCARD virtual FThreadsManager* CreateThreadsManager() const;
+	NO_DISCARD virtual FTimerWheel* CreateTimerWheel() const;
 
 #if ENGINE_TESTS_ALLOW_ANY
 	NO_DISCARD virtual class FTestManager* CreateTestManager() const;
@@ -238,11 +245,13 @@ protected:
 	FEngineTickingManager* EngineTickingManager;
 	FEngineRenderingManager* EngineRenderingManager;
 	FThreadsManager* ThreadsManager;
+	FTimerWheel* TimerWheel;
 
 	FRenderThread* RenderThread;
 	FThreadData* RenderThreadData;
 
-	FDelegate<> FunctionsToCallOnStartOfNextTick;
+	/** Filled from any thread, drained by main thread at start of EngineTick */
+	CMPSCQueue<FFunctorLambda<void>> FunctionsToCallOnStartOfNextTick;
 	FDelegate<void, float> TickingObjectsDelegate;
 
 	/** Array with managed subsystems */
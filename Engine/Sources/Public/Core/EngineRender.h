@@ -78,6 +78,9 @@ public:
 
 	void OnWindowCloseRequested(Uint32 WindowId);
 
+	/** Content of render target textures is lost, with window id 0 all windows are notified */
+	void OnRenderTargetsReset(Uint32 WindowId);
+
 	void SetWindowFocus(Uint32 WindowId, const bool bIsFocused);
 	void SetWindowIsMouseInside(Uint32 WindowId, const bool bIsInside);
 			
@@ -24,4 +24,7 @@ struct ENGINE_API FEngineLaunchParameter
 namespace FEngineLaunchParameterCollection
 {
 	extern const std::string IsServer;
+
+	/** Records draw commands on game thread and submits them to SDL from render thread, one frame later */
+	extern const std::string UseRenderThread;
 };
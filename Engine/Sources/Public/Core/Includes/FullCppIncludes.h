@@ -4,9 +4,11 @@
 
 // C/C++ includes
 #include <array>
+#include <atomic>
 #include <cfloat>
 #include <cmath>
 #include <chrono>
+#include <condition_variable>
 #include <climits>
 #include <filesystem>
 #include <fstream>
@@ -19,5 +21,6 @@
 #include <string>
 #include <time.h>
 #include <random>
+#include <shared_mutex>
 #include <vector>
 #include <thread>
@@ -21,15 +21,41 @@ enum class ERenderOrder : Uint8
 class FRenderableObject
 {
 public:
+	virtual ~FRenderableObject() = default;
+
 	virtual void Render() = 0;
 
 };
 
+/** Renderable object executing lambda, lambda should capture everything by value */
+template<typename TLambda>
+class FRenderableLambda : public FRenderableObject
+{
+public:
+	FRenderableLambda(TLambda InLambda)
+		: Lambda(std::move(InLambda))
+	{
+	}
+
+	/** Begin FRenderableObject interface */
+	void Render() override
+	{
+		Lambda();
+	}
+	/** End FRenderableObject interface */
+
+protected:
+	TLambda Lambda;
+
+};
+
 struct FRenderableObjectsCollection
 {
 	CArray<std::shared_ptr<FRenderableObject>> Collection;
 };
 
+typedef CMap<ERenderOrder, FRenderableObjectsCollection> FRenderCommandList;
+
 class FRenderCommandsWithScopeLock
 {
 public:
@@ -40,49 +66,92 @@ public:
 
 private:
 	FRenderThread* RenderThread;
-	
+
 };
 
 /**
- * @TODO Currently abandoned implementation
- * SDL2 does not really support rendering from any other thread than main thread
+ * Locks SDL renderer resources (texture creation, update, destruction) against render thread.
+ * Does nothing when rendering inline on game thread.
+ */
+class ENGINE_API FScopedRenderResourcesLock
+{
+public:
+	FScopedRenderResourcesLock();
+	~FScopedRenderResourcesLock();
+
+private:
+	std::mutex* RenderResourcesMutex;
+
+};
+
+/**
+ * Pipelined render thread, enabled with launch parameter -UseRenderThread=1.
+ * Game thread records frame N into one command list while this thread submits frame N-1 from the other.
+ * Lists are swapped in SubmitFrame, which only waits if previous frame is not submitted yet.
+ * @Note SDL officially supports renderer only on main thread, software renderer works from this thread.
  */
 class FRenderThread : public FThread
 {
 	friend FEngine;
 	friend FRenderCommandsWithScopeLock;
+	friend FScopedRenderResourcesLock;
 
 public:
 	FRenderThread(FThreadInputData* InThreadInputData, FThreadData* InThreadData);
 	~FRenderThread() override;
 
 	void StartThread() override;
+	void StopThread() override;
 
 	FRenderCommandsWithScopeLock GetRenderCommands();
 
+	/** Add command to frame recorded by game thread */
+	void EnqueueRenderCommand(const std::shared_ptr<FRenderableObject>& InRenderableObject, const ERenderOrder RenderOrder = ERenderOrder::Default);
+
+	/** Add lambda to frame recorded by game thread, lambda should capture everything by value */
+	template<typename TLambda>
+	void EnqueueRenderLambda(TLambda Lambda, const ERenderOrder RenderOrder = ERenderOrder::Default)
+	{
+		EnqueueRenderCommand(std::make_shared<FRenderableLambda<TLambda>>(std::move(Lambda)), RenderOrder);
+	}
+
+	/** Called from game thread when frame is recorded, hands it to render thread. Waits if previous frame is still being submitted. */
+	void SubmitFrame();
+
+	/** Blocks calling thread until render thread submitted all frames */
+	void WaitForRenderingFrameFinished();
+
 	bool IsRenderingFrameFinished() const { return bIsRenderingFrameFinished; }
 
 protected:
 	void TickThread() override;
 
-	void AllowRenderNextFrame();
+	/** Ensures all render orders are present in list so they are executed in order */
+	static void InitializeMapWithDelegates(FRenderCommandList& InRenderCommandList);
 
-	void InitializeMapWithDelegates();
+	/** Executes and clears list */
+	static void ExecuteRenderCommands(FRenderCommandList& InRenderCommandList);
 
 protected:
-	/** Render commands collected during frame */
-	CMap<ERenderOrder, FRenderableObjectsCollection> RenderCommands;
+	/** Double buffered render commands, one is recorded by game thread while other is submitted by render thread */
+	FRenderCommandList RenderCommandsBuffers[2];
 
-	/** Render commands to actually render */
-	CMap<ERenderOrder, FRenderableObjectsCollection> RenderCommandsCopy;
+	/** Index of buffer recorded by game thread, changed only when render thread is idle */
+	int32 RecordingBufferIndex;
 
-	/** True if thread has finished work for this engine tick */
+	/** True if thread has finished work for last submitted frame */
 	std::atomic_bool bIsRenderingFrameFinished;
 
-	/** Will be set from engine when tick is finished. */
-	std::atomic_bool bIsRenderingNextFrameAllowed;
+	/** Set by SubmitFrame, protected by FrameMutex */
+	bool bIsFrameReadyToRender;
+
+	/** Mutex for bIsFrameReadyToRender and bIsRenderingFrameFinished changes */
+	std::mutex FrameMutex;
+
+	/** Notified when frame is submitted by game thread or finished by render thread */
+	std::condition_variable FrameCondition;
 
-	/** Mutex for RenderCommands */
-	std::mutex RenderCommandsMutex;
+	/** Held by render thread while submitting, see FScopedRenderResourcesLock */
+	std::mutex RenderResourcesMutex;
 
 };
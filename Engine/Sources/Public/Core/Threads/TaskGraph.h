@@ -0,0 +1,129 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ThreadStructure.h"
+
+class FTaskGraph;
+class FGraphTaskHandle;
+
+/** Thread on which graph task is executed */
+enum class ETaskThread : Uint8
+{
+	/** Any worker of FThreadsManager (or thread waiting for it) */
+	AnyThread,
+	/** Main thread, executed in FThreadsManager::TickThreadCallbacks or when main thread waits */
+	MainThread
+};
+
+/**
+ * Single node of FTaskGraph.
+ * Starts when all prerequisites are finished, then starts its subsequents.
+ */
+class ENGINE_API FGraphTask
+{
+	friend FTaskGraph;
+	friend FGraphTaskHandle;
+
+public:
+	FGraphTask(const std::shared_ptr<FDelegateSafe<>>& InTaskDelegate, const ETaskThread InTaskThread);
+
+protected:
+	/** Work of this task */
+	std::shared_ptr<FDelegateSafe<>> TaskDelegate;
+
+	ETaskThread TaskThread;
+
+	/** Number of not finished prerequisites, starts with one extra which is removed when task is fully set up */
+	std::atomic<int32> NumberOfPendingPrerequisites;
+
+	/** Tasks waiting for this task to finish */
+	CArray<std::shared_ptr<FGraphTask>> Subsequents;
+
+	/** Mutex for params Subsequents and bSubsequentsStarted */
+	std::mutex SubsequentsMutex;
+
+	/** Set when task is done, tasks added later with this task as prerequisite do not wait for it */
+	bool bSubsequentsStarted;
+
+	/** Shared with FAsyncJobHandle to allow waiting */
+	std::shared_ptr<FAsyncJobState> JobState;
+
+};
+
+/** Handle to task added to FTaskGraph, can be used as prerequisite of other tasks */
+class ENGINE_API FGraphTaskHandle
+{
+	friend FTaskGraph;
+
+public:
+	FGraphTaskHandle();
+
+	/** @returns true if handle points to task */
+	NO_DISCARD bool IsValid() const;
+
+	/** @returns true when task was executed */
+	NO_DISCARD bool IsFinished() const;
+
+	/** Blocks until task is finished, calling thread executes other queued jobs while waiting */
+	void Wait() const;
+
+	/** @returns handle usable with FAsyncJobHandle::WaitForAll */
+	NO_DISCARD FAsyncJobHandle GetJobHandle() const;
+
+protected:
+	FGraphTaskHandle(FThreadsManager* InThreadsManager, const std::shared_ptr<FGraphTask>& InGraphTask);
+
+	FThreadsManager* ThreadsManager;
+
+	std::shared_ptr<FGraphTask> GraphTask;
+
+};
+
+/**
+ * Task graph built on top of FThreadsManager.
+ * Allows adding tasks with prerequisites, continuations on main thread and splitting loops with ParallelFor.
+ * Does not own tasks, graph can be destroyed while tasks are still running.
+ */
+class ENGINE_API FTaskGraph
+{
+public:
+	FTaskGraph(FThreadsManager* InThreadsManager);
+
+	/**
+	 * Add task which will start when all InPrerequisites are finished.
+	 * MainThread tasks are executed on main thread, so it can be used as continuation of async work.
+	 */
+	FGraphTaskHandle AddTask(FDelegateSafe<>& TaskDelegate, const CArray<FGraphTaskHandle>& InPrerequisites = {}, const ETaskThread TaskThread = ETaskThread::AnyThread);
+
+	/**
+	 * Calls Function for each index in range [0, Number) on workers and calling thread, returns when all are done.
+	 * Indexes are taken in batches of at least MinBatchSize, so cheap bodies should use bigger batches.
+	 * Can be called from inside of other tasks.
+	 */
+	void ParallelFor(const int32 Number, FFunctorLambda<void, int32> Function, const int32 MinBatchSize = 1);
+
+	/** Same as ParallelFor but executed as graph task, so it can have prerequisites and be waited on later */
+	FGraphTaskHandle AddParallelForTask(const int32 Number, FFunctorLambda<void, int32> Function, const CArray<FGraphTaskHandle>& InPrerequisites = {}, const int32 MinBatchSize = 1);
+
+	/** Blocks until all tasks are finished */
+	static void WaitForAll(const CArray<FGraphTaskHandle>& InTaskHandles);
+
+protected:
+	/** Sends task to worker or main thread queue. Static as tasks may outlive graph. */
+	static void StartTask(FThreadsManager* InThreadsManager, const std::shared_ptr<FGraphTask>& GraphTask);
+
+	/** Executes task and starts subsequents which have no more pending prerequisites */
+	static void ExecuteTask(FThreadsManager* InThreadsManager, const std::shared_ptr<FGraphTask>& GraphTask);
+
+	/** Removes one pending prerequisite, starts task if it was last one */
+	static void OnPrerequisiteFinished(FThreadsManager* InThreadsManager, const std::shared_ptr<FGraphTask>& GraphTask);
+
+	/** Implementation of ParallelFor, static so it can be used from tasks */
+	static void ParallelForInternal(FThreadsManager* InThreadsManager, const int32 Number, FFunctorLambda<void, int32>& Function, const int32 MinBatchSize);
+
+protected:
+	FThreadsManager* ThreadsManager;
+
+};
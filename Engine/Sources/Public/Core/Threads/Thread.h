@@ -33,8 +33,8 @@ private:
 	/** Thread name visible in debugger etc... */
 	std::string ThreadName;
 
-	/** This setting is used to stop thread. */
-	bool bThreadAlive;
+	/** This setting is used to stop thread. Atomic as it's written from main thread and read from thread itself. */
+	std::atomic<bool> bThreadAlive;
 
 };
 
@@ -84,7 +84,7 @@ private:
 
 /**
  * Thread class for ThreadManager
- * Takes and executes jobs from ThreadManager
+ * Takes and executes jobs from own queue in ThreadManager, steals from other workers when own queue is empty
  * This thread class removes itself on stop
  */
 class ENGINE_API FThreadWorker : public FThread
@@ -95,6 +95,8 @@ class ENGINE_API FThreadWorker : public FThread
 protected:
 	FThreadWorker(FThreadInputData* InThreadInputData, FThreadData* InThreadData);
 
+	void InitThread() override;
+	void StopThread() override;
 	void TickThread() override;
 	void OnFinishThread() override;
 
@@ -122,10 +124,17 @@ protected:
 
 	void TickThread() override;
 	void StartThread() override;
+	void StopThread() override;
 
 	/** Queue which is removed after execution */
 	CQueueSafe<FFunctorLambda<void>> GenericThreadTaskQueue;
 
+	/** Thread sleeps on this condition when GenericThreadTaskQueue is empty */
+	std::condition_variable GenericThreadTaskCondition;
+
+	/** Mutex for param GenericThreadTaskCondition */
+	std::mutex GenericThreadTaskConditionMutex;
+
 	/** By default we remove done jobs, but we can remove it when we want to run it in loop */
 	bool bShouldRemoveDoneJobs;
 
@@ -49,6 +49,9 @@ class ENGINE_API FThreadWorkerData : public FThreadData
 public:
 	FThreadWorkerData(FThreadsManager* InThreadsManager, const std::string& InNewThreadName);
 
+	/** @returns number of thread, also index of job queue used by this worker */
+	int GetThreadNumber() const { return ThreadNumber; }
+
 protected:
 	int ThreadNumber;
 };
@@ -2,11 +2,26 @@
 
 #pragma once
 
+/** Shared state of single async job, used by FAsyncJobHandle to know when work is done */
+struct FAsyncJobState
+{
+	FAsyncJobState()
+		: bIsFinished(false)
+	{
+	}
+
+	/** Set by worker after DelegateToRunAsync was executed (or job was removed by ResetAllJobs) */
+	std::atomic<bool> bIsFinished;
+};
+
 /** Structure for exectution by Worker threads */
 struct FAsyncWorkStructure
 {
 	std::shared_ptr<FDelegateSafe<>> DelegateToRunAsync;
 	std::shared_ptr<FDelegateSafe<>> AsyncCallback;
+
+	/** Created when work is added to FThreadsManager */
+	std::shared_ptr<FAsyncJobState> JobState;
 };
 
 /** Structure for exectution when async work finishes */
@@ -22,4 +37,33 @@ struct FMainThreadCallbackStructure
 	}
 
 	std::shared_ptr<FDelegateSafe<>> AsyncCallback;
-};
\ No newline at end of file
+};
+
+/**
+ * Handle to job added to FThreadsManager.
+ * Can be copied, can be waited on.
+ */
+class ENGINE_API FAsyncJobHandle
+{
+public:
+	FAsyncJobHandle();
+	FAsyncJobHandle(FThreadsManager* InThreadsManager, const std::shared_ptr<FAsyncJobState>& InJobState);
+
+	/** @returns true if handle points to job */
+	NO_DISCARD bool IsValid() const;
+
+	/** @returns true when async part of job is done. AsyncCallback may still wait for main thread. */
+	NO_DISCARD bool IsFinished() const;
+
+	/** Blocks until job is finished, calling thread executes other queued jobs while waiting. */
+	void Wait() const;
+
+	/** Blocks until all jobs are finished */
+	static void WaitForAll(const CArray<FAsyncJobHandle>& InJobHandles);
+
+protected:
+	FThreadsManager* ThreadsManager;
+
+	std::shared_ptr<FAsyncJobState> JobState;
+
+};
@@ -6,14 +6,20 @@
 #include "Thread.h"
 #include "ThreadStructure.h"
 #include "ThreadData.h"
+#include "Containers/WorkStealingQueue.h"
+
+class FTaskGraph;
 
 /**
  * Class for managing threads using SDL2.
+ * Each worker has its own job queue, idle workers steal jobs from queues of other workers.
  */
 class ENGINE_API FThreadsManager
 {
 	friend FThread;
 	friend FThreadWorker;
+	friend FAsyncJobHandle;
+	friend FTaskGraph;
 
 public:
 	FThreadsManager();
@@ -28,13 +34,16 @@ public:
 	void TickThreadCallbacks();
 
 	/** Add delegate which will be run on first available async thread */
-	void AddAsyncDelegate(FDelegateSafe<>& DelegateToRunAsync);
+	FAsyncJobHandle AddAsyncDelegate(FDelegateSafe<>& DelegateToRunAsync);
 
 	/** Add delegate which will be run on first available async thread with main thread AsyncCallback */
-	void AddAsyncDelegate(FDelegateSafe<>& DelegateToRunAsync, FDelegateSafe<>& AsyncCallback);
+	FAsyncJobHandle AddAsyncDelegate(FDelegateSafe<>& DelegateToRunAsync, FDelegateSafe<>& AsyncCallback);
 
-	/** Add delegate which will be run on first available async thread by passing structure */
-	void AddAsyncWork(const FAsyncWorkStructure& AsyncRunWithCallback);
+	/**
+	 * Add delegate which will be run on first available async thread by passing structure
+	 * When called from worker thread job goes to queue of that worker, otherwise queues are filled in round robin.
+	 */
+	FAsyncJobHandle AddAsyncWork(FAsyncWorkStructure AsyncRunWithCallback);
 
 	/** Creates thread for use, use StopThread to disable and automatically delete thread */
 	template<typename TThreadClass, typename TThreadDataClass>
@@ -53,6 +62,12 @@ public:
 		return ThreadData;
 	}
 
+	/** Add callback which will be executed on main thread in TickThreadCallbacks */
+	void AddMainThreadCallback(const std::shared_ptr<FDelegateSafe<>>& InCallback);
+
+	/** @returns true if called from thread which called Initialize */
+	NO_DISCARD bool IsInMainThread() const;
+
 	/** Sets flag to stop a thread, will not be immediate stop. */
 	void TryStopThread(FThreadData* ThreadData);
 
@@ -63,7 +78,7 @@ public:
 
 protected:
 	/** Creates thread for use, use StopThread to disable and automatically delete thread */
-	FThreadWorkerData* CreateThreadWorker(const std::string& NewThreadName);
+	FThreadWorkerData* CreateThreadWorker(const std::string& NewThreadName, const int32 ThreadNumber);
 
 	/** Starts a new thread if there is free number in pool available, see param AvailableThreadsNumbers */
 	void StartNewThread();
@@ -77,16 +92,56 @@ protected:
 	/** @returuns number of system available cores */
 	static int32 GetNumberOfCores();
 
-	/** Used by threads to actually do the job */
-	FAsyncWorkStructure GetFirstAvailableJob();
+	/**
+	 * Takes job from queue with index QueueIndex or steals from other queues if it's empty.
+	 * Use INDEX_NONE as QueueIndex when calling from thread without own queue.
+	 * @returns true if OutAsyncWorkStructure was set
+	 */
+	bool TryGetJob(const int32 QueueIndex, FAsyncWorkStructure& OutAsyncWorkStructure);
+
+	/** Takes single job (own queue first when called from worker) and executes it on calling thread. @returns true if job was executed */
+	bool TryExecuteSingleJob();
+
+	/** Executes oldest main thread callback, must be called from main thread. @returns true if callback was executed */
+	bool TryExecuteSingleMainThreadCallback();
+
+	/** Runs job, enqueues AsyncCallback and marks job as finished */
+	void ExecuteJob(FAsyncWorkStructure& AsyncWorkStructure);
+
+	/** Called from worker thread before first tick to bind thread with its queue */
+	void RegisterWorkerQueueForCurrentThread(const int32 QueueIndex);
+
+	/** @returns index of queue owned by calling thread or INDEX_NONE if it's not worker of this manager */
+	int32 GetQueueIndexForCurrentThread() const;
+
+	/** Called from worker when there is nothing to do, sleeps until job is added or thread is stopped */
+	void WaitForWork(const FThreadInputData* InThreadInputData);
+
+	/** Wakes one sleeping worker if there is any, called after job is added */
+	void WakeWorker();
+
+	/** Wakes all sleeping workers, used when stopping threads */
+	void WakeAllWorkers();
 
 	bool HasAnyJobLeft() const;
 
-	/** Queue of async jobs to be done */
-	CDeque<FAsyncWorkStructure> AsyncJobQueue;
+	/** Job queue for each worker, index is ThreadNumber of worker */
+	CArray<std::shared_ptr<CWorkStealingQueue<FAsyncWorkStructure>>> WorkerJobQueues;
+
+	/** Number of jobs in all WorkerJobQueues */
+	std::atomic<int32> NumberOfQueuedJobs;
+
+	/** Used for round robin when job is added from thread without own queue */
+	std::atomic<uint32> NextQueueIndexForExternalJob;
 
-	/** Mutex for param AsyncJobQueue */
-	std::mutex AsyncJobQueueMutex;
+	/** Workers without work sleep on this condition */
+	std::condition_variable WorkAvailableCondition;
+
+	/** Mutex for param WorkAvailableCondition */
+	std::mutex WorkAvailableMutex;
+
+	/** Number of workers sleeping on WorkAvailableCondition, lets AddAsyncWork skip locking when all are busy */
+	std::atomic<int32> NumberOfSleepingWorkers;
 
 	/** Callbacks from finishes async jobs */
 	CArray<FMainThreadCallbackStructure> MainThreadCallbacks;
@@ -96,6 +151,9 @@ protected:
 
 	CArray<FMainThreadCallbackStructure> MainThreadCallbacksCopy;
 
+	/** Thread which called Initialize */
+	std::thread::id MainThreadId;
+
 	int StartingNumberOfThreads;
 
 private:
@@ -111,6 +169,9 @@ private:
 	/** Mutex for param WorkerThreadsArray */
 	std::mutex WorkerThreadsArrayMutex;
 
+	/** Notified when thread is removed from WorkerThreadsArray or AllThreadsArray, used by DeInitialize */
+	std::condition_variable ThreadRemovedCondition;
+
 	/** Number with thread Id for naming */
 	CArray<int> AvailableThreadsNumbers;
 
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "TimerWheel.h"
+
 class FTimer;
 
 /**
@@ -15,6 +17,7 @@ struct FOptionalTimerParams
 
 /**
  * Global registry for timers.
+ * Register and unregister are O(1), each timer keeps its index in Timers array.
  */
 class FTimerCollector
 {
@@ -36,16 +39,22 @@ protected:
 	CArray<FTimer*> Timers;
 	CArray<FTimer*> PausedTimers;
 
+	/** Timers can be created and destroyed from async callbacks */
+	std::mutex TimersMutex;
+
 	bool bAreTimersPaused;
 
 };
 
 /**
- * Timer class is used for managing raw sdl timer.
+ * Timer scheduled in engine FTimerWheel, which is advanced by main loop.
  * It has FOptionalTimerParams that will be passed to delegate on timer finish. if needed you can override it and pass custom
+ * Sync timers call delegate on main thread at start of tick, async timers call it on first available async thread.
  */
-class FTimer
+class FTimer : public FTimerWheelEntry
 {
+	friend FTimerCollector;
+
 public:
 	/**
 	 * Constructor using float. 1 MS equals 0.001.
@@ -59,10 +68,7 @@ public:
 	 */
 	FTimer(FDelegateSafe<void, FOptionalTimerParams*>& InOnFinishDelegate, const Uint32 Time, std::shared_ptr<FOptionalTimerParams> InOptionalTimerParams = nullptr, bool bInRunAsyncOnFinish = true);
 
-	virtual ~FTimer();
-
-	/** Called when timer finishes */
-	static Uint32 OnTimerFinished(void* InOptionalTimerParams, SDL_TimerID InTimerID, Uint32 InInterval);
+	~FTimer() override;
 
 	void OnSynchronousTimerFinished();
 
@@ -83,7 +89,7 @@ public:
 
 	Uint32 GetTimeMSElapsedSinceStart() const;
 
-	/** @returns raw SDL Timer id */
+	/** @returns unique id given to timer each time it's started */
 	SDL_TimerID GetTimerId() const;
 
 	FOptionalTimerParams* GetOptionalTimerParams() const;
@@ -92,6 +98,10 @@ public:
 	float GetTimerPercent() const;
 
 protected:
+	/** Begin FTimerWheelEntry interface */
+	void OnTimerWheelEntryExpired() override;
+	/** End FTimerWheelEntry interface */
+
 	/** Function used by constructors to run function */
 	void InitializeTimer();
 
@@ -106,14 +116,17 @@ private:
 	bool bRunAsyncOnFinish;
 
 	/** True if running, false if paused */
-	bool bIsTimerActive;
+	std::atomic_bool bIsTimerActive;
 
-	/** Delegate called when  */
-	FDelegateSafe<void, FOptionalTimerParams*> OnFinishDelegate;
+	/** Delegate called when timer finishes, shared with queued async delegates */
+	std::shared_ptr<FDelegateSafe<void, FOptionalTimerParams*>> OnFinishDelegate;
 
 	/** Optional parameters passed in with delegates */
 	std::shared_ptr<FOptionalTimerParams> OptionalTimerParams;
 
+	/** Set by destructor, async delegates queued before skip OnFinishDelegate */
+	std::shared_ptr<std::atomic_bool> bIsTimerDestroyed;
+
 	/** Time left of time set on begging or pause */
 	Uint32 TimeLeftRaw;
 
@@ -125,4 +138,7 @@ private:
 
 	SDL_TimerID TimerIDRaw;
 
+	/** Index in FTimerCollector::Timers */
+	int32 TimerCollectorIndex;
+
 };
@@ -11,20 +11,19 @@ class FTimerManager
 {
 public:
 	/**
-	 * Call to create new timer that will be run on async timer thread on end.
-	 * Note that this async thread is used for timer so using it too heavily can affect other timers.
+	 * Call to create new timer that will be run on first available async thread on end.
 	 *
 	 * @param InOnFinishDelegate	Delegate to call when timer finishes
 	 * @param Time					Time to trigger Delegate
-	 * @param OptionalTimerParams	Optional params which will be transformed into shared_ptr, so you can use new and do not worry about memory
+	 * @param OptionalTimerParams	Optional params which will be transformed into shared_ptr, so you can use new and do not worry about memory. Default params are created when nullptr.
 	 * @return						Timer shared_ptr which can be managed if needed (pause, start, etc...)
 	 *
 	 * @note						!! You have to save returned shared_ptr somewhere in your code or it will be immediately REMOVED. !!
 	 */
 	template<typename TOptionalTimerParams = FOptionalTimerParams>
-	static std::shared_ptr<FTimer> CreateTimerAsync(FDelegateSafe<void, FOptionalTimerParams*>& InOnFinishDelegate, const float Time, TOptionalTimerParams* OptionalTimerParams = new TOptionalTimerParams())
+	static std::shared_ptr<FTimer> CreateTimerAsync(FDelegateSafe<void, FOptionalTimerParams*>& InOnFinishDelegate, const float Time, TOptionalTimerParams* OptionalTimerParams = nullptr)
 	{
-		std::shared_ptr<TOptionalTimerParams> OptionalTimerParamsPtr = std::make_shared<TOptionalTimerParams>();
+		std::shared_ptr<TOptionalTimerParams> OptionalTimerParamsPtr = MakeOptionalTimerParams(OptionalTimerParams);
 
 		std::shared_ptr<FTimer> TimerPtr = std::make_shared<FTimer>(InOnFinishDelegate, Time, OptionalTimerParamsPtr, true);
 
@@ -36,15 +35,15 @@ public:
 	 *
 	 * @param InOnFinishDelegate	Delegate to call when timer finishes
 	 * @param Time					Time to trigger Delegate
-	 * @param OptionalTimerParams	Optional params which will be transformed into shared_ptr, so you can use new and do not worry about memory
+	 * @param OptionalTimerParams	Optional params which will be transformed into shared_ptr, so you can use new and do not worry about memory. Default params are created when nullptr.
 	 * @return						Timer shared_ptr which can be managed if needed (pause, start, etc...)
 	 *
 	 * @note						!! You have to save returned shared_ptr somewhere in your code or it will be immediately REMOVED. !!
 	 */
 	template<typename TOptionalTimerParams = FOptionalTimerParams>
-	static std::shared_ptr<FTimer> CreateTimerSync(FDelegateSafe<void, FOptionalTimerParams*>& InOnFinishDelegate, const float Time, TOptionalTimerParams* OptionalTimerParams = new TOptionalTimerParams())
+	static std::shared_ptr<FTimer> CreateTimerSync(FDelegateSafe<void, FOptionalTimerParams*>& InOnFinishDelegate, const float Time, TOptionalTimerParams* OptionalTimerParams = nullptr)
 	{
-		std::shared_ptr<TOptionalTimerParams> OptionalTimerParamsPtr = std::make_shared<TOptionalTimerParams>();
+		std::shared_ptr<TOptionalTimerParams> OptionalTimerParamsPtr = MakeOptionalTimerParams(OptionalTimerParams);
 
 		std::shared_ptr<FTimer> TimerPtr = std::make_shared<FTimer>(InOnFinishDelegate, Time, OptionalTimerParamsPtr, false);
 
@@ -52,23 +51,22 @@ public:
 	}
 
 	/**
-	 * Call to create new timer that will be run on async timer thread on end.
-	 * Note that this async thread is used for timer so using it too heavily can affect other timers.
+	 * Call to create new timer that will be run on first available async thread on end.
 	 *
 	 * @param Lambda				Lambda to call when timer finishes
 	 * @param Time					Time to trigger Delegate
-	 * @param OptionalTimerParams	Optional params which will be transformed into shared_ptr, so you can use new and do not worry about memory
+	 * @param OptionalTimerParams	Optional params which will be transformed into shared_ptr, so you can use new and do not worry about memory. Default params are created when nullptr.
 	 * @return						Timer shared_ptr which can be managed if needed (pause, start, etc...)
 	 *
 	 * @note						!! You have to save returned shared_ptr somewhere in your code or it will be immediately REMOVED. !!
 	 */
 	template<typename TOptionalTimerParams = FOptionalTimerParams, typename TAutoLambdaType>
-	static std::shared_ptr<FTimer> CreateTimerAsync(TAutoLambdaType Lambda, const float Time, TOptionalTimerParams* OptionalTimerParams = new TOptionalTimerParams())
+	static std::shared_ptr<FTimer> CreateTimerAsync(TAutoLambdaType Lambda, const float Time, TOptionalTimerParams* OptionalTimerParams = nullptr)
 	{
 		FDelegateSafe<void, FOptionalTimerParams*> OnFinishDelegate;
 		OnFinishDelegate.BindLambda(Lambda);
 
-		std::shared_ptr<TOptionalTimerParams> OptionalTimerParamsPtr = std::make_shared<TOptionalTimerParams>();
+		std::shared_ptr<TOptionalTimerParams> OptionalTimerParamsPtr = MakeOptionalTimerParams(OptionalTimerParams);
 
 		std::shared_ptr<FTimer> TimerPtr = std::make_shared<FTimer>(OnFinishDelegate, Time, OptionalTimerParamsPtr, true);
 
@@ -76,27 +74,39 @@ public:
 	}
 
 	/**
-	 * Call to create new timer that will be run on async timer thread on end.
-	 * Note that this async thread is used for timer so using it too heavily can affect other timers.
+	 * Call to create new timer that will be run on main thread at start of tick after timer finishes.
 	 *
 	 * @param Lambda				Lambda to call when timer finishes
 	 * @param Time					Time to trigger Delegate
-	 * @param OptionalTimerParams	Optional params which will be transformed into shared_ptr, so you can use new and do not worry about memory
+	 * @param OptionalTimerParams	Optional params which will be transformed into shared_ptr, so you can use new and do not worry about memory. Default params are created when nullptr.
 	 * @return						Timer shared_ptr which can be managed if needed (pause, start, etc...)
 	 *
 	 * @note						!! You have to save returned shared_ptr somewhere in your code or it will be immediately REMOVED. !!
 	 */
 	template<typename TOptionalTimerParams = FOptionalTimerParams, typename TAutoLambdaType>
-	static std::shared_ptr<FTimer> CreateTimerSync(TAutoLambdaType Lambda, const float Time, TOptionalTimerParams* OptionalTimerParams = new TOptionalTimerParams())
+	static std::shared_ptr<FTimer> CreateTimerSync(TAutoLambdaType Lambda, const float Time, TOptionalTimerParams* OptionalTimerParams = nullptr)
 	{
 		FDelegateSafe<void, FOptionalTimerParams*> OnFinishDelegate;
 		OnFinishDelegate.BindLambda(Lambda);
 
-		std::shared_ptr<TOptionalTimerParams> OptionalTimerParamsPtr = std::make_shared<TOptionalTimerParams>();
+		std::shared_ptr<TOptionalTimerParams> OptionalTimerParamsPtr = MakeOptionalTimerParams(OptionalTimerParams);
 
 		std::shared_ptr<FTimer> TimerPtr = std::make_shared<FTimer>(OnFinishDelegate, Time, OptionalTimerParamsPtr, false);
 
 		return TimerPtr;
 	}
 
+protected:
+	/** Takes ownership of passed params or creates default ones */
+	template<typename TOptionalTimerParams>
+	static std::shared_ptr<TOptionalTimerParams> MakeOptionalTimerParams(TOptionalTimerParams* OptionalTimerParams)
+	{
+		if (OptionalTimerParams != nullptr)
+		{
+			return std::shared_ptr<TOptionalTimerParams>(OptionalTimerParams);
+		}
+
+		return std::make_shared<TOptionalTimerParams>();
+	}
+
 };
@@ -0,0 +1,125 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+class FTimerWheel;
+
+/** Intrusive doubly linked list node, used for wheel slots (as list head) and entries */
+struct FTimerWheelLink
+{
+	FTimerWheelLink()
+		: Previous(nullptr)
+		, Next(nullptr)
+	{
+	}
+
+	FTimerWheelLink* Previous;
+	FTimerWheelLink* Next;
+};
+
+/**
+ * Object which can be scheduled in FTimerWheel.
+ * Entry is not owned by wheel, owner must cancel it before destruction (see FTimer).
+ */
+class ENGINE_API FTimerWheelEntry : protected FTimerWheelLink
+{
+	friend FTimerWheel;
+
+public:
+	FTimerWheelEntry();
+	virtual ~FTimerWheelEntry() = default;
+
+	/** @returns true if entry is waiting in wheel (or is about to be fired) */
+	NO_DISCARD bool IsScheduledInTimerWheel() const { return (TimerWheel.load() != nullptr); }
+
+	/** Removes entry from wheel where it's scheduled. @returns true if entry was removed, false if it was not scheduled */
+	bool CancelInTimerWheel();
+
+	/** @returns time (ms) when entry will expire */
+	NO_DISCARD Uint64 GetTimerWheelExpireTime() const { return ExpireTime; }
+
+protected:
+	/** Called by wheel owner thread inside of FTimerWheel::Advance, entry is already removed from wheel so it can be scheduled again */
+	virtual void OnTimerWheelEntryExpired() = 0;
+
+private:
+	/** Wheel where entry is scheduled, nullptr when not scheduled. Changed only with wheel lock. */
+	std::atomic<FTimerWheel*> TimerWheel;
+
+	Uint64 ExpireTime;
+
+};
+
+/**
+ * Hierarchical timing wheel with 1 ms resolution.
+ * First level has 256 slots of 1 ms, each next level has 64 slots covering whole previous level.
+ * When time passes full lap of a level, next level slot is cascaded into lower levels.
+ * Schedule and cancel are O(1), advancing costs O(1) per elapsed ms plus fired entries.
+ * Entries beyond range of last level (~18 hours) are kept in last level and cascaded again until in range.
+ *
+ * Schedule and cancel are thread safe. Advance must be called from single thread (main loop), entries are fired on that thread.
+ */
+class ENGINE_API FTimerWheel
+{
+public:
+	FTimerWheel(const Uint64 InStartTime);
+	~FTimerWheel();
+
+	/** Add entry to wheel, if it's already scheduled it's moved to new time. Entries in the past expire on next Advance. */
+	void Schedule(FTimerWheelEntry* Entry, const Uint64 InExpireTime);
+
+	/** Remove entry from wheel. @returns true if entry was removed, false if it was not scheduled (for example already fired) */
+	bool Cancel(FTimerWheelEntry* Entry);
+
+	/** Fire all entries with expire time lower or equal to InCurrentTime */
+	void Advance(const Uint64 InCurrentTime);
+
+	/** @returns number of entries waiting in wheel */
+	NO_DISCARD int32 GetNumberOfScheduledEntries() const { return NumberOfScheduledEntries; }
+
+	/** @returns next time (ms) which is not processed yet */
+	NO_DISCARD Uint64 GetCurrentTime() const { return CurrentTime; }
+
+	static constexpr int32 FirstLevelBits = 8;
+	static constexpr int32 LevelBits = 6;
+	static constexpr int32 NumberOfLevels = 4;
+
+	static constexpr int32 FirstLevelSize = 1 << FirstLevelBits;
+	static constexpr int32 LevelSize = 1 << LevelBits;
+
+	/** Time range (ms) covered by all levels */
+	static constexpr Uint64 MaxScheduleTime = (static_cast<Uint64>(1) << (FirstLevelBits + (LevelBits * (NumberOfLevels - 1)))) - 1;
+
+protected:
+	/** Puts entry into slot selected by its expire time, must be called with lock */
+	void AddToSlot(FTimerWheelEntry* Entry);
+
+	/** Moves all entries from slot of given level into lower levels, must be called with lock. @returns slot index of given level for current time */
+	int32 Cascade(const int32 Level);
+
+	/** @returns slot list head */
+	FTimerWheelLink* GetSlot(const int32 Level, const int32 SlotIndex);
+
+	static void LinkAfter(FTimerWheelLink* Head, FTimerWheelLink* Link);
+	static void Unlink(FTimerWheelLink* Link);
+
+	/** Moves all links of slot to end of ExpiredList */
+	void MoveSlotToExpiredList(FTimerWheelLink* Slot);
+
+protected:
+	/** Slot heads, FirstLevelSize slots then LevelSize slots for each other level */
+	FTimerWheelLink Slots[FirstLevelSize + (LevelSize * (NumberOfLevels - 1))];
+
+	/** Entries which expired but were not fired yet, so they can still be cancelled from callbacks */
+	FTimerWheelLink ExpiredList;
+
+	/** Next ms to process */
+	Uint64 CurrentTime;
+
+	/** Entries in slots and ExpiredList */
+	int32 NumberOfScheduledEntries;
+
+	/** Lock for slots, Advance releases it while firing */
+	std::mutex WheelMutex;
+
+};
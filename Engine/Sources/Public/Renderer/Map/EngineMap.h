@@ -4,9 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Map.h"
+#include "MapChunkRenderer.h"
 
 /**
  * Base class for map with default map rendering
+ * Tiles are rendered in chunks baked into textures, see FMapChunkRenderer
  */
 class FEngineMap : public FMap
 {
@@ -15,7 +17,23 @@ public:
 	~FEngineMap() override = default;
 
 	/** Begin FMap */
+	void Initialize() override;
+	void DeInitialize() override;
 	void Render() override;
+	void ClearData() override;
 	/** End FMap */
 
+	const FMapChunkRenderer& GetChunkRenderer() const { return ChunkRenderer; }
+
+protected:
+	/** Begin FMap */
+	void ReadAsset() override;
+	/** End FMap */
+
+	void OnMapTileChanged(FVector2D<int32> InTile);
+	void OnRenderTargetsReset();
+
+protected:
+	FMapChunkRenderer ChunkRenderer;
+
 };
@@ -46,6 +46,9 @@ public:
 	/** Map asset used to load / save this map */
 	FMapAsset* GetMapAsset() const { return MapAsset; }
 
+	/** Tiles and collision settings of this map */
+	const FMapData& GetMapData() const { return MapData; }
+
 	/** Checks given location (assumes it's absolute) if it's inside of bounds */
 	bool IsInBounds(const FVector2D<int>& Location) const;
 
@@ -61,6 +64,9 @@ public:
 	/** Changes tile at given @Location with given @MapAssetIndexToSet. */
 	void ChangeTileAtLocation(const FVector2D<int32>& Location, int32 MapAssetIndexToSet);
 
+	/** Delegate triggered each time when tile is changed - Send location of tile (in tiles) */
+	FDelegate<void, FVector2D<int32>>& GetMapTileChangedDelegate();
+
 protected:
 	/** Reads data from asset into this class from MapAsset memory */
 	virtual void ReadAsset();
@@ -91,6 +97,9 @@ protected:
 	/** MapLocationChangeDelegate for map location change - Send new offset each time it's called */
 	FDelegate<void, FVector2D<int>> MapLocationChangeDelegate;
 
+	/** MapTileChangedDelegate for tile change - Send location of changed tile */
+	FDelegate<void, FVector2D<int32>> MapTileChangedDelegate;
+
 	/** Minimal render tile offset - Everything before that vector will not be rendered */
 	FVector2D<int32> MapLocationTileOffsetMin;
 	FVector2D<int32> MapLocationTileOffsetMax;
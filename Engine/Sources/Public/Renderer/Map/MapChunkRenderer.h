@@ -0,0 +1,102 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMapData;
+
+/**
+ * Renders map tiles in square chunks.
+ * Each chunk is baked once into render target texture and then drawn with single draw call,
+ * chunk is baked again only when one of its tiles changes.
+ * Only visible chunks are baked and drawn, textures of chunks not seen for longest time are released above MaxNumberOfChunkTextures.
+ * When renderer does not support render targets tiles are drawn one by one.
+ */
+class ENGINE_API FMapChunkRenderer
+{
+public:
+	FMapChunkRenderer();
+	~FMapChunkRenderer();
+
+	/** Prepares chunks for size of map, all chunks are dirty */
+	void Initialize(SDL_Renderer* InRenderer, const FMapData& InMapData, const int32 InChunkSizeInTiles = DefaultChunkSizeInTiles);
+
+	/** Releases chunk textures, Initialize must be called before next Render */
+	void Clear();
+
+	/** @returns true if chunks match size of map and its tiles */
+	NO_DISCARD bool IsInitializedFor(const FMapData& InMapData) const;
+
+	/** Chunk with tile will be baked again before it's drawn */
+	void MarkTileDirty(const FVector2D<int32>& InTile);
+
+	/** All chunks will be baked again, for example when map data was read again */
+	void MarkAllChunksDirty();
+
+	/** Draws chunks visible in window, dirty ones are baked first */
+	void Render(const FMapData& InMapData, const FVector2D<int32>& InMapRenderOffset, const FVector2D<int32>& InWindowSize);
+
+	NO_DISCARD int32 GetChunkSizeInTiles() const { return ChunkSizeInTiles; }
+	NO_DISCARD int32 GetNumberOfChunks() const { return Chunks.Size(); }
+
+	/** @returns number of draw calls made by last Render, baking included */
+	NO_DISCARD int32 GetLastNumberOfDrawCalls() const { return LastNumberOfDrawCalls; }
+
+	/** @returns number of chunks baked by last Render */
+	NO_DISCARD int32 GetLastNumberOfBakedChunks() const { return LastNumberOfBakedChunks; }
+
+	/** @returns number of times texture changed between tile draws of last Render, tiles packed in one atlas page share texture */
+	NO_DISCARD int32 GetLastNumberOfTextureSwitches() const { return LastNumberOfTextureSwitches; }
+
+	static constexpr int32 DefaultChunkSizeInTiles = 16;
+
+	/** 512x512 pixel chunks (16 tiles of 32 pixels) take 1MB each */
+	static constexpr int32 MaxNumberOfChunkTextures = 96;
+
+protected:
+	struct FMapChunk
+	{
+		SDL_Texture* Texture;
+
+		/** Frame when chunk was last visible, used to release textures of chunks far away */
+		uint64 LastVisibleFrame;
+
+		bool bIsDirty;
+	};
+
+	/** Records drawing of chunk tiles into its texture, @returns false if texture could not be created */
+	bool BakeChunk(const FMapData& InMapData, const int32 ChunkX, const int32 ChunkY, FMapChunk& InChunk);
+
+	/** Draws tiles of chunk directly to screen, used when render targets are not supported */
+	void DrawChunkTiles(const FMapData& InMapData, const int32 ChunkX, const int32 ChunkY, const FVector2D<int32>& InMapRenderOffset);
+
+	/** @returns size of chunk in tiles, chunks on right and bottom edge may be smaller */
+	NO_DISCARD FVector2D<int32> GetChunkSize(const int32 ChunkX, const int32 ChunkY) const;
+
+	/** Releases textures of chunks not visible for longest time */
+	void ReleaseChunkTextures();
+
+protected:
+	SDL_Renderer* Renderer;
+
+	CArray<FMapChunk> Chunks;
+
+	FVector2D<int32> NumberOfChunks;
+	FVector2D<int32> MapSizeInTiles;
+	FVector2D<int32> TileSize;
+
+	int32 ChunkSizeInTiles;
+
+	int32 NumberOfChunkTextures;
+
+	uint64 FrameNumber;
+
+	/** Cleared when creating render target fails, tiles are drawn directly then */
+	bool bIsRenderTargetSupported;
+
+	int32 LastNumberOfDrawCalls;
+	int32 LastNumberOfBakedChunks;
+	int32 LastNumberOfTextureSwitches;
+
+};
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Threads/RenderThread.h"
+#include "Renderer/SpriteBatch.h"
 
 class FTextureAsset;
 
@@ -60,6 +62,32 @@ public:
 
 	void SetWindowSize(const int32 X, const int32 Y, const bool bUpdateSDL = true) const;
 
+	/**
+	 * Sprites drawn until EndSpriteBatch are queued and drawn together in few large geometries, sorted by layer, then by first sprite of each texture.
+	 * Other draws flush queued sprites first, so they are still drawn on top of sprites drawn before them.
+	 * Can be nested, sprites are drawn when outermost batch ends.
+	 */
+	void BeginSpriteBatch();
+	void EndSpriteBatch();
+
+	/** @returns true between BeginSpriteBatch and EndSpriteBatch */
+	NO_DISCARD bool IsSpriteBatching() const { return SpriteBatchDepth > 0; }
+
+	/** Draws queued sprites now. Call before drawing with ExecuteOrEnqueue directly while batching. */
+	void FlushSpriteBatch() const;
+
+	/** Queues sprite when batching, otherwise draws it now. Destination is in map space when bIsLocationRelative. */
+	void DrawSprite(FSpriteDrawRequest InSprite, const bool bIsLocationRelative = true) const;
+
+	/** @returns part of texture in pixels converted to texture coordinates used by FSpriteDrawRequest */
+	static SDL_FRect ConvertSourceRectToUV(SDL_Texture* Texture, const SDL_FRect& SourceRect);
+
+	/** @returns number of sprites drawn in last frame */
+	NO_DISCARD int32 GetLastNumberOfSprites() const { return LastNumberOfSprites; }
+
+	/** @returns number of geometry draw calls used for sprites in last frame */
+	NO_DISCARD int32 GetLastNumberOfSpriteSubmissions() const { return LastNumberOfSpriteSubmissions; }
+
 	void DrawTexture(const FTextureAsset* Texture,	FVector2D<float> Location, const FVector2D<float> Size, const bool bIsLocationRelative = true) const;
 
 	void DrawTexture(SDL_Texture* Texture,			FVector2D<float> Location, const FVector2D<float> Size, const bool bIsLocationRelative = true) const;
@@ -70,9 +98,27 @@ public:
 	void DrawTextureAdvanced(SDL_Texture* Texture,			FVector2D<float> Location, const FVector2D<float> Size, const double Rotation,
 		const FVector2D<float> CenterOfRotation = FVector2D<float>(), SDL_FlipMode Flip = SDL_FLIP_NONE, const bool bIsLocationRelative = true) const;
 
+	/**
+	 * Draw triangles in single call, used to batch many sprites of same texture.
+	 * Texture can be nullptr for colored triangles. Vertex positions are in map space when bIsLocationRelative.
+	 * Buffers are moved into recorded frame when render thread is used.
+	 */
+	void DrawGeometry(SDL_Texture* Texture, std::vector<SDL_Vertex>&& Vertices, std::vector<int>&& Indices, const bool bIsLocationRelative = true) const;
+
+	/**
+	 * Same as above for buffers kept by caller between frames.
+	 * Without render thread and with screen space vertices (bIsLocationRelative false) nothing is copied,
+	 * otherwise buffers are copied as recorded frame needs own data.
+	 */
+	void DrawGeometry(SDL_Texture* Texture, const std::vector<SDL_Vertex>& Vertices, const std::vector<int>& Indices, const bool bIsLocationRelative = true) const;
+
+	/** Affects draws with SDL_RenderTexture only, sprites use color of FSpriteDrawRequest */
 	static void OverrideTextureColor(SDL_Texture* Texture, const FColorRGBA& Color);
 	static void OverrideTextureColorReset(SDL_Texture* Texture);
 
+	/** Destroys texture, when render thread is used it's destroyed after frames already recorded are submitted */
+	static void DestroyTextureDeferred(SDL_Texture* Texture);
+
 	/** Draw single point. Relative means to move with map */
 	void DrawPointAtRelative(const FColorPoint& ColorPoint) const;
 
@@ -104,6 +150,27 @@ public:
 	/** @returns render offset */
 	FVector2D<int> GetRenderOffset() const { return RenderOffset; }
 
+	/** @returns render thread when threaded rendering is enabled, nullptr when rendering inline */
+	static FRenderThread* GetRenderThread();
+
+	/**
+	 * Executes SDL calls now or records them for render thread.
+	 * Lambda must capture everything by value as it may be executed later.
+	 */
+	template<typename TLambda>
+	static void ExecuteOrEnqueue(TLambda Lambda, const ERenderOrder RenderOrder = ERenderOrder::Default)
+	{
+		FRenderThread* RenderThread = GetRenderThread();
+		if (RenderThread != nullptr)
+		{
+			RenderThread->EnqueueRenderLambda(std::move(Lambda), RenderOrder);
+		}
+		else
+		{
+			Lambda();
+		}
+	}
+
 protected:
 	/** Owner window pointer */
 	FWindow* Window;
@@ -116,6 +183,18 @@ protected:
 
 	bool bNeedsRepaint;
 
+	/** Draw functions are const, queued sprites are not part of renderer settings */
+	mutable FSpriteBatch SpriteBatch;
+
+	int32 SpriteBatchDepth;
+
+	/** Counted in current frame, moved to Last values in PreRender */
+	mutable int32 NumberOfSprites;
+	mutable int32 NumberOfSpriteSubmissions;
+
+	int32 LastNumberOfSprites;
+	int32 LastNumberOfSpriteSubmissions;
+
 	/**
 	 * Render offset. This offset is used to move screen.
 	 * @Note this offset only affects rendering.
@@ -0,0 +1,107 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Single sprite queued in FSpriteBatch */
+struct ENGINE_API FSpriteDrawRequest
+{
+	FSpriteDrawRequest();
+
+	SDL_Texture* Texture;
+
+	/** Drawn part of texture in texture coordinates (0 - 1), whole texture by default */
+	SDL_FRect SourceUV;
+
+	/** Rectangle on screen before rotation */
+	SDL_FRect Destination;
+
+	/** Degrees clockwise around CenterOfRotation */
+	double Rotation;
+
+	/** Relative to top left corner of destination */
+	FVector2D<float> CenterOfRotation;
+
+	SDL_FlipMode Flip;
+
+	/** Multiplies texture color */
+	FColorRGBA Color;
+
+	/** Lower layers are drawn first */
+	int32 Layer;
+};
+
+/** Triangles of sprites with same texture and layer, drawn with single SDL_RenderGeometry */
+struct FSpriteBatchGeometry
+{
+	FSpriteBatchGeometry()
+		: Texture(nullptr)
+		, Layer(0)
+	{
+	}
+
+	FSpriteBatchGeometry(SDL_Texture* InTexture, const int32 InLayer)
+		: Texture(InTexture)
+		, Layer(InLayer)
+	{
+	}
+
+	SDL_Texture* Texture;
+	int32 Layer;
+
+	std::vector<SDL_Vertex> Vertices;
+	std::vector<int> Indices;
+};
+
+/**
+ * Queue of sprites turned into few large vertex buffers.
+ * Sprites are grouped by layer and texture, each group becomes one geometry.
+ * Geometries are sorted by layer, inside layer by first sprite added to them, so order does not depend on texture addresses.
+ * Sprites of same texture and layer keep order they were added in, use layers when sprites of different textures overlap.
+ * Rotation and flip are done on CPU when building vertices.
+ * Has no SDL calls, drawing geometries is up to FRenderer.
+ */
+class ENGINE_API FSpriteBatch
+{
+public:
+	FSpriteBatch();
+
+	void AddSprite(const FSpriteDrawRequest& InSprite);
+
+	/** Sorts queued sprites and builds geometries, queue is empty after */
+	void BuildGeometries();
+
+	NO_DISCARD int32 GetNumberOfQueuedSprites() const { return Sprites.Size(); }
+
+	/** @returns number of geometries built by last BuildGeometries */
+	NO_DISCARD int32 GetNumberOfGeometries() const { return NumberOfGeometries; }
+
+	NO_DISCARD FSpriteBatchGeometry& GetGeometry(const int32 Index) { return Geometries[Index]; }
+
+	/** Writes 4 corners of sprite, clockwise from top left before rotation */
+	static void BuildSpriteVertices(const FSpriteDrawRequest& InSprite, SDL_Vertex* OutVertices);
+
+protected:
+	/** Sprites of same layer and texture */
+	struct FSpriteGroup
+	{
+		int32 Layer;
+		SDL_Texture* Texture;
+		int32 NumberOfSprites;
+		int32 GeometryIndex;
+	};
+
+	CArray<FSpriteDrawRequest> Sprites;
+
+	/** Scratch of BuildGeometries */
+	CArray<FSpriteGroup> Groups;
+	CArray<int32> SpriteGroupIndexes;
+	CArray<int32> GroupOrder;
+
+	/** Kept between builds, so buffers are reused */
+	CArray<FSpriteBatchGeometry> Geometries;
+
+	int32 NumberOfGeometries;
+
+};
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "../Widget.h"
+#include "Renderer/SpriteBatch.h"
+
+class FGlyphCache;
 
 /** What should happen if widget is too big? */
 enum class ETextRenderMode : Uint8
@@ -93,6 +96,18 @@ protected:
 	/** Makes new texture for text */
 	void RedrawText();
 
+	/** Lays out text from glyph cache, @returns false when text has to be rendered to texture instead */
+	bool RedrawTextWithGlyphs();
+
+	/** Renders whole text into TextTexture */
+	void RedrawTextTexture();
+
+	/** @returns glyph cache of current font size, nullptr when text is rendered to texture in current mode */
+	FGlyphCache* GetGlyphCache() const;
+
+	/** Moves glyph quads by change of widget location, so they are drawn as they are */
+	void MoveTextGeometriesToWidgetLocation();
+
 protected:
 	std::string DesiredText;
 	std::string RenderedText;
@@ -112,6 +127,15 @@ protected:
 	SDL_FRect* SDLRect;
 	SDL_Texture* TextTexture;
 
+	/** Quads of glyphs at TextGeometriesLocation, one geometry per glyph page */
+	CArray<FSpriteBatchGeometry> TextGeometries;
+
+	/** Location of widget baked into TextGeometries, updated on layout instead of every frame */
+	FVector2D<float> TextGeometriesLocation;
+
+	/** Text is drawn from TextGeometries instead of TextTexture */
+	bool bIsUsingGlyphs;
+
 	FVector2D<int32> LastTextTextureSize;
 
 	ETextRenderMode CurrentTextRenderMode;
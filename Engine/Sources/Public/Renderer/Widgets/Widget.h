@@ -8,6 +8,7 @@
 enum class EInputState;
 class FWidgetInputManager;
 class FInteractionBaseWidget;
+class FWidgetRenderCache;
 
 /** 
  * Widgets can be created only from within FWidgetManager which is inside window or inside other widgets.
@@ -57,6 +58,12 @@ protected:
 	virtual void OnWidgetVisibilityChanged();
 	void OnChildSizeChanged() override;
 
+	/** Begin IWidgetPositionInterface */
+	void UpdateWidgetLocation() override;
+	void UpdateWidgetSize(const bool bWasSentFromRebuild) override;
+	void OnClippingMethodChanged(EClipping NewClippingMethod) override;
+	/** End IWidgetPositionInterface */
+
 	virtual void OnMouseMove(FVector2D<int> InMousePosition, EInputState InputState);
 	virtual bool OnMouseLeftClick(FVector2D<int> InMousePosition, EInputState InputState);
 	virtual bool OnMouseRightClick(FVector2D<int> InMousePosition, EInputState InputState);
@@ -74,7 +81,26 @@ public:
 	void SetWidgetOrder(const int InWidgetOrder);
 	void SetShouldChangeSizeOnChildChange(const bool bInShouldChangeSizeOnChildChange);
 
+	/**
+	 * When enabled this widget and its children are drawn into texture, which is drawn again only after any of them changes.
+	 * Unchanged subtree costs single textured quad per frame. Children outside of this widget are cut.
+	 * Best for panels which rarely change. Widgets changing look without rebuild must call InvalidateRenderCache.
+	 */
+	void SetRenderCacheEnabled(const bool bInIsRenderCacheEnabled);
+	NO_DISCARD bool IsRenderCacheEnabled() const { return (RenderCache != nullptr); }
+
+	/** @returns cache of subtree or nullptr when it's not enabled */
+	NO_DISCARD const FWidgetRenderCache* GetRenderCache() const { return RenderCache; }
+	NO_DISCARD FWidgetRenderCache* GetRenderCache() { return RenderCache; }
+
+	/** Cached subtrees containing this widget will be drawn again. Call when look of widget changes. */
+	void InvalidateRenderCache();
+
+	/** Called when renderer lost content of render targets, caches of this widget and children are drawn again */
+	void OnRenderTargetsReset();
+
 	/** Begin IWidgetManagementInterface */
+	void RequestWidgetRebuild() override;
 	NO_DISCARD virtual FVector2D<int> GetWidgetManagerOffset() const override;
 	NO_DISCARD virtual FVector2D<int> GetWidgetManagerSize() const override;
 	NO_DISCARD virtual bool HasParent() const override;
@@ -123,6 +149,9 @@ protected:
 	/** Will be called when this widget or any parent was hidden */
 	void OnVisibilityChangedToHidden();
 
+	/** Draws subtree using RenderCache, @returns false if cache can not be used */
+	bool RenderWithCache();
+
 	/** True if WidgetManagementInterface decided to render this widget. */
 	bool bWasRenderedThisFrame;
 
@@ -151,6 +180,9 @@ private:
 	/** Cached input manager for widgets */
 	FWidgetInputManager* WidgetInputManager;
 
+	/** Texture with this widget and children, nullptr when render cache is disabled */
+	FWidgetRenderCache* RenderCache;
+
 #if WITH_WIDGET_DEBUGGER
 	bool bIsWidgetBeingDebugged;
 #endif
@@ -20,6 +20,7 @@ protected:
 	virtual void ReceiveTick();
 
 	/** Begin IWidgetManagementInterface */
+	void RenderWidgets() override;
 	NO_DISCARD FVector2D<int> GetWidgetManagerOffset() const override;
 	NO_DISCARD FVector2D<int> GetWidgetManagerSize() const override;
 	NO_DISCARD bool HasParent() const override;
@@ -31,11 +32,41 @@ protected:
 
 	void OnWindowSizeChanged();
 
+	/** Cached widgets lost their textures content, they are drawn again in next frame */
+	void OnRenderTargetsReset();
+
+public:
+	/** Called by widgets with render cache each time cache is drawn */
+	void AddRenderCacheDraw(const bool bWasRedrawn);
+
+	/** @returns number of cached widgets drawn from texture without drawing children in last frame */
+	NO_DISCARD int32 GetLastNumberOfRenderCacheHits() const { return NumberOfRenderCacheHits; }
+
+	/** @returns number of cached widgets drawn again in last frame */
+	NO_DISCARD int32 GetLastNumberOfRenderCacheRedraws() const { return NumberOfRenderCacheRedraws; }
+
+	/** When enabled cached widgets are outlined green when reused and orange when drawn again. Requires WITH_WIDGET_DEBUGGER. */
+	void SetRenderCacheOverlayEnabled(const bool bInIsRenderCacheOverlayEnabled) { bIsRenderCacheOverlayEnabled = bInIsRenderCacheOverlayEnabled; }
+	NO_DISCARD bool IsRenderCacheOverlayEnabled() const { return bIsRenderCacheOverlayEnabled; }
+
+	/** @returns layout work done in last frame, layout of tick and layout before render are summed */
+	NO_DISCARD const FWidgetLayoutStats& GetLastLayoutStats() const { return LastLayoutStats; }
+
 private:
 	/** Window where widgets are rendered */
 	FWindow* OwnerWindow;
 
 	/** Window size */
 	FVector2D<int> WidgetManagerSize;
+
+	/** Counted during RenderWidgets */
+	int32 NumberOfRenderCacheHits;
+	int32 NumberOfRenderCacheRedraws;
+
+	bool bIsRenderCacheOverlayEnabled;
+
+	/** Counted during current frame, moved to LastLayoutStats on tick */
+	FWidgetLayoutStats LayoutStats;
+	FWidgetLayoutStats LastLayoutStats;
 	
 };
@@ -0,0 +1,79 @@
+// Created by https://www.linkedin.com/in/przemek2122/ 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Render target texture with widget subtree drawn into it.
+ * Subtree is drawn again only after cache is marked dirty, otherwise texture is drawn with single textured quad.
+ * Pixels in texture are premultiplied by alpha, so semi-transparent widgets look same as when drawn directly.
+ * Draws between BeginRedraw and EndRedraw use same absolute locations as without cache, anything outside of cached area is cut.
+ */
+class ENGINE_API FWidgetRenderCache
+{
+public:
+	FWidgetRenderCache();
+	~FWidgetRenderCache();
+
+	/**
+	 * Makes cache texture render target and clears it, can be nested with other caches.
+	 * @returns false if texture can not be created, cached subtree should be drawn directly then
+	 */
+	bool BeginRedraw(SDL_Renderer* InRenderer, const FVector2D<int32>& InLocation, const FVector2D<int32>& InSize);
+
+	/** Restores render target used before BeginRedraw */
+	void EndRedraw();
+
+	/** Draws cached texture at location of last redraw */
+	void Draw();
+
+	/** Releases texture, for example when renderer changes. Cache is dirty after this call. */
+	void Release();
+
+	/** Next Draw must be preceded by redraw */
+	void MarkDirty() { bIsDirty = true; }
+	NO_DISCARD bool IsDirty() const { return bIsDirty; }
+
+	/** Cleared when creating render target fails */
+	NO_DISCARD bool IsRenderTargetSupported() const { return bIsRenderTargetSupported; }
+
+	NO_DISCARD SDL_Texture* GetTexture() const { return Texture; }
+
+	/** @returns true if last Draw used texture drawn again in same frame */
+	NO_DISCARD bool WasLastDrawRedrawn() const { return bWasLastDrawRedrawn; }
+
+	/** @returns number of draws which used texture without drawing subtree */
+	NO_DISCARD int32 GetNumberOfHits() const { return NumberOfHits; }
+
+	/** @returns number of times subtree was drawn into texture */
+	NO_DISCARD int32 GetNumberOfRedraws() const { return NumberOfRedraws; }
+
+protected:
+	/** Render target before redraw, kept for render thread which restores it */
+	struct FRenderTargetRestoreState
+	{
+		SDL_Texture* PreviousRenderTarget = nullptr;
+	};
+
+	SDL_Renderer* Renderer;
+
+	SDL_Texture* Texture;
+
+	FVector2D<int32> TextureSize;
+
+	/** Absolute location and size of cached area */
+	FVector2D<int32> Location;
+	FVector2D<int32> Size;
+
+	std::shared_ptr<FRenderTargetRestoreState> RestoreState;
+
+	bool bIsDirty;
+	bool bIsRedrawn;
+	bool bIsRenderTargetSupported;
+	bool bWasLastDrawRedrawn;
+
+	int32 NumberOfHits;
+	int32 NumberOfRedraws;
+
+};
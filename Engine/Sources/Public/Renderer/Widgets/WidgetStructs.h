@@ -9,6 +9,26 @@ struct ENGINE_API FWidgetGeometry
 	FVector2D<int32> Size;
 };
 
+/** Work done by widget layout, see IWidgetManagementInterface::UpdateWidgetsLayout */
+struct ENGINE_API FWidgetLayoutStats
+{
+	FWidgetLayoutStats()
+		: NumberOfLayoutPasses(0)
+		, NumberOfMeasuredWidgets(0)
+		, NumberOfArrangedWidgets(0)
+	{
+	}
+
+	/** Passes over dirty widgets, more than one when layout changed while it was updated */
+	int32 NumberOfLayoutPasses;
+
+	/** Widgets which generated geometry of children again */
+	int32 NumberOfMeasuredWidgets;
+
+	/** Widgets which updated size, location and children locations (RebuildWidget) */
+	int32 NumberOfArrangedWidgets;
+};
+
 /** Base class for padding and margin */
 struct ENGINE_API FBoxSpacing
 {
@@ -35,7 +35,17 @@ public:
 	/** True if has owner */
 	NO_DISCARD virtual bool HasParent() const = 0;
 
-	virtual bool NeedsWidgetRebuild() { return bIsWidgetRequestingRebuild; }
+	/** @returns true if this widget or any of its children needs layout */
+	virtual bool NeedsWidgetRebuild() { return (bIsLayoutMeasureDirty || bIsLayoutArrangeDirty || bHasChildWithDirtyLayout); }
+
+	/** @returns true if size of this widget may have changed */
+	NO_DISCARD bool IsLayoutMeasureDirty() const { return bIsLayoutMeasureDirty; }
+
+	/** @returns true if location of this widget may have changed */
+	NO_DISCARD bool IsLayoutArrangeDirty() const { return bIsLayoutArrangeDirty; }
+
+	/** @returns true if any child (or its child) needs layout */
+	NO_DISCARD bool HasChildWithDirtyLayout() const { return bHasChildWithDirtyLayout; }
 
 	/**
 	 * Ticking widgets works different than render. \n
@@ -49,16 +59,28 @@ public:
 	 */
 	virtual void RenderWidgets();
 
-	/** Marks widget as requiring rebuild. */
+	/**
+	 * Marks widget as requiring measure and arrange, size of widget may change.
+	 * Parents are only told that child needs layout, they are measured again only if size of child really changes.
+	 */
 	virtual void RequestWidgetRebuild();
 
-	/** Marks widget as after finished rebuild. Rebuild will not be done. */
+	/** Marks widget as requiring arrange only, for changes which do not affect size. Parents are not measured again. */
+	void RequestWidgetArrange();
+
+	/** Clears measure and arrange flags of this widget. Layout will not be done unless requested again. */
 	virtual void MarkAsWidgetRebuild();
 
-	/** Used to determine widget size */
+	/**
+	 * Lays out dirty children in two passes per widget, children are measured before parent and parent arranges them after.
+	 * Widgets which are not dirty and their subtrees are skipped. Repeats while layout changes during layout, up to MaxLayoutPasses.
+	 */
+	void UpdateWidgetsLayout(FWidgetLayoutStats& InOutStats);
+
+	/** Used to determine widget size, children are already measured when it's called */
 	virtual void GenerateWidgetGeometry(FWidgetGeometry& InWidgetGeometry);
 
-	/** Will be called before calling GenerateWidgetGeometry to determine widget size but only if requesting it using bIsWidgetRequestingRebuild */
+	/** Arrange pass of layout. Called after children are measured, updates size and location of widget and locations of its children. */
 	virtual void RebuildWidget();
 
 	/**
@@ -178,10 +200,16 @@ public:
 	/** Last widget number - using when generating unique names for widgets */
 	int32 LastWidgetNumber;
 
+	/** Layout requested while updating layout is done in next pass of same update, this limits number of passes */
+	static constexpr int32 MaxLayoutPasses = 4;
+
 protected:
 	/** Called by wiget when order is changed. */
 	void ChangeWidgetOrder(FWidget* InWidget);
 
+	/** Lays out children needing it, @returns true if geometry of any child has changed */
+	bool UpdateChildrenLayout(FWidgetLayoutStats& InOutStats);
+
 protected:
 	/** Has all widgets. First renders last, last first.... */
 	CArray<FWidget*> ManagedWidgets;
@@ -190,7 +218,13 @@ protected:
 	CMap<std::string, FWidget*> ManagedWidgetsMap;
 
 private:
-	/** True if widget needs update, important because whole chain up to parent needs to update */
-	bool bIsWidgetRequestingRebuild;
+	/** Size of this widget may have changed, children geometry is generated again */
+	bool bIsLayoutMeasureDirty;
+
+	/** Location of this widget may have changed */
+	bool bIsLayoutArrangeDirty;
+
+	/** Set on whole chain of parents of dirty widget, so layout finds it without visiting other widgets */
+	bool bHasChildWithDirtyLayout;
 
 };
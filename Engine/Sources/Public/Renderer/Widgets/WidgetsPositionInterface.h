@@ -22,6 +22,16 @@ public:
 	void RebuildWidget() override;
 	/** End IWidgetManagementInterface */
 
+	/**
+	 * Lays out this widget, children needing layout are laid out first.
+	 * Widget is measured only when it's dirty or size of any child changed, arranged when measured or when location is dirty.
+	 * @returns true if geometry (size with margin) has changed since last layout, parent must measure again then
+	 */
+	bool UpdateWidgetLayout(FWidgetLayoutStats& InOutStats);
+
+	/** @returns true if this widget must be laid out again when size of parent changes */
+	NO_DISCARD virtual bool IsLayoutDependentOnParentSize() const;
+
 	bool IsLocationInsideWidget(const FVector2D<int32>& TestLocation) const;
 
 	NO_DISCARD virtual FVector2D<int32> GetWidgetLocation(EWidgetOrientation WidgetOrientation = EWidgetOrientation::Absolute) const;
@@ -83,9 +93,11 @@ protected:
 	void UpdateSizeInPercent(const bool bWasSentFromRebuild);
 	void UpdateWidgetSizePixels(const bool bWasSentFromRebuild);
 
-	void GenerateChildWidgetGeometry();
+	/** Calls RebuildWidget, then arranges again children which were moved and have children placed relative to them */
+	void ArrangeWidget(FWidgetLayoutStats& InOutStats);
 
-	bool RebuildChildren();
+	/** Gathers geometry of already measured children and generates desired geometry from it */
+	void GenerateChildWidgetGeometry();
 
 	/** Desired size determined by children */
 	FWidgetGeometry DesiredWidgetGeometry;
@@ -119,5 +131,21 @@ private:
 
 	/** It should always match children */
 	CArray<FWidgetGeometry> ChildrenGeometry;
+
+	/** Geometry after last layout, compared to tell parent if it needs to measure again */
+	FVector2D<int32> LastLayoutGeometrySize;
+
+	/** Size after last layout, children depending on it are laid out again when it changes */
+	FVector2D<int32> LastLayoutWidgetSize;
+
+	/** Absolute location after last arrange */
+	FVector2D<int32> LastArrangeLocation;
+
+	/** Location and size children were anchored to, anchoring from rebuild is skipped when they have not changed */
+	FVector2D<int32> ChildrenAnchorLocation;
+	FVector2D<int32> ChildrenAnchorSize;
+
+	/** True while widget is arranged by layout, size changes made then are already reported to parent by layout */
+	bool bIsUpdatingLayout;
 	
 };
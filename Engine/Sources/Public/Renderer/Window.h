@@ -81,6 +81,9 @@ public:
 
 	virtual void OnWindowSizeChanged(Sint32 X, Sint32 Y);
 
+	/** Called when renderer lost content of render targets, everything baked into textures must be rendered again */
+	virtual void OnRenderTargetsReset();
+
 	void SetWindowFocus(const bool bInNewFocus);
 	void SetWindowForcedFocus(const bool bInNewFocus);
 	void SetWindowIsMouseInside(const bool bInIsWindowMouseInside);
@@ -121,6 +124,9 @@ public:
 	/** Delegate called when window size changed */
 	FDelegateSafe<void, FVector2D<int32>> OnWindowSizeChangedDelegate;
 
+	/** Delegate called when content of render targets was lost, see OnRenderTargetsReset */
+	FDelegateSafe<void> OnRenderTargetsResetDelegate;
+
 	/** Delegate called when close of window is requested */
 	FDelegateSafe<void> OnWindowCloseRequestedDelegate;
 
@@ -2,6 +2,40 @@
 #include "Misc/EncryptionManager.h"
 #include "Misc/EncryptionUtil.h"
 #include "Misc/PasswordEncryptionArgon.h"
+#include "Threads/ThreadsManager.h"
+#include "Threads/TaskGraph.h"
+#include "Containers/MPSCQueue.h"
+#include "Timer/TimerWheel.h"
+#include "ECS/ComponentStorage.h"
+#include "Containers/SlotMap.h"
+#include "ECS/EntityManager.h"
+#include "ECS/AI/AITree.h"
+#include "ECS/Systems/ProjectileSystem.h"
+#include "ECS/Collision/AABBTreeBroadphase.h"
+#include "ECS/Collision/GridBroadphase.h"
+#include "ECS/Collision/CollisionNarrowphase.h"
+#include "ECS/Collision/CircleCollision.h"
+#include "ECS/Collision/SquareCollision.h"
+#include "ECS/Collision/CollisionKernels.h"
+#include "ECS/Collision/CollisionManager.h"
+#include "ECS/Collision/CollisionQuery.h"
+#include "ECS/Components/ParentComponent.h"
+#include "ECS/Components/TeamComponent.h"
+#include "ECS/Components/Collision/CircleCollisionComponent.h"
+#include "ECS/Entities/WeaponBase.h"
+#include "ECS/Navigation/NavigationFlowField.h"
+#include "ECS/Navigation/NavigationGrid.h"
+#include "ECS/Navigation/NavigationHierarchy.h"
+#include "ECS/Navigation/NavigationPathfinder.h"
+#include "Renderer/Map/MapChunkRenderer.h"
+#include "Assets/Assets/MapAsset.h"
+#include "Assets/Assets/TextureAsset.h"
+#include "Renderer/SpriteBatch.h"
+#include "Assets/TypesForAssets/TextureAtlasPacker.h"
+#include "Assets/TypesForAssets/GlyphCache.h"
+#include "Renderer/Widgets/WidgetRenderCache.h"
+#include "Renderer/Widgets/Samples/HorizontalBoxWidget.h"
+#include "Renderer/Widgets/Samples/VerticalBoxWidget.h"
 
 TEST(CompressionTest, Accuracy)
 {
@@ -731,3 +765,3771 @@ TEST(EncryptionSecurity, FinalSecurityReport)
     EXPECT_GE(passedTests, totalTests * 0.75)
         << "Security tests: " << passedTests << "/" << totalTests << " passed";
 }
+
+// ============================================================================
+// THREADS
+// ============================================================================
+TEST(ThreadsManagerTest, WorkStealingStress)
+{
+	constexpr int32 NumberOfJobs = 200000;
+
+	FThreadsManager ThreadsManager;
+	ThreadsManager.Initialize();
+
+	std::atomic<int32> NumberOfExecutedJobs = 0;
+
+	CArray<FAsyncJobHandle> JobHandles;
+	JobHandles.Resize(NumberOfJobs);
+
+	auto start = std::chrono::high_resolution_clock::now();
+
+	for (int32 i = 0; i < NumberOfJobs; i++)
+	{
+		FDelegateSafe<void> Job;
+		Job.BindLambda([&NumberOfExecutedJobs]()
+		{
+			NumberOfExecutedJobs.fetch_add(1, std::memory_order_relaxed);
+		});
+
+		JobHandles.Push(ThreadsManager.AddAsyncDelegate(Job));
+	}
+
+	FAsyncJobHandle::WaitForAll(JobHandles);
+
+	auto end = std::chrono::high_resolution_clock::now();
+	auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+	std::cout << NumberOfJobs << " jobs on " << FThreadsManager::GetNumberOfLogicalCPU() << " threads: " << duration.count() << "ms" << std::endl;
+
+	EXPECT_EQ(NumberOfExecutedJobs.load(), NumberOfJobs);
+
+	// Jobs added from worker go to queue of that worker and must be stolen by others
+	std::atomic<int32> NumberOfExecutedNestedJobs = 0;
+
+	FDelegateSafe<void> SpawningJob;
+	SpawningJob.BindLambda([&]()
+	{
+		CArray<FAsyncJobHandle> NestedJobHandles;
+
+		for (int32 i = 0; i < 1000; i++)
+		{
+			FDelegateSafe<void> NestedJob;
+			NestedJob.BindLambda([&NumberOfExecutedNestedJobs]()
+			{
+				NumberOfExecutedNestedJobs.fetch_add(1, std::memory_order_relaxed);
+			});
+
+			NestedJobHandles.Push(ThreadsManager.AddAsyncDelegate(NestedJob));
+		}
+
+		FAsyncJobHandle::WaitForAll(NestedJobHandles);
+	});
+
+	ThreadsManager.AddAsyncDelegate(SpawningJob).Wait();
+
+	EXPECT_EQ(NumberOfExecutedNestedJobs.load(), 1000);
+
+	ThreadsManager.DeInitialize();
+}
+
+TEST(ThreadsManagerTest, IdleWorkerWakeup)
+{
+	FThreadsManager ThreadsManager;
+	ThreadsManager.Initialize();
+
+	// Let workers go to sleep
+	THREAD_WAIT_MS(50);
+
+	double TotalLatencyMS = 0.0;
+	constexpr int32 NumberOfSamples = 100;
+	std::atomic<int32> NumberOfFinishedJobs = 0;
+
+	for (int32 i = 0; i < NumberOfSamples; i++)
+	{
+		std::chrono::high_resolution_clock::time_point JobStartTime;
+
+		FDelegateSafe<void> Job;
+		Job.BindLambda([&JobStartTime, &NumberOfFinishedJobs]()
+		{
+			JobStartTime = std::chrono::high_resolution_clock::now();
+
+			NumberOfFinishedJobs++;
+		});
+
+		const auto EnqueueTime = std::chrono::high_resolution_clock::now();
+
+		// Wait() would execute job on this thread when it is still queued, so spin on IsFinished instead
+		const FAsyncJobHandle JobHandle = ThreadsManager.AddAsyncDelegate(Job);
+		while (!JobHandle.IsFinished())
+		{
+			std::this_thread::yield();
+		}
+
+		TotalLatencyMS += std::chrono::duration<double, std::milli>(JobStartTime - EnqueueTime).count();
+	}
+
+	const double AverageLatencyMS = TotalLatencyMS / NumberOfSamples;
+
+	std::cout << "Average enqueue to start latency: " << std::fixed << std::setprecision(4) << AverageLatencyMS << "ms" << std::endl;
+
+	// Sleeping workers were woken up for every job, latency depends on machine so it's only printed
+	EXPECT_EQ(NumberOfFinishedJobs.load(), NumberOfSamples);
+
+	ThreadsManager.DeInitialize();
+}
+
+TEST(TaskGraphTest, Dependencies)
+{
+	FThreadsManager ThreadsManager;
+	ThreadsManager.Initialize();
+
+	FTaskGraph TaskGraph(&ThreadsManager);
+
+	// Diamond: A -> (B, C) -> D -> MainThread continuation
+	std::atomic<int32> Order = 0;
+	int32 OrderA = INDEX_NONE, OrderB = INDEX_NONE, OrderC = INDEX_NONE, OrderD = INDEX_NONE;
+	bool bContinuationOnMainThread = false;
+
+	FDelegateSafe<void> TaskA;
+	TaskA.BindLambda([&]()
+	{
+		THREAD_WAIT_MS(5);
+		OrderA = Order.fetch_add(1);
+	});
+	const FGraphTaskHandle HandleA = TaskGraph.AddTask(TaskA);
+
+	FDelegateSafe<void> TaskB;
+	TaskB.BindLambda([&]() { OrderB = Order.fetch_add(1); });
+	const FGraphTaskHandle HandleB = TaskGraph.AddTask(TaskB, { HandleA });
+
+	FDelegateSafe<void> TaskC;
+	TaskC.BindLambda([&]() { OrderC = Order.fetch_add(1); });
+	const FGraphTaskHandle HandleC = TaskGraph.AddTask(TaskC, { HandleA });
+
+	FDelegateSafe<void> TaskD;
+	TaskD.BindLambda([&]() { OrderD = Order.fetch_add(1); });
+	const FGraphTaskHandle HandleD = TaskGraph.AddTask(TaskD, { HandleB, HandleC });
+
+	FDelegateSafe<void> Continuation;
+	Continuation.BindLambda([&]()
+	{
+		bContinuationOnMainThread = ThreadsManager.IsInMainThread();
+	});
+	const FGraphTaskHandle ContinuationHandle = TaskGraph.AddTask(Continuation, { HandleD }, ETaskThread::MainThread);
+
+	// Main thread wait executes main thread tasks
+	ContinuationHandle.Wait();
+
+	EXPECT_EQ(OrderA, 0);
+	EXPECT_TRUE(OrderB > OrderA && OrderC > OrderA);
+	EXPECT_EQ(OrderD, 3);
+	EXPECT_TRUE(bContinuationOnMainThread);
+
+	// Prerequisite which is already finished does not block
+	bool bLateTaskExecuted = false;
+	FDelegateSafe<void> LateTask;
+	LateTask.BindLambda([&]() { bLateTaskExecuted = true; });
+	TaskGraph.AddTask(LateTask, { HandleD }).Wait();
+
+	EXPECT_TRUE(bLateTaskExecuted);
+
+	ThreadsManager.DeInitialize();
+}
+
+TEST(TaskGraphTest, ParallelForScaling)
+{
+	FThreadsManager ThreadsManager;
+	ThreadsManager.Initialize();
+
+	FTaskGraph TaskGraph(&ThreadsManager);
+
+	// Fake frame of gameplay work, entities with some math in tick
+	constexpr int32 NumberOfEntities = 100000;
+	constexpr int32 WorkPerEntity = 200;
+
+	CArray<float> EntityValues;
+	EntityValues.SetNum(NumberOfEntities);
+
+	auto TickEntity = [&EntityValues](const int32 Index)
+	{
+		float Value = static_cast<float>(Index);
+		for (int32 i = 0; i < WorkPerEntity; i++)
+		{
+			Value = std::sqrt(Value * Value + 1.f);
+		}
+
+		EntityValues[Index] = Value;
+	};
+
+	auto start = std::chrono::high_resolution_clock::now();
+
+	for (int32 i = 0; i < NumberOfEntities; i++)
+	{
+		TickEntity(i);
+	}
+
+	auto end = std::chrono::high_resolution_clock::now();
+	const auto SingleThreadDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	const CArray<float> SingleThreadValues = EntityValues;
+
+	start = std::chrono::high_resolution_clock::now();
+
+	TaskGraph.ParallelFor(NumberOfEntities, TickEntity, 64);
+
+	end = std::chrono::high_resolution_clock::now();
+	const auto ParallelDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	std::cout << "ParallelFor " << NumberOfEntities << " entities: single thread " << SingleThreadDuration.count() << "us, "
+		<< FThreadsManager::GetNumberOfLogicalCPU() << " threads " << ParallelDuration.count() << "us" << std::endl;
+
+	bool bAllEqual = true;
+	for (int32 i = 0; i < NumberOfEntities; i++)
+	{
+		bAllEqual &= (EntityValues[i] == SingleThreadValues[i]);
+	}
+
+	EXPECT_TRUE(bAllEqual);
+
+	// Nested ParallelFor as graph task with prerequisite
+	std::atomic<int32> Sum = 0;
+
+	FDelegateSafe<void> PrepareTask;
+	PrepareTask.BindLambda([&Sum]() { Sum = 0; });
+	const FGraphTaskHandle PrepareHandle = TaskGraph.AddTask(PrepareTask);
+
+	const FGraphTaskHandle ParallelForHandle = TaskGraph.AddParallelForTask(1000, [&Sum](const int32 Index)
+	{
+		Sum.fetch_add(Index, std::memory_order_relaxed);
+	}, { PrepareHandle });
+
+	ParallelForHandle.Wait();
+
+	EXPECT_EQ(Sum.load(), 999 * 1000 / 2);
+
+	ThreadsManager.DeInitialize();
+}
+
+TEST(MPSCQueueTest, ManyProducersStress)
+{
+	constexpr int32 NumberOfProducers = 8;
+	constexpr int32 NumberOfCallbacksPerProducer = 20000;
+
+	// Small ring so overflow path is used as well
+	CMPSCQueue<FFunctorLambda<void>> Queue(1024);
+
+	std::atomic<int32> NumberOfExecutedCallbacks = 0;
+	std::atomic<int32> NumberOfFinishedProducers = 0;
+
+	std::vector<std::thread> Producers;
+	for (int32 ProducerIndex = 0; ProducerIndex < NumberOfProducers; ProducerIndex++)
+	{
+		Producers.emplace_back([&]()
+		{
+			for (int32 i = 0; i < NumberOfCallbacksPerProducer; i++)
+			{
+				Queue.Push([&NumberOfExecutedCallbacks]()
+				{
+					NumberOfExecutedCallbacks.fetch_add(1, std::memory_order_relaxed);
+				});
+			}
+
+			NumberOfFinishedProducers.fetch_add(1);
+		});
+	}
+
+	// Drain like main thread does on start of each tick
+	while (NumberOfFinishedProducers.load() < NumberOfProducers || !Queue.IsEmpty())
+	{
+		Queue.ConsumeAll([](FFunctorLambda<void>& Function)
+		{
+			Function();
+		});
+	}
+
+	for (std::thread& Producer : Producers)
+	{
+		Producer.join();
+	}
+
+	EXPECT_EQ(NumberOfExecutedCallbacks.load(), NumberOfProducers * NumberOfCallbacksPerProducer);
+}
+
+TEST(MPSCQueueTest, DrainTimeComparedToDelegate)
+{
+	constexpr int32 NumberOfCallbacks = 100000;
+
+	int32 Counter = 0;
+
+	// Previous implementation of next tick functions
+	FDelegate<> Delegate;
+	for (int32 i = 0; i < NumberOfCallbacks; i++)
+	{
+		Delegate.BindLambda([&Counter]() { Counter++; });
+	}
+
+	auto start = std::chrono::high_resolution_clock::now();
+
+	Delegate.Execute();
+	Delegate.UnBindAll();
+
+	auto end = std::chrono::high_resolution_clock::now();
+	const auto DelegateDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	CMPSCQueue<FFunctorLambda<void>> Queue(NumberOfCallbacks);
+	for (int32 i = 0; i < NumberOfCallbacks; i++)
+	{
+		Queue.Push([&Counter]() { Counter++; });
+	}
+
+	start = std::chrono::high_resolution_clock::now();
+
+	Queue.ConsumeAll([](FFunctorLambda<void>& Function)
+	{
+		Function();
+	});
+
+	end = std::chrono::high_resolution_clock::now();
+	const auto QueueDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	std::cout << "Drain " << NumberOfCallbacks << " callbacks: FDelegate " << DelegateDuration.count() << "us, CMPSCQueue " << QueueDuration.count() << "us" << std::endl;
+
+	EXPECT_EQ(Counter, NumberOfCallbacks * 2);
+	EXPECT_TRUE(Queue.IsEmpty());
+}
+
+class FTestTimerWheelEntry : public FTimerWheelEntry
+{
+public:
+	FTestTimerWheelEntry()
+		: WheelTime(nullptr)
+		, FiredTime(0)
+		, NumberOfFires(0)
+	{
+	}
+
+	const Uint64* WheelTime;
+	Uint64 FiredTime;
+	int32 NumberOfFires;
+
+protected:
+	void OnTimerWheelEntryExpired() override
+	{
+		FiredTime = *WheelTime;
+		NumberOfFires++;
+	}
+};
+
+TEST(TimerWheelTest, FiresOnTimeAndCancels)
+{
+	constexpr int32 NumberOfEntries = 100000;
+	constexpr Uint64 MaxDelay = 200000;
+	constexpr Uint64 LongDelay = 5000000;
+	constexpr Uint64 FrameTime = 16;
+
+	Uint64 Time = 1000;
+	FTimerWheel TimerWheel(Time);
+
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_int_distribution<Uint64> DelayDistribution(0, MaxDelay);
+
+	std::vector<FTestTimerWheelEntry> Entries(NumberOfEntries);
+
+	auto start = std::chrono::high_resolution_clock::now();
+
+	for (int32 i = 0; i < NumberOfEntries; i++)
+	{
+		Entries[i].WheelTime = &Time;
+
+		// Few entries go to last level
+		const Uint64 Delay = (i % 1000 == 0) ? LongDelay : DelayDistribution(RandomGenerator);
+
+		TimerWheel.Schedule(&Entries[i], Time + Delay);
+	}
+
+	auto end = std::chrono::high_resolution_clock::now();
+	const auto ScheduleDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	start = std::chrono::high_resolution_clock::now();
+
+	for (int32 i = 1; i < NumberOfEntries; i += 2)
+	{
+		EXPECT_TRUE(TimerWheel.Cancel(&Entries[i]));
+	}
+
+	end = std::chrono::high_resolution_clock::now();
+	const auto CancelDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	EXPECT_EQ(TimerWheel.GetNumberOfScheduledEntries(), NumberOfEntries / 2);
+
+	start = std::chrono::high_resolution_clock::now();
+
+	const Uint64 EndTime = Time + LongDelay + FrameTime;
+	while (Time < EndTime)
+	{
+		Time += FrameTime;
+
+		TimerWheel.Advance(Time);
+	}
+
+	end = std::chrono::high_resolution_clock::now();
+	const auto AdvanceDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	std::cout << NumberOfEntries << " timers: schedule " << ScheduleDuration.count() << "us, cancel half " << CancelDuration.count() << "us, advance " << AdvanceDuration.count() << "us" << std::endl;
+
+	int32 NumberOfWrongEntries = 0;
+	for (int32 i = 0; i < NumberOfEntries; i++)
+	{
+		const FTestTimerWheelEntry& Entry = Entries[i];
+
+		if (i % 2 == 1)
+		{
+			NumberOfWrongEntries += (Entry.NumberOfFires != 0) ? 1 : 0;
+		}
+		else
+		{
+			// Fired once, on first advance after expire time
+			const Uint64 ExpireTime = Entry.GetTimerWheelExpireTime();
+			const bool bFiredOnTime = (Entry.NumberOfFires == 1 && Entry.FiredTime >= ExpireTime && Entry.FiredTime < ExpireTime + FrameTime);
+
+			NumberOfWrongEntries += bFiredOnTime ? 0 : 1;
+		}
+
+		EXPECT_FALSE(Entry.IsScheduledInTimerWheel());
+	}
+
+	EXPECT_EQ(NumberOfWrongEntries, 0);
+	EXPECT_EQ(TimerWheel.GetNumberOfScheduledEntries(), 0);
+}
+
+struct FTestMoveData
+{
+	FVector2D<float> Location;
+	FVector2D<float> Velocity;
+};
+
+struct FTestRenderData
+{
+	FVector2D<float> RenderLocation;
+	int32 TextureIndex;
+};
+
+TEST(ComponentStorageTest, ForEachAndDestroy)
+{
+	FComponentStorage ComponentStorage;
+
+	CArray<FStorageEntityId> EntityIds;
+	for (int32 i = 0; i < 100; i++)
+	{
+		const FStorageEntityId EntityId = ComponentStorage.CreateEntity();
+		EntityIds.Push(EntityId);
+
+		ComponentStorage.AddComponent<FTestMoveData>(EntityId, FTestMoveData{ FVector2D<float>(static_cast<float>(i), 0.f), FVector2D<float>(1.f, 0.f) });
+
+		// Only every second entity is rendered
+		if (i % 2 == 0)
+		{
+			ComponentStorage.AddComponent<FTestRenderData>(EntityId, FTestRenderData{ FVector2D<float>(), i });
+		}
+	}
+
+	int32 NumberOfVisited = 0;
+	ComponentStorage.ForEach<FTestRenderData, FTestMoveData>([&](const FStorageEntityId EntityId, FTestRenderData& RenderData, FTestMoveData& MoveData)
+	{
+		EXPECT_EQ(RenderData.TextureIndex, static_cast<int32>(MoveData.Location.X));
+		NumberOfVisited++;
+	});
+	EXPECT_EQ(NumberOfVisited, 50);
+
+	// Remove from middle, swapped elements must keep their entity
+	for (int32 i = 0; i < 100; i += 4)
+	{
+		ComponentStorage.DestroyEntity(EntityIds[i]);
+	}
+
+	NumberOfVisited = 0;
+	ComponentStorage.ForEach<FTestRenderData, FTestMoveData>([&](const FStorageEntityId EntityId, FTestRenderData& RenderData, FTestMoveData& MoveData)
+	{
+		EXPECT_EQ(RenderData.TextureIndex, static_cast<int32>(MoveData.Location.X));
+		EXPECT_EQ(RenderData.TextureIndex % 4, 2);
+		NumberOfVisited++;
+	});
+	EXPECT_EQ(NumberOfVisited, 25);
+	EXPECT_EQ(ComponentStorage.GetNumberOfEntities(), 75);
+	EXPECT_FALSE(ComponentStorage.IsEntityValid(EntityIds[0]));
+
+	// Ids are reused
+	const FStorageEntityId NewEntityId = ComponentStorage.CreateEntity();
+	EXPECT_TRUE(ComponentStorage.IsEntityValid(NewEntityId));
+	EXPECT_EQ(ComponentStorage.GetComponent<FTestMoveData>(NewEntityId), nullptr);
+}
+
+/** Same layout as IComponentManagerInterface: components allocated separately, found by name and ticked virtually */
+class FTestLegacyComponent
+{
+public:
+	virtual ~FTestLegacyComponent() = default;
+
+	virtual void Tick(const float DeltaTime) = 0;
+};
+
+class FTestLegacyMoveComponent : public FTestLegacyComponent
+{
+public:
+	void Tick(const float DeltaTime) override
+	{
+		MoveData.Location.X += MoveData.Velocity.X * DeltaTime;
+		MoveData.Location.Y += MoveData.Velocity.Y * DeltaTime;
+	}
+
+	FTestMoveData MoveData;
+};
+
+class FTestLegacyRenderComponent : public FTestLegacyComponent
+{
+public:
+	void Tick(const float DeltaTime) override
+	{
+		RenderData.RenderLocation = MoveComponent->MoveData.Location;
+	}
+
+	FTestRenderData RenderData;
+	FTestLegacyMoveComponent* MoveComponent = nullptr;
+};
+
+class FTestLegacyEntity
+{
+public:
+	virtual ~FTestLegacyEntity() = default;
+
+	virtual void ReceiveTick(const float DeltaTime)
+	{
+		for (const auto& [ComponentName, Component] : ComponentsMap)
+		{
+			Component->Tick(DeltaTime);
+		}
+	}
+
+	CUnorderedMap<std::string, std::shared_ptr<FTestLegacyComponent>> ComponentsMap;
+};
+
+TEST(ComponentStorageTest, TickCostComparedToComponentMap)
+{
+	constexpr int32 NumberOfEntities = 100000;
+	constexpr int32 NumberOfTicks = 10;
+	constexpr float DeltaTime = 0.016f;
+
+	CArray<FTestLegacyEntity*> LegacyEntities;
+	FComponentStorage ComponentStorage;
+
+	for (int32 i = 0; i < NumberOfEntities; i++)
+	{
+		const FTestMoveData MoveData{ FVector2D<float>(static_cast<float>(i), 0.f), FVector2D<float>(1.f, 2.f) };
+
+		FTestLegacyEntity* LegacyEntity = new FTestLegacyEntity();
+		std::shared_ptr<FTestLegacyMoveComponent> MoveComponent = std::make_shared<FTestLegacyMoveComponent>();
+		MoveComponent->MoveData = MoveData;
+		std::shared_ptr<FTestLegacyRenderComponent> RenderComponent = std::make_shared<FTestLegacyRenderComponent>();
+		RenderComponent->MoveComponent = MoveComponent.get();
+		LegacyEntity->ComponentsMap.Emplace("MovementComponent", MoveComponent);
+		LegacyEntity->ComponentsMap.Emplace("RenderComponent", RenderComponent);
+		LegacyEntities.Push(LegacyEntity);
+
+		const FStorageEntityId EntityId = ComponentStorage.CreateEntity();
+		ComponentStorage.AddComponent<FTestMoveData>(EntityId, MoveData);
+		ComponentStorage.AddComponent<FTestRenderData>(EntityId, FTestRenderData{ FVector2D<float>(), i });
+	}
+
+	auto start = std::chrono::high_resolution_clock::now();
+
+	for (int32 Tick = 0; Tick < NumberOfTicks; Tick++)
+	{
+		for (FTestLegacyEntity* LegacyEntity : LegacyEntities)
+		{
+			LegacyEntity->ReceiveTick(DeltaTime);
+		}
+	}
+
+	auto end = std::chrono::high_resolution_clock::now();
+	const auto LegacyDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	start = std::chrono::high_resolution_clock::now();
+
+	for (int32 Tick = 0; Tick < NumberOfTicks; Tick++)
+	{
+		// Move system
+		for (FTestMoveData& MoveData : ComponentStorage.GetPool<FTestMoveData>().GetComponents())
+		{
+			MoveData.Location.X += MoveData.Velocity.X * DeltaTime;
+			MoveData.Location.Y += MoveData.Velocity.Y * DeltaTime;
+		}
+
+		// Render system
+		ComponentStorage.ForEach<FTestRenderData, FTestMoveData>([](const FStorageEntityId, FTestRenderData& RenderData, const FTestMoveData& MoveData)
+		{
+			RenderData.RenderLocation = MoveData.Location;
+		});
+	}
+
+	end = std::chrono::high_resolution_clock::now();
+	const auto StorageDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	std::cout << NumberOfEntities << " entities, " << NumberOfTicks << " ticks: component map " << LegacyDuration.count() << "us, component storage " << StorageDuration.count() << "us" << std::endl;
+
+	// Both paths produce same result (render of component map may lag one tick as map order is not defined)
+	const FTestMoveData* MoveData = ComponentStorage.GetComponent<FTestMoveData>(NumberOfEntities - 1);
+	const FTestLegacyRenderComponent* LegacyRenderComponent = static_cast<FTestLegacyRenderComponent*>(LegacyEntities[NumberOfEntities - 1]->ComponentsMap["RenderComponent"].get());
+	EXPECT_FLOAT_EQ(MoveData->Location.X, LegacyRenderComponent->MoveComponent->MoveData.Location.X);
+	EXPECT_FLOAT_EQ(MoveData->Location.Y, LegacyRenderComponent->MoveComponent->MoveData.Location.Y);
+	EXPECT_FLOAT_EQ(ComponentStorage.GetComponent<FTestRenderData>(NumberOfEntities - 1)->RenderLocation.Y, MoveData->Location.Y);
+
+	for (FTestLegacyEntity* LegacyEntity : LegacyEntities)
+	{
+		delete LegacyEntity;
+	}
+}
+
+TEST(SlotMapTest, StaleKeysAndChurnCost)
+{
+	CSlotMap<int32> SlotMap;
+
+	const FSlotMapKey FirstKey = SlotMap.Add(1);
+	const FSlotMapKey SecondKey = SlotMap.Add(2);
+
+	EXPECT_TRUE(SlotMap.Remove(FirstKey));
+	EXPECT_FALSE(SlotMap.Remove(FirstKey));
+
+	// Slot is reused, old key must not find new element
+	const FSlotMapKey ThirdKey = SlotMap.Add(3);
+	EXPECT_EQ(ThirdKey.Index, FirstKey.Index);
+	EXPECT_TRUE(SlotMap.Find(FirstKey) == nullptr);
+	EXPECT_EQ(*SlotMap.Find(ThirdKey), 3);
+	EXPECT_EQ(*SlotMap.Find(SecondKey), 2);
+	EXPECT_FALSE(SlotMap.Contains(FSlotMapKey()));
+	EXPECT_EQ(SlotMap.Size(), 2);
+
+	SlotMap.Clear();
+	EXPECT_TRUE(SlotMap.Find(SecondKey) == nullptr);
+
+	// Spawn and destroy short lived elements (like projectiles), cost per frame must not grow with number of frames
+	const int32 NumberOfFrames = 200;
+	const int32 ElementsPerFrame = 1000;
+	const int32 ElementLifetimeFrames = 5;
+
+	std::vector<FSlotMapKey> AliveKeys;
+	AliveKeys.reserve(ElementsPerFrame * (ElementLifetimeFrames + 1));
+
+	std::vector<int64> FrameDurations;
+
+	for (int32 Frame = 0; Frame < NumberOfFrames; Frame++)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+
+		if (Frame >= ElementLifetimeFrames)
+		{
+			for (int32 i = 0; i < ElementsPerFrame; i++)
+			{
+				EXPECT_TRUE(SlotMap.Remove(AliveKeys[i]));
+			}
+
+			AliveKeys.erase(AliveKeys.begin(), AliveKeys.begin() + ElementsPerFrame);
+		}
+
+		for (int32 i = 0; i < ElementsPerFrame; i++)
+		{
+			AliveKeys.push_back(SlotMap.Add(Frame));
+		}
+
+		auto end = std::chrono::high_resolution_clock::now();
+		FrameDurations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+	}
+
+	EXPECT_EQ(SlotMap.Size(), ElementsPerFrame * ElementLifetimeFrames);
+
+	int64 FirstHalfDuration = 0;
+	int64 SecondHalfDuration = 0;
+	for (int32 Frame = ElementLifetimeFrames; Frame < NumberOfFrames; Frame++)
+	{
+		(Frame < (NumberOfFrames + ElementLifetimeFrames) / 2 ? FirstHalfDuration : SecondHalfDuration) += FrameDurations[Frame];
+	}
+
+	std::cout << NumberOfFrames << " frames, " << ElementsPerFrame << " spawned and destroyed per frame: first half " << FirstHalfDuration << "us, second half " << SecondHalfDuration << "us" << std::endl;
+
+	// Slots are reused, storage does not grow
+	EXPECT_LT(SecondHalfDuration, FirstHalfDuration * 3 + 1000);
+}
+
+/** Entity manager without window */
+class FEntityHandleTestManager : public FEntityManager
+{
+public:
+	FEntityHandleTestManager()
+		: FEntityManager(nullptr)
+	{
+	}
+
+	~FEntityHandleTestManager() override = default;
+};
+
+/** Keeps handle of other entity and resolves it in EndPlay, like weapon holder or AI target */
+class FEntityHandleTestEntity : public EEntity
+{
+public:
+	FEntityHandleTestEntity(FEntityManager* InEntityManager)
+		: EEntity(InEntityManager)
+		, AiTree(nullptr)
+	{
+	}
+
+	void EndPlay() override
+	{
+		EEntity::EndPlay();
+
+		if (OtherEntity.Get() != nullptr)
+		{
+			NumberOfResolvedOnEndPlay++;
+		}
+	}
+
+	FAITree* GetAiTree() const { return AiTree; }
+
+	FEntityHandle OtherEntity;
+
+	static int32 NumberOfResolvedOnEndPlay;
+
+protected:
+	void SetupAIActions() override
+	{
+		AiTree = CreateAiTree<FAITree>();
+	}
+
+	FAITree* AiTree;
+};
+
+int32 FEntityHandleTestEntity::NumberOfResolvedOnEndPlay = 0;
+
+TEST(EntityHandleTest, HandlesNotResolvedAfterDestroy)
+{
+	FEntityHandleTestManager* EntityManager = new FEntityHandleTestManager();
+
+	FEntityHandleTestEntity* EntityA = EntityManager->CreateEntity<FEntityHandleTestEntity>();
+	FEntityHandleTestEntity* EntityB = EntityManager->CreateEntity<FEntityHandleTestEntity>();
+	FEntityHandleTestEntity* EntityC = EntityManager->CreateEntity<FEntityHandleTestEntity>();
+
+	EntityA->OtherEntity = EntityB->GetEntityHandle();
+	EntityB->OtherEntity = EntityA->GetEntityHandle();
+	EntityC->OtherEntity = EntityA->GetEntityHandle();
+
+	// AI tree keeps handle of owner
+	FAITree* AiTreeOfB = EntityB->GetAiTree();
+	ASSERT_TRUE(AiTreeOfB != nullptr);
+	EXPECT_TRUE(AiTreeOfB->GetOwnerEntity() == EntityB);
+
+	// Handle is invalid right after destroy, entity is deleted at flush
+	const FEntityHandle HandleOfB = EntityB->GetEntityHandle();
+	EXPECT_TRUE(EntityManager->DestroyEntity(EntityB));
+	EXPECT_TRUE(HandleOfB.Get() == nullptr);
+	EXPECT_TRUE(AiTreeOfB->GetOwnerEntity() == nullptr);
+	EXPECT_FALSE(EntityManager->DestroyEntity(HandleOfB));
+
+	// EndPlay of B resolves A which is still alive
+	FEntityHandleTestEntity::NumberOfResolvedOnEndPlay = 0;
+	EntityManager->FlushPendingDestroyEntities();
+	EXPECT_EQ(FEntityHandleTestEntity::NumberOfResolvedOnEndPlay, 1);
+	EXPECT_EQ(EntityManager->GetNumberOfEntities(), 2);
+
+	// New entity may reuse slot of B, old handle must not find it
+	FEntityHandleTestEntity* EntityD = EntityManager->CreateEntity<FEntityHandleTestEntity>();
+	EXPECT_TRUE(HandleOfB.Get() == nullptr);
+	EXPECT_TRUE(EntityA->OtherEntity.Get() == nullptr);
+	EXPECT_TRUE(EntityManager->GetEntityByHandle(EntityD->GetEntityHandle()) == EntityD);
+
+	// A is deleted before C runs EndPlay, C must not get dangling pointer to A
+	FEntityHandleTestEntity::NumberOfResolvedOnEndPlay = 0;
+	delete EntityManager;
+	EXPECT_EQ(FEntityHandleTestEntity::NumberOfResolvedOnEndPlay, 0);
+}
+
+TEST(ProjectileSystemTest, FiftyThousandProjectilesFrameCost)
+{
+	const int32 NumberOfProjectiles = 50000;
+	const int32 NumberOfFrames = 60;
+	const float DeltaTime = 1.f / 60.f;
+
+	// No entity manager, simulation and render batching do not need window
+	FProjectileSystem ProjectileSystem(nullptr, NumberOfProjectiles);
+
+	for (int32 i = 0; i < NumberOfProjectiles; i++)
+	{
+		FProjectileData ProjectileData;
+		ProjectileData.Location = FVector2D<float>(static_cast<float>(i % 1000), static_cast<float>(i / 1000));
+		ProjectileData.Velocity = FVector2D<float>(100.f, static_cast<float>(i % 7));
+		// Damage is used as id, order of projectiles changes when they are removed
+		ProjectileData.Damage = static_cast<float>(i);
+		// Half of projectiles expire in middle of test
+		ProjectileData.Lifetime = (i % 2 == 0) ? 0.5f : 10.f;
+
+		EXPECT_TRUE(ProjectileSystem.FireProjectile(ProjectileData));
+	}
+
+	// Pool is preallocated, no growth
+	EXPECT_FALSE(ProjectileSystem.FireProjectile(FProjectileData()));
+
+	int64 TickDuration = 0;
+	int64 BatchDuration = 0;
+
+	for (int32 Frame = 0; Frame < NumberOfFrames; Frame++)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		ProjectileSystem.Tick(DeltaTime);
+		auto end = std::chrono::high_resolution_clock::now();
+		TickDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+		start = std::chrono::high_resolution_clock::now();
+		ProjectileSystem.BuildRenderBatches();
+		end = std::chrono::high_resolution_clock::now();
+		BatchDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+	}
+
+	EXPECT_EQ(ProjectileSystem.GetNumberOfProjectiles(), NumberOfProjectiles / 2);
+
+	// All projectiles share texture (none), so single batch
+	EXPECT_EQ(ProjectileSystem.GetRenderBatches().Size(), 1);
+	EXPECT_EQ(static_cast<int32>(ProjectileSystem.GetRenderBatches()[0].Vertices.size()), (NumberOfProjectiles / 2) * 4);
+
+	// Each projectile moved 1 second worth of velocity
+	int32 NumberOfWrongProjectiles = 0;
+	for (int32 Index = 0; Index < ProjectileSystem.GetNumberOfProjectiles(); Index++)
+	{
+		const FProjectileData& Projectile = ProjectileSystem.GetProjectileAt(Index);
+		const int32 i = static_cast<int32>(Projectile.Damage);
+
+		const bool bIsLocationCorrect = FMath::Abs(Projectile.Location.X - static_cast<float>(i % 1000 + 100)) < 0.05f
+			&& FMath::Abs(Projectile.Location.Y - static_cast<float>(i / 1000 + i % 7)) < 0.05f;
+
+		if (i % 2 == 0 || !bIsLocationCorrect || FMath::Abs(Projectile.Lifetime - 9.f) > 0.01f)
+		{
+			NumberOfWrongProjectiles++;
+		}
+	}
+
+	EXPECT_EQ(NumberOfWrongProjectiles, 0);
+
+	// Vertices are offset by render offset, first projectile is at its location
+	const FVector2D<float> RenderOffset(-50.f, 20.f);
+	ProjectileSystem.BuildRenderBatches(RenderOffset);
+
+	const FProjectileData& FirstProjectile = ProjectileSystem.GetProjectileAt(0);
+	const std::vector<SDL_Vertex>& Vertices = ProjectileSystem.GetRenderBatches()[0].Vertices;
+	const float CenterX = (Vertices[0].position.x + Vertices[2].position.x) * 0.5f;
+	const float CenterY = (Vertices[0].position.y + Vertices[2].position.y) * 0.5f;
+	EXPECT_NEAR(CenterX, FirstProjectile.Location.X + RenderOffset.X, 0.01f);
+	EXPECT_NEAR(CenterY, FirstProjectile.Location.Y + RenderOffset.Y, 0.01f);
+
+	const int64 AverageFrameDuration = (TickDuration + BatchDuration) / NumberOfFrames;
+
+	std::cout << NumberOfProjectiles << " projectiles, " << NumberOfFrames << " frames: tick " << TickDuration << "us, render batching " << BatchDuration << "us, average frame " << AverageFrameDuration << "us" << std::endl;
+}
+
+/** Unit with team and circle collision, entity manager of test has no map so collision manager is set directly */
+class FCollisionTestUnit : public EEntity
+{
+public:
+	FCollisionTestUnit(FEntityManager* InEntityManager, FCollisionManager* InCollisionManager, const int32 InTeam)
+		: EEntity(InEntityManager)
+	{
+		UParentComponent* RootComponent = CreateComponent<UParentComponent>("Root");
+		SetRootComponent(RootComponent);
+
+		CollisionComponent = RootComponent->CreateComponent<UCircleCollisionComponent>("Collision");
+		CollisionComponent->SetCollisionManager(InCollisionManager);
+		CollisionComponent->SetSize(FVector2D<int>(20, 20));
+
+		if (InTeam != INDEX_NONE)
+		{
+			CreateComponent<UTeamComponent>("Team")->SetCurrentTeam(InTeam);
+		}
+	}
+
+	UCircleCollisionComponent* CollisionComponent;
+};
+
+class FProjectileTestWeapon : public EWeaponBase
+{
+public:
+	FProjectileTestWeapon(FEntityManager* InEntityManager)
+		: EWeaponBase(InEntityManager)
+	{
+	}
+
+	bool Fire(const FProjectileData& InProjectileData)
+	{
+		return FireProjectile(InProjectileData);
+	}
+};
+
+TEST(ProjectileSystemTest, HitsSkipOwnerAndTeam)
+{
+	const float DeltaTime = 1.f / 60.f;
+
+	FCollisionManager CollisionManager;
+	CollisionManager.InitializeSubSystem();
+
+	FEntityHandleTestManager* EntityManager = new FEntityHandleTestManager();
+
+	FProjectileSystem* ProjectileSystem = EntityManager->CreateEntitySystem<FProjectileSystem>();
+	ProjectileSystem->SetCollisionManager(&CollisionManager);
+
+	// Units on one line, projectiles fly right from shooter
+	FCollisionTestUnit* Shooter = EntityManager->CreateEntity<FCollisionTestUnit>(&CollisionManager, 1);
+	FCollisionTestUnit* Ally = EntityManager->CreateEntity<FCollisionTestUnit>(&CollisionManager, 1);
+	FCollisionTestUnit* Enemy = EntityManager->CreateEntity<FCollisionTestUnit>(&CollisionManager, 2);
+	Shooter->SetLocation(FVector2D<int32>(100, 100));
+	Ally->SetLocation(FVector2D<int32>(200, 100));
+	Enemy->SetLocation(FVector2D<int32>(300, 100));
+
+	FProjectileTestWeapon* Weapon = EntityManager->CreateEntity<FProjectileTestWeapon>();
+	Weapon->AttachToEntity(Shooter);
+
+	CArray<UCollisionComponent*> HitComponents;
+	CArray<FProjectileData> HitProjectiles;
+	ProjectileSystem->OnProjectileHit.BindLambda([&](const FProjectileData& InProjectileData, UCollisionComponent* InCollisionComponent)
+	{
+		HitProjectiles.Push(InProjectileData);
+		HitComponents.Push(InCollisionComponent);
+	});
+
+	auto FireAndTick = [&](const FProjectileData& InProjectileData, const bool bUseWeapon)
+	{
+		HitComponents.Clear();
+		HitProjectiles.Clear();
+
+		const bool bWasFired = bUseWeapon ? Weapon->Fire(InProjectileData) : ProjectileSystem->FireProjectile(InProjectileData);
+		EXPECT_TRUE(bWasFired);
+
+		for (int32 Frame = 0; Frame < 60 && ProjectileSystem->GetNumberOfProjectiles() > 0; Frame++)
+		{
+			ProjectileSystem->Tick(DeltaTime);
+		}
+
+		EXPECT_EQ(ProjectileSystem->GetNumberOfProjectiles(), 0);
+	};
+
+	FProjectileData ProjectileData;
+	ProjectileData.Location = FVector2D<float>(100.f, 100.f);
+	ProjectileData.Velocity = FVector2D<float>(600.f, 0.f);
+
+	// Weapon fills owner and team from unit it is attached to, so shooter and ally are skipped
+	FireAndTick(ProjectileData, true);
+	ASSERT_EQ(HitComponents.Size(), 1);
+	EXPECT_TRUE(HitComponents[0] == Enemy->CollisionComponent);
+	EXPECT_TRUE(HitProjectiles[0].Owner == Shooter->GetEntityHandle());
+	EXPECT_EQ(HitProjectiles[0].Team, 1);
+
+	// Without team only owner is skipped
+	ProjectileData.Owner = Shooter->GetEntityHandle();
+	FireAndTick(ProjectileData, false);
+	ASSERT_EQ(HitComponents.Size(), 1);
+	EXPECT_TRUE(HitComponents[0] == Ally->CollisionComponent);
+
+	// Without owner shooter is hit right away
+	ProjectileData.Owner = FEntityHandle();
+	FireAndTick(ProjectileData, false);
+	ASSERT_EQ(HitComponents.Size(), 1);
+	EXPECT_TRUE(HitComponents[0] == Shooter->CollisionComponent);
+
+	// Projectile of other team passes through its team
+	ProjectileData.Team = 2;
+	ProjectileData.Location = FVector2D<float>(400.f, 100.f);
+	ProjectileData.Velocity = FVector2D<float>(-600.f, 0.f);
+	FireAndTick(ProjectileData, false);
+	ASSERT_EQ(HitComponents.Size(), 1);
+	EXPECT_TRUE(HitComponents[0] == Ally->CollisionComponent);
+
+	// Weapon held by destroyed unit does not fire
+	EntityManager->DestroyEntity(Shooter);
+	EXPECT_FALSE(Weapon->Fire(ProjectileData));
+	EXPECT_EQ(ProjectileSystem->GetNumberOfProjectiles(), 0);
+
+	delete EntityManager;
+}
+
+TEST(CollisionBroadphaseTest, GridAndTreeWithMixedSizes)
+{
+	const int32 NumberOfObjects = 10000;
+	const int32 NumberOfFrames = 30;
+	const int32 WorldSize = 4096;
+
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_real_distribution<float> LocationDistribution(0.f, static_cast<float>(WorldSize));
+	std::uniform_real_distribution<float> SmallSizeDistribution(4.f, 32.f);
+	std::uniform_real_distribution<float> BigSizeDistribution(200.f, 500.f);
+	std::uniform_real_distribution<float> VelocityDistribution(-3.f, 3.f);
+
+	// Mostly small objects with 1% of big ones, which grid handles badly
+	std::vector<FCollisionAABB> Bounds(NumberOfObjects);
+	std::vector<FVector2D<float>> Velocities(NumberOfObjects);
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		const float Size = (i % 100 == 0) ? BigSizeDistribution(RandomGenerator) : SmallSizeDistribution(RandomGenerator);
+		const FVector2D<float> Location(LocationDistribution(RandomGenerator), LocationDistribution(RandomGenerator));
+
+		Bounds[i] = FCollisionAABB(Location, FVector2D<float>(Location.X + Size, Location.Y + Size));
+		Velocities[i] = FVector2D<float>(VelocityDistribution(RandomGenerator), VelocityDistribution(RandomGenerator));
+	}
+
+	FGridBroadphase GridBroadphase(FVector2D<int>(64, 64), FVector2D<int>(WorldSize, WorldSize));
+	FAABBTreeBroadphase TreeBroadphase;
+
+	std::vector<FBroadphaseProxyId> GridProxyIds(NumberOfObjects);
+	std::vector<FBroadphaseProxyId> TreeProxyIds(NumberOfObjects);
+
+	// Proxy id to object index
+	std::unordered_map<FBroadphaseProxyId, int32> GridObjectIndices;
+	std::unordered_map<FBroadphaseProxyId, int32> TreeObjectIndices;
+
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		GridProxyIds[i] = GridBroadphase.CreateProxy(Bounds[i], nullptr);
+		TreeProxyIds[i] = TreeBroadphase.CreateProxy(Bounds[i], nullptr);
+
+		GridObjectIndices[GridProxyIds[i]] = i;
+		TreeObjectIndices[TreeProxyIds[i]] = i;
+	}
+
+	EXPECT_EQ(GridBroadphase.GetNumberOfProxies(), NumberOfObjects);
+	EXPECT_EQ(TreeBroadphase.GetNumberOfProxies(), NumberOfObjects);
+
+	CArray<FBroadphasePair> GridPairs;
+	CArray<FBroadphasePair> TreePairs;
+
+	int64 GridDuration = 0;
+	int64 TreeDuration = 0;
+
+	for (int32 Frame = 0; Frame < NumberOfFrames; Frame++)
+	{
+		for (int32 i = 0; i < NumberOfObjects; i++)
+		{
+			Bounds[i].Min += Velocities[i];
+			Bounds[i].Max += Velocities[i];
+		}
+
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int32 i = 0; i < NumberOfObjects; i++)
+		{
+			GridBroadphase.MoveProxy(GridProxyIds[i], Bounds[i]);
+		}
+		GridBroadphase.UpdatePairs(GridPairs);
+		auto end = std::chrono::high_resolution_clock::now();
+		GridDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+		start = std::chrono::high_resolution_clock::now();
+		for (int32 i = 0; i < NumberOfObjects; i++)
+		{
+			TreeBroadphase.MoveProxy(TreeProxyIds[i], Bounds[i]);
+		}
+		TreeBroadphase.UpdatePairs(TreePairs);
+		end = std::chrono::high_resolution_clock::now();
+		TreeDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+	}
+
+	// Tree reports pairs of fat bounds, keep only pairs with overlapping exact bounds to compare with reference
+	auto ToSortedObjectPairs = [&](const CArray<FBroadphasePair>& InPairs, const std::unordered_map<FBroadphaseProxyId, int32>& ObjectIndices)
+	{
+		std::vector<std::pair<int32, int32>> ObjectPairs;
+
+		for (const FBroadphasePair& Pair : InPairs)
+		{
+			const int32 IndexA = ObjectIndices.at(Pair.ProxyA);
+			const int32 IndexB = ObjectIndices.at(Pair.ProxyB);
+
+			if (Bounds[IndexA].Overlaps(Bounds[IndexB]))
+			{
+				ObjectPairs.emplace_back(FMath::Min(IndexA, IndexB), FMath::Max(IndexA, IndexB));
+			}
+		}
+
+		std::sort(ObjectPairs.begin(), ObjectPairs.end());
+
+		return ObjectPairs;
+	};
+
+	const std::vector<std::pair<int32, int32>> GridObjectPairs = ToSortedObjectPairs(GridPairs, GridObjectIndices);
+	const std::vector<std::pair<int32, int32>> TreeObjectPairs = ToSortedObjectPairs(TreePairs, TreeObjectIndices);
+
+	// Brute force reference, all objects moved in last frame so all pairs are reported
+	std::vector<std::pair<int32, int32>> ReferencePairs;
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		for (int32 j = i + 1; j < NumberOfObjects; j++)
+		{
+			if (Bounds[i].Overlaps(Bounds[j]))
+			{
+				ReferencePairs.emplace_back(i, j);
+			}
+		}
+	}
+
+	EXPECT_FALSE(ReferencePairs.empty());
+	EXPECT_TRUE(GridObjectPairs == ReferencePairs);
+	EXPECT_TRUE(TreeObjectPairs == ReferencePairs);
+
+	// Slow movement stays inside fat bounds most of the time
+	EXPECT_LT(TreeBroadphase.GetNumberOfReinserts(), NumberOfObjects * NumberOfFrames / 2);
+
+	CArray<FBroadphaseProxyId> QueryResult;
+	TreeBroadphase.Query(FCollisionAABB(FVector2D<float>(0.f, 0.f), FVector2D<float>(static_cast<float>(WorldSize) * 2.f, static_cast<float>(WorldSize) * 2.f)), QueryResult);
+	EXPECT_GE(QueryResult.Size(), NumberOfObjects * 9 / 10);
+
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		GridBroadphase.DestroyProxy(GridProxyIds[i]);
+		TreeBroadphase.DestroyProxy(TreeProxyIds[i]);
+	}
+
+	EXPECT_EQ(GridBroadphase.GetNumberOfProxies(), 0);
+	EXPECT_EQ(TreeBroadphase.GetNumberOfProxies(), 0);
+	EXPECT_EQ(TreeBroadphase.GetHeight(), INDEX_NONE);
+
+	// No speed expectation, grid is usually faster for many small objects inside of map, tree does not depend on object size or map size
+	std::cout << NumberOfObjects << " moving objects (1% big), " << NumberOfFrames << " frames: grid " << GridDuration / NumberOfFrames << "us per frame, AABB tree " << TreeDuration / NumberOfFrames << "us per frame, " << ReferencePairs.size() << " pairs" << std::endl;
+}
+
+TEST(CollisionNarrowphaseTest, ParallelSameAsSerial)
+{
+	FThreadsManager ThreadsManager;
+	ThreadsManager.Initialize();
+
+	const int32 NumberOfObjects = 20000;
+	const int32 AreaSize = 1500;
+
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_int_distribution<int> LocationDistribution(0, AreaSize);
+	std::uniform_int_distribution<int> SizeDistribution(4, 40);
+
+	// Many units packed in small area, collision component is not needed for shape checks
+	std::vector<std::unique_ptr<FCollisionBase>> Collisions;
+	FAABBTreeBroadphase Broadphase;
+
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		const FVector2D<int> Location(LocationDistribution(RandomGenerator), LocationDistribution(RandomGenerator));
+		const int Size = SizeDistribution(RandomGenerator);
+
+		FCollisionAABB Bounds;
+		if (i % 2 == 0)
+		{
+			Collisions.push_back(std::make_unique<FCircleCollision>(nullptr, Location, Size / 2));
+
+			Bounds = FCollisionAABB(FVector2D<float>(Location - FVector2D<int>(Size / 2, Size / 2)), FVector2D<float>(Location + FVector2D<int>(Size / 2, Size / 2)));
+		}
+		else
+		{
+			Collisions.push_back(std::make_unique<FSquareCollision>(nullptr, Location, FVector2D<int>(Size, Size)));
+
+			Bounds = FCollisionAABB(FVector2D<float>(Location), FVector2D<float>(Location + FVector2D<int>(Size, Size)));
+		}
+
+		Broadphase.CreateProxy(Bounds, Collisions.back().get());
+	}
+
+	CArray<FBroadphasePair> BroadphasePairs;
+	Broadphase.UpdatePairs(BroadphasePairs);
+
+	CArray<FCollisionNarrowphasePair> NarrowphasePairs;
+	for (const FBroadphasePair& Pair : BroadphasePairs)
+	{
+		NarrowphasePairs.Push(FCollisionNarrowphasePair(Broadphase.GetCollision(Pair.ProxyA), Broadphase.GetCollision(Pair.ProxyB)));
+	}
+
+	auto IsPairIntersecting = [](FCollisionBase* CollisionA, FCollisionBase* CollisionB)
+	{
+		return FCollisionNarrowphase::IsIntersecting(CollisionA, CollisionB);
+	};
+
+	FCollisionNarrowphase SerialNarrowphase(nullptr);
+	FCollisionNarrowphase ParallelNarrowphase(&ThreadsManager);
+	ParallelNarrowphase.SetMinPairsForParallel(0);
+
+	CArray<int32> SerialResult;
+	CArray<int32> ParallelResult;
+
+	auto start = std::chrono::high_resolution_clock::now();
+	SerialNarrowphase.FindIntersectingPairs(NarrowphasePairs, IsPairIntersecting, SerialResult);
+	auto end = std::chrono::high_resolution_clock::now();
+	const auto SerialDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	// Few runs, order of batches on workers differs each time
+	std::chrono::microseconds ParallelDuration(0);
+	for (int32 Run = 0; Run < 5; Run++)
+	{
+		start = std::chrono::high_resolution_clock::now();
+		ParallelNarrowphase.FindIntersectingPairs(NarrowphasePairs, IsPairIntersecting, ParallelResult);
+		end = std::chrono::high_resolution_clock::now();
+		ParallelDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+		EXPECT_TRUE(ParallelResult == SerialResult);
+	}
+
+	// Shapes reject part of broadphase pairs
+	EXPECT_GT(SerialResult.Size(), 0);
+	EXPECT_LT(SerialResult.Size(), NarrowphasePairs.Size());
+
+	std::cout << NarrowphasePairs.Size() << " narrowphase pairs, " << SerialResult.Size() << " intersecting: serial " << SerialDuration.count() << "us, "
+		<< FThreadsManager::GetNumberOfLogicalCPU() << " threads " << ParallelDuration.count() << "us" << std::endl;
+
+	ThreadsManager.DeInitialize();
+}
+
+TEST(CollisionManagerTest, ContactBeginStayAndEnd)
+{
+	FCollisionManager CollisionManager;
+	CollisionManager.InitializeSubSystem();
+
+	FEntityHandleTestManager* EntityManager = new FEntityHandleTestManager();
+
+	// Circles with radius 10
+	FCollisionTestUnit* UnitA = EntityManager->CreateEntity<FCollisionTestUnit>(&CollisionManager, INDEX_NONE);
+	FCollisionTestUnit* UnitB = EntityManager->CreateEntity<FCollisionTestUnit>(&CollisionManager, INDEX_NONE);
+	FCollisionTestUnit* UnitC = EntityManager->CreateEntity<FCollisionTestUnit>(&CollisionManager, INDEX_NONE);
+	UnitA->SetLocation(FVector2D<int32>(100, 100));
+	UnitB->SetLocation(FVector2D<int32>(300, 100));
+	UnitC->SetLocation(FVector2D<int32>(500, 100));
+
+	FCollisionBase* CollisionA = UnitA->CollisionComponent->GetCollisionObjectsArray()[0];
+	FCollisionBase* CollisionB = UnitB->CollisionComponent->GetCollisionObjectsArray()[0];
+	FCollisionBase* CollisionC = UnitC->CollisionComponent->GetCollisionObjectsArray()[0];
+
+	int32 NumberOfBegins = 0;
+	int32 NumberOfStays = 0;
+	int32 NumberOfEnds = 0;
+	CollisionManager.OnContactBegin.BindLambda([&](const FCollisionContact&) { NumberOfBegins++; });
+	CollisionManager.OnContactStay.BindLambda([&](const FCollisionContact&) { NumberOfStays++; });
+	CollisionManager.OnContactEnd.BindLambda([&](const FCollisionContact&) { NumberOfEnds++; });
+
+	int32 NumberOfEntersOfA = 0;
+	int32 NumberOfExitsOfA = 0;
+	UnitA->CollisionComponent->OnCollisionEnter.BindLambda([&](UCollisionComponent*) { NumberOfEntersOfA++; });
+	UnitA->CollisionComponent->OnCollisionExit.BindLambda([&](UCollisionComponent*) { NumberOfExitsOfA++; });
+
+	CollisionManager.TickSubSystem();
+	EXPECT_EQ(CollisionManager.GetNumberOfContacts(), 0);
+	EXPECT_EQ(NumberOfBegins, 0);
+
+	// B moves onto A
+	UnitB->SetLocation(FVector2D<int32>(110, 100));
+	CollisionManager.TickSubSystem();
+	EXPECT_EQ(NumberOfBegins, 1);
+	EXPECT_EQ(NumberOfEntersOfA, 1);
+	EXPECT_EQ(CollisionManager.GetNumberOfContacts(), 1);
+
+	const FCollisionContact* Contact = CollisionManager.FindContact(CollisionB, CollisionA);
+	ASSERT_TRUE(Contact != nullptr);
+	EXPECT_TRUE(Contact == CollisionManager.FindContact(CollisionA, CollisionB));
+	EXPECT_EQ(Contact->BeginTick, Contact->LastUpdateTick);
+	EXPECT_TRUE(CollisionManager.FindContact(CollisionA, CollisionC) == nullptr);
+
+	// Stay is called only when one of objects moved
+	CollisionManager.TickSubSystem();
+	EXPECT_EQ(NumberOfStays, 0);
+
+	UnitB->SetLocation(FVector2D<int32>(115, 100));
+	CollisionManager.TickSubSystem();
+	EXPECT_EQ(NumberOfStays, 1);
+	EXPECT_EQ(NumberOfBegins, 1);
+	EXPECT_GT(CollisionManager.FindContact(CollisionA, CollisionB)->LastUpdateTick, CollisionManager.FindContact(CollisionA, CollisionB)->BeginTick);
+
+	// B leaves
+	UnitB->SetLocation(FVector2D<int32>(300, 100));
+	CollisionManager.TickSubSystem();
+	EXPECT_EQ(NumberOfEnds, 1);
+	EXPECT_EQ(NumberOfExitsOfA, 1);
+	EXPECT_EQ(CollisionManager.GetNumberOfContacts(), 0);
+	EXPECT_TRUE(CollisionManager.FindContact(CollisionA, CollisionB) == nullptr);
+
+	// End callback unregisters other collision in contact with A, its contact ends once and is not visited again
+	UnitB->SetLocation(FVector2D<int32>(110, 100));
+	UnitC->SetLocation(FVector2D<int32>(90, 100));
+	CollisionManager.TickSubSystem();
+	EXPECT_EQ(CollisionManager.GetNumberOfContacts(), 2);
+
+	FCollisionBase* UnregisteredCollision = nullptr;
+	CollisionManager.OnContactEnd.BindLambda([&](const FCollisionContact& InContact)
+	{
+		if (UnregisteredCollision == nullptr)
+		{
+			UnregisteredCollision = (InContact.CollisionA == CollisionB || InContact.CollisionB == CollisionB) ? CollisionC : CollisionB;
+
+			UnregisteredCollision->GetCollisionComponent()->RemoveCollision(UnregisteredCollision);
+		}
+	});
+
+	NumberOfEnds = 0;
+	UnitA->CollisionComponent->SetCollisionsEnabled(false);
+	CollisionManager.TickSubSystem();
+	EXPECT_EQ(NumberOfEnds, 2);
+	EXPECT_EQ(CollisionManager.GetNumberOfContacts(), 0);
+
+	// Stay callback unregisters other collision, contact ends and remaining stay callbacks are skipped
+	UnitA->CollisionComponent->SetCollisionsEnabled(true);
+	CollisionManager.TickSubSystem();
+	EXPECT_EQ(CollisionManager.GetNumberOfContacts(), 1);
+
+	FCollisionTestUnit* RemainingUnit = (UnregisteredCollision == CollisionB) ? UnitC : UnitB;
+	FCollisionBase* RemainingCollision = (UnregisteredCollision == CollisionB) ? CollisionC : CollisionB;
+	UnitA->CollisionComponent->OnCollisionStaying.BindLambda([&](UCollisionComponent*)
+	{
+		if (RemainingUnit->CollisionComponent->GetCollisionObjectsArray().Size() > 0)
+		{
+			RemainingUnit->CollisionComponent->RemoveCollision(RemainingCollision);
+		}
+	});
+
+	NumberOfStays = 0;
+	NumberOfEnds = 0;
+	RemainingUnit->SetLocation(FVector2D<int32>(105, 100));
+	CollisionManager.TickSubSystem();
+	EXPECT_EQ(NumberOfStays, 0);
+	EXPECT_EQ(NumberOfEnds, 1);
+	EXPECT_EQ(CollisionManager.GetNumberOfContacts(), 0);
+
+	// Begin callback unregisters collision of pair which begins later in same tick, that pair is skipped
+	FCollisionTestUnit* UnitD = EntityManager->CreateEntity<FCollisionTestUnit>(&CollisionManager, INDEX_NONE);
+	FCollisionTestUnit* UnitE = EntityManager->CreateEntity<FCollisionTestUnit>(&CollisionManager, INDEX_NONE);
+	FCollisionTestUnit* UnitF = EntityManager->CreateEntity<FCollisionTestUnit>(&CollisionManager, INDEX_NONE);
+	UnitD->SetLocation(FVector2D<int32>(1000, 100));
+	UnitE->SetLocation(FVector2D<int32>(1010, 100));
+	UnitF->SetLocation(FVector2D<int32>(990, 100));
+
+	FCollisionBase* CollisionD = UnitD->CollisionComponent->GetCollisionObjectsArray()[0];
+	FCollisionBase* CollisionE = UnitE->CollisionComponent->GetCollisionObjectsArray()[0];
+	FCollisionBase* CollisionF = UnitF->CollisionComponent->GetCollisionObjectsArray()[0];
+
+	bool bWasUnregisteredOnBegin = false;
+	CollisionManager.OnContactBegin.BindLambda([&](const FCollisionContact& InContact)
+	{
+		if (!bWasUnregisteredOnBegin)
+		{
+			bWasUnregisteredOnBegin = true;
+
+			FCollisionBase* OtherCollision = (InContact.CollisionA == CollisionE || InContact.CollisionB == CollisionE) ? CollisionF : CollisionE;
+			OtherCollision->GetCollisionComponent()->RemoveCollision(OtherCollision);
+		}
+	});
+
+	NumberOfBegins = 0;
+	CollisionManager.TickSubSystem();
+	EXPECT_EQ(NumberOfBegins, 1);
+	EXPECT_EQ(CollisionManager.GetNumberOfContacts(), 1);
+	EXPECT_NE(CollisionManager.FindContact(CollisionD, CollisionE) != nullptr, CollisionManager.FindContact(CollisionD, CollisionF) != nullptr);
+
+	delete EntityManager;
+}
+
+TEST(CollisionKernelsTest, MillionPairTests)
+{
+	const int32 NumberOfCandidates = 1000000;
+
+	// Coordinates below 2048, so float kernels are exact and must match int checks
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_int_distribution<int> LocationDistribution(0, 1000);
+	std::uniform_int_distribution<int> SizeDistribution(1, 60);
+
+	std::vector<FCircle> Circles;
+	std::vector<FRectangleWithDiagonal> Rectangles;
+	Circles.reserve(NumberOfCandidates);
+	Rectangles.reserve(NumberOfCandidates);
+
+	FCollisionCircleBatch CircleBatch;
+	FCollisionRectangleBatch RectangleBatch;
+	CircleBatch.Reserve(NumberOfCandidates);
+	RectangleBatch.Reserve(NumberOfCandidates);
+
+	for (int32 i = 0; i < NumberOfCandidates; i++)
+	{
+		Circles.emplace_back(FVector2D<int>(LocationDistribution(RandomGenerator), LocationDistribution(RandomGenerator)), SizeDistribution(RandomGenerator));
+		Rectangles.emplace_back(FVector2D<int>(LocationDistribution(RandomGenerator), LocationDistribution(RandomGenerator)), FVector2D<int>(SizeDistribution(RandomGenerator), SizeDistribution(RandomGenerator)));
+
+		CircleBatch.Add(Circles.back());
+		RectangleBatch.Add(Rectangles.back());
+	}
+
+	const FCircle TestedCircle(FVector2D<int>(500, 500), 120);
+	const FRectangleWithDiagonal TestedRectangle(FVector2D<int>(400, 450), FVector2D<int>(200, 100));
+
+	CArray<uint8> Results;
+	int32 NumberOfMismatches = 0;
+	int32 NumberOfIntersecting = 0;
+
+	auto MeasureKernel = [&](const char* KernelName, auto&& Kernel, auto&& IsIntersectingScalar)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		Kernel();
+		auto end = std::chrono::high_resolution_clock::now();
+		const auto KernelDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+		start = std::chrono::high_resolution_clock::now();
+		for (int32 i = 0; i < NumberOfCandidates; i++)
+		{
+			const bool bIsIntersecting = IsIntersectingScalar(i);
+
+			NumberOfIntersecting += bIsIntersecting ? 1 : 0;
+			NumberOfMismatches += (bIsIntersecting != (Results[i] != 0)) ? 1 : 0;
+		}
+		end = std::chrono::high_resolution_clock::now();
+		const auto ScalarDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+		EXPECT_EQ(Results.Size(), NumberOfCandidates);
+
+		std::cout << KernelName << ": kernel " << KernelDuration.count() << "us, FCollisionGlobals " << ScalarDuration.count() << "us" << std::endl;
+	};
+
+	std::cout << "Collision kernels use " << FCollisionKernels::GetInstructionSetName() << ", " << NumberOfCandidates << " pair tests per call" << std::endl;
+
+	MeasureKernel("Circle vs circles",
+		[&]() { FCollisionKernels::CircleAgainstCircles(TestedCircle, CircleBatch, Results); },
+		[&](const int32 Index) { return FCollisionGlobals::CirclesIntersect(TestedCircle, Circles[Index]); });
+
+	MeasureKernel("Circle vs rectangles",
+		[&]() { FCollisionKernels::CircleAgainstRectangles(TestedCircle, RectangleBatch, Results); },
+		[&](const int32 Index) { return FCollisionGlobals::CircleAndSquareIntersect(Rectangles[Index], TestedCircle); });
+
+	MeasureKernel("Rectangle vs rectangles",
+		[&]() { FCollisionKernels::RectangleAgainstRectangles(TestedRectangle, RectangleBatch, Results); },
+		[&](const int32 Index) { return FCollisionGlobals::RectanglesIntersect(TestedRectangle, Rectangles[Index]); });
+
+	MeasureKernel("Rectangle vs circles",
+		[&]() { FCollisionKernels::RectangleAgainstCircles(TestedRectangle, CircleBatch, Results); },
+		[&](const int32 Index) { return FCollisionGlobals::CircleAndSquareIntersect(TestedRectangle, Circles[Index]); });
+
+	EXPECT_EQ(NumberOfMismatches, 0);
+	EXPECT_GT(NumberOfIntersecting, 0);
+}
+
+TEST(CollisionKernelsTest, BatchedSameAsScalarFarFromOrigin)
+{
+	FThreadsManager ThreadsManager;
+	ThreadsManager.Initialize();
+
+	const int32 NumberOfObjects = 20000;
+	const int32 AreaSize = 1500;
+
+	// Far from origin, absolute coordinates are not exact in float
+	const FVector2D<int> AreaOrigin(3000000, -2000000);
+
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_int_distribution<int> LocationDistribution(0, AreaSize);
+	std::uniform_int_distribution<int> SizeDistribution(4, 40);
+
+	std::vector<std::unique_ptr<FCollisionBase>> Collisions;
+	FAABBTreeBroadphase Broadphase;
+
+	auto AddCollision = [&](const FVector2D<int>& Location, const int Size, const bool bIsCircle)
+	{
+		FCollisionAABB Bounds;
+		if (bIsCircle)
+		{
+			Collisions.push_back(std::make_unique<FCircleCollision>(nullptr, Location, Size / 2));
+
+			Bounds = FCollisionAABB(FVector2D<float>(Location - FVector2D<int>(Size / 2, Size / 2)), FVector2D<float>(Location + FVector2D<int>(Size / 2, Size / 2)));
+		}
+		else
+		{
+			Collisions.push_back(std::make_unique<FSquareCollision>(nullptr, Location, FVector2D<int>(Size, Size)));
+
+			Bounds = FCollisionAABB(FVector2D<float>(Location), FVector2D<float>(Location + FVector2D<int>(Size, Size)));
+		}
+
+		Broadphase.CreateProxy(Bounds, Collisions.back().get());
+	};
+
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		AddCollision(AreaOrigin + FVector2D<int>(LocationDistribution(RandomGenerator), LocationDistribution(RandomGenerator)), SizeDistribution(RandomGenerator), (i % 2 == 0));
+	}
+
+	// Shapes touching exactly at edge do not intersect, one unit closer they do
+	AddCollision(AreaOrigin + FVector2D<int>(-500, -500), 200, true);
+	AddCollision(AreaOrigin + FVector2D<int>(-300, -500), 200, true);
+	AddCollision(AreaOrigin + FVector2D<int>(-500, -800), 200, false);
+	AddCollision(AreaOrigin + FVector2D<int>(-301, -800), 200, false);
+	AddCollision(AreaOrigin + FVector2D<int>(-800, -500), 100, false);
+	AddCollision(AreaOrigin + FVector2D<int>(-650, -450), 100, true);
+
+	// Too big for exact float, checked by FCollisionGlobals
+	AddCollision(AreaOrigin + FVector2D<int>(AreaSize / 2, AreaSize / 2), 5000, true);
+	AddCollision(AreaOrigin + FVector2D<int>(AreaSize / 3, AreaSize / 3), 6000, false);
+
+	CArray<FBroadphasePair> BroadphasePairs;
+	Broadphase.UpdatePairs(BroadphasePairs);
+
+	CArray<FCollisionNarrowphasePair> NarrowphasePairs;
+	for (const FBroadphasePair& Pair : BroadphasePairs)
+	{
+		NarrowphasePairs.Push(FCollisionNarrowphasePair(Broadphase.GetCollision(Pair.ProxyA), Broadphase.GetCollision(Pair.ProxyB)));
+	}
+
+	FCollisionNarrowphase SerialNarrowphase(nullptr);
+	FCollisionNarrowphase ParallelNarrowphase(&ThreadsManager);
+	ParallelNarrowphase.SetMinPairsForParallel(0);
+
+	CArray<int32> ScalarResult;
+	auto start = std::chrono::high_resolution_clock::now();
+	SerialNarrowphase.FindIntersectingPairs(NarrowphasePairs, &FCollisionNarrowphase::IsIntersecting, ScalarResult);
+	auto end = std::chrono::high_resolution_clock::now();
+	const auto ScalarDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	std::atomic<int32> NumberOfCustomChecks(0);
+	auto IsCustomPairIntersecting = [&NumberOfCustomChecks](FCollisionBase* /*CollisionA*/, FCollisionBase* /*CollisionB*/)
+	{
+		NumberOfCustomChecks++;
+
+		return false;
+	};
+
+	// First call grows buffers
+	CArray<int32> BatchedResult;
+	SerialNarrowphase.FindIntersectingShapes(NarrowphasePairs, IsCustomPairIntersecting, BatchedResult);
+
+	start = std::chrono::high_resolution_clock::now();
+	SerialNarrowphase.FindIntersectingShapes(NarrowphasePairs, IsCustomPairIntersecting, BatchedResult);
+	end = std::chrono::high_resolution_clock::now();
+	const auto BatchedDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+	EXPECT_TRUE(BatchedResult == ScalarResult);
+
+	for (int32 Run = 0; Run < 3; Run++)
+	{
+		ParallelNarrowphase.FindIntersectingShapes(NarrowphasePairs, IsCustomPairIntersecting, BatchedResult);
+
+		EXPECT_TRUE(BatchedResult == ScalarResult);
+	}
+
+	// Only custom types reach callback
+	EXPECT_EQ(NumberOfCustomChecks.load(), 0);
+	EXPECT_GT(ScalarResult.Size(), 0);
+	EXPECT_LT(ScalarResult.Size(), NarrowphasePairs.Size());
+
+	// Queries check candidates by kernels too
+	FCollisionQuery Query(&Broadphase);
+	CArray<FCollisionBase*> Result;
+	CArray<FCollisionBase*> Expected;
+
+	const FVector2D<int> QueryLocations[] = { AreaOrigin + FVector2D<int>(700, 700), AreaOrigin + FVector2D<int>(-400, -500), AreaOrigin + FVector2D<int>(-700, -700) };
+	const int QueryRadiuses[] = { 100, 1, 3000 };
+
+	for (int32 QueryIndex = 0; QueryIndex < 3; QueryIndex++)
+	{
+		const FVector2D<int>& QueryLocation = QueryLocations[QueryIndex];
+		const int QueryRadius = QueryRadiuses[QueryIndex];
+		const FRectangleWithDiagonal Selection(QueryLocation, FVector2D<int>(QueryRadius, QueryRadius));
+
+		Query.OverlapCircle(QueryLocation, QueryRadius, FCollisionQueryFilter(), Result);
+
+		Expected.Clear();
+		for (const std::unique_ptr<FCollisionBase>& Collision : Collisions)
+		{
+			if (FCollisionQuery::IsCircleOverlapping(QueryLocation, QueryRadius, Collision.get()))
+			{
+				Expected.Push(Collision.get());
+			}
+		}
+
+		std::sort(Result.Vector.begin(), Result.Vector.end());
+		std::sort(Expected.Vector.begin(), Expected.Vector.end());
+		EXPECT_TRUE(Result == Expected);
+
+		Query.OverlapRectangle(QueryLocation, Selection.GetSize(), FCollisionQueryFilter(), Result);
+
+		Expected.Clear();
+		for (const std::unique_ptr<FCollisionBase>& Collision : Collisions)
+		{
+			if (FCollisionQuery::IsRectangleOverlapping(Selection, Collision.get()))
+			{
+				Expected.Push(Collision.get());
+			}
+		}
+
+		std::sort(Result.Vector.begin(), Result.Vector.end());
+		std::sort(Expected.Vector.begin(), Expected.Vector.end());
+		EXPECT_TRUE(Result == Expected);
+		EXPECT_GT(Expected.Size(), 0);
+	}
+
+	std::cout << NarrowphasePairs.Size() << " narrowphase pairs, " << ScalarResult.Size() << " intersecting: FCollisionGlobals " << ScalarDuration.count() << "us, "
+		<< FCollisionKernels::GetInstructionSetName() << " batches " << BatchedDuration.count() << "us" << std::endl;
+
+	ThreadsManager.DeInitialize();
+}
+
+TEST(CollisionQueryTest, QueriesSameAsBruteForce)
+{
+	const int32 NumberOfObjects = 20000;
+	const int32 AreaSize = 4000;
+
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_int_distribution<int> LocationDistribution(0, AreaSize);
+	std::uniform_int_distribution<int> SizeDistribution(4, 40);
+
+	// Two teams in layers 1 and 2, collision component is not needed for queries
+	std::vector<std::unique_ptr<FCollisionBase>> Collisions;
+	FAABBTreeBroadphase TreeBroadphase;
+	FGridBroadphase GridBroadphase(FVector2D<int>(64, 64), FVector2D<int>(AreaSize, AreaSize));
+
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		const FVector2D<int> Location(LocationDistribution(RandomGenerator), LocationDistribution(RandomGenerator));
+		const int Size = SizeDistribution(RandomGenerator);
+
+		FCollisionAABB Bounds;
+		if (i % 2 == 0)
+		{
+			Collisions.push_back(std::make_unique<FCircleCollision>(nullptr, Location, Size / 2));
+
+			Bounds = FCollisionAABB(FVector2D<float>(Location - FVector2D<int>(Size / 2, Size / 2)), FVector2D<float>(Location + FVector2D<int>(Size / 2, Size / 2)));
+		}
+		else
+		{
+			Collisions.push_back(std::make_unique<FSquareCollision>(nullptr, Location, FVector2D<int>(Size, Size)));
+
+			Bounds = FCollisionAABB(FVector2D<float>(Location), FVector2D<float>(Location + FVector2D<int>(Size, Size)));
+		}
+
+		Collisions.back()->SetCollisionLayer((i % 3 == 0) ? 2 : 1);
+
+		TreeBroadphase.CreateProxy(Bounds, Collisions.back().get());
+		GridBroadphase.CreateProxy(Bounds, Collisions.back().get());
+	}
+
+	const FCollisionQueryFilter TeamFilter(1);
+
+	auto SortCollisions = [](CArray<FCollisionBase*>& InOutCollisions)
+	{
+		std::sort(InOutCollisions.Vector.begin(), InOutCollisions.Vector.end());
+	};
+
+	// Brute force results
+	const FVector2D<int> SelectionTopLeft(1000, 1200);
+	const FVector2D<int> SelectionSize(600, 400);
+	const FRectangleWithDiagonal Selection(SelectionTopLeft, SelectionSize);
+	const FVector2D<int> CircleLocation(2500, 2500);
+	const int CircleRadius = 150;
+	const FVector2D<float> RayStart(10.f, 3900.f);
+	const FVector2D<float> RayEnd(3700.f, 150.f);
+	const int32 NearestCount = 10;
+
+	CArray<FCollisionBase*> ExpectedRectangle;
+	CArray<FCollisionBase*> ExpectedCircle;
+	CArray<FCollisionBase*> ExpectedRay;
+	CArray<float> ExpectedNearestDistances;
+
+	for (const std::unique_ptr<FCollisionBase>& Collision : Collisions)
+	{
+		if (!TeamFilter.IsPassing(Collision.get()))
+		{
+			continue;
+		}
+
+		if (FCollisionQuery::IsRectangleOverlapping(Selection, Collision.get()))
+		{
+			ExpectedRectangle.Push(Collision.get());
+		}
+
+		if (FCollisionQuery::IsCircleOverlapping(CircleLocation, CircleRadius, Collision.get()))
+		{
+			ExpectedCircle.Push(Collision.get());
+		}
+
+		float Fraction;
+		if (FCollisionQuery::RaycastCollision(RayStart, RayEnd, Collision.get(), Fraction))
+		{
+			ExpectedRay.Push(Collision.get());
+		}
+
+		ExpectedNearestDistances.Push(FCollisionQuery::GetDistanceToCollision(CircleLocation, Collision.get()));
+	}
+
+	SortCollisions(ExpectedRectangle);
+	SortCollisions(ExpectedCircle);
+	SortCollisions(ExpectedRay);
+	std::sort(ExpectedNearestDistances.Vector.begin(), ExpectedNearestDistances.Vector.end());
+
+	EXPECT_GT(ExpectedRectangle.Size(), 0);
+	EXPECT_GT(ExpectedRay.Size(), 0);
+
+	const ICollisionBroadphaseInterface* Broadphases[] = { &GridBroadphase, &TreeBroadphase };
+	const char* BroadphaseNames[] = { "grid", "AABB tree" };
+
+	for (int32 BroadphaseIndex = 0; BroadphaseIndex < 2; BroadphaseIndex++)
+	{
+		FCollisionQuery Query(Broadphases[BroadphaseIndex]);
+
+		CArray<FCollisionBase*> Result;
+		CArray<FCollisionRayHit> RayHits;
+		CArray<FCollisionNearestResult> NearestResults;
+
+		// First call grows buffers
+		Query.OverlapRectangle(SelectionTopLeft, SelectionSize, TeamFilter, Result);
+
+		auto start = std::chrono::high_resolution_clock::now();
+		Query.OverlapRectangle(SelectionTopLeft, SelectionSize, TeamFilter, Result);
+		auto end = std::chrono::high_resolution_clock::now();
+		const auto BoxSelectDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+		SortCollisions(Result);
+		EXPECT_TRUE(Result == ExpectedRectangle);
+
+		Query.OverlapCircle(CircleLocation, CircleRadius, TeamFilter, Result);
+		SortCollisions(Result);
+		EXPECT_TRUE(Result == ExpectedCircle);
+
+		start = std::chrono::high_resolution_clock::now();
+		Query.RaycastAll(RayStart, RayEnd, TeamFilter, RayHits);
+		end = std::chrono::high_resolution_clock::now();
+		const auto RaycastDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+		Result.Clear();
+		for (int32 HitIndex = 0; HitIndex < RayHits.Size(); HitIndex++)
+		{
+			Result.Push(RayHits[HitIndex].Collision);
+
+			if (HitIndex > 0)
+			{
+				EXPECT_LE(RayHits[HitIndex - 1].Fraction, RayHits[HitIndex].Fraction);
+			}
+		}
+		SortCollisions(Result);
+		EXPECT_TRUE(Result == ExpectedRay);
+
+		FCollisionRayHit FirstHit;
+		EXPECT_TRUE(Query.RaycastFirst(RayStart, RayEnd, TeamFilter, FirstHit));
+		EXPECT_EQ(FirstHit.Fraction, RayHits[0].Fraction);
+
+		start = std::chrono::high_resolution_clock::now();
+		Query.FindNearest(CircleLocation, NearestCount, std::numeric_limits<float>::max(), TeamFilter, NearestResults);
+		end = std::chrono::high_resolution_clock::now();
+		const auto NearestDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+		EXPECT_EQ(NearestResults.Size(), NearestCount);
+		for (int32 ResultIndex = 0; ResultIndex < NearestResults.Size(); ResultIndex++)
+		{
+			EXPECT_EQ(NearestResults[ResultIndex].Distance, ExpectedNearestDistances[ResultIndex]);
+		}
+
+		std::cout << BroadphaseNames[BroadphaseIndex] << ": box select " << ExpectedRectangle.Size() << " of " << NumberOfObjects << " in " << BoxSelectDuration.count()
+			<< "us, raycast " << RayHits.Size() << " hits in " << RaycastDuration.count() << "us, " << NearestCount << " nearest in " << NearestDuration.count() << "us" << std::endl;
+	}
+}
+
+TEST(CollisionLayersTest, FilteredPairsSameAsBruteForce)
+{
+	const int32 NumberOfObjects = 8000;
+	const int32 AreaSize = 2000;
+
+	// Layers as in default CollisionSettings.ini
+	const FCollisionLayerMask DefaultLayer = 1 << 0;
+	const FCollisionLayerMask StaticLayer = 1 << 1;
+	const FCollisionLayerMask ProjectileLayer = 1 << 2;
+	const FCollisionLayerMask TriggerLayer = 1 << 3;
+
+	const FCollisionFilter UnitFilter(DefaultLayer, FCollisionFilter::AllLayers);
+	const FCollisionFilter BlockerFilter(StaticLayer, DefaultLayer | ProjectileLayer, true);
+	const FCollisionFilter ProjectileFilter(ProjectileLayer, DefaultLayer | StaticLayer);
+	const FCollisionFilter TriggerFilter(TriggerLayer, DefaultLayer);
+
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_int_distribution<int> LocationDistribution(0, AreaSize);
+	std::uniform_int_distribution<int> SizeDistribution(8, 40);
+
+	std::vector<std::unique_ptr<FCollisionBase>> Collisions;
+	std::vector<FCollisionAABB> Bounds;
+	std::vector<FCollisionFilter> Filters;
+
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		FVector2D<int> Location(LocationDistribution(RandomGenerator), LocationDistribution(RandomGenerator));
+		int Size = SizeDistribution(RandomGenerator);
+
+		// 30% units, 30% projectiles, 30% blockers placed as touching tiles, 10% triggers
+		const int32 ObjectKind = i % 10;
+		if (ObjectKind < 3)
+		{
+			Filters.push_back(UnitFilter);
+		}
+		else if (ObjectKind < 6)
+		{
+			Filters.push_back(ProjectileFilter);
+		}
+		else if (ObjectKind < 9)
+		{
+			Size = 32;
+			Location = FVector2D<int>((Location.X / Size) * Size, (Location.Y / Size) * Size);
+
+			Filters.push_back(BlockerFilter);
+		}
+		else
+		{
+			Filters.push_back(TriggerFilter);
+		}
+
+		Collisions.push_back(std::make_unique<FSquareCollision>(nullptr, Location, FVector2D<int>(Size, Size)));
+		Collisions.back()->SetCollisionFilter(Filters.back());
+
+		Bounds.push_back(FCollisionAABB(FVector2D<float>(Location), FVector2D<float>(Location + FVector2D<int>(Size, Size))));
+	}
+
+	int32 ExpectedUnfilteredPairs = 0;
+	int32 ExpectedFilteredPairs = 0;
+
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		for (int32 j = i + 1; j < NumberOfObjects; j++)
+		{
+			if (Bounds[i].Overlaps(Bounds[j]))
+			{
+				ExpectedUnfilteredPairs++;
+
+				if (Filters[i].CanCollide(Filters[j]))
+				{
+					ExpectedFilteredPairs++;
+				}
+			}
+		}
+	}
+
+	EXPECT_LT(ExpectedFilteredPairs, ExpectedUnfilteredPairs);
+
+	FAABBTreeBroadphase UnfilteredTree;
+	FAABBTreeBroadphase FilteredTree;
+	FGridBroadphase UnfilteredGrid(FVector2D<int>(64, 64), FVector2D<int>(AreaSize, AreaSize));
+	FGridBroadphase FilteredGrid(FVector2D<int>(64, 64), FVector2D<int>(AreaSize, AreaSize));
+
+	CArray<FBroadphaseProxyId> FilteredTreeProxyIds;
+
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		UnfilteredTree.CreateProxy(Bounds[i], Collisions[i].get());
+		FilteredTreeProxyIds.Push(FilteredTree.CreateProxy(Bounds[i], Collisions[i].get(), Filters[i]));
+		UnfilteredGrid.CreateProxy(Bounds[i], Collisions[i].get());
+		FilteredGrid.CreateProxy(Bounds[i], Collisions[i].get(), Filters[i]);
+	}
+
+	ICollisionBroadphaseInterface* Broadphases[] = { &UnfilteredTree, &FilteredTree, &UnfilteredGrid, &FilteredGrid };
+	const char* BroadphaseNames[] = { "AABB tree", "AABB tree with layers", "grid", "grid with layers" };
+	const int32 ExpectedPairs[] = { ExpectedUnfilteredPairs, ExpectedFilteredPairs, ExpectedUnfilteredPairs, ExpectedFilteredPairs };
+
+	CArray<FBroadphasePair> Pairs;
+
+	for (int32 BroadphaseIndex = 0; BroadphaseIndex < 4; BroadphaseIndex++)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		Broadphases[BroadphaseIndex]->UpdatePairs(Pairs);
+		auto end = std::chrono::high_resolution_clock::now();
+
+		EXPECT_EQ(Pairs.Size(), ExpectedPairs[BroadphaseIndex]);
+
+		std::cout << BroadphaseNames[BroadphaseIndex] << ": " << Pairs.Size() << " pairs in " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << "us" << std::endl;
+	}
+
+	// Changed filter is used by next update, blocker becomes dynamic unit so it is paired with other blockers
+	FilteredTree.SetProxyFilter(FilteredTreeProxyIds[6], UnitFilter);
+	FilteredTree.UpdatePairs(Pairs);
+
+	int32 ExpectedPairsOfChangedProxy = 0;
+	for (int32 i = 0; i < NumberOfObjects; i++)
+	{
+		if (i != 6 && Bounds[i].Overlaps(Bounds[6]) && Filters[i].CanCollide(UnitFilter))
+		{
+			ExpectedPairsOfChangedProxy++;
+		}
+	}
+
+	EXPECT_EQ(Pairs.Size(), ExpectedPairsOfChangedProxy);
+}
+
+TEST(NavigationTest, JumpPointSameCostAsAStar)
+{
+	std::mt19937 RandomGenerator(2026);
+
+	// @returns cost of path, checks that each part is straight or diagonal line of walkable tiles
+	auto GetValidatedPathCost = [](const FNavigationGrid& Grid, const CArray<FVector2D<int32>>& PathTiles) -> int32
+	{
+		int32 PathCost = 0;
+
+		for (int32 i = 1; i < PathTiles.Size(); i++)
+		{
+			const int32 DistanceX = FMath::Abs(PathTiles[i].X - PathTiles[i - 1].X);
+			const int32 DistanceY = FMath::Abs(PathTiles[i].Y - PathTiles[i - 1].Y);
+
+			EXPECT_TRUE(DistanceX == 0 || DistanceY == 0 || DistanceX == DistanceY);
+			EXPECT_TRUE(Grid.HasLineOfSight(PathTiles[i - 1], PathTiles[i]));
+
+			PathCost += FNavigationPathfinder::GetOctileDistance(PathTiles[i - 1], PathTiles[i]);
+		}
+
+		return PathCost;
+	};
+
+	// Small grids with random blocked tiles, many different shapes of obstacles
+	{
+		const int32 GridSize = 48;
+
+		FNavigationGrid Grid;
+		FNavigationPathfinder Pathfinder;
+		CArray<FVector2D<int32>> AStarPath;
+		CArray<FVector2D<int32>> JumpPointPath;
+		CArray<FVector2D<int32>> SmoothedPath;
+
+		std::uniform_int_distribution<int> PercentDistribution(0, 99);
+		std::uniform_int_distribution<int> TileDistribution(0, GridSize - 1);
+
+		int32 NumberOfFoundPaths = 0;
+
+		for (int32 GridIndex = 0; GridIndex < 50; GridIndex++)
+		{
+			const int32 BlockedPercent = 10 + (GridIndex % 4) * 10;
+
+			Grid.Initialize(FVector2D<int32>(GridSize, GridSize), FVector2D<int32>(32, 32));
+			for (int32 Y = 0; Y < GridSize; Y++)
+			{
+				for (int32 X = 0; X < GridSize; X++)
+				{
+					Grid.SetWalkable(X, Y, PercentDistribution(RandomGenerator) >= BlockedPercent);
+				}
+			}
+
+			for (int32 QueryIndex = 0; QueryIndex < 40; QueryIndex++)
+			{
+				const FVector2D<int32> StartTile(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+				const FVector2D<int32> EndTile(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+
+				const bool bIsAStarPathFound = Pathfinder.FindPath(Grid, StartTile, EndTile, ENavigationAlgorithm::AStar, AStarPath);
+				const int32 AStarCost = Pathfinder.GetLastPathCost();
+
+				const bool bIsJumpPointPathFound = Pathfinder.FindPath(Grid, StartTile, EndTile, ENavigationAlgorithm::JumpPoint, JumpPointPath);
+				const int32 JumpPointCost = Pathfinder.GetLastPathCost();
+
+				ASSERT_EQ(bIsAStarPathFound, bIsJumpPointPathFound);
+
+				if (bIsAStarPathFound)
+				{
+					NumberOfFoundPaths++;
+
+					ASSERT_EQ(AStarCost, JumpPointCost);
+					EXPECT_EQ(GetValidatedPathCost(Grid, AStarPath), AStarCost);
+					EXPECT_EQ(GetValidatedPathCost(Grid, JumpPointPath), JumpPointCost);
+					EXPECT_EQ(AStarPath[0], StartTile);
+					EXPECT_EQ(JumpPointPath[JumpPointPath.Size() - 1], EndTile);
+
+					// Smoothed path keeps ends and is never blocked
+					FNavigationPathfinder::SmoothPath(Grid, JumpPointPath, SmoothedPath);
+					EXPECT_LE(SmoothedPath.Size(), JumpPointPath.Size());
+					EXPECT_EQ(SmoothedPath[0], StartTile);
+					EXPECT_EQ(SmoothedPath[SmoothedPath.Size() - 1], EndTile);
+
+					for (int32 i = 1; i < SmoothedPath.Size(); i++)
+					{
+						EXPECT_TRUE(Grid.HasLineOfSight(SmoothedPath[i - 1], SmoothedPath[i]));
+					}
+				}
+			}
+		}
+
+		EXPECT_GT(NumberOfFoundPaths, 500);
+	}
+
+	// Benchmark on 1024x1024 map with walls
+	{
+		const int32 GridSize = 1024;
+		const int32 NumberOfWalls = 6000;
+		const int32 NumberOfQueries = 20;
+
+		FNavigationGrid Grid;
+		Grid.Initialize(FVector2D<int32>(GridSize, GridSize), FVector2D<int32>(32, 32));
+
+		std::uniform_int_distribution<int> TileDistribution(0, GridSize - 1);
+		std::uniform_int_distribution<int> WallLengthDistribution(4, 48);
+
+		for (int32 WallIndex = 0; WallIndex < NumberOfWalls; WallIndex++)
+		{
+			const int32 WallX = TileDistribution(RandomGenerator);
+			const int32 WallY = TileDistribution(RandomGenerator);
+			const int32 WallLength = WallLengthDistribution(RandomGenerator);
+			const bool bIsHorizontal = (WallIndex % 2 == 0);
+
+			for (int32 i = 0; i < WallLength; i++)
+			{
+				Grid.SetWalkable(bIsHorizontal ? WallX + i : WallX, bIsHorizontal ? WallY : WallY + i, false);
+			}
+		}
+
+		CArray<FVector2D<int32>> StartTiles;
+		CArray<FVector2D<int32>> EndTiles;
+
+		while (StartTiles.Size() < NumberOfQueries)
+		{
+			const FVector2D<int32> StartTile(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+			const FVector2D<int32> EndTile(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+
+			if (Grid.IsWalkable(StartTile.X, StartTile.Y) && Grid.IsWalkable(EndTile.X, EndTile.Y))
+			{
+				StartTiles.Push(StartTile);
+				EndTiles.Push(EndTile);
+			}
+		}
+
+		FNavigationPathfinder Pathfinder;
+		CArray<FVector2D<int32>> PathTiles;
+
+		const ENavigationAlgorithm Algorithms[] = { ENavigationAlgorithm::AStar, ENavigationAlgorithm::JumpPoint };
+		const char* AlgorithmNames[] = { "A*", "Jump point" };
+		CArray<int32> PathCosts[2];
+
+		for (int32 AlgorithmIndex = 0; AlgorithmIndex < 2; AlgorithmIndex++)
+		{
+			int64 NumberOfExpandedTiles = 0;
+
+			auto start = std::chrono::high_resolution_clock::now();
+
+			for (int32 QueryIndex = 0; QueryIndex < NumberOfQueries; QueryIndex++)
+			{
+				const bool bIsPathFound = Pathfinder.FindPath(Grid, StartTiles[QueryIndex], EndTiles[QueryIndex], Algorithms[AlgorithmIndex], PathTiles);
+
+				PathCosts[AlgorithmIndex].Push(bIsPathFound ? Pathfinder.GetLastPathCost() : INDEX_NONE);
+				NumberOfExpandedTiles += Pathfinder.GetLastNumberOfExpandedTiles();
+			}
+
+			auto end = std::chrono::high_resolution_clock::now();
+			const int64 Microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+			std::cout << AlgorithmNames[AlgorithmIndex] << " on " << GridSize << "x" << GridSize << ": " << (NumberOfQueries * 1000000.0 / FMath::Max<int64>(Microseconds, 1)) << " paths/s, "
+				<< (NumberOfExpandedTiles / NumberOfQueries) << " expanded tiles per path" << std::endl;
+		}
+
+		for (int32 QueryIndex = 0; QueryIndex < NumberOfQueries; QueryIndex++)
+		{
+			EXPECT_EQ(PathCosts[0][QueryIndex], PathCosts[1][QueryIndex]);
+		}
+	}
+}
+
+TEST(NavigationTest, FlowFieldSameAsPathsAndRepairedIncrementally)
+{
+	const int32 GridSize = 512;
+	const int32 NumberOfWalls = 1500;
+	const int32 NumberOfUnits = 5000;
+
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_int_distribution<int> TileDistribution(0, GridSize - 1);
+	std::uniform_int_distribution<int> WallLengthDistribution(4, 48);
+
+	FNavigationGrid Grid;
+	Grid.Initialize(FVector2D<int32>(GridSize, GridSize), FVector2D<int32>(32, 32));
+
+	for (int32 WallIndex = 0; WallIndex < NumberOfWalls; WallIndex++)
+	{
+		const int32 WallX = TileDistribution(RandomGenerator);
+		const int32 WallY = TileDistribution(RandomGenerator);
+		const int32 WallLength = WallLengthDistribution(RandomGenerator);
+		const bool bIsHorizontal = (WallIndex % 2 == 0);
+
+		for (int32 i = 0; i < WallLength; i++)
+		{
+			Grid.SetWalkable(bIsHorizontal ? WallX + i : WallX, bIsHorizontal ? WallY : WallY + i, false);
+		}
+	}
+
+	auto GetRandomWalkableTile = [&]() -> FVector2D<int32>
+	{
+		FVector2D<int32> Tile;
+
+		do
+		{
+			Tile = FVector2D<int32>(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+		}
+		while (!Grid.IsWalkable(Tile.X, Tile.Y));
+
+		return Tile;
+	};
+
+	const FVector2D<int32> GoalTile = GetRandomWalkableTile();
+
+	CArray<FVector2D<int32>> UnitTiles;
+	for (int32 UnitIndex = 0; UnitIndex < NumberOfUnits; UnitIndex++)
+	{
+		UnitTiles.Push(GetRandomWalkableTile());
+	}
+
+	// All units ask for field, only first one builds it
+	FNavigationFlowFieldCache FlowFieldCache;
+	std::shared_ptr<FNavigationFlowField> FlowField;
+
+	auto start = std::chrono::high_resolution_clock::now();
+
+	for (int32 UnitIndex = 0; UnitIndex < NumberOfUnits; UnitIndex++)
+	{
+		FlowField = FlowFieldCache.GetFlowField(Grid, GoalTile);
+	}
+
+	auto end = std::chrono::high_resolution_clock::now();
+	const int64 FlowFieldMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+	EXPECT_EQ(FlowFieldCache.GetNumberOfBuilds(), 1);
+
+	// Each unit makes one step per tick, following field takes constant time
+	CArray<FVector2D<int32>> SteppedUnitTiles = UnitTiles;
+
+	start = std::chrono::high_resolution_clock::now();
+
+	for (FVector2D<int32>& UnitTile : SteppedUnitTiles)
+	{
+		UnitTile += FlowField->GetFlowDirection(UnitTile.X, UnitTile.Y);
+	}
+
+	end = std::chrono::high_resolution_clock::now();
+	const int64 SteeringMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+	// Same units with one search each
+	const int32 NumberOfSearchedUnits = 100;
+
+	FNavigationPathfinder Pathfinder;
+	CArray<FVector2D<int32>> PathTiles;
+
+	start = std::chrono::high_resolution_clock::now();
+
+	for (int32 UnitIndex = 0; UnitIndex < NumberOfSearchedUnits; UnitIndex++)
+	{
+		const bool bIsPathFound = Pathfinder.FindPath(Grid, UnitTiles[UnitIndex], GoalTile, ENavigationAlgorithm::JumpPoint, PathTiles);
+
+		ASSERT_EQ(bIsPathFound, FlowField->IsReachable(UnitTiles[UnitIndex].X, UnitTiles[UnitIndex].Y));
+		if (bIsPathFound)
+		{
+			EXPECT_EQ(Pathfinder.GetLastPathCost(), FlowField->GetIntegrationCost(UnitTiles[UnitIndex].X, UnitTiles[UnitIndex].Y));
+		}
+	}
+
+	end = std::chrono::high_resolution_clock::now();
+	const int64 SearchMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+	std::cout << NumberOfUnits << " units to one goal on " << GridSize << "x" << GridSize << ": flow field " << FlowFieldMicroseconds << "us, one step of all units " << SteeringMicroseconds << "us, "
+		<< "jump point search per unit " << (SearchMicroseconds / NumberOfSearchedUnits) << "us (" << (SearchMicroseconds * NumberOfUnits / NumberOfSearchedUnits) << "us for all units)" << std::endl;
+
+	// Following directions reaches goal with integration cost
+	auto ExpectFieldConsistent = [&Grid](const FNavigationFlowField& InFlowField)
+	{
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				const int32 Cost = InFlowField.GetIntegrationCost(X, Y);
+				const FVector2D<int32> Direction = InFlowField.GetFlowDirection(X, Y);
+
+				if (Cost == FNavigationFlowField::UnreachableCost || Cost == 0)
+				{
+					EXPECT_TRUE(Direction.X == 0 && Direction.Y == 0);
+				}
+				else
+				{
+					ASSERT_TRUE(Grid.CanMove(X, Y, Direction.X, Direction.Y));
+
+					const int32 MoveCost = (Direction.X != 0 && Direction.Y != 0) ? FNavigationPathfinder::DiagonalMoveCost : FNavigationPathfinder::StraightMoveCost;
+					ASSERT_EQ(Cost, InFlowField.GetIntegrationCost(X + Direction.X, Y + Direction.Y) + MoveCost);
+				}
+			}
+		}
+	};
+
+	ExpectFieldConsistent(*FlowField);
+
+	// Changed tiles repair only dependent part of field, result must be same as new field
+	FNavigationFlowField RebuiltFlowField;
+	int64 NumberOfRepairedTiles = 0;
+	const int32 NumberOfChanges = 200;
+
+	start = std::chrono::high_resolution_clock::now();
+
+	for (int32 ChangeIndex = 0; ChangeIndex < NumberOfChanges; ChangeIndex++)
+	{
+		// Tiles near goal change paths of many units
+		const FVector2D<int32> ChangedTile = (ChangeIndex % 4 == 0)
+			? FVector2D<int32>(FMath::Clamp(GoalTile.X + (ChangeIndex % 7) - 3, 0, GridSize - 1), FMath::Clamp(GoalTile.Y + (ChangeIndex % 5) - 2, 0, GridSize - 1))
+			: FVector2D<int32>(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+
+		Grid.SetWalkable(ChangedTile.X, ChangedTile.Y, !Grid.IsWalkable(ChangedTile.X, ChangedTile.Y));
+		FlowFieldCache.OnTileWalkabilityChanged(Grid, ChangedTile);
+
+		NumberOfRepairedTiles += FlowField->GetLastNumberOfUpdatedTiles();
+	}
+
+	end = std::chrono::high_resolution_clock::now();
+
+	std::cout << NumberOfChanges << " tile changes: " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << "us, "
+		<< (NumberOfRepairedTiles / NumberOfChanges) << " tiles repaired per change of " << FlowField->GetNumberOfTiles() << std::endl;
+
+	RebuiltFlowField.Build(Grid, GoalTile);
+
+	for (int32 Y = 0; Y < GridSize; Y++)
+	{
+		for (int32 X = 0; X < GridSize; X++)
+		{
+			ASSERT_EQ(FlowField->GetIntegrationCost(X, Y), RebuiltFlowField.GetIntegrationCost(X, Y));
+		}
+	}
+
+	ExpectFieldConsistent(*FlowField);
+
+	// Least recently used fields are evicted, field still held is taken back without building
+	FlowFieldCache.SetCapacity(2);
+
+	const FVector2D<int32> SecondGoalTile = GetRandomWalkableTile();
+	const FVector2D<int32> ThirdGoalTile = GetRandomWalkableTile();
+
+	FlowFieldCache.GetFlowField(Grid, SecondGoalTile);
+	FlowFieldCache.GetFlowField(Grid, ThirdGoalTile);
+
+	EXPECT_EQ(FlowFieldCache.GetNumberOfCachedFields(), 2);
+	EXPECT_EQ(FlowFieldCache.GetNumberOfBuilds(), 3);
+
+	EXPECT_EQ(FlowFieldCache.GetFlowField(Grid, GoalTile), FlowField);
+	EXPECT_EQ(FlowFieldCache.GetNumberOfBuilds(), 3);
+
+	FlowFieldCache.GetFlowField(Grid, SecondGoalTile);
+	EXPECT_EQ(FlowFieldCache.GetNumberOfBuilds(), 4);
+}
+
+TEST(NavigationTest, HierarchyComparedToAStarAndUpdatedIncrementally)
+{
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_int_distribution<int> WallLengthDistribution(4, 48);
+
+	auto AddRandomWalls = [&RandomGenerator, &WallLengthDistribution](FNavigationGrid& Grid, const int32 GridSize, const int32 NumberOfWalls)
+	{
+		std::uniform_int_distribution<int> TileDistribution(0, GridSize - 1);
+
+		for (int32 WallIndex = 0; WallIndex < NumberOfWalls; WallIndex++)
+		{
+			const int32 WallX = TileDistribution(RandomGenerator);
+			const int32 WallY = TileDistribution(RandomGenerator);
+			const int32 WallLength = WallLengthDistribution(RandomGenerator);
+			const bool bIsHorizontal = (WallIndex % 2 == 0);
+
+			for (int32 i = 0; i < WallLength; i++)
+			{
+				Grid.SetWalkable(bIsHorizontal ? WallX + i : WallX, bIsHorizontal ? WallY : WallY + i, false);
+			}
+		}
+	};
+
+	// @returns cost of path, checks that each part is straight or diagonal line of walkable tiles
+	auto GetValidatedPathCost = [](const FNavigationGrid& Grid, const CArray<FVector2D<int32>>& PathTiles) -> int32
+	{
+		int32 PathCost = 0;
+
+		for (int32 i = 1; i < PathTiles.Size(); i++)
+		{
+			EXPECT_TRUE(Grid.HasLineOfSight(PathTiles[i - 1], PathTiles[i]));
+
+			PathCost += FNavigationPathfinder::GetOctileDistance(PathTiles[i - 1], PathTiles[i]);
+		}
+
+		return PathCost;
+	};
+
+	// Long queries on 1024x1024 map, flat A* against hierarchy without and with cached portal paths
+	{
+		const int32 GridSize = 1024;
+		const int32 NumberOfQueries = 20;
+
+		FNavigationGrid Grid;
+		Grid.Initialize(FVector2D<int32>(GridSize, GridSize), FVector2D<int32>(32, 32));
+		AddRandomWalls(Grid, GridSize, 6000);
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		FNavigationHierarchy Hierarchy;
+		Hierarchy.Build(Grid);
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		std::cout << "Hierarchy build on " << GridSize << "x" << GridSize << ": " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms, "
+			<< Hierarchy.GetNumberOfNodes() << " portals, " << Hierarchy.GetNumberOfEdges() << " connections" << std::endl;
+
+		// Walls split map into separate areas, queries are made only inside area reachable from center
+		std::uniform_int_distribution<int> TileDistribution(0, GridSize - 1);
+
+		FVector2D<int32> CenterTile(GridSize / 2, GridSize / 2);
+		while (!Grid.IsWalkable(CenterTile.X, CenterTile.Y))
+		{
+			CenterTile = FVector2D<int32>(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+		}
+
+		FNavigationFlowField ReachableField;
+		ReachableField.Build(Grid, CenterTile);
+
+		// Second set of queries starts and ends in same clusters as first one, so it can use cached portal paths
+		std::uniform_int_distribution<int> ClusterOffsetDistribution(0, Hierarchy.GetClusterSize() - 1);
+
+		auto GetRandomTileInSameCluster = [&](const FVector2D<int32>& InTile)
+		{
+			const int32 ClusterSize = Hierarchy.GetClusterSize();
+
+			while (true)
+			{
+				const FVector2D<int32> Tile((InTile.X / ClusterSize) * ClusterSize + ClusterOffsetDistribution(RandomGenerator), (InTile.Y / ClusterSize) * ClusterSize + ClusterOffsetDistribution(RandomGenerator));
+				if (ReachableField.IsReachable(Tile.X, Tile.Y))
+				{
+					return Tile;
+				}
+			}
+		};
+
+		CArray<FVector2D<int32>> StartTiles;
+		CArray<FVector2D<int32>> EndTiles;
+
+		while (StartTiles.Size() < NumberOfQueries)
+		{
+			const FVector2D<int32> StartTile(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+			const FVector2D<int32> EndTile(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+
+			if (ReachableField.IsReachable(StartTile.X, StartTile.Y) && ReachableField.IsReachable(EndTile.X, EndTile.Y) && FNavigationPathfinder::GetOctileDistance(StartTile, EndTile) > GridSize * 5)
+			{
+				StartTiles.Push(StartTile);
+				EndTiles.Push(EndTile);
+			}
+		}
+
+		for (int32 QueryIndex = 0; QueryIndex < NumberOfQueries; QueryIndex++)
+		{
+			StartTiles.Push(GetRandomTileInSameCluster(StartTiles[QueryIndex]));
+			EndTiles.Push(GetRandomTileInSameCluster(EndTiles[QueryIndex]));
+		}
+
+		const int32 NumberOfAllQueries = StartTiles.Size();
+
+		FNavigationPathfinder Pathfinder;
+		CArray<FVector2D<int32>> PathTiles;
+		CArray<int32> AStarCosts;
+
+		start = std::chrono::high_resolution_clock::now();
+
+		for (int32 QueryIndex = 0; QueryIndex < NumberOfAllQueries; QueryIndex++)
+		{
+			const bool bIsPathFound = Pathfinder.FindPath(Grid, StartTiles[QueryIndex], EndTiles[QueryIndex], ENavigationAlgorithm::AStar, PathTiles);
+			AStarCosts.Push(bIsPathFound ? Pathfinder.GetLastPathCost() : INDEX_NONE);
+		}
+
+		end = std::chrono::high_resolution_clock::now();
+
+		std::cout << "A* on " << GridSize << "x" << GridSize << ": " << (NumberOfAllQueries * 1000000.0 / FMath::Max<int64>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(), 1)) << " paths/s" << std::endl;
+
+		for (int32 bUseCache = 0; bUseCache <= 1; bUseCache++)
+		{
+			Hierarchy.SetUseAbstractPathCache(bUseCache != 0);
+
+			const int32 CacheHitsBefore = Hierarchy.GetNumberOfCacheHits();
+			int64 SumOfCosts = 0;
+			int64 SumOfOptimalCosts = 0;
+
+			start = std::chrono::high_resolution_clock::now();
+
+			for (int32 QueryIndex = 0; QueryIndex < NumberOfAllQueries; QueryIndex++)
+			{
+				int32 PathCost;
+				const bool bIsPathFound = Hierarchy.FindPath(StartTiles[QueryIndex], EndTiles[QueryIndex], PathTiles, PathCost);
+
+				// Moves between clusters are straight, but diagonal corner crossing can always be replaced by two straight moves
+				ASSERT_TRUE(bIsPathFound);
+				ASSERT_TRUE(AStarCosts[QueryIndex] != INDEX_NONE);
+
+				if (bIsPathFound)
+				{
+					EXPECT_EQ(PathTiles[0], StartTiles[QueryIndex]);
+					EXPECT_EQ(PathTiles[PathTiles.Size() - 1], EndTiles[QueryIndex]);
+					EXPECT_EQ(GetValidatedPathCost(Grid, PathTiles), PathCost);
+					EXPECT_GE(PathCost, AStarCosts[QueryIndex]);
+
+					SumOfCosts += PathCost;
+					SumOfOptimalCosts += AStarCosts[QueryIndex];
+				}
+			}
+
+			end = std::chrono::high_resolution_clock::now();
+
+			const int32 CacheHits = Hierarchy.GetNumberOfCacheHits() - CacheHitsBefore;
+			if (bUseCache != 0)
+			{
+				EXPECT_GT(CacheHits, 0);
+			}
+
+			std::cout << "Hierarchy " << (bUseCache != 0 ? "with" : "without") << " cached portal paths: "
+				<< (NumberOfAllQueries * 1000000.0 / FMath::Max<int64>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(), 1)) << " paths/s, "
+				<< CacheHits << " cache hits, paths " << ((SumOfCosts - SumOfOptimalCosts) * 100.0 / FMath::Max<int64>(SumOfOptimalCosts, 1)) << "% longer than shortest" << std::endl;
+		}
+	}
+
+	// Tile changes rebuild only nearby clusters, result must be same as hierarchy built from scratch
+	{
+		const int32 GridSize = 256;
+		const int32 NumberOfChanges = 400;
+
+		FNavigationGrid Grid;
+		Grid.Initialize(FVector2D<int32>(GridSize, GridSize), FVector2D<int32>(32, 32));
+		AddRandomWalls(Grid, GridSize, 300);
+
+		FNavigationHierarchy Hierarchy;
+		Hierarchy.Build(Grid);
+		Hierarchy.SetUseAbstractPathCache(false);
+
+		std::uniform_int_distribution<int> TileDistribution(0, GridSize - 1);
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (int32 ChangeIndex = 0; ChangeIndex < NumberOfChanges; ChangeIndex++)
+		{
+			const FVector2D<int32> Tile(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+			const bool bIsWalkable = !Grid.IsWalkable(Tile.X, Tile.Y);
+
+			Grid.SetWalkable(Tile.X, Tile.Y, bIsWalkable);
+			Hierarchy.SetTileWalkable(Tile, bIsWalkable);
+		}
+
+		auto end = std::chrono::high_resolution_clock::now();
+
+		std::cout << "Hierarchy tile change: " << (std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / NumberOfChanges) << "us" << std::endl;
+
+		FNavigationHierarchy RebuiltHierarchy;
+		RebuiltHierarchy.Build(Grid);
+		RebuiltHierarchy.SetUseAbstractPathCache(false);
+
+		EXPECT_EQ(Hierarchy.GetNumberOfNodes(), RebuiltHierarchy.GetNumberOfNodes());
+		EXPECT_EQ(Hierarchy.GetNumberOfEdges(), RebuiltHierarchy.GetNumberOfEdges());
+
+		FNavigationPathfinder Pathfinder;
+		CArray<FVector2D<int32>> PathTiles;
+
+		for (int32 QueryIndex = 0; QueryIndex < 200; QueryIndex++)
+		{
+			const FVector2D<int32> StartTile(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+			const FVector2D<int32> EndTile(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator));
+
+			int32 PathCost = 0;
+			int32 RebuiltPathCost = 0;
+
+			const bool bIsPathFound = Hierarchy.FindPath(StartTile, EndTile, PathTiles, PathCost);
+			if (bIsPathFound)
+			{
+				EXPECT_EQ(GetValidatedPathCost(Grid, PathTiles), PathCost);
+			}
+
+			ASSERT_EQ(bIsPathFound, RebuiltHierarchy.FindPath(StartTile, EndTile, PathTiles, RebuiltPathCost));
+			ASSERT_EQ(bIsPathFound, Pathfinder.FindPath(Grid, StartTile, EndTile, ENavigationAlgorithm::JumpPoint, PathTiles));
+			EXPECT_EQ(PathCost, RebuiltPathCost);
+		}
+	}
+}
+
+TEST(NavigationTest, HierarchyQueriesOnManyThreadsAndSnapshot)
+{
+	const int32 GridSize = 512;
+	const int32 NumberOfQueries = 64;
+	const int32 NumberOfThreads = 4;
+
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_int_distribution<int> TileDistribution(0, GridSize - 1);
+
+	FNavigationGrid Grid;
+	Grid.Initialize(FVector2D<int32>(GridSize, GridSize), FVector2D<int32>(32, 32));
+
+	for (int32 WallIndex = 0; WallIndex < 1500; WallIndex++)
+	{
+		const int32 WallX = TileDistribution(RandomGenerator);
+		const int32 WallY = TileDistribution(RandomGenerator);
+
+		for (int32 i = 0; i < 24; i++)
+		{
+			Grid.SetWalkable((WallIndex % 2 == 0) ? WallX + i : WallX, (WallIndex % 2 == 0) ? WallY : WallY + i, false);
+		}
+	}
+
+	FNavigationHierarchy Hierarchy;
+	Hierarchy.Build(Grid);
+
+	CArray<FVector2D<int32>> StartTiles;
+	CArray<FVector2D<int32>> EndTiles;
+	CArray<int32> SerialCosts;
+	CArray<FVector2D<int32>> PathTiles;
+
+	for (int32 QueryIndex = 0; QueryIndex < NumberOfQueries; QueryIndex++)
+	{
+		StartTiles.Push(FVector2D<int32>(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator)));
+		EndTiles.Push(FVector2D<int32>(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator)));
+
+		int32 PathCost;
+		SerialCosts.Push(Hierarchy.FindPath(StartTiles[QueryIndex], EndTiles[QueryIndex], PathTiles, PathCost) ? PathCost : INDEX_NONE);
+	}
+
+	// Snapshot keeps graph when original is changed, as async queries of navigation manager
+	FNavigationHierarchy Snapshot(Hierarchy);
+
+	CArray<int32> ThreadCosts;
+	ThreadCosts.SetNum(NumberOfQueries * NumberOfThreads);
+
+	auto RunQueries = [&](FNavigationHierarchy* InHierarchy, const int32 ThreadIndex)
+	{
+		CArray<FVector2D<int32>> ThreadPathTiles;
+
+		for (int32 QueryIndex = 0; QueryIndex < NumberOfQueries; QueryIndex++)
+		{
+			int32 PathCost;
+			ThreadCosts[ThreadIndex * NumberOfQueries + QueryIndex] = InHierarchy->FindPath(StartTiles[QueryIndex], EndTiles[QueryIndex], ThreadPathTiles, PathCost) ? PathCost : INDEX_NONE;
+		}
+	};
+
+	auto start = std::chrono::high_resolution_clock::now();
+
+	std::vector<std::thread> Threads;
+	for (int32 ThreadIndex = 0; ThreadIndex < NumberOfThreads; ThreadIndex++)
+	{
+		Threads.emplace_back(RunQueries, &Snapshot, ThreadIndex);
+	}
+
+	// Changes of original do not wait for queries on snapshot
+	for (int32 ChangeIndex = 0; ChangeIndex < 200; ChangeIndex++)
+	{
+		Hierarchy.SetTileWalkable(FVector2D<int32>(TileDistribution(RandomGenerator), TileDistribution(RandomGenerator)), false);
+	}
+
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	auto end = std::chrono::high_resolution_clock::now();
+
+	for (int32 ThreadIndex = 0; ThreadIndex < NumberOfThreads; ThreadIndex++)
+	{
+		for (int32 QueryIndex = 0; QueryIndex < NumberOfQueries; QueryIndex++)
+		{
+			EXPECT_EQ(ThreadCosts[ThreadIndex * NumberOfQueries + QueryIndex], SerialCosts[QueryIndex]);
+		}
+	}
+
+	std::cout << NumberOfThreads << " threads, " << NumberOfQueries << " hierarchy queries each with 200 changes of original: "
+		<< std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << "us" << std::endl;
+}
+
+/** Texture asset prepared without engine, texture is packed into atlas only when it's given */
+class FMapChunkTestTextureAsset : public FTextureAsset
+{
+public:
+	FMapChunkTestTextureAsset(const std::string& InTexturePath, SDL_Renderer* InRenderer, const std::shared_ptr<FTextureAtlas>& InTextureAtlas = nullptr)
+		: FTextureAsset("MapChunkTestTexture", InTexturePath)
+	{
+		Texture = new FTexture(InTexturePath, InRenderer, InTextureAtlas);
+		bIsTexturePrepared = true;
+	}
+};
+
+TEST(MapChunkRendererTest, ChunksBakedOnceAndAgainAfterTileChange)
+{
+	const int32 NumberOfTextures = 2;
+	const int32 MapSizeInTiles = 64;
+	const int32 ChunkSizeInTiles = 4;
+	const int32 NumberOfFrames = 200;
+
+	// Window shows 2x2 chunks of 4x4 tiles (128x128 pixels each)
+	const FVector2D<int32> WindowSize(250, 250);
+	const int32 NumberOfVisibleChunks = 4;
+	const int32 NumberOfTilesInChunk = ChunkSizeInTiles * ChunkSizeInTiles;
+
+	SDL_Surface* ScreenSurface = SDL_CreateSurface(WindowSize.X, WindowSize.Y, SDL_PIXELFORMAT_RGBA32);
+	ASSERT_TRUE(ScreenSurface != nullptr);
+
+	SDL_Renderer* Renderer = SDL_CreateSoftwareRenderer(ScreenSurface);
+	ASSERT_TRUE(Renderer != nullptr);
+
+	FMapData MapData;
+
+	CArray<FMapChunkTestTextureAsset*> TextureAssets;
+	for (int32 i = 0; i < NumberOfTextures; i++)
+	{
+		// Tile textures are loaded from files like assets of map
+		const std::string TexturePath = (std::filesystem::temp_directory_path() / ("MapChunkRendererTest" + std::to_string(i) + ".bmp")).string();
+
+		SDL_Surface* TileSurface = SDL_CreateSurface(MapData.AssetsTileSize.X, MapData.AssetsTileSize.Y, SDL_PIXELFORMAT_RGBA32);
+		ASSERT_TRUE(TileSurface != nullptr);
+		ASSERT_TRUE(SDL_SaveBMP(TileSurface, TexturePath.c_str()));
+		SDL_DestroySurface(TileSurface);
+
+		FMapChunkTestTextureAsset* TextureAsset = new FMapChunkTestTextureAsset(TexturePath, Renderer);
+		ASSERT_TRUE(TextureAsset->GetTexture()->GetSDLTexture() != nullptr);
+		TextureAssets.Push(TextureAsset);
+
+		FMapSubAssetSettings AssetSettings;
+		AssetSettings.AssetIndex = i;
+		AssetSettings.Collision = 0;
+		AssetSettings.SetTextureAsset(TextureAsset);
+		MapData.MapSubAssetSettingsArray.Push(AssetSettings);
+	}
+
+	for (int32 Y = 0; Y < MapSizeInTiles; Y++)
+	{
+		FMapRow MapRow;
+		for (int32 X = 0; X < MapSizeInTiles; X++)
+		{
+			MapRow.Array.Push((X + Y) % NumberOfTextures);
+		}
+
+		MapData.MapArray.Push(MapRow);
+	}
+
+	FMapChunkRenderer ChunkRenderer;
+	ChunkRenderer.Initialize(Renderer, MapData, ChunkSizeInTiles);
+
+	ASSERT_TRUE(ChunkRenderer.IsInitializedFor(MapData));
+	EXPECT_EQ(ChunkRenderer.GetNumberOfChunks(), (MapSizeInTiles / ChunkSizeInTiles) * (MapSizeInTiles / ChunkSizeInTiles));
+
+	const FVector2D<int32> MapRenderOffset(0, 0);
+
+	// First frame bakes visible chunks only, one draw per tile and one per chunk
+	ChunkRenderer.Render(MapData, MapRenderOffset, WindowSize);
+	EXPECT_EQ(ChunkRenderer.GetLastNumberOfBakedChunks(), NumberOfVisibleChunks);
+	EXPECT_EQ(ChunkRenderer.GetLastNumberOfDrawCalls(), (NumberOfVisibleChunks * NumberOfTilesInChunk) + NumberOfVisibleChunks);
+
+	// Following frames draw baked chunks
+	int64 CachedDuration = 0;
+	for (int32 Frame = 0; Frame < NumberOfFrames; Frame++)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		ChunkRenderer.Render(MapData, MapRenderOffset, WindowSize);
+		SDL_FlushRenderer(Renderer);
+		auto end = std::chrono::high_resolution_clock::now();
+		CachedDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+		EXPECT_EQ(ChunkRenderer.GetLastNumberOfBakedChunks(), 0);
+		EXPECT_EQ(ChunkRenderer.GetLastNumberOfDrawCalls(), NumberOfVisibleChunks);
+	}
+
+	// Changed tile bakes only its chunk again
+	MapData.MapArray[5].Array[6] = (MapData.MapArray[5].Array[6] + 1) % NumberOfTextures;
+	ChunkRenderer.MarkTileDirty(FVector2D<int32>(6, 5));
+
+	ChunkRenderer.Render(MapData, MapRenderOffset, WindowSize);
+	EXPECT_EQ(ChunkRenderer.GetLastNumberOfBakedChunks(), 1);
+	EXPECT_EQ(ChunkRenderer.GetLastNumberOfDrawCalls(), NumberOfTilesInChunk + NumberOfVisibleChunks);
+
+	ChunkRenderer.Render(MapData, MapRenderOffset, WindowSize);
+	EXPECT_EQ(ChunkRenderer.GetLastNumberOfBakedChunks(), 0);
+
+	// Dirty chunk outside of window waits until it's visible
+	ChunkRenderer.MarkTileDirty(FVector2D<int32>(40, 40));
+
+	ChunkRenderer.Render(MapData, MapRenderOffset, WindowSize);
+	EXPECT_EQ(ChunkRenderer.GetLastNumberOfBakedChunks(), 0);
+
+	const FVector2D<int32> MovedMapRenderOffset(-(10 * ChunkSizeInTiles * MapData.AssetsTileSize.X), -(10 * ChunkSizeInTiles * MapData.AssetsTileSize.Y));
+	ChunkRenderer.Render(MapData, MovedMapRenderOffset, WindowSize);
+	EXPECT_EQ(ChunkRenderer.GetLastNumberOfBakedChunks(), NumberOfVisibleChunks);
+
+	// Lost render targets, all visible chunks are baked again
+	ChunkRenderer.MarkAllChunksDirty();
+
+	ChunkRenderer.Render(MapData, MapRenderOffset, WindowSize);
+	EXPECT_EQ(ChunkRenderer.GetLastNumberOfBakedChunks(), NumberOfVisibleChunks);
+
+	// Chunks baked in every frame for comparison
+	int64 BakedDuration = 0;
+	for (int32 Frame = 0; Frame < NumberOfFrames; Frame++)
+	{
+		ChunkRenderer.MarkAllChunksDirty();
+
+		auto start = std::chrono::high_resolution_clock::now();
+		ChunkRenderer.Render(MapData, MapRenderOffset, WindowSize);
+		SDL_FlushRenderer(Renderer);
+		auto end = std::chrono::high_resolution_clock::now();
+		BakedDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+	}
+
+	std::cout << NumberOfVisibleChunks << " visible chunks of " << NumberOfTilesInChunk << " tiles, " << NumberOfFrames << " frames: baked every frame " << BakedDuration
+		<< "us, drawn from chunk textures " << CachedDuration << "us" << std::endl;
+
+	ChunkRenderer.Clear();
+
+	for (FMapChunkTestTextureAsset* TextureAsset : TextureAssets)
+	{
+		delete TextureAsset;
+	}
+
+	SDL_DestroyRenderer(Renderer);
+	SDL_DestroySurface(ScreenSurface);
+}
+
+TEST(SpriteBatchTest, TwentyThousandRotatedSprites)
+{
+	const int32 NumberOfSprites = 20000;
+	const int32 NumberOfTextures = 4;
+	const int32 NumberOfLayers = 2;
+	const int32 NumberOfFrames = 60;
+
+	// Textures are never used by batch, only compared
+	SDL_Texture* Textures[NumberOfTextures];
+	for (int32 i = 0; i < NumberOfTextures; i++)
+	{
+		Textures[i] = reinterpret_cast<SDL_Texture*>(static_cast<uintptr_t>(0x1000 * (i + 1)));
+	}
+
+	FSpriteBatch SpriteBatch;
+
+	int64 AddDuration = 0;
+	int64 BuildDuration = 0;
+
+	for (int32 Frame = 0; Frame < NumberOfFrames; Frame++)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int32 i = 0; i < NumberOfSprites; i++)
+		{
+			// Textures and layers interleaved, as entities would draw them
+			FSpriteDrawRequest Sprite;
+			Sprite.Texture = Textures[i % NumberOfTextures];
+			Sprite.Layer = (i / 3) % NumberOfLayers;
+			Sprite.Destination = { static_cast<float>(i % 200) * 8.f, static_cast<float>(i / 200) * 8.f, 16.f, 16.f };
+			Sprite.Rotation = static_cast<double>((i + Frame) % 360);
+			Sprite.CenterOfRotation = FVector2D<float>(8.f, 8.f);
+
+			SpriteBatch.AddSprite(Sprite);
+		}
+		auto end = std::chrono::high_resolution_clock::now();
+		AddDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+		start = std::chrono::high_resolution_clock::now();
+		SpriteBatch.BuildGeometries();
+		end = std::chrono::high_resolution_clock::now();
+		BuildDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+	}
+
+	EXPECT_EQ(SpriteBatch.GetNumberOfQueuedSprites(), 0);
+
+	// One geometry per texture in each layer, lower layers first
+	ASSERT_EQ(SpriteBatch.GetNumberOfGeometries(), NumberOfTextures * NumberOfLayers);
+
+	int32 NumberOfVertices = 0;
+	for (int32 i = 0; i < SpriteBatch.GetNumberOfGeometries(); i++)
+	{
+		const FSpriteBatchGeometry& Geometry = SpriteBatch.GetGeometry(i);
+
+		EXPECT_EQ(Geometry.Layer, i / NumberOfTextures);
+		EXPECT_EQ(Geometry.Indices.size(), (Geometry.Vertices.size() / 4) * 6);
+
+		NumberOfVertices += static_cast<int32>(Geometry.Vertices.size());
+	}
+
+	EXPECT_EQ(NumberOfVertices, NumberOfSprites * 4);
+
+	// Sprites keep order inside geometry, first sprite of layer 0 with first texture is sprite 0
+	const FSpriteBatchGeometry& FirstGeometry = SpriteBatch.GetGeometry(0);
+	EXPECT_EQ(FirstGeometry.Texture, Textures[0]);
+	const float HalfDiagonal = FMath::Sqrt(128.f);
+	const float CenterX = (FirstGeometry.Vertices[0].position.x + FirstGeometry.Vertices[2].position.x) * 0.5f;
+	const float CenterY = (FirstGeometry.Vertices[0].position.y + FirstGeometry.Vertices[2].position.y) * 0.5f;
+	EXPECT_NEAR(CenterX, 8.f, 0.01f);
+	EXPECT_NEAR(CenterY, 8.f, 0.01f);
+	EXPECT_NEAR(FMath::Sqrt((FirstGeometry.Vertices[0].position.x - CenterX) * (FirstGeometry.Vertices[0].position.x - CenterX)
+		+ (FirstGeometry.Vertices[0].position.y - CenterY) * (FirstGeometry.Vertices[0].position.y - CenterY)), HalfDiagonal, 0.01f);
+
+	// Rotation clockwise around pivot and flip swap texture coordinates
+	FSpriteDrawRequest Sprite;
+	Sprite.Destination = { 10.f, 20.f, 40.f, 20.f };
+	Sprite.CenterOfRotation = FVector2D<float>(20.f, 10.f);
+	Sprite.Rotation = 90.0;
+	Sprite.Flip = SDL_FLIP_HORIZONTAL;
+
+	SDL_Vertex Vertices[4];
+	FSpriteBatch::BuildSpriteVertices(Sprite, Vertices);
+
+	EXPECT_NEAR(Vertices[0].position.x, 40.f, 0.01f);
+	EXPECT_NEAR(Vertices[0].position.y, 10.f, 0.01f);
+	EXPECT_NEAR(Vertices[2].position.x, 20.f, 0.01f);
+	EXPECT_NEAR(Vertices[2].position.y, 50.f, 0.01f);
+	EXPECT_EQ(Vertices[0].tex_coord.x, 1.f);
+	EXPECT_EQ(Vertices[1].tex_coord.x, 0.f);
+	EXPECT_EQ(Vertices[0].tex_coord.y, 0.f);
+
+	const int64 AverageFrameDuration = (AddDuration + BuildDuration) / NumberOfFrames;
+
+	std::cout << NumberOfSprites << " rotated sprites, " << SpriteBatch.GetNumberOfGeometries() << " geometries, " << NumberOfFrames << " frames: queue " << AddDuration << "us, build " << BuildDuration << "us, average frame " << AverageFrameDuration << "us" << std::endl;
+}
+
+TEST(SpriteBatchTest, TexturesOfLayerKeepSubmissionOrder)
+{
+	// Texture with higher address is added first, order must not follow addresses
+	SDL_Texture* FirstTexture = reinterpret_cast<SDL_Texture*>(static_cast<uintptr_t>(0x2000));
+	SDL_Texture* SecondTexture = reinterpret_cast<SDL_Texture*>(static_cast<uintptr_t>(0x1000));
+	SDL_Texture* LayerTexture = reinterpret_cast<SDL_Texture*>(static_cast<uintptr_t>(0x3000));
+
+	FSpriteBatch SpriteBatch;
+
+	auto AddSprite = [&SpriteBatch](SDL_Texture* InTexture, const int32 InLayer, const float InX)
+	{
+		FSpriteDrawRequest Sprite;
+		Sprite.Texture = InTexture;
+		Sprite.Layer = InLayer;
+		Sprite.Destination = { InX, 0.f, 16.f, 16.f };
+
+		SpriteBatch.AddSprite(Sprite);
+	};
+
+	for (int32 Frame = 0; Frame < 2; Frame++)
+	{
+		AddSprite(LayerTexture, 1, 0.f);
+		AddSprite(FirstTexture, 0, 10.f);
+		AddSprite(SecondTexture, 0, 20.f);
+		AddSprite(FirstTexture, 0, 30.f);
+
+		SpriteBatch.BuildGeometries();
+
+		ASSERT_EQ(SpriteBatch.GetNumberOfGeometries(), 3);
+
+		const FSpriteBatchGeometry& FirstGeometry = SpriteBatch.GetGeometry(0);
+		EXPECT_EQ(FirstGeometry.Layer, 0);
+		EXPECT_EQ(FirstGeometry.Texture, FirstTexture);
+		ASSERT_EQ(FirstGeometry.Vertices.size(), 8u);
+		EXPECT_EQ(FirstGeometry.Vertices[0].position.x, 10.f);
+		EXPECT_EQ(FirstGeometry.Vertices[4].position.x, 30.f);
+
+		const FSpriteBatchGeometry& SecondGeometry = SpriteBatch.GetGeometry(1);
+		EXPECT_EQ(SecondGeometry.Layer, 0);
+		EXPECT_EQ(SecondGeometry.Texture, SecondTexture);
+
+		// Higher layer is drawn last even when added first
+		const FSpriteBatchGeometry& LayerGeometry = SpriteBatch.GetGeometry(2);
+		EXPECT_EQ(LayerGeometry.Layer, 1);
+		EXPECT_EQ(LayerGeometry.Texture, LayerTexture);
+	}
+
+	// Textures added in other order, geometries follow it
+	AddSprite(SecondTexture, 0, 20.f);
+	AddSprite(FirstTexture, 0, 10.f);
+
+	SpriteBatch.BuildGeometries();
+
+	ASSERT_EQ(SpriteBatch.GetNumberOfGeometries(), 2);
+	EXPECT_EQ(SpriteBatch.GetGeometry(0).Texture, SecondTexture);
+	EXPECT_EQ(SpriteBatch.GetGeometry(1).Texture, FirstTexture);
+}
+
+TEST(TextureAtlasPackerTest, PagesWithoutOverlapsAndOccupancy)
+{
+	const int32 NumberOfRectangles = 4000;
+	const FVector2D<int32> PageSize(1024, 1024);
+
+	struct FPackedRectangle
+	{
+		int32 PageIndex;
+		FVector2D<int32> Location;
+		FVector2D<int32> Size;
+	};
+
+	// Mostly tiles and small sprites, some bigger images
+	std::mt19937 Generator(42);
+	std::uniform_int_distribution<int32> SizeDistribution(8, 96);
+	std::uniform_int_distribution<int32> KindDistribution(0, 9);
+
+	CArray<FVector2D<int32>> Sizes;
+	for (int32 i = 0; i < NumberOfRectangles; i++)
+	{
+		const int32 Kind = KindDistribution(Generator);
+		if (Kind < 5)
+		{
+			Sizes.Push(FVector2D<int32>(34, 34));
+		}
+		else if (Kind < 9)
+		{
+			Sizes.Push(FVector2D<int32>(SizeDistribution(Generator), SizeDistribution(Generator)));
+		}
+		else
+		{
+			Sizes.Push(FVector2D<int32>(SizeDistribution(Generator) * 2, SizeDistribution(Generator) * 2));
+		}
+	}
+
+	CArray<FTextureAtlasPacker> Pages;
+	CArray<FPackedRectangle> PackedRectangles;
+
+	auto start = std::chrono::high_resolution_clock::now();
+	for (const FVector2D<int32>& Size : Sizes)
+	{
+		FVector2D<int32> Location;
+		int32 PageIndex = INDEX_NONE;
+
+		for (int32 i = 0; i < Pages.Size(); i++)
+		{
+			if (Pages[i].Insert(Size, Location))
+			{
+				PageIndex = i;
+
+				break;
+			}
+		}
+
+		if (PageIndex == INDEX_NONE)
+		{
+			Pages.Push(FTextureAtlasPacker(PageSize));
+			PageIndex = Pages.GetLastIndex();
+
+			ASSERT_TRUE(Pages[PageIndex].Insert(Size, Location));
+		}
+
+		PackedRectangles.Push({ PageIndex, Location, Size });
+	}
+	auto end = std::chrono::high_resolution_clock::now();
+	const int64 PackDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+	// Inside page and not overlapping others on same page
+	int32 NumberOfOverlaps = 0;
+	for (int32 i = 0; i < PackedRectangles.Size(); i++)
+	{
+		const FPackedRectangle& A = PackedRectangles[i];
+
+		EXPECT_TRUE(A.Location.X >= 0 && A.Location.Y >= 0);
+		EXPECT_TRUE(A.Location.X + A.Size.X <= PageSize.X && A.Location.Y + A.Size.Y <= PageSize.Y);
+
+		for (int32 j = i + 1; j < PackedRectangles.Size(); j++)
+		{
+			const FPackedRectangle& B = PackedRectangles[j];
+
+			if (A.PageIndex == B.PageIndex
+				&& A.Location.X < B.Location.X + B.Size.X && B.Location.X < A.Location.X + A.Size.X
+				&& A.Location.Y < B.Location.Y + B.Size.Y && B.Location.Y < A.Location.Y + A.Size.Y)
+			{
+				NumberOfOverlaps++;
+			}
+		}
+	}
+
+	EXPECT_EQ(NumberOfOverlaps, 0);
+
+	// Every page except last one is full
+	float MinOccupancy = 1.f;
+	for (int32 i = 0; i < Pages.GetLastIndex(); i++)
+	{
+		MinOccupancy = FMath::Min(MinOccupancy, Pages[i].GetOccupancy());
+	}
+
+	// Page can be filled again after reset
+	FTextureAtlasPacker& FirstPage = Pages[0];
+	FirstPage.Reset();
+	FVector2D<int32> Location;
+	EXPECT_TRUE(FirstPage.Insert(PageSize, Location));
+	EXPECT_EQ(Location, FVector2D<int32>(0, 0));
+	EXPECT_FALSE(FirstPage.Insert(FVector2D<int32>(1, 1), Location));
+
+	std::cout << NumberOfRectangles << " rectangles packed into " << Pages.Size() << " pages of " << PageSize.X << "x" << PageSize.Y << " in " << PackDuration << "us, lowest occupancy of full page " << MinOccupancy << std::endl;
+
+	EXPECT_GT(MinOccupancy, 0.8f);
+}
+
+TEST(TextureAtlasTest, MapTilesSwitchTextureOncePerPage)
+{
+	const int32 NumberOfTextures = 12;
+	const int32 MapSizeInTiles = 16;
+
+	// Window shows single chunk with all tiles of map
+	const FVector2D<int32> WindowSize(500, 500);
+	const int32 NumberOfTiles = MapSizeInTiles * MapSizeInTiles;
+
+	SDL_Surface* ScreenSurface = SDL_CreateSurface(WindowSize.X, WindowSize.Y, SDL_PIXELFORMAT_RGBA32);
+	ASSERT_TRUE(ScreenSurface != nullptr);
+
+	SDL_Renderer* Renderer = SDL_CreateSoftwareRenderer(ScreenSurface);
+	ASSERT_TRUE(Renderer != nullptr);
+
+	std::shared_ptr<FTextureAtlas> TextureAtlas = std::make_shared<FTextureAtlas>(Renderer);
+
+	FMapData OwnTexturesMapData;
+	FMapData AtlasMapData;
+
+	CArray<FMapChunkTestTextureAsset*> TextureAssets;
+	for (int32 i = 0; i < NumberOfTextures; i++)
+	{
+		const std::string TexturePath = (std::filesystem::temp_directory_path() / ("TextureAtlasTest" + std::to_string(i) + ".bmp")).string();
+
+		SDL_Surface* TileSurface = SDL_CreateSurface(AtlasMapData.AssetsTileSize.X, AtlasMapData.AssetsTileSize.Y, SDL_PIXELFORMAT_RGBA32);
+		ASSERT_TRUE(TileSurface != nullptr);
+		ASSERT_TRUE(SDL_SaveBMP(TileSurface, TexturePath.c_str()));
+		SDL_DestroySurface(TileSurface);
+
+		FMapChunkTestTextureAsset* OwnTextureAsset = new FMapChunkTestTextureAsset(TexturePath, Renderer);
+		FMapChunkTestTextureAsset* AtlasTextureAsset = new FMapChunkTestTextureAsset(TexturePath, Renderer, TextureAtlas);
+		ASSERT_FALSE(OwnTextureAsset->GetTexture()->IsInAtlas());
+		ASSERT_TRUE(AtlasTextureAsset->GetTexture()->IsInAtlas());
+
+		TextureAssets.Push(OwnTextureAsset);
+		TextureAssets.Push(AtlasTextureAsset);
+
+		FMapSubAssetSettings AssetSettings;
+		AssetSettings.AssetIndex = i;
+		AssetSettings.Collision = 0;
+
+		AssetSettings.SetTextureAsset(OwnTextureAsset);
+		OwnTexturesMapData.MapSubAssetSettingsArray.Push(AssetSettings);
+
+		AssetSettings.SetTextureAsset(AtlasTextureAsset);
+		AtlasMapData.MapSubAssetSettingsArray.Push(AssetSettings);
+	}
+
+	// Following tiles never share texture
+	for (int32 Y = 0; Y < MapSizeInTiles; Y++)
+	{
+		FMapRow MapRow;
+		for (int32 X = 0; X < MapSizeInTiles; X++)
+		{
+			MapRow.Array.Push((X + (Y * 5)) % NumberOfTextures);
+		}
+
+		OwnTexturesMapData.MapArray.Push(MapRow);
+		AtlasMapData.MapArray.Push(MapRow);
+	}
+
+	FMapChunkRenderer OwnTexturesChunkRenderer;
+	OwnTexturesChunkRenderer.Initialize(Renderer, OwnTexturesMapData, MapSizeInTiles);
+
+	FMapChunkRenderer AtlasChunkRenderer;
+	AtlasChunkRenderer.Initialize(Renderer, AtlasMapData, MapSizeInTiles);
+
+	OwnTexturesChunkRenderer.Render(OwnTexturesMapData, FVector2D<int32>(0, 0), WindowSize);
+	AtlasChunkRenderer.Render(AtlasMapData, FVector2D<int32>(0, 0), WindowSize);
+
+	ASSERT_EQ(OwnTexturesChunkRenderer.GetLastNumberOfBakedChunks(), 1);
+	ASSERT_EQ(AtlasChunkRenderer.GetLastNumberOfBakedChunks(), 1);
+
+	// Small tiles fit on single page, so texture is set once instead of for every tile
+	const int32 OwnTexturesSwitches = OwnTexturesChunkRenderer.GetLastNumberOfTextureSwitches();
+	const int32 AtlasSwitches = AtlasChunkRenderer.GetLastNumberOfTextureSwitches();
+
+	std::cout << NumberOfTiles << " tiles of " << NumberOfTextures << " textures: " << OwnTexturesSwitches << " texture switches with own textures, "
+		<< AtlasSwitches << " with atlas of " << TextureAtlas->GetNumberOfPages() << " pages" << std::endl;
+
+	EXPECT_EQ(OwnTexturesSwitches, NumberOfTiles);
+	EXPECT_EQ(TextureAtlas->GetNumberOfPages(), 1);
+	EXPECT_EQ(AtlasSwitches, TextureAtlas->GetNumberOfPages());
+
+	OwnTexturesChunkRenderer.Clear();
+	AtlasChunkRenderer.Clear();
+
+	for (FMapChunkTestTextureAsset* TextureAsset : TextureAssets)
+	{
+		delete TextureAsset;
+	}
+
+	TextureAtlas.reset();
+
+	SDL_DestroyRenderer(Renderer);
+	SDL_DestroySurface(ScreenSurface);
+}
+
+TEST(GlyphCacheTest, CounterTextRasterizesGlyphsOnce)
+{
+	const int32 NumberOfFrames = 1000;
+	const std::string CounterPrefix = "Score: ";
+
+	SDL_Surface* ScreenSurface = SDL_CreateSurface(256, 64, SDL_PIXELFORMAT_RGBA32);
+	ASSERT_TRUE(ScreenSurface != nullptr);
+
+	SDL_Renderer* Renderer = SDL_CreateSoftwareRenderer(ScreenSurface);
+	ASSERT_TRUE(Renderer != nullptr);
+
+	ASSERT_TRUE(TTF_Init());
+
+	const std::string FontPath = (std::filesystem::path(__FILE__).parent_path() / ".." / "Assets" / "Fonts" / "OpenSans" / "OpenSans-Regular.ttf").string();
+	TTF_Font* Font = TTF_OpenFont(FontPath.c_str(), 16);
+	ASSERT_TRUE(Font != nullptr);
+
+	FGlyphCache GlyphCache(Font, Renderer);
+	EXPECT_GT(GlyphCache.GetLineHeight(), 0);
+
+	CArray<FSpriteBatchGeometry> Geometries;
+	FVector2D<int32> TextSize;
+
+	// Every glyph of counter is seen after first 10 values
+	int32 NumberOfGlyphsAfterAllDigits = 0;
+
+	auto start = std::chrono::high_resolution_clock::now();
+	for (int32 Frame = 0; Frame < NumberOfFrames; Frame++)
+	{
+		const std::string CounterText = CounterPrefix + std::to_string(Frame);
+
+		ASSERT_TRUE(GlyphCache.BuildTextGeometry(CounterText, FColorRGBA::ColorWhite(), Geometries, TextSize));
+
+		if (Frame == 9)
+		{
+			NumberOfGlyphsAfterAllDigits = GlyphCache.GetNumberOfRasterizedGlyphs();
+		}
+		else if (Frame > 9)
+		{
+			EXPECT_EQ(GlyphCache.GetNumberOfRasterizedGlyphs(), NumberOfGlyphsAfterAllDigits);
+		}
+	}
+	auto end = std::chrono::high_resolution_clock::now();
+	const int64 GlyphsDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+	// Each distinct character is rasterized at most once
+	std::string DistinctCharacters = CounterPrefix + "0123456789";
+	std::sort(DistinctCharacters.begin(), DistinctCharacters.end());
+	DistinctCharacters.erase(std::unique(DistinctCharacters.begin(), DistinctCharacters.end()), DistinctCharacters.end());
+	const int32 NumberOfDistinctCharacters = static_cast<int32>(DistinctCharacters.size());
+
+	EXPECT_GT(NumberOfGlyphsAfterAllDigits, 0);
+	EXPECT_LE(NumberOfGlyphsAfterAllDigits, NumberOfDistinctCharacters);
+	EXPECT_EQ(GlyphCache.GetNumberOfRasterizedGlyphs(), NumberOfGlyphsAfterAllDigits);
+
+	// All glyphs fit on single page, so counter is drawn with one geometry
+	ASSERT_EQ(Geometries.Size(), 1);
+	EXPECT_EQ(Geometries[0].Indices.size(), (Geometries[0].Vertices.size() / 4) * 6);
+	EXPECT_GT(TextSize.X, 0);
+	EXPECT_EQ(TextSize.Y, GlyphCache.GetLineHeight());
+
+	// Whole text rendered again for every value, as without cache
+	start = std::chrono::high_resolution_clock::now();
+	for (int32 Frame = 0; Frame < NumberOfFrames; Frame++)
+	{
+		const std::string CounterText = CounterPrefix + std::to_string(Frame);
+
+		SDL_Surface* TextSurface = TTF_RenderText_Blended(Font, CounterText.c_str(), 0, FColorRGBA::ColorWhite());
+		SDL_Texture* TextTexture = SDL_CreateTextureFromSurface(Renderer, TextSurface);
+
+		SDL_DestroyTexture(TextTexture);
+		SDL_DestroySurface(TextSurface);
+	}
+	end = std::chrono::high_resolution_clock::now();
+	const int64 TextureDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+	std::cout << NumberOfFrames << " counter values: " << GlyphCache.GetNumberOfRasterizedGlyphs() << " glyphs rasterized, laid out in " << GlyphsDuration
+		<< "us, rendered to texture in " << TextureDuration << "us" << std::endl;
+
+	TTF_CloseFont(Font);
+
+	SDL_DestroyRenderer(Renderer);
+	SDL_DestroySurface(ScreenSurface);
+}
+
+TEST(WidgetRenderCacheTest, CachedOutputMatchesDirectDraw)
+{
+	const FVector2D<int32> ScreenSize(256, 192);
+	const FVector2D<int32> PanelLocation(24, 20);
+	const FVector2D<int32> PanelSize(192, 144);
+
+	// Software renderer draws into surface, no window is needed
+	SDL_Surface* ScreenSurface = SDL_CreateSurface(ScreenSize.X, ScreenSize.Y, SDL_PIXELFORMAT_RGBA32);
+	ASSERT_TRUE(ScreenSurface != nullptr);
+
+	SDL_Renderer* Renderer = SDL_CreateSoftwareRenderer(ScreenSurface);
+	ASSERT_TRUE(Renderer != nullptr);
+
+	SDL_SetRenderDrawBlendMode(Renderer, SDL_BLENDMODE_BLEND);
+
+	auto DrawBackground = [Renderer]()
+	{
+		SDL_SetRenderDrawColor(Renderer, 30, 60, 90, 255);
+		SDL_RenderClear(Renderer);
+	};
+
+	// Panel with opaque and semi-transparent children, drawn at absolute locations like widgets
+	auto DrawPanel = [Renderer, PanelLocation, PanelSize]()
+	{
+		const SDL_FRect PanelRect = { static_cast<float>(PanelLocation.X), static_cast<float>(PanelLocation.Y), static_cast<float>(PanelSize.X), static_cast<float>(PanelSize.Y) };
+		SDL_SetRenderDrawColor(Renderer, 20, 20, 20, 160);
+		SDL_RenderFillRect(Renderer, &PanelRect);
+
+		for (int32 Y = 0; Y < 8; Y++)
+		{
+			for (int32 X = 0; X < 12; X++)
+			{
+				const SDL_FRect ChildRect = { PanelRect.x + 4.f + (X * 15.f), PanelRect.y + 4.f + (Y * 17.f), 12.f, 14.f };
+				const Uint8 Alpha = ((X + Y) % 2 == 0) ? 255 : 128;
+
+				SDL_SetRenderDrawColor(Renderer, static_cast<Uint8>(X * 20), static_cast<Uint8>(Y * 30), 200, Alpha);
+				SDL_RenderFillRect(Renderer, &ChildRect);
+			}
+		}
+
+		SDL_SetRenderDrawColor(Renderer, 255, 255, 255, 255);
+		SDL_RenderRect(Renderer, &PanelRect);
+	};
+
+	auto ReadPixels = [Renderer]()
+	{
+		SDL_Surface* Pixels = SDL_RenderReadPixels(Renderer, nullptr);
+		SDL_Surface* ConvertedPixels = SDL_ConvertSurface(Pixels, SDL_PIXELFORMAT_RGBA32);
+		SDL_DestroySurface(Pixels);
+
+		return ConvertedPixels;
+	};
+
+	auto GetMaxDifference = [ScreenSize](SDL_Surface* A, SDL_Surface* B)
+	{
+		int32 MaxDifference = 0;
+
+		for (int32 Y = 0; Y < ScreenSize.Y; Y++)
+		{
+			const Uint8* RowA = static_cast<const Uint8*>(A->pixels) + (Y * A->pitch);
+			const Uint8* RowB = static_cast<const Uint8*>(B->pixels) + (Y * B->pitch);
+
+			for (int32 i = 0; i < ScreenSize.X * 4; i++)
+			{
+				MaxDifference = FMath::Max(MaxDifference, std::abs(static_cast<int32>(RowA[i]) - static_cast<int32>(RowB[i])));
+			}
+		}
+
+		return MaxDifference;
+	};
+
+	static constexpr int32 NumberOfFrames = 200;
+
+	DrawBackground();
+	DrawPanel();
+	SDL_Surface* DirectPixels = ReadPixels();
+
+	auto start = std::chrono::high_resolution_clock::now();
+	for (int32 i = 0; i < NumberOfFrames; i++)
+	{
+		DrawBackground();
+		DrawPanel();
+		SDL_FlushRenderer(Renderer);
+	}
+	auto end = std::chrono::high_resolution_clock::now();
+	const int64 DirectDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+	FWidgetRenderCache RenderCache;
+	EXPECT_TRUE(RenderCache.IsDirty());
+
+	DrawBackground();
+	ASSERT_TRUE(RenderCache.BeginRedraw(Renderer, PanelLocation, PanelSize));
+	DrawPanel();
+	RenderCache.EndRedraw();
+	RenderCache.Draw();
+	SDL_Surface* RedrawnPixels = ReadPixels();
+
+	EXPECT_FALSE(RenderCache.IsDirty());
+	EXPECT_TRUE(RenderCache.WasLastDrawRedrawn());
+
+	start = std::chrono::high_resolution_clock::now();
+	for (int32 i = 0; i < NumberOfFrames; i++)
+	{
+		DrawBackground();
+		RenderCache.Draw();
+		SDL_FlushRenderer(Renderer);
+	}
+	end = std::chrono::high_resolution_clock::now();
+	const int64 CachedDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+	SDL_Surface* CachedPixels = ReadPixels();
+
+	EXPECT_FALSE(RenderCache.WasLastDrawRedrawn());
+	EXPECT_EQ(RenderCache.GetNumberOfRedraws(), 1);
+	EXPECT_EQ(RenderCache.GetNumberOfHits(), NumberOfFrames);
+
+	// Premultiplied alpha is rounded twice for semi-transparent pixels, opaque ones are exact
+	const int32 RedrawnDifference = GetMaxDifference(DirectPixels, RedrawnPixels);
+	const int32 CachedDifference = GetMaxDifference(DirectPixels, CachedPixels);
+
+	std::cout << "Panel of 96 widgets drawn " << NumberOfFrames << " times directly in " << DirectDuration << "us, from cache in " << CachedDuration
+		<< "us, max channel difference " << CachedDifference << std::endl;
+
+	EXPECT_LE(RedrawnDifference, 2);
+	EXPECT_LE(CachedDifference, 2);
+
+	// Cache is drawn again after it's marked dirty
+	RenderCache.MarkDirty();
+	EXPECT_TRUE(RenderCache.IsDirty());
+
+	SDL_DestroySurface(DirectPixels);
+	SDL_DestroySurface(RedrawnPixels);
+	SDL_DestroySurface(CachedPixels);
+
+	RenderCache.Release();
+
+	SDL_DestroyRenderer(Renderer);
+	SDL_DestroySurface(ScreenSurface);
+}
+
+/** Root of widgets laid out without window */
+class FWidgetLayoutTestRoot : public IWidgetManagementInterface
+{
+public:
+	FVector2D<int32> GetWidgetManagerOffset() const override { return FVector2D<int32>(0, 0); }
+	FVector2D<int32> GetWidgetManagerSize() const override { return FVector2D<int32>(4096, 4096); }
+	IWidgetManagementInterface* GetParent() const override { return nullptr; }
+	int32 GetParentsNumber() const override { return 0; }
+	bool HasParent() const override { return false; }
+	FWindow* GetOwnerWindow() const override { return nullptr; }
+	void OnWindowChanged() override { }
+};
+
+class FWidgetLayoutTestLeaf : public FWidget
+{
+public:
+	FWidgetLayoutTestLeaf(IWidgetManagementInterface* InWidgetManagementInterface, const std::string& InWidgetName, const int32 InWidgetOrder)
+		: FWidget(InWidgetManagementInterface, InWidgetName, InWidgetOrder)
+	{
+	}
+};
+
+TEST(WidgetLayoutTest, SingleChangeLaysOutOnlyAffectedWidgets)
+{
+	static constexpr int32 NumberOfRows = 40;
+	static constexpr int32 NumberOfLeavesInRow = 20;
+	static constexpr int32 NumberOfWidgets = 1 + NumberOfRows + (NumberOfRows * NumberOfLeavesInRow);
+	static constexpr int32 NumberOfChanges = 2000;
+
+	const FVector2D<int32> LeafSize(20, 10);
+	const FVector2D<int32> ChangedLeafSize(30, 10);
+
+	struct FLayoutTree
+	{
+		FVerticalBoxWidget* VerticalBox = nullptr;
+		CArray<FHorizontalBoxWidget*> Rows;
+		CArray<FWidgetLayoutTestLeaf*> Leaves;
+	};
+
+	// Vertical box of rows, each row is horizontal box of leaves
+	auto CreateTree = [&](FWidgetLayoutTestRoot& Root, const int32 ChangedLeafIndex)
+	{
+		FLayoutTree Tree;
+		Tree.VerticalBox = Root.CreateWidget<FVerticalBoxWidget>();
+
+		for (int32 Row = 0; Row < NumberOfRows; Row++)
+		{
+			FHorizontalBoxWidget* HorizontalBox = Tree.VerticalBox->CreateWidget<FHorizontalBoxWidget>();
+			Tree.Rows.Push(HorizontalBox);
+
+			for (int32 i = 0; i < NumberOfLeavesInRow; i++)
+			{
+				FWidgetLayoutTestLeaf* Leaf = HorizontalBox->CreateWidget<FWidgetLayoutTestLeaf>();
+				Leaf->SetWidgetSize((Tree.Leaves.Size() == ChangedLeafIndex) ? ChangedLeafSize : LeafSize);
+				Tree.Leaves.Push(Leaf);
+			}
+		}
+
+		return Tree;
+	};
+
+	auto DestroyTree = [](FLayoutTree& Tree)
+	{
+		for (FWidgetLayoutTestLeaf* Leaf : Tree.Leaves)
+		{
+			Leaf->DestroyWidgetImmediate();
+		}
+
+		for (FHorizontalBoxWidget* HorizontalBox : Tree.Rows)
+		{
+			HorizontalBox->DestroyWidgetImmediate();
+		}
+
+		Tree.VerticalBox->DestroyWidgetImmediate();
+	};
+
+	// Leaf in the middle of tree
+	const int32 ChangedLeafIndex = ((NumberOfRows / 2) * NumberOfLeavesInRow) + (NumberOfLeavesInRow / 2);
+
+	FWidgetLayoutTestRoot Root;
+	FLayoutTree Tree = CreateTree(Root, INDEX_NONE);
+
+	FWidgetLayoutStats InitialStats;
+	Root.UpdateWidgetsLayout(InitialStats);
+
+	EXPECT_GE(InitialStats.NumberOfArrangedWidgets, NumberOfWidgets);
+	EXPECT_EQ(Tree.VerticalBox->GetWidgetSize(), FVector2D<int32>(LeafSize.X * NumberOfLeavesInRow, LeafSize.Y * NumberOfRows));
+
+	// Nothing changed, nothing is visited
+	FWidgetLayoutStats CleanStats;
+	Root.UpdateWidgetsLayout(CleanStats);
+
+	EXPECT_EQ(CleanStats.NumberOfLayoutPasses, 0);
+	EXPECT_EQ(CleanStats.NumberOfArrangedWidgets, 0);
+
+	// Leaf, its row and vertical box change size, row is also moved to center of wider box
+	Tree.Leaves[ChangedLeafIndex]->SetWidgetSize(ChangedLeafSize);
+
+	FWidgetLayoutStats ChangeStats;
+	Root.UpdateWidgetsLayout(ChangeStats);
+
+	std::cout << "Layout of " << NumberOfWidgets << " widgets: initial arranged " << InitialStats.NumberOfArrangedWidgets
+		<< ", after single change passes " << ChangeStats.NumberOfLayoutPasses << ", measured " << ChangeStats.NumberOfMeasuredWidgets
+		<< ", arranged " << ChangeStats.NumberOfArrangedWidgets << std::endl;
+
+	EXPECT_EQ(ChangeStats.NumberOfLayoutPasses, 1);
+	EXPECT_LE(ChangeStats.NumberOfMeasuredWidgets, 3);
+	EXPECT_LE(ChangeStats.NumberOfArrangedWidgets, 4);
+
+	// Incremental layout must match layout of tree created with changed leaf
+	FWidgetLayoutTestRoot ExpectedRoot;
+	FLayoutTree ExpectedTree = CreateTree(ExpectedRoot, ChangedLeafIndex);
+
+	FWidgetLayoutStats ExpectedStats;
+	ExpectedRoot.UpdateWidgetsLayout(ExpectedStats);
+
+	EXPECT_EQ(Tree.VerticalBox->GetWidgetSize(), ExpectedTree.VerticalBox->GetWidgetSize());
+	EXPECT_EQ(Tree.VerticalBox->GetWidgetSize().X, (LeafSize.X * NumberOfLeavesInRow) + (ChangedLeafSize.X - LeafSize.X));
+
+	for (ContainerInt i = 0; i < Tree.Rows.Size(); i++)
+	{
+		EXPECT_EQ(Tree.Rows[i]->GetWidgetLocation(), ExpectedTree.Rows[i]->GetWidgetLocation());
+		EXPECT_EQ(Tree.Rows[i]->GetWidgetSize(), ExpectedTree.Rows[i]->GetWidgetSize());
+	}
+
+	for (ContainerInt i = 0; i < Tree.Leaves.Size(); i++)
+	{
+		EXPECT_EQ(Tree.Leaves[i]->GetWidgetLocation(), ExpectedTree.Leaves[i]->GetWidgetLocation());
+		EXPECT_EQ(Tree.Leaves[i]->GetWidgetSize(), ExpectedTree.Leaves[i]->GetWidgetSize());
+	}
+
+	// Cost of single change compared to laying out whole tree like before
+	FWidgetLayoutStats IncrementalStats;
+
+	auto start = std::chrono::high_resolution_clock::now();
+	for (int32 i = 0; i < NumberOfChanges; i++)
+	{
+		Tree.Leaves[ChangedLeafIndex]->SetWidgetSize((i % 2 == 0) ? LeafSize : ChangedLeafSize);
+
+		Root.UpdateWidgetsLayout(IncrementalStats);
+	}
+	auto end = std::chrono::high_resolution_clock::now();
+	const int64 IncrementalDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+	FWidgetLayoutStats FullStats;
+
+	start = std::chrono::high_resolution_clock::now();
+	for (int32 i = 0; i < NumberOfChanges; i++)
+	{
+		Tree.Leaves[ChangedLeafIndex]->SetWidgetSize((i % 2 == 0) ? LeafSize : ChangedLeafSize);
+
+		Tree.VerticalBox->RequestWidgetRebuild();
+		for (FHorizontalBoxWidget* HorizontalBox : Tree.Rows)
+		{
+			HorizontalBox->RequestWidgetRebuild();
+		}
+		for (FWidgetLayoutTestLeaf* Leaf : Tree.Leaves)
+		{
+			Leaf->RequestWidgetRebuild();
+		}
+
+		Root.UpdateWidgetsLayout(FullStats);
+	}
+	end = std::chrono::high_resolution_clock::now();
+	const int64 FullDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+	std::cout << NumberOfChanges << " single changes laid out incrementally in " << IncrementalDuration << "us (" << IncrementalStats.NumberOfArrangedWidgets
+		<< " arranged), whole tree in " << FullDuration << "us (" << FullStats.NumberOfArrangedWidgets << " arranged)" << std::endl;
+
+	EXPECT_LT(IncrementalStats.NumberOfArrangedWidgets, FullStats.NumberOfArrangedWidgets / 10);
+
+	DestroyTree(Tree);
+	DestroyTree(ExpectedTree);
+}
+
+TEST(WidgetRenderCacheTest, ChangedChildDirtiesOnlyCachedAncestors)
+{
+	const FVector2D<int32> PanelSize(64, 48);
+
+	SDL_Surface* ScreenSurface = SDL_CreateSurface(256, 128, SDL_PIXELFORMAT_RGBA32);
+	ASSERT_TRUE(ScreenSurface != nullptr);
+
+	SDL_Renderer* Renderer = SDL_CreateSoftwareRenderer(ScreenSurface);
+	ASSERT_TRUE(Renderer != nullptr);
+
+	// Cached panel with cached inner panel and leaf, next to cached sibling panel with leaf
+	FWidgetLayoutTestRoot Root;
+	FWidgetLayoutTestLeaf* OuterPanel = Root.CreateWidget<FWidgetLayoutTestLeaf>();
+	FWidgetLayoutTestLeaf* InnerPanel = OuterPanel->CreateWidget<FWidgetLayoutTestLeaf>();
+	FWidgetLayoutTestLeaf* Leaf = InnerPanel->CreateWidget<FWidgetLayoutTestLeaf>();
+	FWidgetLayoutTestLeaf* SiblingPanel = Root.CreateWidget<FWidgetLayoutTestLeaf>();
+	FWidgetLayoutTestLeaf* SiblingLeaf = SiblingPanel->CreateWidget<FWidgetLayoutTestLeaf>();
+
+	OuterPanel->SetWidgetSize(PanelSize);
+	InnerPanel->SetWidgetSize(PanelSize);
+	Leaf->SetWidgetSize(FVector2D<int32>(16, 8));
+	SiblingPanel->SetWidgetLocation(FVector2D<int32>(128, 0));
+	SiblingPanel->SetWidgetSize(PanelSize);
+	SiblingLeaf->SetWidgetSize(FVector2D<int32>(16, 8));
+
+	OuterPanel->SetRenderCacheEnabled(true);
+	InnerPanel->SetRenderCacheEnabled(true);
+	SiblingPanel->SetRenderCacheEnabled(true);
+
+	FWidgetLayoutStats LayoutStats;
+	Root.UpdateWidgetsLayout(LayoutStats);
+
+	CArray<FWidgetLayoutTestLeaf*> CachedPanels;
+	CachedPanels.Push(OuterPanel);
+	CachedPanels.Push(InnerPanel);
+	CachedPanels.Push(SiblingPanel);
+
+	// Same as FWidget::RenderWithCache, subtree is drawn into cache only when it's dirty
+	auto RedrawDirtyCaches = [&CachedPanels, Renderer]()
+	{
+		for (FWidgetLayoutTestLeaf* Panel : CachedPanels)
+		{
+			FWidgetRenderCache* RenderCache = Panel->GetRenderCache();
+			if (RenderCache->IsDirty())
+			{
+				ASSERT_TRUE(RenderCache->BeginRedraw(Renderer, Panel->GetWidgetLocation(), Panel->GetWidgetSize()));
+				RenderCache->EndRedraw();
+			}
+
+			RenderCache->Draw();
+		}
+	};
+
+	// Caches start dirty and are clean after first frame
+	for (FWidgetLayoutTestLeaf* Panel : CachedPanels)
+	{
+		EXPECT_TRUE(Panel->GetRenderCache()->IsDirty());
+	}
+
+	RedrawDirtyCaches();
+
+	for (FWidgetLayoutTestLeaf* Panel : CachedPanels)
+	{
+		EXPECT_FALSE(Panel->GetRenderCache()->IsDirty());
+	}
+
+	// Nested leaf changes size, panels containing its pixels are drawn again
+	Leaf->SetWidgetSize(FVector2D<int32>(24, 8));
+	Root.UpdateWidgetsLayout(LayoutStats);
+
+	EXPECT_TRUE(OuterPanel->GetRenderCache()->IsDirty());
+	EXPECT_TRUE(InnerPanel->GetRenderCache()->IsDirty());
+	EXPECT_FALSE(SiblingPanel->GetRenderCache()->IsDirty());
+
+	RedrawDirtyCaches();
+
+	EXPECT_EQ(OuterPanel->GetRenderCache()->GetNumberOfRedraws(), 2);
+	EXPECT_EQ(InnerPanel->GetRenderCache()->GetNumberOfRedraws(), 2);
+	EXPECT_EQ(SiblingPanel->GetRenderCache()->GetNumberOfRedraws(), 1);
+
+	// Leaf of sibling changes look without rebuild
+	SiblingLeaf->InvalidateRenderCache();
+
+	EXPECT_FALSE(OuterPanel->GetRenderCache()->IsDirty());
+	EXPECT_FALSE(InnerPanel->GetRenderCache()->IsDirty());
+	EXPECT_TRUE(SiblingPanel->GetRenderCache()->IsDirty());
+
+	RedrawDirtyCaches();
+
+	// Content of render targets is lost, all caches are drawn again
+	OuterPanel->OnRenderTargetsReset();
+	SiblingPanel->OnRenderTargetsReset();
+
+	for (FWidgetLayoutTestLeaf* Panel : CachedPanels)
+	{
+		EXPECT_TRUE(Panel->GetRenderCache()->IsDirty());
+	}
+
+	RedrawDirtyCaches();
+
+	EXPECT_EQ(OuterPanel->GetRenderCache()->GetNumberOfRedraws(), 3);
+	EXPECT_EQ(InnerPanel->GetRenderCache()->GetNumberOfRedraws(), 3);
+	EXPECT_EQ(SiblingPanel->GetRenderCache()->GetNumberOfRedraws(), 3);
+
+	for (FWidgetLayoutTestLeaf* Panel : CachedPanels)
+	{
+		Panel->GetRenderCache()->Release();
+	}
+
+	Leaf->DestroyWidgetImmediate();
+	InnerPanel->DestroyWidgetImmediate();
+	OuterPanel->DestroyWidgetImmediate();
+	SiblingLeaf->DestroyWidgetImmediate();
+	SiblingPanel->DestroyWidgetImmediate();
+
+	SDL_DestroyRenderer(Renderer);
+	SDL_DestroySurface(ScreenSurface);
+}
+
+/** Entity manager without window, camera is set by test */
+class FEntityRenderCullingTestManager : public FEntityManager
+{
+public:
+	FEntityRenderCullingTestManager()
+		: FEntityManager(nullptr)
+		, RenderCounter(0)
+	{
+	}
+
+	~FEntityRenderCullingTestManager() override = default;
+
+	FCollisionAABB GetCameraBounds() const override { return CameraBounds; }
+
+	FCollisionAABB CameraBounds;
+
+	/** Incremented by each rendered entity, used to check render order */
+	int32 RenderCounter;
+};
+
+/** Entity with bounds set by test instead of render components */
+class FEntityRenderCullingTestEntity : public EEntity
+{
+public:
+	FEntityRenderCullingTestEntity(FEntityManager* InEntityManager)
+		: EEntity(InEntityManager)
+		, bHasBounds(true)
+		, LastRenderIndex(INDEX_NONE)
+	{
+	}
+
+	bool GetRenderBounds(FCollisionAABB& OutBounds) const override
+	{
+		OutBounds = Bounds;
+
+		return bHasBounds;
+	}
+
+	void Render() override
+	{
+		LastRenderIndex = static_cast<FEntityRenderCullingTestManager*>(GetEntityManagerOwner())->RenderCounter++;
+	}
+
+	void SetBounds(const FCollisionAABB& InBounds, const bool bInHasBounds = true)
+	{
+		Bounds = InBounds;
+		bHasBounds = bInHasBounds;
+
+		MarkRenderBoundsDirty();
+	}
+
+	FCollisionAABB Bounds;
+	bool bHasBounds;
+	int32 LastRenderIndex;
+};
+
+TEST(EntityRenderCullingTest, RendersOnlyVisibleEntities)
+{
+	const int32 NumberOfEntities = 50000;
+	const int32 NumberOfUnboundedEntities = 10;
+	const int32 NumberOfMovedEntitiesPerFrame = 500;
+	const int32 NumberOfFrames = 100;
+	const int32 AreaSize = 20000;
+
+	std::mt19937 RandomGenerator(2026);
+	std::uniform_int_distribution<int> LocationDistribution(0, AreaSize);
+	std::uniform_int_distribution<int> SizeDistribution(16, 64);
+
+	auto MakeRandomBounds = [&]()
+	{
+		const FVector2D<float> Location(static_cast<float>(LocationDistribution(RandomGenerator)), static_cast<float>(LocationDistribution(RandomGenerator)));
+		const float Size = static_cast<float>(SizeDistribution(RandomGenerator));
+
+		return FCollisionAABB(Location, FVector2D<float>(Location.X + Size, Location.Y + Size));
+	};
+
+	FEntityRenderCullingTestManager EntityManager;
+	EntityManager.CameraBounds = FCollisionAABB(FVector2D<float>(6000.f, 4000.f), FVector2D<float>(6000.f + 1280.f, 4000.f + 720.f));
+
+	CArray<FEntityRenderCullingTestEntity*> TestEntities;
+	for (int32 i = 0; i < NumberOfEntities; i++)
+	{
+		FEntityRenderCullingTestEntity* Entity = EntityManager.CreateEntity<FEntityRenderCullingTestEntity>();
+		Entity->SetBounds(MakeRandomBounds(), (i % (NumberOfEntities / NumberOfUnboundedEntities)) != 0);
+
+		TestEntities.Push(Entity);
+	}
+
+	// Rendered entities must be same as brute force check and keep creation order
+	auto RenderAndCheck = [&]()
+	{
+		for (FEntityRenderCullingTestEntity* Entity : TestEntities)
+		{
+			Entity->LastRenderIndex = INDEX_NONE;
+		}
+
+		EntityManager.RenderCounter = 0;
+		EntityManager.Render();
+
+		int32 NumberOfMismatches = 0;
+		int32 NumberOfExpected = 0;
+		int32 PreviousRenderIndex = INDEX_NONE;
+		bool bIsOrderKept = true;
+
+		for (FEntityRenderCullingTestEntity* Entity : TestEntities)
+		{
+			const bool bIsExpected = (!Entity->bHasBounds || Entity->Bounds.Overlaps(EntityManager.CameraBounds));
+			const bool bWasRendered = (Entity->LastRenderIndex != INDEX_NONE);
+
+			if (bIsExpected != bWasRendered)
+			{
+				NumberOfMismatches++;
+			}
+
+			if (bWasRendered)
+			{
+				bIsOrderKept = bIsOrderKept && (Entity->LastRenderIndex > PreviousRenderIndex);
+				PreviousRenderIndex = Entity->LastRenderIndex;
+			}
+
+			NumberOfExpected += bIsExpected ? 1 : 0;
+		}
+
+		EXPECT_EQ(NumberOfMismatches, 0);
+		EXPECT_TRUE(bIsOrderKept);
+		EXPECT_EQ(EntityManager.GetLastNumberOfRenderedEntities(), NumberOfExpected);
+
+		return NumberOfExpected;
+	};
+
+	const int32 NumberOfVisible = RenderAndCheck();
+	EXPECT_GT(NumberOfVisible, NumberOfUnboundedEntities);
+	EXPECT_LT(NumberOfVisible, NumberOfEntities / 50);
+	EXPECT_EQ(EntityManager.GetRenderCulling().GetNumberOfUnboundedEntities(), NumberOfUnboundedEntities);
+
+	// Entity moved into camera is rendered, entity moved out of it is not
+	FEntityRenderCullingTestEntity* MovedEntity = TestEntities[1];
+	MovedEntity->SetBounds(FCollisionAABB(FVector2D<float>(6100.f, 4100.f), FVector2D<float>(6132.f, 4132.f)));
+	RenderAndCheck();
+	EXPECT_NE(MovedEntity->LastRenderIndex, INDEX_NONE);
+
+	MovedEntity->SetBounds(FCollisionAABB(FVector2D<float>(100.f, 100.f), FVector2D<float>(132.f, 132.f)));
+	RenderAndCheck();
+	EXPECT_EQ(MovedEntity->LastRenderIndex, INDEX_NONE);
+
+	// Destroyed visible entity is removed from culling
+	MovedEntity->SetBounds(FCollisionAABB(FVector2D<float>(6100.f, 4100.f), FVector2D<float>(6132.f, 4132.f)));
+	EntityManager.DestroyEntity(MovedEntity);
+	EntityManager.FlushPendingDestroyEntities();
+	TestEntities.Remove(MovedEntity);
+
+	RenderAndCheck();
+	EXPECT_EQ(EntityManager.GetRenderCulling().GetNumberOfEntities(), NumberOfEntities - 1);
+
+	// Frame cost with some entities moving every frame, camera sees small part of map
+	auto RenderFrames = [&]()
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int32 Frame = 0; Frame < NumberOfFrames; Frame++)
+		{
+			for (int32 i = 0; i < NumberOfMovedEntitiesPerFrame; i++)
+			{
+				TestEntities[(Frame * NumberOfMovedEntitiesPerFrame + i) % TestEntities.Size()]->SetBounds(MakeRandomBounds());
+			}
+
+			EntityManager.Render();
+		}
+		auto end = std::chrono::high_resolution_clock::now();
+
+		return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / NumberOfFrames;
+	};
+
+	const int64 CulledFrameDuration = RenderFrames();
+	const int32 CulledRenderedEntities = EntityManager.GetLastNumberOfRenderedEntities();
+
+	// Camera covering whole map renders every entity, like before culling
+	EntityManager.CameraBounds = FCollisionAABB(FVector2D<float>(0.f, 0.f), FVector2D<float>(static_cast<float>(AreaSize) + 64.f, static_cast<float>(AreaSize) + 64.f));
+
+	const int64 AllFrameDuration = RenderFrames();
+	const int32 AllRenderedEntities = EntityManager.GetLastNumberOfRenderedEntities();
+
+	EXPECT_EQ(AllRenderedEntities, TestEntities.Size());
+	RenderAndCheck();
+
+	std::cout << TestEntities.Size() << " entities, " << NumberOfMovedEntitiesPerFrame << " moved per frame: camera frame " << CulledFrameDuration << "us ("
+		<< CulledRenderedEntities << " rendered), whole map frame " << AllFrameDuration << "us (" << AllRenderedEntities << " rendered)" << std::endl;
+}